@@ -0,0 +1,720 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xaxidma_example_sg_batch.c
+ *
+ * This file compares the packet rate of the AXI DMA core in Scatter Gather
+ * mode when BDs are committed and reaped one packet at a time with
+ * XAxiDma_BdRingToHw()/XAxiDma_BdRingFromHw(), and when they are batched
+ * with XAxiDma_BdRingToHwDeferred()/XAxiDma_BdRingCommit() and
+ * XAxiDma_BdRingFromHwBatch().
+ *
+ * In batched mode up to BATCH_PKTS packets are staged and handed to the
+ * hardware with one BD cache flush and one tail pointer write, and completed
+ * BDs are reaped with one cache invalidation per XAXIDMA_BD_PREFETCH_CNT BDs,
+ * at most REAP_BUDGET BDs per call.
+ *
+ * This code assumes a loopback hardware widget is connected to the AXI DMA
+ * core for data packet loopback. Small packets of PKT_LEN bytes are used so
+ * that the BD processing dominates the run time.
+ *
+ * The packet rate is measured with the global timer on ARM processors. On
+ * other processors the packets are still checked but no rate is reported.
+ *
+ * Make sure that MEMORY_BASE is defined properly as per the HW system.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 9.5   ag   10/18/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+/***************************** Include Files *********************************/
+#include "xaxidma.h"
+#include "xparameters.h"
+#include "xdebug.h"
+#if defined (__arm__) || defined (__aarch64__)
+#include "xtime_l.h"
+#endif
+
+#ifdef __aarch64__
+#include "xil_mmu.h"
+#endif
+
+#if (!defined(DEBUG))
+extern void xil_printf(const char *format, ...);
+#endif
+
+/******************** Constant Definitions **********************************/
+
+/*
+ * Device hardware build related constants.
+ */
+
+#define DMA_DEV_ID		XPAR_AXIDMA_0_DEVICE_ID
+
+#ifdef XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_BASE_ADDR	XPAR_MIG7SERIES_0_BASEADDR
+#elif XPAR_MIG_0_BASEADDR
+#define DDR_BASE_ADDR	XPAR_MIG_0_BASEADDR
+#elif XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_PSU_DDR_0_S_AXI_BASEADDR
+#endif
+
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define MEM_BASE_ADDR		0x01000000
+#else
+#define MEM_BASE_ADDR		(DDR_BASE_ADDR + 0x1000000)
+#endif
+
+#define TX_BD_SPACE_BASE	(MEM_BASE_ADDR)
+#define TX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x00000FFF)
+#define RX_BD_SPACE_BASE	(MEM_BASE_ADDR + 0x00001000)
+#define RX_BD_SPACE_HIGH	(MEM_BASE_ADDR + 0x00001FFF)
+#define TX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00100000)
+#define RX_BUFFER_BASE		(MEM_BASE_ADDR + 0x00300000)
+
+#define MARK_UNCACHEABLE        0x701
+
+#define PKT_LEN			64	/* Bytes per packet */
+#define NUM_PKTS		100000	/* Packets per run */
+#define BATCH_PKTS		16	/* Packets committed per tail write */
+#define REAP_BUDGET		32	/* BDs reaped per FromHwBatch call */
+
+#define POLL_TIMEOUT		1000000	/* Polls without progress */
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*
+ * Index of a BD in its ring, used to find the buffer attached to it.
+ */
+#define BD_INDEX(RingPtr, BdPtr) \
+	(((UINTPTR)(BdPtr) - (RingPtr)->FirstBdAddr) / (RingPtr)->Separation)
+
+/************************** Function Prototypes ******************************/
+
+static int RxSetup(XAxiDma * AxiDmaInstPtr);
+static int TxSetup(XAxiDma * AxiDmaInstPtr);
+static int SendPackets(XAxiDma_BdRing * TxRingPtr, int NumPkts, int Batch);
+static int ReapTx(XAxiDma_BdRing * TxRingPtr, int Batch);
+static int ReapRx(XAxiDma_BdRing * RxRingPtr, int Batch);
+static int RunPackets(XAxiDma * AxiDmaInstPtr, int Batch, u64 *TicksPtr);
+static int CheckData(XAxiDma * AxiDmaInstPtr);
+static void PrintRate(const char *Name, u64 Ticks);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XAxiDma AxiDma;
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function sets up the DMA engine and runs NUM_PKTS packets through the
+* loopback once with per-packet BD processing and once with batched BD
+* processing, printing the packet rate of both runs.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if test passes
+*		- XST_FAILURE if test fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	XAxiDma_Config *Config;
+	u64 SingleTicks;
+	u64 BatchTicks;
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+
+#ifdef __aarch64__
+	Xil_SetTlbAttributes(TX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+	Xil_SetTlbAttributes(RX_BD_SPACE_BASE, MARK_UNCACHEABLE);
+#endif
+
+	Config = XAxiDma_LookupConfig(DMA_DEV_ID);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", DMA_DEV_ID);
+
+		return XST_FAILURE;
+	}
+
+	/* Initialize DMA engine */
+	Status = XAxiDma_CfgInitialize(&AxiDma, Config);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	if(!XAxiDma_HasSg(&AxiDma)) {
+		xil_printf("Device configured as Simple mode \r\n");
+		return XST_FAILURE;
+	}
+
+	Status = TxSetup(&AxiDma);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = RxSetup(&AxiDma);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = RunPackets(&AxiDma, FALSE, &SingleTicks);
+	if (Status == XST_SUCCESS) {
+		Status = CheckData(&AxiDma);
+	}
+	if (Status != XST_SUCCESS) {
+		xil_printf("AXI DMA SG Batch Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = RunPackets(&AxiDma, TRUE, &BatchTicks);
+	if (Status == XST_SUCCESS) {
+		Status = CheckData(&AxiDma);
+	}
+	if (Status != XST_SUCCESS) {
+		xil_printf("AXI DMA SG Batch Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	PrintRate("per packet", SingleTicks);
+	PrintRate("batched   ", BatchTicks);
+
+	xil_printf("Successfully ran AXI DMA SG Batch Example\r\n");
+	xil_printf("--- Exiting main() --- \r\n");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up the RX channel of the DMA engine. Every BD of the ring
+* gets its own PKT_LEN byte buffer and all BDs are handed to the hardware.
+*
+* @param	AxiDmaInstPtr is the pointer to the instance of the DMA engine.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int RxSetup(XAxiDma * AxiDmaInstPtr)
+{
+	XAxiDma_BdRing *RxRingPtr;
+	int Status;
+	XAxiDma_Bd BdTemplate;
+	XAxiDma_Bd *BdPtr;
+	XAxiDma_Bd *BdCurPtr;
+	u32 BdCount;
+	u32 FreeBdCount;
+	UINTPTR RxBufferPtr;
+	u32 Index;
+
+	RxRingPtr = XAxiDma_GetRxRing(AxiDmaInstPtr);
+
+	/* Disable all RX interrupts before RxBD space setup */
+	XAxiDma_BdRingIntDisable(RxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	/* Setup Rx BD space */
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+				RX_BD_SPACE_HIGH - RX_BD_SPACE_BASE + 1);
+
+	Status = XAxiDma_BdRingCreate(RxRingPtr, RX_BD_SPACE_BASE,
+				RX_BD_SPACE_BASE,
+				XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX create BD ring failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(RxRingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX clone BD failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Attach buffers to RxBD ring so we are ready to receive packets */
+	FreeBdCount = XAxiDma_BdRingGetFreeCnt(RxRingPtr);
+	Status = XAxiDma_BdRingAlloc(RxRingPtr, FreeBdCount, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX alloc BD failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	BdCurPtr = BdPtr;
+	RxBufferPtr = RX_BUFFER_BASE;
+	for (Index = 0; Index < FreeBdCount; Index++) {
+		Status = XAxiDma_BdSetBufAddr(BdCurPtr, RxBufferPtr);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Set buffer addr %x on BD %x failed %d\r\n",
+			    (unsigned int)RxBufferPtr,
+			    (UINTPTR)BdCurPtr, Status);
+			return XST_FAILURE;
+		}
+
+		Status = XAxiDma_BdSetLength(BdCurPtr, PKT_LEN,
+				RxRingPtr->MaxTransferLen);
+		if (Status != XST_SUCCESS) {
+			xil_printf("Rx set length %d on BD %x failed %d\r\n",
+			    PKT_LEN, (UINTPTR)BdCurPtr, Status);
+			return XST_FAILURE;
+		}
+
+		XAxiDma_BdSetCtrl(BdCurPtr, 0);
+		XAxiDma_BdSetId(BdCurPtr, RxBufferPtr);
+
+		RxBufferPtr += PKT_LEN;
+		BdCurPtr = (XAxiDma_Bd *)XAxiDma_BdRingNext(RxRingPtr, BdCurPtr);
+	}
+
+	Status = XAxiDma_BdRingToHw(RxRingPtr, FreeBdCount, BdPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX submit hw failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Start RX DMA channel */
+	Status = XAxiDma_BdRingStart(RxRingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("RX start hw failed %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets up the TX channel of the DMA engine. The transmit buffer
+* of every BD is filled with a pattern derived from the BD index.
+*
+* @param	AxiDmaInstPtr is the instance pointer to the DMA engine.
+*
+* @return	XST_SUCCESS if the setup is successful, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int TxSetup(XAxiDma * AxiDmaInstPtr)
+{
+	XAxiDma_BdRing *TxRingPtr;
+	XAxiDma_Bd BdTemplate;
+	int Status;
+	u32 BdCount;
+	u8 *TxPacket = (u8 *)TX_BUFFER_BASE;
+	u32 Index;
+
+	TxRingPtr = XAxiDma_GetTxRing(AxiDmaInstPtr);
+
+	/* Disable all TX interrupts before TxBD space setup */
+	XAxiDma_BdRingIntDisable(TxRingPtr, XAXIDMA_IRQ_ALL_MASK);
+
+	/* Setup TxBD space  */
+	BdCount = XAxiDma_BdRingCntCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+				TX_BD_SPACE_HIGH - TX_BD_SPACE_BASE + 1);
+
+	Status = XAxiDma_BdRingCreate(TxRingPtr, TX_BD_SPACE_BASE,
+				TX_BD_SPACE_BASE,
+				XAXIDMA_BD_MINIMUM_ALIGNMENT, BdCount);
+	if (Status != XST_SUCCESS) {
+		xil_printf("failed create BD ring in txsetup\r\n");
+		return XST_FAILURE;
+	}
+
+	XAxiDma_BdClear(&BdTemplate);
+	Status = XAxiDma_BdRingClone(TxRingPtr, &BdTemplate);
+	if (Status != XST_SUCCESS) {
+		xil_printf("failed bdring clone in txsetup %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* One packet buffer per BD, flushed once as it never changes */
+	for (Index = 0; Index < BdCount * PKT_LEN; Index++) {
+		TxPacket[Index] = (u8)((Index / PKT_LEN) + Index);
+	}
+	Xil_DCacheFlushRange((UINTPTR)TxPacket, BdCount * PKT_LEN);
+
+	/* Start the TX channel */
+	Status = XAxiDma_BdRingStart(TxRingPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("failed start bdring txsetup %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues NumPkts single-BD packets on the TX channel. Without
+* batching every packet is committed with its own XAxiDma_BdRingToHw() call.
+* With batching the packets are staged and committed with one
+* XAxiDma_BdRingCommit() call.
+*
+* @param	TxRingPtr is the TX BD ring.
+* @param	NumPkts is the number of packets to queue.
+* @param	Batch selects batched BD processing.
+*
+* @return	- XST_SUCCESS if the packets were queued,
+*		- XST_FAILURE otherwise.
+*
+* @note     None.
+*
+******************************************************************************/
+static int SendPackets(XAxiDma_BdRing * TxRingPtr, int NumPkts, int Batch)
+{
+	XAxiDma_Bd *BdPtr;
+	UINTPTR BufAddr;
+	int Status;
+	int Index;
+
+	for (Index = 0; Index < NumPkts; Index++) {
+		Status = XAxiDma_BdRingAlloc(TxRingPtr, 1, &BdPtr);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		BufAddr = TX_BUFFER_BASE + (BD_INDEX(TxRingPtr, BdPtr) * PKT_LEN);
+		XAxiDma_BdSetBufAddr(BdPtr, BufAddr);
+		XAxiDma_BdSetLength(BdPtr, PKT_LEN, TxRingPtr->MaxTransferLen);
+		XAxiDma_BdSetCtrl(BdPtr, XAXIDMA_BD_CTRL_TXEOF_MASK |
+					XAXIDMA_BD_CTRL_TXSOF_MASK);
+		XAxiDma_BdSetId(BdPtr, BufAddr);
+
+		if (Batch) {
+			Status = XAxiDma_BdRingToHwDeferred(TxRingPtr, 1, BdPtr);
+		} else {
+			Status = XAxiDma_BdRingToHw(TxRingPtr, 1, BdPtr);
+		}
+		if (Status != XST_SUCCESS) {
+			xil_printf("to hw failed %d\r\n", Status);
+			return XST_FAILURE;
+		}
+	}
+
+	if (Batch) {
+		return XAxiDma_BdRingCommit(TxRingPtr);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the TX BDs completed by the hardware.
+*
+* @param	TxRingPtr is the TX BD ring.
+* @param	Batch selects batched BD processing.
+*
+* @return	Number of BDs freed, or -1 if the BDs could not be freed.
+*
+* @note     None.
+*
+******************************************************************************/
+static int ReapTx(XAxiDma_BdRing * TxRingPtr, int Batch)
+{
+	XAxiDma_Bd *BdPtr;
+	int BdCount;
+
+	if (Batch) {
+		BdCount = XAxiDma_BdRingFromHwBatch(TxRingPtr, REAP_BUDGET,
+						    &BdPtr);
+	} else {
+		BdCount = XAxiDma_BdRingFromHw(TxRingPtr, XAXIDMA_ALL_BDS,
+					       &BdPtr);
+	}
+
+	if (BdCount > 0) {
+		if (XAxiDma_BdRingFree(TxRingPtr, BdCount, BdPtr) !=
+				XST_SUCCESS) {
+			return -1;
+		}
+	}
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees the RX BDs completed by the hardware and hands them
+* back to the hardware for the next packets.
+*
+* @param	RxRingPtr is the RX BD ring.
+* @param	Batch selects batched BD processing.
+*
+* @return	Number of packets received, or -1 on error.
+*
+* @note     None.
+*
+******************************************************************************/
+static int ReapRx(XAxiDma_BdRing * RxRingPtr, int Batch)
+{
+	XAxiDma_Bd *BdPtr;
+	int BdCount;
+	int Status;
+
+	if (Batch) {
+		BdCount = XAxiDma_BdRingFromHwBatch(RxRingPtr, REAP_BUDGET,
+						    &BdPtr);
+	} else {
+		BdCount = XAxiDma_BdRingFromHw(RxRingPtr, XAXIDMA_ALL_BDS,
+					       &BdPtr);
+	}
+
+	if (BdCount <= 0) {
+		return BdCount;
+	}
+
+	Status = XAxiDma_BdRingFree(RxRingPtr, BdCount, BdPtr);
+	if (Status != XST_SUCCESS) {
+		return -1;
+	}
+
+	/* The BDs keep their buffer and length, re-arm them as they are */
+	Status = XAxiDma_BdRingAlloc(RxRingPtr, BdCount, &BdPtr);
+	if (Status != XST_SUCCESS) {
+		return -1;
+	}
+
+	if (Batch) {
+		Status = XAxiDma_BdRingToHwDeferred(RxRingPtr, BdCount, BdPtr);
+		if (Status == XST_SUCCESS) {
+			Status = XAxiDma_BdRingCommit(RxRingPtr);
+		}
+	} else {
+		Status = XAxiDma_BdRingToHw(RxRingPtr, BdCount, BdPtr);
+	}
+	if (Status != XST_SUCCESS) {
+		return -1;
+	}
+
+	return BdCount;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs NUM_PKTS packets through the loopback, keeping the TX
+* ring as full as possible, and measures the elapsed time.
+*
+* @param	AxiDmaInstPtr is the instance pointer to the DMA engine.
+* @param	Batch selects batched BD processing.
+* @param	TicksPtr returns the elapsed global timer counts, 0 if no
+*		timer is available.
+*
+* @return	- XST_SUCCESS if all packets were received,
+*		- XST_FAILURE otherwise.
+*
+* @note     None.
+*
+******************************************************************************/
+static int RunPackets(XAxiDma * AxiDmaInstPtr, int Batch, u64 *TicksPtr)
+{
+	XAxiDma_BdRing *TxRingPtr = XAxiDma_GetTxRing(AxiDmaInstPtr);
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(AxiDmaInstPtr);
+	int Sent = 0;
+	int Received = 0;
+	int ToSend;
+	int Reaped;
+	u32 Idle = 0;
+#if defined (__arm__) || defined (__aarch64__)
+	XTime Start;
+	XTime End;
+
+	XTime_GetTime(&Start);
+#endif
+
+	while (Received < NUM_PKTS) {
+		ToSend = XAxiDma_BdRingGetFreeCnt(TxRingPtr);
+		if (ToSend > (NUM_PKTS - Sent)) {
+			ToSend = NUM_PKTS - Sent;
+		}
+		if (ToSend > BATCH_PKTS) {
+			ToSend = BATCH_PKTS;
+		}
+
+		if (ToSend > 0) {
+			if (SendPackets(TxRingPtr, ToSend, Batch) !=
+					XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+			Sent += ToSend;
+		}
+
+		if (ReapTx(TxRingPtr, Batch) < 0) {
+			xil_printf("Failed to free tx BDs\r\n");
+			return XST_FAILURE;
+		}
+
+		Reaped = ReapRx(RxRingPtr, Batch);
+		if (Reaped < 0) {
+			xil_printf("Failed to recycle rx BDs\r\n");
+			return XST_FAILURE;
+		}
+		Received += Reaped;
+
+		if ((ToSend == 0) && (Reaped == 0)) {
+			if (++Idle == POLL_TIMEOUT) {
+				xil_printf("Timed out after %d packets\r\n",
+					   Received);
+				return XST_FAILURE;
+			}
+		} else {
+			Idle = 0;
+		}
+	}
+
+	/* Drain the last TX completions */
+	while (TxRingPtr->HwCnt > 0) {
+		if (ReapTx(TxRingPtr, Batch) < 0) {
+			return XST_FAILURE;
+		}
+	}
+
+#if defined (__arm__) || defined (__aarch64__)
+	XTime_GetTime(&End);
+	*TicksPtr = End - Start;
+#else
+	*TicksPtr = 0;
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function checks the receive buffers after a run. The RX and TX rings
+* have the same number of BDs and advance in lock step, so the buffer of each
+* RX BD holds the last packet sent from the TX BD with the same index.
+*
+* @param	AxiDmaInstPtr is the instance pointer to the DMA engine.
+*
+* @return	- XST_SUCCESS if validation is successful
+*		- XST_FAILURE if validation is failure.
+*
+* @note		None.
+*
+******************************************************************************/
+static int CheckData(XAxiDma * AxiDmaInstPtr)
+{
+	XAxiDma_BdRing *RxRingPtr = XAxiDma_GetRxRing(AxiDmaInstPtr);
+	u8 *RxPacket = (u8 *)RX_BUFFER_BASE;
+	u8 *TxPacket = (u8 *)TX_BUFFER_BASE;
+	u32 Bytes = XAxiDma_BdRingGetCnt(RxRingPtr) * PKT_LEN;
+	u32 Index;
+
+	if (NUM_PKTS < XAxiDma_BdRingGetCnt(RxRingPtr)) {
+		Bytes = NUM_PKTS * PKT_LEN;
+	}
+
+#ifndef __aarch64__
+	Xil_DCacheInvalidateRange((UINTPTR)RxPacket, Bytes);
+#endif
+
+	for (Index = 0; Index < Bytes; Index++) {
+		if (RxPacket[Index] != TxPacket[Index]) {
+			xil_printf("Data error %d: %x/%x\r\n",
+			    Index, (unsigned int)RxPacket[Index],
+			    (unsigned int)TxPacket[Index]);
+			return XST_FAILURE;
+		}
+	}
+
+	/* Clear the buffers so that the next run is checked as well */
+	for (Index = 0; Index < Bytes; Index++) {
+		RxPacket[Index] = 0;
+	}
+	Xil_DCacheFlushRange((UINTPTR)RxPacket, Bytes);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function prints the packet rate of a run.
+*
+* @param	Name is the name of the run.
+* @param	Ticks is the elapsed global timer counts of the run.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+static void PrintRate(const char *Name, u64 Ticks)
+{
+#if defined (__arm__) || defined (__aarch64__)
+	u64 Rate = 0;
+
+	if (Ticks != 0) {
+		Rate = ((u64)NUM_PKTS * COUNTS_PER_SECOND) / Ticks;
+	}
+
+	xil_printf("%s: %d packets of %d bytes, %d packets/s\r\n", Name,
+		   NUM_PKTS, PKT_LEN, (u32)Rate);
+#else
+	(void)Ticks;
+	xil_printf("%s: %d packets of %d bytes, no timer\r\n", Name,
+		   NUM_PKTS, PKT_LEN);
+#endif
+}
@@ -202,6 +202,17 @@
 *   and no new packets to process. Note that the interrupt will only fire if
 *   at least one packet has been processed.
 *
+* The driver can also tune both values online. XAxiDma_BdRingAdaptInit()
+* sets the bounds: the coalesce counter range, the longest time a completed
+* packet may wait for its interrupt, and the packet rate from which the
+* channel is polled instead of interrupting. XAxiDma_BdRingAdaptUpdate(),
+* called periodically with the elapsed time, measures the packet rate of the
+* channel and sets the counter to the number of packets expected within the
+* latency bound, and the delay timer to the latency bound. Above the polling
+* rate the completion interrupts are disabled until the rate falls below half
+* of it; XAxiDma_BdRingAdaptIsPolled() tells the application which mode is in
+* use. XAxiDma_BdRingAdaptGetStats() returns the current settings and rates.
+*
 * <b> Interrupt </b>
 *
 * Interrupts are handled by the user application. Each DMA channel has its own
@@ -469,6 +480,7 @@
 * 9.4  adk   25/07/17 Added example for cyclic dma mode CR#974218.
 *      adk   08/08/17 Fixed CR#980607 Can't select individual AXI DMA code examples.
 *		      Fixed compilation warning in the driver
+* 9.5   ag   10/18/26 Added adaptive interrupt coalescing in xaxidma_adapt.c.
 * </pre>
 *
 ******************************************************************************/
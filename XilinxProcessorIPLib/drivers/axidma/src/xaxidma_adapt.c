@@ -0,0 +1,352 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxidma_adapt.c
+* @addtogroup axidma_v9_4
+* @{
+*
+* This file implements the adaptive interrupt coalescing of a DMA channel.
+*
+* A static coalesce counter either interrupts too often at high packet rates
+* or delays completions at low packet rates. The functions in this file
+* retune the counter and the delay timer of a channel from its measured
+* packet rate:
+*
+* - The packet rate is counted by XAxiDma_BdRingFromHw() and
+*   XAxiDma_BdRingFromHwBatch(), and smoothed by XAxiDma_BdRingAdaptUpdate()
+*   which the application calls periodically, for example from a timer tick,
+*   with the time elapsed since the previous call.
+*
+* - The coalesce counter is set to the number of packets expected within the
+*   latency bound, clamped to the configured range, so that an interrupt is
+*   raised at most once per latency bound at a steady rate.
+*
+* - The delay timer is set to the latency bound so that the last packets of
+*   a burst do not wait for the counter to fill.
+*
+* - When the rate reaches the polling rate, the completion interrupts are
+*   disabled and the application polls the channel, until the rate falls
+*   below half of the polling rate.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 9.5   ag   10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxidma_bdring.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Completion interrupts turned off in polled mode
+ */
+#define XAXIDMA_ADAPT_IRQ_MASK	(XAXIDMA_IRQ_IOC_MASK | XAXIDMA_IRQ_DELAY_MASK)
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static u32 XAxiDma_AdaptTimer(XAxiDma_AdaptCfg *CfgPtr, u32 Counter);
+
+/************************** Variable Definitions *****************************/
+
+
+/*****************************************************************************/
+/**
+ * Start the adaptive interrupt coalescing of a channel. The channel starts in
+ * interrupt mode with the smallest coalesce counter and its statistics are
+ * cleared.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	CfgPtr points to the bounds of the tuning. It is copied.
+ *
+ * @return
+ *		- XST_SUCCESS if the tuning is started.
+ *		- XST_INVALID_PARAM if the counter range or the delay timer
+ *		unit is invalid.
+ *		- XST_FAILURE if the coalescing could not be set.
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingAdaptInit(XAxiDma_BdRing * RingPtr,
+			    XAxiDma_AdaptCfg *CfgPtr)
+{
+	XAxiDma_Adapt *AdaptPtr;
+	u32 Timer;
+	int Status;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+
+	if ((CfgPtr->MinCounter == 0) ||
+	    (CfgPtr->MinCounter > CfgPtr->MaxCounter) ||
+	    (CfgPtr->MaxCounter > XAXIDMA_ADAPT_MAX_COUNTER) ||
+	    (CfgPtr->TimerUnitNs == 0)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingAdaptInit: "
+			"invalid bounds\r\n");
+
+		return XST_INVALID_PARAM;
+	}
+
+	AdaptPtr = &RingPtr->Adapt;
+
+	/* Give back the completion interrupts if a previous run polled */
+	XAxiDma_BdRingAdaptDisable(RingPtr);
+
+	Timer = XAxiDma_AdaptTimer(CfgPtr, CfgPtr->MinCounter);
+	Status = XAxiDma_BdRingSetCoalesce(RingPtr, CfgPtr->MinCounter, Timer);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	AdaptPtr->Cfg = *CfgPtr;
+	memset(&AdaptPtr->Stats, 0, sizeof(XAxiDma_AdaptStats));
+	AdaptPtr->Stats.Counter = CfgPtr->MinCounter;
+	AdaptPtr->Stats.Timer = Timer;
+	AdaptPtr->Packets = 0;
+	AdaptPtr->Interrupts = 0;
+	AdaptPtr->Enabled = TRUE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Close a sample of the adaptive interrupt coalescing of a channel and retune
+ * the channel from it.
+ *
+ * The packets completed since the previous call give the packet rate of the
+ * sample, which is smoothed into the rate of the channel. From the smoothed
+ * rate the channel is switched between interrupt and polled mode, and in
+ * interrupt mode the coalesce counter and the delay timer are set. The
+ * control register is only written when a setting changes.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	ElapsedUs is the time in microseconds since the previous call,
+ *		or since XAxiDma_BdRingAdaptInit().
+ *
+ * @return
+ *		- XST_SUCCESS if the sample was taken.
+ *		- XST_FAILURE if the tuning is not started or the coalescing
+ *		could not be set.
+ *
+ * @note	The interval between calls should be a few times the latency
+ *		bound so that each sample covers several interrupts.
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingAdaptUpdate(XAxiDma_BdRing * RingPtr, u32 ElapsedUs)
+{
+	XAxiDma_Adapt *AdaptPtr;
+	XAxiDma_AdaptStats *StatsPtr;
+	XAxiDma_AdaptCfg *CfgPtr;
+	u32 Sample;
+	u32 Counter;
+	u32 Timer;
+	u64 Expected;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	AdaptPtr = &RingPtr->Adapt;
+	StatsPtr = &AdaptPtr->Stats;
+	CfgPtr = &AdaptPtr->Cfg;
+
+	if (!AdaptPtr->Enabled) {
+		return XST_FAILURE;
+	}
+
+	if (ElapsedUs == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Packets per millisecond in this sample, smoothed into the rate */
+	Sample = (u32)(((u64)AdaptPtr->Packets * 1000U) / ElapsedUs);
+	StatsPtr->Rate = (u32)((((u64)StatsPtr->Rate *
+			(XAXIDMA_ADAPT_WEIGHT - 1)) + Sample) /
+			XAXIDMA_ADAPT_WEIGHT);
+	if (StatsPtr->Rate > StatsPtr->PeakRate) {
+		StatsPtr->PeakRate = StatsPtr->Rate;
+	}
+
+	StatsPtr->Packets += AdaptPtr->Packets;
+	StatsPtr->Interrupts += AdaptPtr->Interrupts;
+	AdaptPtr->Packets = 0;
+	AdaptPtr->Interrupts = 0;
+
+	/* Switch between interrupt and polled mode with hysteresis */
+	if (CfgPtr->PollRate != 0) {
+		if (!StatsPtr->Polled && (StatsPtr->Rate >= CfgPtr->PollRate)) {
+			XAxiDma_BdRingIntDisable(RingPtr,
+						 XAXIDMA_ADAPT_IRQ_MASK);
+			StatsPtr->Polled = TRUE;
+			StatsPtr->ModeSwitches++;
+		}
+		else if (StatsPtr->Polled &&
+			 (StatsPtr->Rate < (CfgPtr->PollRate / 2))) {
+			XAxiDma_BdRingIntEnable(RingPtr,
+						XAXIDMA_ADAPT_IRQ_MASK);
+			StatsPtr->Polled = FALSE;
+			StatsPtr->ModeSwitches++;
+		}
+	}
+
+	if (StatsPtr->Polled) {
+		return XST_SUCCESS;
+	}
+
+	/* Packets expected within the latency bound */
+	Expected = ((u64)StatsPtr->Rate * CfgPtr->MaxLatencyUs) / 1000U;
+	if (Expected < CfgPtr->MinCounter) {
+		Counter = CfgPtr->MinCounter;
+	}
+	else if (Expected > CfgPtr->MaxCounter) {
+		Counter = CfgPtr->MaxCounter;
+	}
+	else {
+		Counter = (u32)Expected;
+	}
+
+	Timer = XAxiDma_AdaptTimer(CfgPtr, Counter);
+
+	if ((Counter != StatsPtr->Counter) || (Timer != StatsPtr->Timer)) {
+		if (XAxiDma_BdRingSetCoalesce(RingPtr, Counter, Timer) !=
+				XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		StatsPtr->Counter = Counter;
+		StatsPtr->Timer = Timer;
+		StatsPtr->Retunes++;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Stop the adaptive interrupt coalescing of a channel. A polled channel gets
+ * its completion interrupts back. The coalescing last set is kept.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+void XAxiDma_BdRingAdaptDisable(XAxiDma_BdRing * RingPtr)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+
+	if (RingPtr->Adapt.Enabled && RingPtr->Adapt.Stats.Polled) {
+		XAxiDma_BdRingIntEnable(RingPtr, XAXIDMA_ADAPT_IRQ_MASK);
+		RingPtr->Adapt.Stats.Polled = FALSE;
+	}
+
+	RingPtr->Adapt.Enabled = FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * Retrieve the current settings and statistics of the adaptive interrupt
+ * coalescing of a channel. The packets and interrupts of the sample in
+ * progress are not included.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	StatsPtr points to a memory location where the settings and
+ *		statistics are written.
+ *
+ * @return	None
+ *
+ * @note	This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+void XAxiDma_BdRingAdaptGetStats(XAxiDma_BdRing * RingPtr,
+				 XAxiDma_AdaptStats *StatsPtr)
+{
+	Xil_AssertVoid(RingPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = RingPtr->Adapt.Stats;
+}
+
+/*****************************************************************************/
+/**
+ * Compute the delay timer for a coalesce counter. With a counter of one every
+ * packet interrupts and the timer is not needed; otherwise the timer is the
+ * latency bound in delay timer counts.
+ *
+ * @param	CfgPtr points to the bounds of the tuning.
+ * @param	Counter is the coalesce counter the timer is used with.
+ *
+ * @return	Delay timer value, 0 to XAXIDMA_ADAPT_MAX_TIMER.
+ *
+ * @note	None
+ *
+ *****************************************************************************/
+static u32 XAxiDma_AdaptTimer(XAxiDma_AdaptCfg *CfgPtr, u32 Counter)
+{
+	u64 Timer;
+
+	if (Counter <= 1) {
+		return 0;
+	}
+
+	Timer = ((u64)CfgPtr->MaxLatencyUs * 1000U) / CfgPtr->TimerUnitNs;
+	if (Timer == 0) {
+		Timer = 1;
+	}
+	else if (Timer > XAXIDMA_ADAPT_MAX_TIMER) {
+		Timer = XAXIDMA_ADAPT_MAX_TIMER;
+	}
+
+	return (u32)Timer;
+}
+/** @} */
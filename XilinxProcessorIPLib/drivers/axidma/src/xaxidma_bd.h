@@ -101,6 +101,8 @@
  *			clear the field first and set it.
  * 8.0   srt  01/29/14 Added support for Micro DMA Mode.
  * 9.2   vak  15/04/16 Fixed compilation warnings in axidma driver
+ * 9.5   ag   10/18/26 Added XAXIDMA_CACHE_FLUSH_RANGE and
+ *		       XAXIDMA_CACHE_INVALIDATE_RANGE for spans of BDs.
  *
  * </pre>
  *****************************************************************************/
@@ -145,12 +147,22 @@ typedef u32 XAxiDma_Bd[XAXIDMA_BD_NUM_WORDS];
 #ifdef __aarch64__
 #define XAXIDMA_CACHE_FLUSH(BdPtr)
 #define XAXIDMA_CACHE_INVALIDATE(BdPtr)
+#define XAXIDMA_CACHE_FLUSH_RANGE(Addr, Bytes) \
+	((void)(Addr), (void)(Bytes))
+#define XAXIDMA_CACHE_INVALIDATE_RANGE(Addr, Bytes) \
+	((void)(Addr), (void)(Bytes))
 #else
 #define XAXIDMA_CACHE_FLUSH(BdPtr) \
 	Xil_DCacheFlushRange((UINTPTR)(BdPtr), XAXIDMA_BD_HW_NUM_BYTES)
 
 #define XAXIDMA_CACHE_INVALIDATE(BdPtr) \
 	Xil_DCacheInvalidateRange((UINTPTR)(BdPtr), XAXIDMA_BD_HW_NUM_BYTES)
+
+#define XAXIDMA_CACHE_FLUSH_RANGE(Addr, Bytes) \
+	Xil_DCacheFlushRange((UINTPTR)(Addr), (Bytes))
+
+#define XAXIDMA_CACHE_INVALIDATE_RANGE(Addr, Bytes) \
+	Xil_DCacheInvalidateRange((UINTPTR)(Addr), (Bytes))
 #endif
 
 /*****************************************************************************/
@@ -66,7 +66,13 @@
 *						 int RingIndex)
 * 7.00a srt  06/18/12  All the APIs changed in v6_00_a are reverted back for
 *		       backward compatibility.
-*
+* 9.5   ag   10/18/26  Added XAxiDma_BdRingToHwDeferred, XAxiDma_BdRingCommit
+*		       and XAxiDma_BdRingFromHwBatch. XAxiDma_BdRingToHw now
+*		       flushes the committed BDs with one range operation per
+*		       contiguous span and XAxiDma_BdRingFromHw shares its scan
+*		       with XAxiDma_BdRingFromHwBatch.
+*		       The BD scan counts completed packets for the adaptive
+*		       interrupt coalescing in xaxidma_adapt.c.
 *
 * </pre>
 ******************************************************************************/
@@ -166,6 +172,11 @@
 
 /************************** Function Prototypes ******************************/
 
+static void XAxiDma_BdRingCacheRange(XAxiDma_BdRing * RingPtr,
+		XAxiDma_Bd * BdPtr, int NumBd, int Flush);
+static int XAxiDma_BdRingScanHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+		XAxiDma_Bd ** BdSetPtr, int Prefetch);
+
 /************************** Variable Definitions *****************************/
 
 
@@ -363,6 +374,7 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 	RingPtr->HwCnt = 0;
 	RingPtr->PreCnt = 0;
 	RingPtr->PostCnt = 0;
+	RingPtr->StageCnt = 0;
 	RingPtr->Cyclic = 0;
 
 	/* Make sure Alignment parameter meets minimum requirements */
@@ -468,6 +480,8 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 	RingPtr->HwHead = (XAxiDma_Bd *) VirtAddr;
 	RingPtr->HwTail = (XAxiDma_Bd *) VirtAddr;
 	RingPtr->PostHead = (XAxiDma_Bd *) VirtAddr;
+	RingPtr->StageHead = (XAxiDma_Bd *) VirtAddr;
+	RingPtr->StageTail = (XAxiDma_Bd *) VirtAddr;
 	RingPtr->BdaRestart = (XAxiDma_Bd *) PhysAddr;
 	RingPtr->CyclicBd = (XAxiDma_Bd *) malloc(sizeof(XAxiDma_Bd));
 
@@ -993,6 +1007,9 @@ int XAxiDma_BdRingUnAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
  * For transmit, the set will be rejected if the last BD of the set does not
  * mark the end of a packet or the first BD does not mark the start of a packet.
  *
+ * Any BDs staged earlier with XAxiDma_BdRingToHwDeferred() are committed
+ * together with this set.
+ *
  * @param	RingPtr is a pointer to the descriptor ring instance to be
  *		worked on.
  * @param	NumBd is the number of BDs in the set.
@@ -1018,12 +1035,59 @@ int XAxiDma_BdRingUnAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
  *****************************************************************************/
 int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	XAxiDma_Bd * BdSetPtr)
+{
+	int Status;
+
+	Status = XAxiDma_BdRingToHwDeferred(RingPtr, NumBd, BdSetPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	return XAxiDma_BdRingCommit(RingPtr);
+}
+
+/*****************************************************************************/
+/**
+ * Stage a set of BDs that were previously allocated by XAxiDma_BdRingAlloc()
+ * for a later XAxiDma_BdRingCommit(). The BDs are checked and their completed
+ * bits cleared as in XAxiDma_BdRingToHw(), but neither the data cache
+ * maintenance of the BDs nor the tail pointer update are done here. This
+ * allows several packets to be queued with one cache range operation and one
+ * tail pointer write.
+ *
+ * Once this function returns the BD set must not be changed anymore. It is
+ * handed to hardware by the next XAxiDma_BdRingCommit() or
+ * XAxiDma_BdRingToHw() call.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	BdSetPtr is the first BD of the set to stage.
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was accepted and staged
+ *		- XST_INVALID_PARAM if passed in NumBd is negative
+ *		- XST_FAILURE if the set of BDs was rejected because the first
+ *		BD does not have its start-of-packet bit set, or the last BD
+ *		does not have its end-of-packet bit set, or any one of the BDs
+ *		has 0 length.
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingAlloc()
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingToHwDeferred(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd * BdSetPtr)
 {
 	XAxiDma_Bd *CurBdPtr;
 	int i;
 	u32 BdCr;
 	u32 BdSts;
-	int RingIndex = RingPtr->RingIndex;
 
 	if (NumBd < 0) {
 
@@ -1076,9 +1140,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 		BdSts &=  ~XAXIDMA_BD_STS_COMPLETE_MASK;
 		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-		/* Flush the current BD so DMA core could see the updates */
-		XAXIDMA_CACHE_FLUSH(CurBdPtr);
-
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
@@ -1107,17 +1168,57 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	BdSts &= ~XAXIDMA_BD_STS_COMPLETE_MASK;
 	XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-	/* Flush the last BD so DMA core could see the updates */
-	XAXIDMA_CACHE_FLUSH(CurBdPtr);
-	DATA_SYNC;
-
-	/* This set has completed pre-processing, adjust ring pointers and
-	 * counters
+	/* This set has completed pre-processing, move it from the pre-work
+	 * group to the staged group
 	 */
 	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
 	RingPtr->PreCnt -= NumBd;
-	RingPtr->HwTail = CurBdPtr;
-	RingPtr->HwCnt += NumBd;
+	if (RingPtr->StageCnt == 0) {
+		RingPtr->StageHead = BdSetPtr;
+	}
+	RingPtr->StageTail = CurBdPtr;
+	RingPtr->StageCnt += NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Hand all BDs staged with XAxiDma_BdRingToHwDeferred() to hardware. The
+ * staged BDs are flushed from the data cache with one range operation per
+ * contiguous span of the ring and the tail pointer is written once.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the staged BDs, if any, were enqueued to
+ *		hardware
+ *
+ * @note	This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingCommit(XAxiDma_BdRing * RingPtr)
+{
+	int RingIndex = RingPtr->RingIndex;
+
+	if (RingPtr->StageCnt == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Flush the staged BDs so DMA core could see the updates */
+	XAxiDma_BdRingCacheRange(RingPtr, RingPtr->StageHead,
+				 RingPtr->StageCnt, TRUE);
+	DATA_SYNC;
+
+	/* Move the staged BDs to the work group */
+	RingPtr->HwTail = RingPtr->StageTail;
+	RingPtr->HwCnt += RingPtr->StageCnt;
+	RingPtr->StageCnt = 0;
 
 	/* If it is running, signal the engine to begin processing */
 	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
@@ -1239,101 +1340,49 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 			     XAxiDma_Bd ** BdSetPtr)
 {
-	XAxiDma_Bd *CurBdPtr;
-	int BdCount;
-	int BdPartialCount;
-	u32 BdSts;
-	u32 BdCr;
-
-	CurBdPtr = RingPtr->HwHead;
-	BdCount = 0;
-	BdPartialCount = 0;
-	BdSts = 0;
-	BdCr = 0;
-
-	/* If no BDs in work group, then there's nothing to search */
-	if (RingPtr->HwCnt == 0) {
-		*BdSetPtr = (XAxiDma_Bd *)NULL;
-
-		return 0;
-	}
-
-	if (BdLimit > RingPtr->HwCnt) {
-		BdLimit = RingPtr->HwCnt;
-	}
-
-	/* Starting at HwHead, keep moving forward in the list until:
-	 *  - A BD is encountered with its completed bit clear in the status
-	 *    word which means hardware has not completed processing of that
-	 *    BD.
-	 *  - RingPtr->HwTail is reached
-	 *  - The number of requested BDs has been processed
-	 */
-
-	while (BdCount < BdLimit) {
-		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
-		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
-		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
-
-		/* If the hardware still hasn't processed this BD then we are
-		 * done
-		 */
-		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
-			break;
-		}
-
-		BdCount++;
-
-		/* Hardware has processed this BD so check the "last" bit. If
-		 * it is clear, then there are more BDs for the current packet.
-		 * Keep a count of these partial packet BDs.
-		 *
-		 * For tx BDs, EOF bit is in the control word
-		 * For rx BDs, EOF bit is in the status word
-		 */
-		if (((!(RingPtr->IsRxChannel) &&
-		(BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
-		((RingPtr->IsRxChannel) && (BdSts &
-			XAXIDMA_BD_STS_RXEOF_MASK)))) {
-
-			BdPartialCount = 0;
-		}
-		else {
-			BdPartialCount++;
-		}
-
-		/* Reached the end of the work group */
-		if (CurBdPtr == RingPtr->HwTail) {
-			break;
-		}
-
-		/* Move on to the next BD in work group */
-		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
-	}
-
-	/* Subtract off any partial packet BDs found */
-	BdCount -= BdPartialCount;
-
-	/* If BdCount is non-zero then BDs were found to return. Set return
-	 * parameters, update pointers and counters, return success
-	 */
-	if (BdCount) {
-		*BdSetPtr = RingPtr->HwHead;
-		if (!RingPtr->Cyclic) {
-			RingPtr->HwCnt -= BdCount;
-			RingPtr->PostCnt += BdCount;
-		}
-		XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
-
-		return BdCount;
-	}
-	else {
-		*BdSetPtr = (XAxiDma_Bd *)NULL;
+	return XAxiDma_BdRingScanHw(RingPtr, BdLimit, BdSetPtr, 1);
+}
 
-		return 0;
-	}
+/*****************************************************************************/
+/**
+ * Returns a set of BD(s) that have been processed by hardware, like
+ * XAxiDma_BdRingFromHw(), but invalidates the BDs of the work group
+ * XAXIDMA_BD_PREFETCH_CNT at a time with one cache range operation instead of
+ * one BD at a time.
+ *
+ * BdLimit also bounds the number of BDs inspected and invalidated by one call,
+ * so it can be used as a work budget when this function is called from an
+ * interrupt handler or a polling loop with other work to do. Completed BDs
+ * beyond the budget are returned by the next call.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to inspect and return. Use
+ *		XAXIDMA_ALL_BDS to return all BDs that have been processed.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ *
+ * @return	The number of BDs processed by hardware. A value of 0 indicates
+ *		that no data is available. No more than BdLimit BDs will be
+ *		returned.
+ *
+ * @note	Treat BDs returned by this function as read-only. They must be
+ *		freed with XAxiDma_BdRingFree() as for XAxiDma_BdRingFromHw().
+ *
+ * 		This function should not be preempted by another XAxiDma ring
+ *		function call that modifies the BD space. It is the caller's
+ *		responsibility to provide a mutual exclusion mechanism.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingFromHwBatch(XAxiDma_BdRing * RingPtr, int BdLimit,
+			     XAxiDma_Bd ** BdSetPtr)
+{
+	return XAxiDma_BdRingScanHw(RingPtr, BdLimit, BdSetPtr,
+				    XAXIDMA_BD_PREFETCH_CNT);
 }
+
 /*****************************************************************************/
 /**
  * Frees a set of BDs that had been previously retrieved with
@@ -1516,7 +1565,7 @@ int XAxiDma_BdRingCheck(XAxiDma_BdRing * RingPtr)
 
 	/* Verify internal counters add up */
 	if ((RingPtr->HwCnt + RingPtr->PreCnt + RingPtr->FreeCnt +
-	     RingPtr->PostCnt) != RingPtr->AllCnt) {
+	     RingPtr->PostCnt + RingPtr->StageCnt) != RingPtr->AllCnt) {
 
 		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingCheck: internal counter "
 			"error\r\n");
@@ -1605,4 +1654,181 @@ void XAxiDma_BdRingDumpRegs(XAxiDma_BdRing *RingPtr) {
 
 	xil_printf("\r\n");
 }
+
+/*****************************************************************************/
+/**
+ * Find the BDs at the head of the work group that have been processed by
+ * hardware. This is the common implementation of XAxiDma_BdRingFromHw() and
+ * XAxiDma_BdRingFromHwBatch().
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to return in the set.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ * @param	Prefetch is the number of BDs invalidated with one cache
+ *		range operation.
+ *
+ * @return	The number of BDs processed by hardware.
+ *
+ *****************************************************************************/
+static int XAxiDma_BdRingScanHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+			     XAxiDma_Bd ** BdSetPtr, int Prefetch)
+{
+	XAxiDma_Bd *CurBdPtr;
+	int BdCount;
+	int BdPartialCount;
+	int Window;
+	u32 Packets;
+	u32 BdSts;
+	u32 BdCr;
+
+	CurBdPtr = RingPtr->HwHead;
+	BdCount = 0;
+	BdPartialCount = 0;
+	Window = 0;
+	Packets = 0;
+	BdSts = 0;
+	BdCr = 0;
+
+	/* If no BDs in work group, then there's nothing to search */
+	if (RingPtr->HwCnt == 0) {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+
+	if (BdLimit > RingPtr->HwCnt) {
+		BdLimit = RingPtr->HwCnt;
+	}
+
+	/* Starting at HwHead, keep moving forward in the list until:
+	 *  - A BD is encountered with its completed bit clear in the status
+	 *    word which means hardware has not completed processing of that
+	 *    BD.
+	 *  - RingPtr->HwTail is reached
+	 *  - The number of requested BDs has been processed
+	 */
+
+	while (BdCount < BdLimit) {
+		/* Invalidate the next window of BDs from the work group */
+		if (Window == 0) {
+			Window = BdLimit - BdCount;
+			if (Window > Prefetch) {
+				Window = Prefetch;
+			}
+
+			XAxiDma_BdRingCacheRange(RingPtr, CurBdPtr, Window,
+						 FALSE);
+		}
+		Window--;
+
+		/* Read the status */
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+
+		/* If the hardware still hasn't processed this BD then we are
+		 * done
+		 */
+		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
+			break;
+		}
+
+		BdCount++;
+
+		/* Hardware has processed this BD so check the "last" bit. If
+		 * it is clear, then there are more BDs for the current packet.
+		 * Keep a count of these partial packet BDs.
+		 *
+		 * For tx BDs, EOF bit is in the control word
+		 * For rx BDs, EOF bit is in the status word
+		 */
+		if (((!(RingPtr->IsRxChannel) &&
+		(BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
+		((RingPtr->IsRxChannel) && (BdSts &
+			XAXIDMA_BD_STS_RXEOF_MASK)))) {
+
+			BdPartialCount = 0;
+			Packets++;
+		}
+		else {
+			BdPartialCount++;
+		}
+
+		/* Reached the end of the work group */
+		if (CurBdPtr == RingPtr->HwTail) {
+			break;
+		}
+
+		/* Move on to the next BD in work group */
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+	}
+
+	/* Subtract off any partial packet BDs found */
+	BdCount -= BdPartialCount;
+
+	/* If BdCount is non-zero then BDs were found to return. Set return
+	 * parameters, update pointers and counters, return success
+	 */
+	if (BdCount) {
+		RingPtr->Adapt.Packets += Packets;
+		*BdSetPtr = RingPtr->HwHead;
+		if (!RingPtr->Cyclic) {
+			RingPtr->HwCnt -= BdCount;
+			RingPtr->PostCnt += BdCount;
+		}
+		XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
+
+		return BdCount;
+	}
+	else {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Flush or invalidate the data cache lines of NumBd consecutive BDs starting
+ * at BdPtr. The span is split in two range operations where it wraps around
+ * the end of the ring.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdPtr is the first BD of the span.
+ * @param	NumBd is the number of BDs in the span, at most the number of
+ *		BDs in the ring.
+ * @param	Flush is TRUE to flush the span, FALSE to invalidate it.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingCacheRange(XAxiDma_BdRing * RingPtr,
+		XAxiDma_Bd * BdPtr, int NumBd, int Flush)
+{
+	UINTPTR Start = (UINTPTR)BdPtr;
+	UINTPTR RingEnd = RingPtr->FirstBdAddr + RingPtr->Length;
+	u32 Bytes = (u32)NumBd * (u32)RingPtr->Separation;
+	u32 FirstBytes = Bytes;
+
+	if ((Start + Bytes) > RingEnd) {
+		FirstBytes = (u32)(RingEnd - Start);
+	}
+
+	if (Flush) {
+		XAXIDMA_CACHE_FLUSH_RANGE(Start, FirstBytes);
+		if (FirstBytes < Bytes) {
+			XAXIDMA_CACHE_FLUSH_RANGE(RingPtr->FirstBdAddr,
+						  Bytes - FirstBytes);
+		}
+	}
+	else {
+		XAXIDMA_CACHE_INVALIDATE_RANGE(Start, FirstBytes);
+		if (FirstBytes < Bytes) {
+			XAXIDMA_CACHE_INVALIDATE_RANGE(RingPtr->FirstBdAddr,
+						       Bytes - FirstBytes);
+		}
+	}
+}
 /** @} */
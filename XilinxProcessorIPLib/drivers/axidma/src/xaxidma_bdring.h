@@ -68,6 +68,25 @@
 * 7.00a srt  06/18/12  All the APIs changed in v6_00_a are reverted back for
 *		       backward compatibility.
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
+* 9.5   ag   10/18/26  Added batched BD processing
+*		       - New APIs
+*			* XAxiDma_BdRingToHwDeferred(XAxiDma_BdRing * RingPtr,
+*					int NumBd, XAxiDma_Bd * BdSetPtr)
+*			* XAxiDma_BdRingCommit(XAxiDma_BdRing * RingPtr)
+*			* XAxiDma_BdRingFromHwBatch(XAxiDma_BdRing * RingPtr,
+*					int BdLimit, XAxiDma_Bd ** BdSetPtr)
+*		       - Added StageHead, StageTail and StageCnt to
+*			 XAxiDma_BdRing.
+*		       Added adaptive interrupt coalescing
+*		       - New APIs
+*			* XAxiDma_BdRingAdaptInit(XAxiDma_BdRing * RingPtr,
+*					XAxiDma_AdaptCfg * CfgPtr)
+*			* XAxiDma_BdRingAdaptUpdate(XAxiDma_BdRing * RingPtr,
+*					u32 ElapsedUs)
+*			* XAxiDma_BdRingAdaptDisable(XAxiDma_BdRing * RingPtr)
+*			* XAxiDma_BdRingAdaptGetStats(XAxiDma_BdRing * RingPtr,
+*					XAxiDma_AdaptStats * StatsPtr)
+*		       - Added Adapt to XAxiDma_BdRing.
 *
 * </pre>
 *
@@ -97,8 +116,67 @@ extern "C" {
 #define XAXIDMA_NO_CHANGE		0xFFFFFFFF
 #define XAXIDMA_ALL_BDS			0x0FFFFFFF /* 268 Million */
 
+/* Number of BDs invalidated at a time by XAxiDma_BdRingFromHwBatch()
+ */
+#ifndef XAXIDMA_BD_PREFETCH_CNT
+#define XAXIDMA_BD_PREFETCH_CNT		8
+#endif
+
+/* Largest coalesce counter and delay timer value of a channel
+ */
+#define XAXIDMA_ADAPT_MAX_COUNTER	0xFF
+#define XAXIDMA_ADAPT_MAX_TIMER		0xFF
+
+/* Weight of a new sample in the smoothed completion rate is
+ * 1/XAXIDMA_ADAPT_WEIGHT
+ */
+#ifndef XAXIDMA_ADAPT_WEIGHT
+#define XAXIDMA_ADAPT_WEIGHT		4
+#endif
+
 /**************************** Type Definitions *******************************/
 
+/** Bounds of the adaptive interrupt coalescing of a channel, see
+ *  XAxiDma_BdRingAdaptInit()
+ */
+typedef struct {
+	u32 MinCounter;		/**< Smallest coalesce counter, 1 to 255 */
+	u32 MaxCounter;		/**< Largest coalesce counter, MinCounter
+				     to 255 */
+	u32 MaxLatencyUs;	/**< Longest time in microseconds a completed
+				     packet may wait for its interrupt */
+	u32 TimerUnitNs;	/**< Duration of one delay timer count in
+				     nanoseconds (125 SG clock periods) */
+	u32 PollRate;		/**< Packets per millisecond from which the
+				     channel is polled, 0 never polls */
+} XAxiDma_AdaptCfg;
+
+/** Current settings and statistics of the adaptive interrupt coalescing
+ *  of a channel
+ */
+typedef struct {
+	u32 Counter;		/**< Coalesce counter in use */
+	u32 Timer;		/**< Delay timer in use */
+	u32 Polled;		/**< Whether completion interrupts are off
+				     and the channel is polled */
+	u32 Rate;		/**< Smoothed packets per millisecond */
+	u32 PeakRate;		/**< Highest smoothed rate seen */
+	u32 Packets;		/**< Packets completed since init */
+	u32 Interrupts;		/**< Interrupts counted since init */
+	u32 Retunes;		/**< Number of coalescing changes */
+	u32 ModeSwitches;	/**< Number of interrupt/polled switches */
+} XAxiDma_AdaptStats;
+
+/** Adaptive interrupt coalescing state of a channel
+ */
+typedef struct {
+	XAxiDma_AdaptCfg Cfg;	/**< Bounds given at init */
+	XAxiDma_AdaptStats Stats; /**< Current settings and statistics */
+	int Enabled;		/**< Whether the channel is being tuned */
+	u32 Packets;		/**< Packets completed in this sample */
+	u32 Interrupts;		/**< Interrupts counted in this sample */
+} XAxiDma_Adapt;
+
 /** Container structure for descriptor storage control. If address translation
  * is enabled, then all addresses and pointers excluding FirstBdPhysAddr are
  * expressed in terms of the virtual address.
@@ -127,6 +205,10 @@ typedef struct {
 	XAxiDma_Bd *PostHead;	/**< First BD in the post-work group */
 	XAxiDma_Bd *BdaRestart;	/**< BD to load when channel is started */
 	XAxiDma_Bd *CyclicBd;	/**< Useful for Cyclic DMA operations */
+	XAxiDma_Bd *StageHead;	/**< First BD staged but not committed */
+	XAxiDma_Bd *StageTail;	/**< Last BD staged but not committed */
+	int StageCnt;		/**< Number of BDs staged by
+				     XAxiDma_BdRingToHwDeferred() */
 	int FreeCnt;		/**< Number of allocatable BDs in free group */
 	int PreCnt;		/**< Number of BDs in pre-work group */
 	int HwCnt;		/**< Number of BDs in work group */
@@ -134,6 +216,7 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+	XAxiDma_Adapt Adapt;	/**< Adaptive interrupt coalescing state */
 } XAxiDma_BdRing;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -506,6 +589,41 @@ typedef struct {
 #define XAxiDma_BdRingEnableCyclicDMA(RingPtr)			\
 		(RingPtr->Cyclic = 1)
 
+/****************************************************************************/
+/**
+* Account a completion interrupt of the channel for the adaptive interrupt
+* coalescing. Call this from the interrupt handler of the channel.
+*
+* @param	RingPtr is the channel instance to operate on.
+*
+* @note
+*		C-style signature:
+*		void XAxiDma_BdRingAdaptIntr(XAxiDma_BdRing* RingPtr)
+*		This function is used only when system is configured as SG mode
+*
+*****************************************************************************/
+#define XAxiDma_BdRingAdaptIntr(RingPtr)			\
+		((RingPtr)->Adapt.Interrupts++)
+
+/****************************************************************************/
+/**
+* Check whether the adaptive interrupt coalescing has turned off the
+* completion interrupts of the channel. Completed BDs must then be retrieved
+* by polling XAxiDma_BdRingFromHw() or XAxiDma_BdRingFromHwBatch().
+*
+* @param	RingPtr is the channel instance to operate on.
+*
+* @return	TRUE if the channel is polled, FALSE otherwise.
+*
+* @note
+*		C-style signature:
+*		int XAxiDma_BdRingAdaptIsPolled(XAxiDma_BdRing* RingPtr)
+*		This function is used only when system is configured as SG mode
+*
+*****************************************************************************/
+#define XAxiDma_BdRingAdaptIsPolled(RingPtr)			\
+		((RingPtr)->Adapt.Stats.Polled ? TRUE : FALSE)
+
 /****************************************************************************/
 
 /************************* Function Prototypes ******************************/
@@ -526,6 +644,11 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_Bd * BdSetPtr);
 int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		XAxiDma_Bd ** BdSetPtr);
+int XAxiDma_BdRingToHwDeferred(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd * BdSetPtr);
+int XAxiDma_BdRingCommit(XAxiDma_BdRing * RingPtr);
+int XAxiDma_BdRingFromHwBatch(XAxiDma_BdRing * RingPtr, int BdLimit,
+		XAxiDma_Bd ** BdSetPtr);
 int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 		XAxiDma_Bd * BdSetPtr);
 int XAxiDma_BdRingStart(XAxiDma_BdRing * RingPtr);
@@ -533,6 +656,15 @@ int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing * RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing * RingPtr,
 		u32 *CounterPtr, u32 *TimerPtr);
 
+/* Adaptive interrupt coalescing, see xaxidma_adapt.c
+ */
+int XAxiDma_BdRingAdaptInit(XAxiDma_BdRing * RingPtr,
+		XAxiDma_AdaptCfg *CfgPtr);
+int XAxiDma_BdRingAdaptUpdate(XAxiDma_BdRing * RingPtr, u32 ElapsedUs);
+void XAxiDma_BdRingAdaptDisable(XAxiDma_BdRing * RingPtr);
+void XAxiDma_BdRingAdaptGetStats(XAxiDma_BdRing * RingPtr,
+		XAxiDma_AdaptStats *StatsPtr);
+
 /* The following functions are for debug only
  */
 int XAxiDma_BdRingCheck(XAxiDma_BdRing * RingPtr);
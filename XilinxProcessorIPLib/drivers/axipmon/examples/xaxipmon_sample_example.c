@@ -0,0 +1,367 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xaxipmon_sample_example.c
+*
+* This file contains a design example showing how to use the continuous
+* sampling service of the AXI Performance Monitor driver.
+*
+*
+* @note
+*
+* The bandwidth and latency of slot 0 are sampled every SAMPLE_INTERVAL
+* clocks of the monitor. The samples are exported as comma separated lines
+* to the UART. To stream them to a host over the network instead, pass an
+* output function which writes the line to a TCP connection, for example
+* with tcp_write() of lwIP.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.7   ag     10/19/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xaxipmon.h"
+#include "xparameters.h"
+#include "xstatus.h"
+#include "xil_exception.h"
+#include "xil_printf.h"
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+#include "xintc.h"
+#else
+#include "xscugic.h"
+#endif
+/************************** Constant Definitions ****************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#ifdef XPAR_INTC_0_DEVICE_ID
+#define INTC				XIntc
+#define INTC_HANDLER			XIntc_InterruptHandler
+#define AXIPMON_DEVICE_ID		XPAR_AXIPMON_0_DEVICE_ID
+#define INTC_DEVICE_ID			XPAR_INTC_0_DEVICE_ID
+#define INTC_AXIPMON_INTERRUPT_ID	XPAR_INTC_0_AXIPMON_0_VEC_ID
+#else
+#define INTC				XScuGic
+#define INTC_HANDLER			XScuGic_InterruptHandler
+#define AXIPMON_DEVICE_ID		XPAR_AXIPMON_0_DEVICE_ID
+#define INTC_DEVICE_ID			XPAR_SCUGIC_0_DEVICE_ID
+#define INTC_AXIPMON_INTERRUPT_ID	XPAR_XAPMPS_0_INTR
+#endif
+
+/*
+ * Clock of the monitor in Hz, used to convert counts into rates.
+ */
+#ifndef AXIPMON_CLOCK_FREQ_HZ
+#define AXIPMON_CLOCK_FREQ_HZ	100000000U
+#endif
+
+#define SAMPLE_INTERVAL		(AXIPMON_CLOCK_FREQ_HZ / 100U) /* 10 ms */
+#define SAMPLE_COUNT		200U	/* Samples to export */
+
+/**************************** Type Definitions ******************************/
+
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+int AxiPmonSampleExample(u16 AxiPmonDeviceId);
+
+static void UartOutput(void *CallBackRef, const char *Buf, u32 Len);
+
+static int AxiPmonSetupIntrSystem(INTC* IntcInstancePtr,
+				XAxiPmon_Sampler* SamplerPtr, u16 IntrId);
+
+/************************** Variable Definitions ****************************/
+
+static XAxiPmon AxiPmonInst;	/* AXI Performance Monitor driver instance */
+static XAxiPmon_Sampler Sampler;	/* Sampling service instance */
+INTC Intc;	/* The Instance of the Interrupt Controller Driver */
+
+/****************************************************************************/
+/**
+*
+* Main function that invokes the example in this file.
+*
+* @param	None.
+*
+* @return
+*		- XST_SUCCESS if the example has completed successfully.
+*		- XST_FAILURE if the example has failed.
+*
+* @note		None.
+*
+*****************************************************************************/
+int main(void)
+{
+	int Status;
+
+	xil_printf("AXI Performance Monitor Sample Example\r\n");
+
+	Status = AxiPmonSampleExample(AXIPMON_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("AXI Performance Monitor Sample Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran AXI Performance Monitor Sample "
+						"Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function samples the bandwidth and latency of slot 0 and exports the
+* samples to the UART while they are taken.
+* This function does the following tasks:
+*	- Initiate the AXI Performance Monitor device driver instance
+*	- Run self-test on the device
+*	- Setup Interrupt System with the sampler interrupt handler
+*	- Start sampling
+*	- Export samples until SAMPLE_COUNT samples are written
+*	- Stop sampling
+*
+* @param	AxiPmonDeviceId is the XPAR_<AXIPMON_instance>_DEVICE_ID value
+*		from xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if the example has completed successfully.
+*		- XST_FAILURE if the example has failed.
+*
+* @note		The application whose traffic is measured should run while
+*		the samples are exported.
+*
+******************************************************************************/
+int AxiPmonSampleExample(u16 AxiPmonDeviceId)
+{
+	int Status;
+	XAxiPmon_Config *ConfigPtr;
+	XAxiPmon_SamplerConfig SamplerConfig;
+	u32 Exported = 0U;
+
+	/*
+	 * Initialize the AxiPmon driver.
+	 */
+	ConfigPtr = XAxiPmon_LookupConfig(AxiPmonDeviceId);
+	if (ConfigPtr == NULL) {
+		return XST_FAILURE;
+	}
+	XAxiPmon_CfgInitialize(&AxiPmonInst, ConfigPtr,
+				ConfigPtr->BaseAddress);
+
+	/*
+	 * Self Test the Axi Performance Monitor device
+	 */
+	Status = XAxiPmon_SelfTest(&AxiPmonInst);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = AxiPmonSetupIntrSystem(&Intc, &Sampler,
+					INTC_AXIPMON_INTERRUPT_ID);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	SamplerConfig.SlotMask = 0x01U;
+	SamplerConfig.Metrics = XAPM_SAMPLE_BANDWIDTH | XAPM_SAMPLE_LATENCY;
+	SamplerConfig.SampleInterval = SAMPLE_INTERVAL;
+	SamplerConfig.ClockFreqHz = AXIPMON_CLOCK_FREQ_HZ;
+
+	Status = XAxiPmon_SamplerStart(&Sampler, &AxiPmonInst, &SamplerConfig);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	UartOutput(NULL, XAPM_SAMPLE_CSV_HEADER,
+			sizeof(XAPM_SAMPLE_CSV_HEADER) - 1U);
+
+	/*
+	 * Application for which Metrics has to be computed should be
+	 * running now. Samples are exported as they arrive.
+	 */
+	while (Exported < SAMPLE_COUNT) {
+		Exported += XAxiPmon_SamplerExport(&Sampler, UartOutput, NULL);
+	}
+
+	XAxiPmon_SamplerStop(&Sampler);
+
+	xil_printf("Samples dropped: %d\r\n", Sampler.Overruns);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the output function passed to XAxiPmon_SamplerExport().
+* It writes one line to the UART.
+*
+* @param	CallBackRef is not used.
+* @param	Buf is the line.
+* @param	Len is the length of the line.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void UartOutput(void *CallBackRef, const char *Buf, u32 Len)
+{
+	u32 Index;
+
+	(void)CallBackRef;
+
+	for (Index = 0U; Index < Len; Index++) {
+		outbyte(Buf[Index]);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function setups the interrupt system such that interrupts can occur
+* for the AXI Performance Monitor device, with the sampler interrupt handler
+* connected.
+*
+* @param	IntcInstancePtr is a pointer to the instance of the Interrupt
+*		controller.
+* @param	SamplerPtr is the pointer to the sampler instance.
+* @param	IntrId is the interrupt Id and is typically
+*		XPAR_<AXIPMON_instance>_INTR value from xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if the interrupt setup is successful.
+*		- XST_FAILURE if interrupt setup is not successful.
+*
+* @note		None.
+*
+******************************************************************************/
+static int AxiPmonSetupIntrSystem(INTC* IntcInstancePtr,
+				XAxiPmon_Sampler* SamplerPtr, u16 IntrId)
+{
+	int Status;
+#ifdef XPAR_INTC_0_DEVICE_ID
+	/*
+	 * Initialize the interrupt controller driver so that it's ready to
+	 * use.
+	 */
+	Status = XIntc_Initialize(IntcInstancePtr, INTC_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Connect the sampler interrupt handler, which copies the sampled
+	 * metric counters into the ring of the sampler.
+	 */
+	Status = XIntc_Connect(IntcInstancePtr, IntrId,
+		(XInterruptHandler) XAxiPmon_SamplerIntrHandler, SamplerPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Start the interrupt controller so interrupts are enabled for all
+	 * devices that cause interrupts. Specify real mode so that the Axi
+	 * Performance Monitor device can cause interrupts through the interrupt
+	 * controller.
+	 */
+	Status = XIntc_Start(IntcInstancePtr, XIN_REAL_MODE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Enable the interrupt for the AXI Performance Monitor.
+	 */
+	XIntc_Enable(IntcInstancePtr, IntrId);
+#else
+	XScuGic_Config *IntcConfig;
+	/*
+	 * Initialize the interrupt controller driver so that it is ready to
+	 * use.
+	 */
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+					IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Connect the sampler interrupt handler, which copies the sampled
+	 * metric counters into the ring of the sampler.
+	 */
+	Status = XScuGic_Connect(IntcInstancePtr, IntrId,
+		(XInterruptHandler) XAxiPmon_SamplerIntrHandler, SamplerPtr);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XScuGic_Enable(IntcInstancePtr, IntrId);
+#endif
+	/*
+	 * Initialize the exception table.
+	 */
+	Xil_ExceptionInit();
+
+	/*
+	 * Register the interrupt controller handler with the exception table.
+	 */
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+				(Xil_ExceptionHandler) INTC_HANDLER,
+					IntcInstancePtr);
+	/*
+	 * Enable exceptions.
+	 */
+	Xil_ExceptionEnable();
+
+	return XST_SUCCESS;
+}
@@ -134,6 +134,26 @@
 * is recommended that users leave asserts on during development.
 *
 *
+* <b> Continuous Sampling </b>
+*
+* The sampling service in xaxipmon_sample.c records the read and write
+* bandwidth and the average read and write latency of a set of slots over
+* time. XAxiPmon_SamplerStart() selects the metrics of each slot, makes the
+* metric counters restart at every sample interval and enables the sample
+* interval interrupt. On that interrupt, XAxiPmon_SamplerIntrHandler() copies
+* the sampled metric counters into a ring which is written only by the
+* interrupt handler and read only by the application, so neither side needs
+* a lock. The application takes samples with XAxiPmon_SamplerGet(), converts
+* them with XAxiPmon_SamplerGetRates(), or has them formatted as text lines
+* and passed to an output function with XAxiPmon_SamplerExport(). The output
+* function can write to the UART or to a network connection. When the ring
+* is full new samples are discarded and counted; the gap also shows in the
+* sample numbers.
+*
+* In Advanced mode each sampled slot uses one metric counter per metric, so
+* the number of slots that can be sampled is limited by the number of
+* counters. In Profile mode the counters of every slot are fixed.
+*
 * <b> Building the driver </b>
 *
 * The XAxiPmon driver is composed of several source files. This allows the user
@@ -261,6 +281,10 @@
 *                     generation.
 * 6.6   ms   04/18/17 Modified tcl file to add suffix U for all macro
 *                     definitions of axipmon in xparameters.h
+* 6.7   ag   10/19/26 Added the continuous sampling service in
+*                     xaxipmon_sample.c.
+*                     Fixed XAxiPmon_IntrDisable, which set the bits of the
+*                     mask in the Interrupt Enable Register.
 * </pre>
 *
 *****************************************************************************/
@@ -437,6 +461,42 @@ extern "C" {
 
 /*@}*/
 
+/** @name Sampled metrics
+ *
+ * Metrics recorded per slot by the sampling service, used as index into
+ * XAxiPmon_Sample.Counter.
+ * @{
+ */
+#define XAPM_SAMPLE_WR_BYTES		0U /**< Write Byte Count */
+#define XAPM_SAMPLE_RD_BYTES		1U /**< Read Byte Count */
+#define XAPM_SAMPLE_WR_TRANS		2U /**< Write Transaction Count */
+#define XAPM_SAMPLE_RD_TRANS		3U /**< Read Transaction Count */
+#define XAPM_SAMPLE_WR_LATENCY		4U /**< Total Write Latency */
+#define XAPM_SAMPLE_RD_LATENCY		5U /**< Total Read Latency */
+#define XAPM_SAMPLE_NUM_METRICS		6U /**< Number of sampled metrics */
+/*@}*/
+
+/** @name Sampler metric groups
+ * @{
+ */
+#define XAPM_SAMPLE_BANDWIDTH		0x01U /**< Byte counts */
+#define XAPM_SAMPLE_LATENCY		0x02U /**< Transaction counts and
+						total latencies */
+/*@}*/
+
+/**
+ * Number of samples the sampler ring holds, must be a power of two.
+ */
+#ifndef XAPM_SAMPLE_RING_LEN
+#define XAPM_SAMPLE_RING_LEN		64U
+#endif
+
+/**
+ * Column names of the lines written by XAxiPmon_SamplerExport().
+ */
+#define XAPM_SAMPLE_CSV_HEADER	\
+	"sample,slot,wr_bytes_per_s,rd_bytes_per_s,wr_latency,rd_latency\r\n"
+
 /**************************** Type Definitions *******************************/
 
 /**
@@ -478,6 +538,61 @@ typedef struct {
 	u8   Mode;		/**< APM Mode */
 } XAxiPmon;
 
+/**
+ * Counter values of one sample interval. Counters of metrics that are not
+ * sampled read as zero.
+ */
+typedef struct {
+	u32 Seq;		/**< Sample number, counts every interval */
+	u32 Counter[XAPM_MAX_AGENTS][XAPM_SAMPLE_NUM_METRICS];
+				/**< Counters per slot and XAPM_SAMPLE_* */
+} XAxiPmon_Sample;
+
+/**
+ * Rates of one slot over a sample interval.
+ */
+typedef struct {
+	u64 WrBandwidth;	/**< Written bytes per second */
+	u64 RdBandwidth;	/**< Read bytes per second */
+	u32 WrLatency;		/**< Average write latency in APM clocks */
+	u32 RdLatency;		/**< Average read latency in APM clocks */
+} XAxiPmon_SlotRates;
+
+/**
+ * Configuration of the sampling service.
+ */
+typedef struct {
+	u8  SlotMask;		/**< Slots to sample, bit n for slot n */
+	u8  Metrics;		/**< XAPM_SAMPLE_BANDWIDTH and/or
+				  *  XAPM_SAMPLE_LATENCY */
+	u32 SampleInterval;	/**< Sample interval in APM clocks */
+	u32 ClockFreqHz;	/**< APM clock frequency */
+} XAxiPmon_SamplerConfig;
+
+/**
+ * Output function of XAxiPmon_SamplerExport(). It is passed one complete
+ * text line per call.
+ */
+typedef void (*XAxiPmon_SampleOutput)(void *CallBackRef, const char *Buf,
+					u32 Len);
+
+/**
+ * Sampling service instance. Head is only written by the interrupt handler
+ * and Tail only by the reader of the samples.
+ */
+typedef struct {
+	XAxiPmon *InstancePtr;		/**< Monitor being sampled */
+	XAxiPmon_SamplerConfig Config;	/**< Sampler configuration */
+	u32 Offset[XAPM_MAX_AGENTS][XAPM_SAMPLE_NUM_METRICS];
+					/**< Sampled counter register offsets,
+					  *  0 if not sampled */
+	u32 Seq;			/**< Number of the next sample */
+	volatile u32 Head;		/**< Samples written */
+	volatile u32 Tail;		/**< Samples read */
+	volatile u32 Overruns;		/**< Samples lost to a full ring */
+	XAxiPmon_Sample Ring[XAPM_SAMPLE_RING_LEN]; /**< Sample ring */
+} XAxiPmon_Sampler;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 
@@ -561,7 +676,7 @@ typedef struct {
 #define XAxiPmon_IntrDisable(InstancePtr, Mask)				     \
 	XAxiPmon_WriteReg((InstancePtr)->Config.BaseAddress, XAPM_IE_OFFSET, \
 			XAxiPmon_ReadReg((InstancePtr)->Config.BaseAddress, \
-			XAPM_IE_OFFSET) | (Mask));
+			XAPM_IE_OFFSET) & ~(Mask));
 
 /****************************************************************************/
 /**
@@ -933,6 +1048,26 @@ u32 XAxiPmon_GetWriteIdMask(XAxiPmon *InstancePtr);
 u32 XAxiPmon_GetReadIdMask(XAxiPmon *InstancePtr);
 
 
+/**
+ * Functions in xaxipmon_sample.c
+ */
+s32 XAxiPmon_SamplerStart(XAxiPmon_Sampler *SamplerPtr, XAxiPmon *InstancePtr,
+				XAxiPmon_SamplerConfig *ConfigPtr);
+
+void XAxiPmon_SamplerStop(XAxiPmon_Sampler *SamplerPtr);
+
+void XAxiPmon_SamplerIntrHandler(void *CallBackRef);
+
+s32 XAxiPmon_SamplerGet(XAxiPmon_Sampler *SamplerPtr,
+				XAxiPmon_Sample *SamplePtr);
+
+void XAxiPmon_SamplerGetRates(XAxiPmon_Sampler *SamplerPtr,
+		const XAxiPmon_Sample *SamplePtr, u8 Slot,
+		XAxiPmon_SlotRates *RatesPtr);
+
+u32 XAxiPmon_SamplerExport(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon_SampleOutput Output, void *CallBackRef);
+
 /**
  * Functions in xaxipmon_selftest.c
  */
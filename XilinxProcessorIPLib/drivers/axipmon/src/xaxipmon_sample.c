@@ -0,0 +1,569 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxipmon_sample.c
+* @addtogroup axipmon_v6_3
+* @{
+*
+* This file contains the continuous sampling service of the XAxiPmon driver.
+* The sampled metric counters of the selected slots are copied into a ring
+* on every sample interval interrupt and can be read back, converted into
+* bandwidth and latency, or exported as text.
+*
+* See xaxipmon.h for more information.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- -----  -------- -----------------------------------------------------
+* 6.7   ag     10/19/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xaxipmon.h"
+
+/************************** Constant Definitions ****************************/
+
+/*
+ * Number of fixed metric counters of each slot in Profile mode.
+ */
+#define XAPM_PROFILE_COUNTERS_PER_SLOT	6U
+
+/*
+ * Longest line written by XAxiPmon_SamplerExport(): four 20 digit and two
+ * 10 digit numbers, separators and line end.
+ */
+#define XAPM_SAMPLE_LINE_LEN		112U
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/*
+ * Orders the ring accesses. The ring is read on the processor that takes
+ * the interrupt or on another one, so a data memory barrier is used where
+ * one exists.
+ */
+#if defined (__arm__) || defined (__aarch64__)
+#define XAxiPmon_SampleBarrier()	__asm__ __volatile__ ("dmb sy" : : : "memory")
+#else
+#define XAxiPmon_SampleBarrier()	__asm__ __volatile__ ("" : : : "memory")
+#endif
+
+/************************** Variable Definitions ****************************/
+
+/*
+ * Metric set selected for each sampled metric in Advanced mode.
+ */
+static const u8 XAxiPmon_SampleMetricSet[XAPM_SAMPLE_NUM_METRICS] = {
+	XAPM_METRIC_SET_2,	/* Write Byte Count */
+	XAPM_METRIC_SET_3,	/* Read Byte Count */
+	XAPM_METRIC_SET_0,	/* Write Transaction Count */
+	XAPM_METRIC_SET_1,	/* Read Transaction Count */
+	XAPM_METRIC_SET_6,	/* Total Write Latency */
+	XAPM_METRIC_SET_5	/* Total Read Latency */
+};
+
+/*
+ * Position of each sampled metric among the counters of a slot in Profile
+ * mode. The counters of a slot follow the order of the metric sets.
+ */
+static const u8 XAxiPmon_SampleProfileIndex[XAPM_SAMPLE_NUM_METRICS] = {
+	2U,	/* Write Byte Count */
+	3U,	/* Read Byte Count */
+	0U,	/* Write Transaction Count */
+	1U,	/* Read Transaction Count */
+	5U,	/* Total Write Latency */
+	4U	/* Total Read Latency */
+};
+
+/************************** Function Prototypes *****************************/
+
+static u32 XAxiPmon_SmcOffset(u32 CounterNum);
+static u32 XAxiPmon_SampleUtoa(char *Buf, u64 Value);
+
+/****************************************************************************/
+/**
+*
+* This function starts continuous sampling of the AXI Performance Monitor.
+* The metrics of the selected slots are assigned to metric counters, the
+* metric counters are set to restart at every sample interval and the sample
+* interval interrupt is enabled.
+*
+* @param	SamplerPtr is a pointer to the sampler instance.
+* @param	InstancePtr is a pointer to the initialized XAxiPmon instance.
+* @param	ConfigPtr is a pointer to the sampler configuration.
+*
+* @return
+*		- XST_SUCCESS if sampling is started.
+*		- XST_INVALID_PARAM if a slot does not exist, no metric is
+*		selected, or there are not enough counters for the slots in
+*		Advanced mode.
+*		- XST_NO_FEATURE if the monitor has no sampled metric
+*		counters.
+*
+* @note		XAxiPmon_SamplerIntrHandler() must be connected to the
+*		interrupt of the monitor by the application, with SamplerPtr
+*		as its callback reference.
+*
+*****************************************************************************/
+s32 XAxiPmon_SamplerStart(XAxiPmon_Sampler *SamplerPtr, XAxiPmon *InstancePtr,
+				XAxiPmon_SamplerConfig *ConfigPtr)
+{
+	u32 Counter = 0U;
+	u32 CounterNum;
+	u32 Slot;
+	u32 Metric;
+	u32 Index;
+	u32 RegValue;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(ConfigPtr != NULL);
+	Xil_AssertNonvoid(ConfigPtr->SampleInterval != 0U);
+	Xil_AssertNonvoid(ConfigPtr->ClockFreqHz != 0U);
+
+	if ((InstancePtr->Mode == XAPM_MODE_TRACE) ||
+	    ((InstancePtr->Mode == XAPM_MODE_ADVANCED) &&
+	     (InstancePtr->Config.HaveSampledCounters != 1U))) {
+		return XST_NO_FEATURE;
+	}
+	if ((ConfigPtr->SlotMask == 0U) ||
+	    ((ConfigPtr->SlotMask >> InstancePtr->Config.NumberofSlots) != 0U) ||
+	    ((ConfigPtr->Metrics &
+	      (XAPM_SAMPLE_BANDWIDTH | XAPM_SAMPLE_LATENCY)) == 0U)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Index = 0U; Index < sizeof(XAxiPmon_Sampler); Index++) {
+		((u8 *)SamplerPtr)[Index] = 0U;
+	}
+	SamplerPtr->InstancePtr = InstancePtr;
+	SamplerPtr->Config = *ConfigPtr;
+
+	/*
+	 * Assign a counter to every sampled metric of every selected slot
+	 */
+	for (Slot = 0U; Slot < XAPM_MAX_AGENTS; Slot++) {
+		if ((ConfigPtr->SlotMask & ((u32)1U << Slot)) == 0U) {
+			continue;
+		}
+		for (Metric = 0U; Metric < XAPM_SAMPLE_NUM_METRICS; Metric++) {
+			if ((Metric < XAPM_SAMPLE_WR_TRANS) ?
+			    ((ConfigPtr->Metrics & XAPM_SAMPLE_BANDWIDTH) == 0U) :
+			    ((ConfigPtr->Metrics & XAPM_SAMPLE_LATENCY) == 0U)) {
+				continue;
+			}
+
+			if (InstancePtr->Mode == XAPM_MODE_PROFILE) {
+				CounterNum = (Slot *
+					XAPM_PROFILE_COUNTERS_PER_SLOT) +
+					XAxiPmon_SampleProfileIndex[Metric];
+			}
+			else {
+				if (Counter >= InstancePtr->Config.NumberofCounters) {
+					return XST_INVALID_PARAM;
+				}
+				CounterNum = Counter;
+				(void)XAxiPmon_SetMetrics(InstancePtr, (u8)Slot,
+					XAxiPmon_SampleMetricSet[Metric],
+					(u8)CounterNum);
+			}
+			Counter++;
+
+			SamplerPtr->Offset[Slot][Metric] =
+					XAxiPmon_SmcOffset(CounterNum);
+		}
+	}
+
+	/*
+	 * Start the metric counters from zero and have them restart at
+	 * every sample interval, so each sample covers one interval.
+	 */
+	(void)XAxiPmon_ResetMetricCounter(InstancePtr);
+
+	RegValue = XAxiPmon_ReadReg(InstancePtr->Config.BaseAddress,
+					XAPM_CTL_OFFSET);
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_CTL_OFFSET,
+					RegValue | XAPM_CR_MCNTR_ENABLE_MASK);
+
+	XAxiPmon_SetSampleInterval(InstancePtr, ConfigPtr->SampleInterval);
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+					XAPM_SICR_LOAD_MASK);
+
+	XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrEnable(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrGlobalEnable(InstancePtr);
+
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+			XAPM_SICR_ENABLE_MASK | XAPM_SICR_MCNTR_RST_MASK);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function stops sampling. The sample interval counter and its
+* interrupt are disabled; samples still in the ring can be read.
+*
+* @param	SamplerPtr is a pointer to the sampler instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XAxiPmon_SamplerStop(XAxiPmon_Sampler *SamplerPtr)
+{
+	XAxiPmon *InstancePtr;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplerPtr->InstancePtr != NULL);
+
+	InstancePtr = SamplerPtr->InstancePtr;
+
+	XAxiPmon_WriteReg(InstancePtr->Config.BaseAddress, XAPM_SICR_OFFSET,
+					0U);
+	XAxiPmon_IntrDisable(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+	XAxiPmon_IntrClear(InstancePtr, XAPM_IXR_SIC_OVERFLOW_MASK);
+}
+
+/****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the sampling service. On a
+* sample interval interrupt the sampled metric counters of the selected
+* slots are appended to the ring. If the ring is full the sample is dropped
+* and counted in Overruns.
+*
+* @param	CallBackRef is a pointer to the sampler instance.
+*
+* @return	None.
+*
+* @note		The handler clears all pending interrupts of the monitor.
+*
+*****************************************************************************/
+void XAxiPmon_SamplerIntrHandler(void *CallBackRef)
+{
+	XAxiPmon_Sampler *SamplerPtr = (XAxiPmon_Sampler *)CallBackRef;
+	UINTPTR BaseAddress;
+	XAxiPmon_Sample *SamplePtr;
+	u32 IntrStatus;
+	u32 Head;
+	u32 Slot;
+	u32 Metric;
+	u32 Offset;
+
+	BaseAddress = SamplerPtr->InstancePtr->Config.BaseAddress;
+
+	IntrStatus = XAxiPmon_ReadReg(BaseAddress, XAPM_IS_OFFSET);
+	XAxiPmon_WriteReg(BaseAddress, XAPM_IS_OFFSET, IntrStatus);
+
+	if ((IntrStatus & XAPM_IXR_SIC_OVERFLOW_MASK) == 0U) {
+		return;
+	}
+
+	Head = SamplerPtr->Head;
+	if ((Head - SamplerPtr->Tail) >= XAPM_SAMPLE_RING_LEN) {
+		SamplerPtr->Overruns++;
+		SamplerPtr->Seq++;
+		return;
+	}
+
+	SamplePtr = &SamplerPtr->Ring[Head & (XAPM_SAMPLE_RING_LEN - 1U)];
+	SamplePtr->Seq = SamplerPtr->Seq++;
+
+	for (Slot = 0U; Slot < XAPM_MAX_AGENTS; Slot++) {
+		for (Metric = 0U; Metric < XAPM_SAMPLE_NUM_METRICS; Metric++) {
+			Offset = SamplerPtr->Offset[Slot][Metric];
+			SamplePtr->Counter[Slot][Metric] = (Offset != 0U) ?
+				XAxiPmon_ReadReg(BaseAddress, Offset) : 0U;
+		}
+	}
+
+	/* Publish the sample only after its contents are written */
+	XAxiPmon_SampleBarrier();
+	SamplerPtr->Head = Head + 1U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function takes the oldest sample from the ring.
+*
+* @param	SamplerPtr is a pointer to the sampler instance.
+* @param	SamplePtr is a pointer where the sample is copied to.
+*
+* @return
+*		- XST_SUCCESS if a sample is returned.
+*		- XST_NO_DATA if the ring is empty.
+*
+* @note		Samples must be read from one context only.
+*
+*****************************************************************************/
+s32 XAxiPmon_SamplerGet(XAxiPmon_Sampler *SamplerPtr,
+				XAxiPmon_Sample *SamplePtr)
+{
+	u32 Tail;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(SamplePtr != NULL);
+
+	Tail = SamplerPtr->Tail;
+	if (Tail == SamplerPtr->Head) {
+		return XST_NO_DATA;
+	}
+
+	/* Read the sample only after its publication is seen */
+	XAxiPmon_SampleBarrier();
+	*SamplePtr = SamplerPtr->Ring[Tail & (XAPM_SAMPLE_RING_LEN - 1U)];
+
+	/* Release the entry only after it has been copied */
+	XAxiPmon_SampleBarrier();
+	SamplerPtr->Tail = Tail + 1U;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* This function converts the counters of one slot of a sample into
+* bandwidth and average latency.
+*
+* @param	SamplerPtr is a pointer to the sampler instance.
+* @param	SamplePtr is a pointer to a sample from XAxiPmon_SamplerGet().
+* @param	Slot is the slot.
+* @param	RatesPtr is a pointer where the rates are returned.
+*
+* @return	None.
+*
+* @note		Metrics that are not sampled are returned as zero.
+*
+*****************************************************************************/
+void XAxiPmon_SamplerGetRates(XAxiPmon_Sampler *SamplerPtr,
+		const XAxiPmon_Sample *SamplePtr, u8 Slot,
+		XAxiPmon_SlotRates *RatesPtr)
+{
+	const u32 *Counter;
+	u64 ClockFreqHz;
+	u64 Interval;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertVoid(SamplerPtr != NULL);
+	Xil_AssertVoid(SamplePtr != NULL);
+	Xil_AssertVoid(Slot < XAPM_MAX_AGENTS);
+	Xil_AssertVoid(RatesPtr != NULL);
+
+	Counter = SamplePtr->Counter[Slot];
+	ClockFreqHz = SamplerPtr->Config.ClockFreqHz;
+	Interval = SamplerPtr->Config.SampleInterval;
+
+	RatesPtr->WrBandwidth = ((u64)Counter[XAPM_SAMPLE_WR_BYTES] *
+					ClockFreqHz) / Interval;
+	RatesPtr->RdBandwidth = ((u64)Counter[XAPM_SAMPLE_RD_BYTES] *
+					ClockFreqHz) / Interval;
+
+	RatesPtr->WrLatency = 0U;
+	if (Counter[XAPM_SAMPLE_WR_TRANS] != 0U) {
+		RatesPtr->WrLatency = Counter[XAPM_SAMPLE_WR_LATENCY] /
+					Counter[XAPM_SAMPLE_WR_TRANS];
+	}
+	RatesPtr->RdLatency = 0U;
+	if (Counter[XAPM_SAMPLE_RD_TRANS] != 0U) {
+		RatesPtr->RdLatency = Counter[XAPM_SAMPLE_RD_LATENCY] /
+					Counter[XAPM_SAMPLE_RD_TRANS];
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* This function drains the ring and writes one text line per sample and
+* selected slot through the output function. The columns are given by
+* XAPM_SAMPLE_CSV_HEADER: sample number, slot, write and read bandwidth in
+* bytes per second, and average write and read latency in APM clocks.
+*
+* @param	SamplerPtr is a pointer to the sampler instance.
+* @param	Output is the function the lines are passed to, for example
+*		one writing to the UART or to a TCP connection.
+* @param	CallBackRef is passed to Output.
+*
+* @return	The number of samples exported.
+*
+* @note		Export must not be mixed with XAxiPmon_SamplerGet() from
+*		another context.
+*
+*****************************************************************************/
+u32 XAxiPmon_SamplerExport(XAxiPmon_Sampler *SamplerPtr,
+		XAxiPmon_SampleOutput Output, void *CallBackRef)
+{
+	XAxiPmon_Sample Sample;
+	XAxiPmon_SlotRates Rates;
+	char Line[XAPM_SAMPLE_LINE_LEN];
+	u32 Count = 0U;
+	u32 Len;
+	u8 Slot;
+
+	/*
+	 * Assert the arguments.
+	 */
+	Xil_AssertNonvoid(SamplerPtr != NULL);
+	Xil_AssertNonvoid(Output != NULL);
+
+	while (XAxiPmon_SamplerGet(SamplerPtr, &Sample) == XST_SUCCESS) {
+		for (Slot = 0U; Slot < XAPM_MAX_AGENTS; Slot++) {
+			if ((SamplerPtr->Config.SlotMask &
+			     ((u32)1U << Slot)) == 0U) {
+				continue;
+			}
+
+			XAxiPmon_SamplerGetRates(SamplerPtr, &Sample, Slot,
+						&Rates);
+
+			Len = XAxiPmon_SampleUtoa(Line, Sample.Seq);
+			Line[Len++] = ',';
+			Len += XAxiPmon_SampleUtoa(&Line[Len], Slot);
+			Line[Len++] = ',';
+			Len += XAxiPmon_SampleUtoa(&Line[Len],
+						Rates.WrBandwidth);
+			Line[Len++] = ',';
+			Len += XAxiPmon_SampleUtoa(&Line[Len],
+						Rates.RdBandwidth);
+			Line[Len++] = ',';
+			Len += XAxiPmon_SampleUtoa(&Line[Len],
+						Rates.WrLatency);
+			Line[Len++] = ',';
+			Len += XAxiPmon_SampleUtoa(&Line[Len],
+						Rates.RdLatency);
+			Line[Len++] = '\r';
+			Line[Len++] = '\n';
+
+			Output(CallBackRef, Line, Len);
+		}
+		Count++;
+	}
+
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the offset of a Sampled Metric Counter Register.
+*
+* @param	CounterNum is the number of the Sampled Metric Counter.
+*
+* @return	The register offset.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 XAxiPmon_SmcOffset(u32 CounterNum)
+{
+	u32 Offset;
+
+	if (CounterNum < 10U) {
+		Offset = (u32)XAPM_SMC0_OFFSET + (CounterNum * (u32)16);
+	}
+	else if (CounterNum < 12U) {
+		Offset = (u32)XAPM_SMC10_OFFSET +
+				((CounterNum - (u32)10) * (u32)16);
+	}
+	else if (CounterNum < 24U) {
+		Offset = (u32)XAPM_SMC12_OFFSET +
+				((CounterNum - (u32)12) * (u32)16);
+	}
+	else if (CounterNum < 36U) {
+		Offset = (u32)XAPM_SMC24_OFFSET +
+				((CounterNum - (u32)24) * (u32)16);
+	}
+	else {
+		Offset = (u32)XAPM_SMC36_OFFSET +
+				((CounterNum - (u32)36) * (u32)16);
+	}
+
+	return Offset;
+}
+
+/****************************************************************************/
+/**
+*
+* This function writes a number in decimal, without a terminating null.
+*
+* @param	Buf is the buffer, at least 20 characters long.
+* @param	Value is the number.
+*
+* @return	The number of characters written.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 XAxiPmon_SampleUtoa(char *Buf, u64 Value)
+{
+	char Digits[20];
+	u32 Count = 0U;
+	u32 Len;
+
+	do {
+		Digits[Count] = (char)('0' + (char)(Value % 10U));
+		Count++;
+		Value /= 10U;
+	} while (Value != 0U);
+
+	for (Len = 0U; Len < Count; Len++) {
+		Buf[Len] = Digits[Count - 1U - Len];
+	}
+
+	return Count;
+}
+/** @} */
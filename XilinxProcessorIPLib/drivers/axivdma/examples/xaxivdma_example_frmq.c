@@ -0,0 +1,468 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xaxivdma_example_frmq.c
+ *
+ * This example demonstrates the frame queue of the AXI Video DMA driver in a
+ * capture, process and display pipeline. A video source writes frames through
+ * the write channel, the processor borrows each captured frame in place,
+ * processes it and submits it to the read channel, which sends it to a video
+ * sink. No frame is copied and no frame store address is reprogrammed while
+ * the pipeline runs.
+ *
+ * Like xaxivdma_example_intr.c, this example does not work by itself. It
+ * needs a video IP writing frames to the VDMA and one reading frames from it.
+ *
+ * @note
+ * The values of DDR_BASE_ADDR and DDR_HIGH_ADDR should be as per the HW system.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 6.5   ag   10/19/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+#include "xaxivdma.h"
+#include "xparameters.h"
+#include "xil_exception.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+#include "xintc.h"
+#else
+#include "xscugic.h"
+#endif
+
+/******************** Constant Definitions **********************************/
+
+/*
+ * Device related constants. These need to defined as per the HW system.
+ */
+#define DMA_DEVICE_ID		XPAR_AXIVDMA_0_DEVICE_ID
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+#define INTC_DEVICE_ID		XPAR_INTC_0_DEVICE_ID
+#define WRITE_INTR_ID		XPAR_INTC_0_AXIVDMA_0_S2MM_INTROUT_VEC_ID
+#define READ_INTR_ID		XPAR_INTC_0_AXIVDMA_0_MM2S_INTROUT_VEC_ID
+#else
+#define INTC_DEVICE_ID		XPAR_SCUGIC_SINGLE_DEVICE_ID
+#define WRITE_INTR_ID		XPAR_FABRIC_AXIVDMA_0_S2MM_INTROUT_VEC_ID
+#define READ_INTR_ID		XPAR_FABRIC_AXIVDMA_0_MM2S_INTROUT_VEC_ID
+#endif
+
+#ifdef XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR		XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_BASE_ADDR		XPAR_MIG7SERIES_0_BASEADDR
+#elif XPAR_MIG_0_BASEADDR
+#define DDR_BASE_ADDR		XPAR_MIG_0_BASEADDR
+#else
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+			DEFAULT SET TO 0x01000000
+#define DDR_BASE_ADDR		0x10000000
+#endif
+
+#define MEM_BASE_ADDR		(DDR_BASE_ADDR + 0x01000000)
+
+/* Frame size related constants
+ */
+#define FRAME_HORIZONTAL_LEN	0x1E00	/* 1920 pixels, each pixel 4 bytes */
+#define FRAME_VERTICAL_LEN	0x438	/* 1080 pixels */
+#define FRAME_SIZE		(FRAME_HORIZONTAL_LEN * FRAME_VERTICAL_LEN)
+
+/* Four buffers: one being written, one being read, one with the processor
+ * and one spare so that the write channel does not have to drop frames
+ * while the processor is busy.
+ */
+#define NUMBER_OF_FRAMES	4
+
+/* Number of frames to process before the statistics are printed
+ */
+#define NUM_TEST_FRAMES		300
+
+/*
+ * Device instance definitions
+ */
+XAxiVdma AxiVdma;
+XAxiVdma_FrameQueue FrameQueue;
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+static XIntc Intc;	/* Instance of the Interrupt Controller */
+#else
+static XScuGic Intc;	/* Instance of the Interrupt Controller */
+#endif
+
+static volatile u32 Errors;
+
+/******************* Function Prototypes ************************************/
+
+static void ProcessFrame(UINTPTR Addr);
+static void FrameQueueHandler(void *CallBackRef, u32 Event, u32 FrameIndex);
+static int SetupIntrSystem(XAxiVdma *AxiVdmaPtr, u16 ReadIntrId,
+				u16 WriteIntrId);
+static void DisableIntrSystem(u16 ReadIntrId, u16 WriteIntrId);
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function sets up the frame queue with the processor stage enabled,
+* starts it, and then processes and submits every captured frame until
+* NUM_TEST_FRAMES frames have been displayed. The frame statistics are
+* printed at the end.
+*
+* @return
+*		- XST_SUCCESS if example finishes successfully
+*		- XST_FAILURE if example fails.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+	int Index;
+	u32 FrameIndex;
+	UINTPTR FrameAddr;
+	XAxiVdma_Config *Config;
+	XAxiVdma_FqConfig FqConfig;
+	XAxiVdma_FqStats Stats;
+
+	xil_printf("\r\n--- Entering main() --- \r\n");
+
+	Config = XAxiVdma_LookupConfig(DMA_DEVICE_ID);
+	if (!Config) {
+		xil_printf(
+		    "No video DMA found for ID %d\r\n", DMA_DEVICE_ID);
+		xil_printf("AXI VDMA Frame Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiVdma_CfgInitialize(&AxiVdma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed %d\r\n", Status);
+		xil_printf("AXI VDMA Frame Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	FqConfig.VertSizeInput = FRAME_VERTICAL_LEN;
+	FqConfig.HoriSizeInput = FRAME_HORIZONTAL_LEN;
+	FqConfig.Stride = FRAME_HORIZONTAL_LEN;
+	FqConfig.NumFrames = NUMBER_OF_FRAMES;
+	FqConfig.Flags = XAXIVDMA_FQ_CPU_STAGE | XAXIVDMA_FQ_LATEST;
+	for (Index = 0; Index < NUMBER_OF_FRAMES; Index++) {
+		FqConfig.FrameAddr[Index] = MEM_BASE_ADDR + Index * FRAME_SIZE;
+	}
+
+	Status = XAxiVdma_FqInitialize(&FrameQueue, &AxiVdma, &FqConfig);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Frame queue setup failed %d\r\n", Status);
+		xil_printf("AXI VDMA Frame Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+	XAxiVdma_FqSetHandler(&FrameQueue, FrameQueueHandler, &FrameQueue);
+
+	Status = SetupIntrSystem(&AxiVdma, READ_INTR_ID, WRITE_INTR_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Setup interrupt system failed %d\r\n", Status);
+		xil_printf("AXI VDMA Frame Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XAxiVdma_FqStart(&FrameQueue);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Frame queue start failed %d\r\n", Status);
+		xil_printf("AXI VDMA Frame Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	XAxiVdma_FqGetStats(&FrameQueue, &Stats);
+	while ((Stats.Displayed < NUM_TEST_FRAMES) && !Errors) {
+		/* Borrow the newest captured frame, older ones are dropped */
+		Status = XAxiVdma_FqAcquire(&FrameQueue, &FrameIndex,
+				&FrameAddr);
+		if (Status == XST_SUCCESS) {
+			ProcessFrame(FrameAddr);
+			XAxiVdma_FqSubmit(&FrameQueue, FrameIndex);
+		}
+
+		XAxiVdma_FqGetStats(&FrameQueue, &Stats);
+	}
+
+	XAxiVdma_FqStop(&FrameQueue);
+	DisableIntrSystem(READ_INTR_ID, WRITE_INTR_ID);
+
+	xil_printf("Captured %d, displayed %d, dropped %d, repeated %d\r\n",
+		Stats.Captured, Stats.Displayed, Stats.Dropped,
+		Stats.Repeated);
+
+	if (Errors) {
+		xil_printf("Transfer error %x\r\n", Errors);
+		xil_printf("AXI VDMA Frame Queue Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran AXI VDMA Frame Queue Example\r\n");
+	xil_printf("--- Exiting main() --- \r\n");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* This function stands for the processing stage of the pipeline. It inverts
+* the first line of the frame in place.
+*
+* @param	Addr is the start address of the frame.
+*
+* @return	None.
+*
+* @note		The frame is invalidated before and flushed after it is
+*		processed, since it is written and read by the VDMA.
+*
+******************************************************************************/
+static void ProcessFrame(UINTPTR Addr)
+{
+	u32 *Pixel = (u32 *)Addr;
+	int Index;
+
+	Xil_DCacheInvalidateRange(Addr, FRAME_HORIZONTAL_LEN);
+
+	for (Index = 0; Index < FRAME_HORIZONTAL_LEN / 4; Index++) {
+		Pixel[Index] = ~Pixel[Index];
+	}
+
+	Xil_DCacheFlushRange(Addr, FRAME_HORIZONTAL_LEN);
+}
+
+/*****************************************************************************/
+/*
+ * Frame queue event handler
+ *
+ * Records transfer errors. It is called from the VDMA interrupt handlers.
+ *
+ * @param	CallBackRef is the frame queue
+ * @param	Event is the frame queue event
+ * @param	FrameIndex is the frame index, or the error mask for errors
+ *
+ * @return	None
+*
+******************************************************************************/
+static void FrameQueueHandler(void *CallBackRef, u32 Event, u32 FrameIndex)
+{
+	if (Event == XAXIVDMA_FQ_EVT_ERROR) {
+		Errors |= FrameIndex;
+	}
+}
+
+/*****************************************************************************/
+/*
+*
+* This function setups the interrupt system so interrupts can occur for the
+* DMA.  This function assumes INTC component exists in the hardware system.
+*
+* @param	AxiDmaPtr is a pointer to the instance of the DMA engine
+* @param	ReadIntrId is the read channel Interrupt ID.
+* @param	WriteIntrId is the write channel Interrupt ID.
+*
+* @return	XST_SUCCESS if successful, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int SetupIntrSystem(XAxiVdma *AxiVdmaPtr, u16 ReadIntrId,
+				u16 WriteIntrId)
+{
+	int Status;
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc *IntcInstancePtr =&Intc;
+
+
+	/* Initialize the interrupt controller and connect the ISRs */
+	Status = XIntc_Initialize(IntcInstancePtr, INTC_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+
+		xil_printf( "Failed init intc\r\n");
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Connect(IntcInstancePtr, ReadIntrId,
+	         (XInterruptHandler)XAxiVdma_ReadIntrHandler, AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+
+		xil_printf(
+		    "Failed read channel connect intc %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	Status = XIntc_Connect(IntcInstancePtr, WriteIntrId,
+	         (XInterruptHandler)XAxiVdma_WriteIntrHandler, AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+
+		xil_printf(
+		    "Failed write channel connect intc %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	/* Start the interrupt controller */
+	Status = XIntc_Start(IntcInstancePtr, XIN_REAL_MODE);
+	if (Status != XST_SUCCESS) {
+
+		xil_printf( "Failed to start intc\r\n");
+		return XST_FAILURE;
+	}
+
+	/* Enable interrupts from the hardware */
+	XIntc_Enable(IntcInstancePtr, ReadIntrId);
+	XIntc_Enable(IntcInstancePtr, WriteIntrId);
+
+	Xil_ExceptionInit();
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_INT,
+			(Xil_ExceptionHandler)XIntc_InterruptHandler,
+			(void *)IntcInstancePtr);
+
+	Xil_ExceptionEnable();
+
+#else
+
+	XScuGic *IntcInstancePtr = &Intc;	/* Instance of the Interrupt Controller */
+	XScuGic_Config *IntcConfig;
+
+
+	/*
+	 * Initialize the interrupt controller driver so that it is ready to
+	 * use.
+	 */
+	IntcConfig = XScuGic_LookupConfig(INTC_DEVICE_ID);
+	if (NULL == IntcConfig) {
+		return XST_FAILURE;
+	}
+
+	Status = XScuGic_CfgInitialize(IntcInstancePtr, IntcConfig,
+					IntcConfig->CpuBaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XScuGic_SetPriorityTriggerType(IntcInstancePtr, ReadIntrId, 0xA0, 0x3);
+	XScuGic_SetPriorityTriggerType(IntcInstancePtr, WriteIntrId, 0xA0, 0x3);
+
+	/*
+	 * Connect the device driver handler that will be called when an
+	 * interrupt for the device occurs, the handler defined above performs
+	 * the specific interrupt processing for the device.
+	 */
+	Status = XScuGic_Connect(IntcInstancePtr, ReadIntrId,
+				(Xil_InterruptHandler)XAxiVdma_ReadIntrHandler,
+				AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	Status = XScuGic_Connect(IntcInstancePtr, WriteIntrId,
+				(Xil_InterruptHandler)XAxiVdma_WriteIntrHandler,
+				AxiVdmaPtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/*
+	 * Enable the interrupt for the DMA device.
+	 */
+	XScuGic_Enable(IntcInstancePtr, ReadIntrId);
+	XScuGic_Enable(IntcInstancePtr, WriteIntrId);
+
+	Xil_ExceptionInit();
+
+	/*
+	 * Connect the interrupt controller interrupt handler to the hardware
+	 * interrupt handling logic in the processor.
+	 */
+	Xil_ExceptionRegisterHandler(XIL_EXCEPTION_ID_IRQ_INT,
+				(Xil_ExceptionHandler)XScuGic_InterruptHandler,
+				IntcInstancePtr);
+
+
+	/*
+	 * Enable interrupts in the Processor.
+	 */
+	Xil_ExceptionEnable();
+
+
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function disables the interrupts
+*
+* @param	ReadIntrId is interrupt ID associated w/ DMA read channel
+* @param	WriteIntrId is interrupt ID associated w/ DMA write channel
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void DisableIntrSystem(u16 ReadIntrId, u16 WriteIntrId)
+{
+
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc *IntcInstancePtr =&Intc;
+
+	/* Disconnect the interrupts for the DMA TX and RX channels */
+	XIntc_Disconnect(IntcInstancePtr, ReadIntrId);
+	XIntc_Disconnect(IntcInstancePtr, WriteIntrId);
+#else
+	XScuGic *IntcInstancePtr = &Intc;
+
+	XScuGic_Disable(IntcInstancePtr, ReadIntrId);
+	XScuGic_Disable(IntcInstancePtr, WriteIntrId);
+
+	XScuGic_Disconnect(IntcInstancePtr, ReadIntrId);
+	XScuGic_Disconnect(IntcInstancePtr, WriteIntrId);
+#endif
+}
@@ -199,6 +199,32 @@
 * Buffer addresses for transfers are physical addresses. If the system does not
 * use MMU, then physical and virtual addresses are the same.
 *
+* <b>Frame Queue</b>
+*
+* The frame queue (xaxivdma_frmq.c) manages a set of frame buffers between
+* the write channel (producer) and the read channel (consumer) so that
+* capture, processing and display pipelines run without tearing or copies.
+* Both channels are programmed once with all frame buffers and run parked;
+* handing a frame over only moves a park pointer from the frame count
+* interrupt of the channel. Every buffer is owned by exactly one party at a
+* time: the write channel, the read channel, the processor, or one of the
+* queues between them.
+*
+* - A completed write frame is queued for the read channel, or for the
+*   processor if XAXIVDMA_FQ_CPU_STAGE is set.
+* - The processor borrows frames in place with XAxiVdma_FqAcquire() or
+*   XAxiVdma_FqAcquireFree() and hands them on with XAxiVdma_FqSubmit() or
+*   XAxiVdma_FqRelease().
+* - The write channel never parks on the frame the read channel is parked on
+*   or still reports as its current frame, and the read channel only takes
+*   completed frames, which is genlock done by the driver.
+* - When no buffer is free the oldest queued frame is overwritten and
+*   counted as dropped; when no new frame is queued the read channel shows
+*   its frame again and it is counted as repeated.
+*
+* The park pointers are updated from the interrupt handlers, which must
+* therefore run within the vertical blanking of the video stream.
+*
 * <b>API Change from PLB Video DMA</b>
 *
 * We try to keep the API as consistent with the PLB Video DMA driver as
@@ -301,6 +327,8 @@
 * 6.4   ms   04/18/17 Modified tcl file to add suffix U for all macro
 *                     definitions of axivdma in xparameters.h
 *       ms   08/07/17 Fixed compilation warnings in xaxivdma_sinit.c
+* 6.5   ag   10/19/26 Added the frame queue in xaxivdma_frmq.c for frame
+*                     buffer handoff between the write and read channels.
 * </pre>
 *
 ******************************************************************************/
@@ -379,6 +407,23 @@ extern "C" {
 #define XST_VDMA_MISMATCH_ERROR 1430
 #endif
 
+/** @name Frame queue flags
+ * @{
+ */
+#define XAXIVDMA_FQ_CPU_STAGE	0x00000001 /**< Captured frames go to the
+					     *  processor before display */
+#define XAXIVDMA_FQ_LATEST	0x00000002 /**< Take the newest queued frame,
+					     *  dropping older ones */
+/*@}*/
+
+/** @name Frame queue events passed to XAxiVdma_FqHandler
+ * @{
+ */
+#define XAXIVDMA_FQ_EVT_CAPTURED	1 /**< Write channel completed a frame */
+#define XAXIVDMA_FQ_EVT_DISPLAYED	2 /**< Read channel took a new frame */
+#define XAXIVDMA_FQ_EVT_ERROR		3 /**< A channel reported an error */
+/*@}*/
+
 /**************************** Type Definitions *******************************/
 
 /*****************************************************************************/
@@ -538,6 +583,71 @@ typedef struct {
 	int AddrWidth;		  /**< Address Width */
 } XAxiVdma;
 
+/*****************************************************************************/
+/**
+ * Callback type for frame queue events
+ *
+ * @param   CallBackRef is the reference passed to XAxiVdma_FqSetHandler().
+ * @param   Event is one of the XAXIVDMA_FQ_EVT_* values.
+ * @param   FrameIndex is the frame captured or displayed, or the error mask
+ *          for XAXIVDMA_FQ_EVT_ERROR.
+ *****************************************************************************/
+typedef void (*XAxiVdma_FqHandler) (void *CallBackRef, u32 Event,
+		u32 FrameIndex);
+
+/**
+ * Configuration of a frame queue.
+ */
+typedef struct {
+    int VertSizeInput;      /**< Vertical size in lines */
+    int HoriSizeInput;      /**< Horizontal size in bytes */
+    int Stride;             /**< Stride in bytes */
+    u32 NumFrames;          /**< Number of frame buffers */
+    UINTPTR FrameAddr[XAXIVDMA_MAX_FRAMESTORE];
+                            /**< Start addresses of the frame buffers */
+    u32 Flags;              /**< XAXIVDMA_FQ_* flags */
+} XAxiVdma_FqConfig;
+
+/**
+ * Frame queue statistics.
+ */
+typedef struct {
+    u32 Captured;           /**< Frames completed by the write channel */
+    u32 Displayed;          /**< New frames taken by the read channel */
+    u32 Dropped;            /**< Completed frames never displayed */
+    u32 Repeated;           /**< Frames shown again for lack of a new one */
+    u32 Errors;             /**< Error interrupts */
+} XAxiVdma_FqStats;
+
+/**
+ * A frame buffer of a frame queue.
+ */
+typedef struct {
+    UINTPTR Addr;           /**< Start address */
+    u32 Seq;                /**< Capture order */
+    u8 State;               /**< Owner of the frame */
+} XAxiVdma_FqFrame;
+
+/**
+ * Frame queue instance. The fields are only accessed by the driver.
+ */
+typedef struct {
+    XAxiVdma *InstancePtr;  /**< VDMA the queue runs on */
+    XAxiVdma_FqFrame Frame[XAXIVDMA_MAX_FRAMESTORE]; /**< Frame buffers */
+    u32 NumFrames;          /**< Number of frame buffers */
+    u32 Flags;              /**< XAXIVDMA_FQ_* flags */
+    u32 Seq;                /**< Sequence number of the last capture */
+    int IsStarted;          /**< Channels are running */
+    int WriteIdx;           /**< Frame parked for writing, -1 if none */
+    int ReadIdx;            /**< Frame parked for reading, -1 if none */
+    int VertSizeInput;      /**< Vertical size in lines */
+    int HoriSizeInput;      /**< Horizontal size in bytes */
+    int Stride;             /**< Stride in bytes */
+    XAxiVdma_FqStats Stats; /**< Statistics */
+    XAxiVdma_FqHandler Handler; /**< Event callback */
+    void *HandlerRef;       /**< Event callback reference */
+} XAxiVdma_FrameQueue;
+
 
 /************************** Function Prototypes ******************************/
 /* Initialization */
@@ -610,6 +720,24 @@ int XAxiVdma_SetCallBack(XAxiVdma * InstancePtr, u32 HandlerType,
         void *CallBackFunc, void *CallBackRef, u16 Direction);
 int XAxiVdma_Selftest(XAxiVdma * InstancePtr);
 
+/*
+ * Frame queue functions in xaxivdma_frmq.c
+ */
+int XAxiVdma_FqInitialize(XAxiVdma_FrameQueue *FqPtr, XAxiVdma *InstancePtr,
+        XAxiVdma_FqConfig *CfgPtr);
+void XAxiVdma_FqSetHandler(XAxiVdma_FrameQueue *FqPtr,
+        XAxiVdma_FqHandler Handler, void *CallBackRef);
+int XAxiVdma_FqStart(XAxiVdma_FrameQueue *FqPtr);
+void XAxiVdma_FqStop(XAxiVdma_FrameQueue *FqPtr);
+int XAxiVdma_FqAcquire(XAxiVdma_FrameQueue *FqPtr, u32 *FrameIndexPtr,
+        UINTPTR *AddrPtr);
+int XAxiVdma_FqAcquireFree(XAxiVdma_FrameQueue *FqPtr, u32 *FrameIndexPtr,
+        UINTPTR *AddrPtr);
+int XAxiVdma_FqSubmit(XAxiVdma_FrameQueue *FqPtr, u32 FrameIndex);
+int XAxiVdma_FqRelease(XAxiVdma_FrameQueue *FqPtr, u32 FrameIndex);
+void XAxiVdma_FqGetStats(XAxiVdma_FrameQueue *FqPtr,
+        XAxiVdma_FqStats *StatsPtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,786 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xaxivdma_frmq.c
+* @addtogroup axivdma_v6_0
+* @{
+*
+* Implementation of the frame queue, which hands frame buffers between the
+* write channel, the read channel and the processor. See xaxivdma.h for a
+* description.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 6.5   ag   10/19/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xaxivdma.h"
+#include "xaxivdma_i.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * Owner of a frame buffer
+ */
+#define XAXIVDMA_FQ_FREE	0 /* Nobody */
+#define XAXIVDMA_FQ_WRITE	1 /* Write channel is parked on it */
+#define XAXIVDMA_FQ_CAPTURED	2 /* Completed, queued for the processor */
+#define XAXIVDMA_FQ_LENT	3 /* Processor */
+#define XAXIVDMA_FQ_READY	4 /* Queued for the read channel */
+#define XAXIVDMA_FQ_READ	5 /* Read channel is parked on it */
+
+#define XAXIVDMA_FQ_INTR_MASK	(XAXIVDMA_IXR_FRMCNT_MASK | \
+				 XAXIVDMA_IXR_ERROR_MASK)
+
+/************************** Function Prototypes ******************************/
+
+static void XAxiVdma_FqWriteDone(void *CallBackRef, u32 InterruptTypes);
+static void XAxiVdma_FqReadDone(void *CallBackRef, u32 InterruptTypes);
+static void XAxiVdma_FqError(void *CallBackRef, u32 ErrorMask);
+
+/*****************************************************************************/
+/*
+ * Find a frame in the given state, skipping frame Exclude.
+ *
+ * @param FqPtr is the frame queue
+ * @param State is the state to look for
+ * @param Newest selects the most recently queued frame instead of the
+ *        least recently queued one
+ * @param Exclude is a frame to skip, or -1
+ *
+ * @return
+ * The frame index, or -1 if no frame is in the state
+ *
+ *****************************************************************************/
+static int XAxiVdma_FqFind(XAxiVdma_FrameQueue *FqPtr, u8 State, int Newest,
+		int Exclude)
+{
+	int Found = -1;
+	int Index;
+	s32 Age;
+
+	for (Index = 0; Index < (int)FqPtr->NumFrames; Index++) {
+		if ((FqPtr->Frame[Index].State != State) || (Index == Exclude)) {
+			continue;
+		}
+		if (Found < 0) {
+			Found = Index;
+			continue;
+		}
+
+		/* Sequence numbers wrap, so compare their distance */
+		Age = (s32)(FqPtr->Frame[Index].Seq - FqPtr->Frame[Found].Seq);
+		if ((Newest && (Age > 0)) || (!Newest && (Age < 0))) {
+			Found = Index;
+		}
+	}
+
+	return Found;
+}
+
+/*****************************************************************************/
+/*
+ * Take the next frame from a queue. With XAXIVDMA_FQ_LATEST the newest frame
+ * is taken and the older ones are freed and counted as dropped, otherwise
+ * frames are taken in the order they were queued.
+ *
+ * @param FqPtr is the frame queue
+ * @param State is the queue, XAXIVDMA_FQ_CAPTURED or XAXIVDMA_FQ_READY
+ *
+ * @return
+ * The frame index, or -1 if the queue is empty
+ *
+ *****************************************************************************/
+static int XAxiVdma_FqTake(XAxiVdma_FrameQueue *FqPtr, u8 State)
+{
+	int Latest = (FqPtr->Flags & XAXIVDMA_FQ_LATEST) != 0;
+	int Found;
+	int Index;
+
+	Found = XAxiVdma_FqFind(FqPtr, State, Latest, -1);
+	if ((Found < 0) || !Latest) {
+		return Found;
+	}
+
+	for (Index = 0; Index < (int)FqPtr->NumFrames; Index++) {
+		if ((Index != Found) && (FqPtr->Frame[Index].State == State)) {
+			FqPtr->Frame[Index].State = XAXIVDMA_FQ_FREE;
+			FqPtr->Stats.Dropped++;
+		}
+	}
+
+	return Found;
+}
+
+/*****************************************************************************/
+/*
+ * Return the frame a channel reports as its current frame. It lags the park
+ * pointer by up to one frame.
+ *
+ * @param FqPtr is the frame queue
+ * @param Direction is the channel, use XAXIVDMA_READ or XAXIVDMA_WRITE
+ *
+ * @return
+ * The frame index, or -1 if the channel is not used
+ *
+ *****************************************************************************/
+static int XAxiVdma_FqHwFrame(XAxiVdma_FrameQueue *FqPtr, u16 Direction)
+{
+	if (((Direction == XAXIVDMA_READ) ? FqPtr->ReadIdx :
+					    FqPtr->WriteIdx) < 0) {
+		return -1;
+	}
+
+	return (int)XAxiVdma_CurrFrameStore(FqPtr->InstancePtr, Direction);
+}
+
+/*****************************************************************************/
+/*
+ * Park a channel on a frame. Only the park pointer is written; the channel
+ * moves to the frame at its next frame sync.
+ *
+ * @param FqPtr is the frame queue
+ * @param FrameIndex is the frame to park on
+ * @param Direction is the channel, use XAXIVDMA_READ or XAXIVDMA_WRITE
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FqPark(XAxiVdma_FrameQueue *FqPtr, int FrameIndex,
+		u16 Direction)
+{
+	UINTPTR BaseAddr = FqPtr->InstancePtr->BaseAddr;
+	u32 RegValue;
+
+	RegValue = XAxiVdma_ReadReg(BaseAddr, XAXIVDMA_PARKPTR_OFFSET);
+
+	if (Direction == XAXIVDMA_READ) {
+		RegValue &= ~XAXIVDMA_PARKPTR_READREF_MASK;
+		RegValue |= (u32)FrameIndex & XAXIVDMA_PARKPTR_READREF_MASK;
+	}
+	else {
+		RegValue &= ~XAXIVDMA_PARKPTR_WRTREF_MASK;
+		RegValue |= ((u32)FrameIndex << XAXIVDMA_WRTREF_SHIFT) &
+			XAXIVDMA_PARKPTR_WRTREF_MASK;
+	}
+
+	XAxiVdma_WriteReg(BaseAddr, XAXIVDMA_PARKPTR_OFFSET, RegValue);
+}
+
+/*****************************************************************************/
+/*
+ * Keep the interrupt handlers of the queue from running while the processor
+ * changes the frame states. An interrupt raised meanwhile stays pending and
+ * is taken in XAxiVdma_FqUnlock().
+ *
+ * @param FqPtr is the frame queue
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FqLock(XAxiVdma_FrameQueue *FqPtr)
+{
+	if (FqPtr->IsStarted) {
+		XAxiVdma_IntrDisable(FqPtr->InstancePtr, XAXIVDMA_FQ_INTR_MASK,
+			XAXIVDMA_WRITE);
+		XAxiVdma_IntrDisable(FqPtr->InstancePtr, XAXIVDMA_FQ_INTR_MASK,
+			XAXIVDMA_READ);
+	}
+}
+
+/*****************************************************************************/
+/*
+ * Allow the interrupt handlers of the queue to run again.
+ *
+ * @param FqPtr is the frame queue
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FqUnlock(XAxiVdma_FrameQueue *FqPtr)
+{
+	if (FqPtr->IsStarted) {
+		XAxiVdma_IntrEnable(FqPtr->InstancePtr, XAXIVDMA_FQ_INTR_MASK,
+			XAXIVDMA_WRITE);
+		XAxiVdma_IntrEnable(FqPtr->InstancePtr, XAXIVDMA_FQ_INTR_MASK,
+			XAXIVDMA_READ);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Initialize a frame queue on a VDMA instance. The frame store number of
+ * both channels is set to the number of frame buffers.
+ *
+ * @param FqPtr is the frame queue to initialize
+ * @param InstancePtr is the initialized VDMA the queue runs on
+ * @param CfgPtr is the configuration of the queue
+ *
+ * @return
+ * - XST_SUCCESS if the queue is initialized
+ * - XST_INVALID_PARAM if the number of frames is out of range
+ * - XST_FAILURE if the frame store number cannot be set
+ *
+ * @note
+ * Without a read channel the captured frames always go to the processor.
+ *
+ *****************************************************************************/
+int XAxiVdma_FqInitialize(XAxiVdma_FrameQueue *FqPtr, XAxiVdma *InstancePtr,
+        XAxiVdma_FqConfig *CfgPtr)
+{
+	XAxiVdma_Channel *Channel;
+	u16 Direction;
+	u32 Index;
+	int Status;
+
+	Xil_AssertNonvoid(FqPtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XAXIVDMA_DEVICE_READY);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+
+	if ((CfgPtr->NumFrames < 2) ||
+	    (CfgPtr->NumFrames > XAXIVDMA_MAX_FRAMESTORE) ||
+	    (CfgPtr->NumFrames > (u32)InstancePtr->MaxNumFrames)) {
+		return XST_INVALID_PARAM;
+	}
+
+	for (Direction = XAXIVDMA_WRITE; Direction <= XAXIVDMA_READ;
+	     Direction++) {
+		Channel = XAxiVdma_GetChannel(InstancePtr, Direction);
+		if (!Channel->IsValid) {
+			continue;
+		}
+
+		Status = XAxiVdma_SetFrmStore(InstancePtr,
+				(u8)CfgPtr->NumFrames, Direction);
+		if ((Status == XST_NO_FEATURE) &&
+		    ((u32)Channel->NumFrames == CfgPtr->NumFrames)) {
+			Status = XST_SUCCESS;
+		}
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	memset(FqPtr, 0, sizeof(XAxiVdma_FrameQueue));
+
+	FqPtr->InstancePtr = InstancePtr;
+	FqPtr->NumFrames = CfgPtr->NumFrames;
+	FqPtr->Flags = CfgPtr->Flags;
+	FqPtr->VertSizeInput = CfgPtr->VertSizeInput;
+	FqPtr->HoriSizeInput = CfgPtr->HoriSizeInput;
+	FqPtr->Stride = CfgPtr->Stride;
+	FqPtr->WriteIdx = -1;
+	FqPtr->ReadIdx = -1;
+
+	if (!InstancePtr->HasMm2S) {
+		FqPtr->Flags |= XAXIVDMA_FQ_CPU_STAGE;
+	}
+
+	for (Index = 0; Index < FqPtr->NumFrames; Index++) {
+		FqPtr->Frame[Index].Addr = CfgPtr->FrameAddr[Index];
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Set the callback for frame queue events. It is called from the interrupt
+ * handlers of the VDMA.
+ *
+ * @param FqPtr is the frame queue
+ * @param Handler is the callback, or NULL for none
+ * @param CallBackRef is passed back to the callback
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+void XAxiVdma_FqSetHandler(XAxiVdma_FrameQueue *FqPtr,
+        XAxiVdma_FqHandler Handler, void *CallBackRef)
+{
+	Xil_AssertVoid(FqPtr != NULL);
+
+	FqPtr->Handler = Handler;
+	FqPtr->HandlerRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+ * Start both channels on the frame queue. All frame buffers are given to
+ * each channel once, the channels are parked on their first frames and the
+ * frame count and error interrupts of the queue are installed and enabled.
+ * All frames are free afterwards, except those the channels are parked on.
+ *
+ * @param FqPtr is the frame queue
+ *
+ * @return
+ * - XST_SUCCESS if the channels are started
+ * - XST_FAILURE if a channel cannot be configured or started
+ *
+ * @note
+ * The callbacks of the VDMA instance are replaced by those of the queue.
+ * The VDMA interrupt handlers must be connected to the interrupt controller
+ * by the application.
+ *
+ *****************************************************************************/
+int XAxiVdma_FqStart(XAxiVdma_FrameQueue *FqPtr)
+{
+	XAxiVdma *InstancePtr;
+	XAxiVdma_DmaSetup Setup;
+	XAxiVdma_Channel *Channel;
+	u16 Direction;
+	u32 Index;
+	int FrameIndex;
+	int Status;
+
+	Xil_AssertNonvoid(FqPtr != NULL);
+	Xil_AssertNonvoid(FqPtr->InstancePtr != NULL);
+
+	InstancePtr = FqPtr->InstancePtr;
+
+	memset(&Setup, 0, sizeof(XAxiVdma_DmaSetup));
+	Setup.VertSizeInput = FqPtr->VertSizeInput;
+	Setup.HoriSizeInput = FqPtr->HoriSizeInput;
+	Setup.Stride = FqPtr->Stride;
+	Setup.EnableCircularBuf = 1;
+
+	for (Index = 0; Index < FqPtr->NumFrames; Index++) {
+		Setup.FrameStoreStartAddr[Index] = FqPtr->Frame[Index].Addr;
+		FqPtr->Frame[Index].State = XAXIVDMA_FQ_FREE;
+		FqPtr->Frame[Index].Seq = 0;
+	}
+
+	FqPtr->Seq = 0;
+	FqPtr->WriteIdx = InstancePtr->HasS2Mm ? 0 : -1;
+	FqPtr->ReadIdx = -1;
+	if (InstancePtr->HasMm2S) {
+		FqPtr->ReadIdx = InstancePtr->HasS2Mm ? 1 : 0;
+	}
+	memset(&FqPtr->Stats, 0, sizeof(XAxiVdma_FqStats));
+
+	for (Direction = XAXIVDMA_WRITE; Direction <= XAXIVDMA_READ;
+	     Direction++) {
+		Channel = XAxiVdma_GetChannel(InstancePtr, Direction);
+		if (!Channel->IsValid) {
+			continue;
+		}
+
+		if (Direction == XAXIVDMA_WRITE) {
+			FrameIndex = FqPtr->WriteIdx;
+			FqPtr->Frame[FrameIndex].State = XAXIVDMA_FQ_WRITE;
+			XAxiVdma_SetCallBack(InstancePtr,
+				XAXIVDMA_HANDLER_GENERAL,
+				(void *)XAxiVdma_FqWriteDone, FqPtr, Direction);
+		}
+		else {
+			FrameIndex = FqPtr->ReadIdx;
+			FqPtr->Frame[FrameIndex].State = XAXIVDMA_FQ_READ;
+			XAxiVdma_SetCallBack(InstancePtr,
+				XAXIVDMA_HANDLER_GENERAL,
+				(void *)XAxiVdma_FqReadDone, FqPtr, Direction);
+		}
+		XAxiVdma_SetCallBack(InstancePtr, XAXIVDMA_HANDLER_ERROR,
+			(void *)XAxiVdma_FqError, FqPtr, Direction);
+
+		Status = XAxiVdma_DmaConfig(InstancePtr, Direction, &Setup);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = XAxiVdma_DmaSetBufferAddr(InstancePtr, Direction,
+				Setup.FrameStoreStartAddr);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		/* One frame count interrupt per frame. Without the frame
+		 * counter register the counter is fixed at one.
+		 */
+		(void)XAxiVdma_ChannelSetFrmCnt(Channel, 1, 0);
+
+		Status = XAxiVdma_DmaStart(InstancePtr, Direction);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		Status = XAxiVdma_StartParking(InstancePtr, FrameIndex,
+				Direction);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	FqPtr->IsStarted = 1;
+	XAxiVdma_FqUnlock(FqPtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Stop both channels of the frame queue and disable its interrupts. Frames
+ * lent to the processor stay valid until the queue is started again.
+ *
+ * @param FqPtr is the frame queue
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+void XAxiVdma_FqStop(XAxiVdma_FrameQueue *FqPtr)
+{
+	Xil_AssertVoid(FqPtr != NULL);
+
+	XAxiVdma_FqLock(FqPtr);
+	FqPtr->IsStarted = 0;
+
+	XAxiVdma_DmaStop(FqPtr->InstancePtr, XAXIVDMA_WRITE);
+	XAxiVdma_DmaStop(FqPtr->InstancePtr, XAXIVDMA_READ);
+}
+
+/*****************************************************************************/
+/**
+ * Lend the next completed frame to the processor. The frame is taken from
+ * the queue of the processor if XAXIVDMA_FQ_CPU_STAGE is set, otherwise from
+ * the queue of the read channel. The frame is not touched by the VDMA until
+ * it is given back with XAxiVdma_FqSubmit() or XAxiVdma_FqRelease().
+ *
+ * @param FqPtr is the frame queue
+ * @param FrameIndexPtr returns the frame index
+ * @param AddrPtr returns the start address of the frame
+ *
+ * @return
+ * - XST_SUCCESS if a frame is lent
+ * - XST_NO_DATA if no completed frame is queued
+ *
+ *****************************************************************************/
+int XAxiVdma_FqAcquire(XAxiVdma_FrameQueue *FqPtr, u32 *FrameIndexPtr,
+        UINTPTR *AddrPtr)
+{
+	int FrameIndex;
+
+	Xil_AssertNonvoid(FqPtr != NULL);
+	Xil_AssertNonvoid(FrameIndexPtr != NULL);
+	Xil_AssertNonvoid(AddrPtr != NULL);
+
+	XAxiVdma_FqLock(FqPtr);
+
+	FrameIndex = XAxiVdma_FqTake(FqPtr,
+			(FqPtr->Flags & XAXIVDMA_FQ_CPU_STAGE) ?
+			XAXIVDMA_FQ_CAPTURED : XAXIVDMA_FQ_READY);
+	if (FrameIndex >= 0) {
+		FqPtr->Frame[FrameIndex].State = XAXIVDMA_FQ_LENT;
+	}
+
+	XAxiVdma_FqUnlock(FqPtr);
+
+	if (FrameIndex < 0) {
+		return XST_NO_DATA;
+	}
+
+	*FrameIndexPtr = (u32)FrameIndex;
+	*AddrPtr = FqPtr->Frame[FrameIndex].Addr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Lend a free frame to the processor, for example to render a frame for the
+ * read channel into.
+ *
+ * @param FqPtr is the frame queue
+ * @param FrameIndexPtr returns the frame index
+ * @param AddrPtr returns the start address of the frame
+ *
+ * @return
+ * - XST_SUCCESS if a frame is lent
+ * - XST_DEVICE_BUSY if all frames are in use
+ *
+ *****************************************************************************/
+int XAxiVdma_FqAcquireFree(XAxiVdma_FrameQueue *FqPtr, u32 *FrameIndexPtr,
+        UINTPTR *AddrPtr)
+{
+	int FrameIndex;
+
+	Xil_AssertNonvoid(FqPtr != NULL);
+	Xil_AssertNonvoid(FrameIndexPtr != NULL);
+	Xil_AssertNonvoid(AddrPtr != NULL);
+
+	XAxiVdma_FqLock(FqPtr);
+
+	FrameIndex = XAxiVdma_FqFind(FqPtr, XAXIVDMA_FQ_FREE, 0,
+			XAxiVdma_FqHwFrame(FqPtr, XAXIVDMA_READ));
+	if (FrameIndex >= 0) {
+		FqPtr->Frame[FrameIndex].State = XAXIVDMA_FQ_LENT;
+	}
+
+	XAxiVdma_FqUnlock(FqPtr);
+
+	if (FrameIndex < 0) {
+		return XST_DEVICE_BUSY;
+	}
+
+	*FrameIndexPtr = (u32)FrameIndex;
+	*AddrPtr = FqPtr->Frame[FrameIndex].Addr;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Queue a frame lent to the processor for the read channel. Frames are
+ * displayed in the order they are submitted.
+ *
+ * @param FqPtr is the frame queue
+ * @param FrameIndex is a frame lent by XAxiVdma_FqAcquire() or
+ *        XAxiVdma_FqAcquireFree()
+ *
+ * @return
+ * - XST_SUCCESS if the frame is queued
+ * - XST_INVALID_PARAM if the frame is not lent to the processor
+ * - XST_NO_FEATURE if the VDMA has no read channel
+ *
+ * @note
+ * Cache maintenance of the frame is up to the application.
+ *
+ *****************************************************************************/
+int XAxiVdma_FqSubmit(XAxiVdma_FrameQueue *FqPtr, u32 FrameIndex)
+{
+	Xil_AssertNonvoid(FqPtr != NULL);
+
+	if ((FrameIndex >= FqPtr->NumFrames) ||
+	    (FqPtr->Frame[FrameIndex].State != XAXIVDMA_FQ_LENT)) {
+		return XST_INVALID_PARAM;
+	}
+	if (!FqPtr->InstancePtr->HasMm2S) {
+		return XST_NO_FEATURE;
+	}
+
+	XAxiVdma_FqLock(FqPtr);
+
+	FqPtr->Frame[FrameIndex].Seq = ++FqPtr->Seq;
+	FqPtr->Frame[FrameIndex].State = XAXIVDMA_FQ_READY;
+
+	XAxiVdma_FqUnlock(FqPtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Give a frame lent to the processor back without displaying it.
+ *
+ * @param FqPtr is the frame queue
+ * @param FrameIndex is a frame lent by XAxiVdma_FqAcquire() or
+ *        XAxiVdma_FqAcquireFree()
+ *
+ * @return
+ * - XST_SUCCESS if the frame is free again
+ * - XST_INVALID_PARAM if the frame is not lent to the processor
+ *
+ *****************************************************************************/
+int XAxiVdma_FqRelease(XAxiVdma_FrameQueue *FqPtr, u32 FrameIndex)
+{
+	Xil_AssertNonvoid(FqPtr != NULL);
+
+	if ((FrameIndex >= FqPtr->NumFrames) ||
+	    (FqPtr->Frame[FrameIndex].State != XAXIVDMA_FQ_LENT)) {
+		return XST_INVALID_PARAM;
+	}
+
+	/* The handlers never take a lent frame, no lock needed */
+	FqPtr->Frame[FrameIndex].State = XAXIVDMA_FQ_FREE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Get the statistics of the frame queue since it was started.
+ *
+ * @param FqPtr is the frame queue
+ * @param StatsPtr returns the statistics
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+void XAxiVdma_FqGetStats(XAxiVdma_FrameQueue *FqPtr,
+        XAxiVdma_FqStats *StatsPtr)
+{
+	Xil_AssertVoid(FqPtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	XAxiVdma_FqLock(FqPtr);
+	*StatsPtr = FqPtr->Stats;
+	XAxiVdma_FqUnlock(FqPtr);
+}
+
+/*****************************************************************************/
+/*
+ * Frame count interrupt of the write channel. The frame just written is
+ * queued and the channel is parked on a free frame, or on the oldest queued
+ * frame if none is free. The frame the read channel is on is never chosen.
+ *
+ * @param CallBackRef is the frame queue
+ * @param InterruptTypes is the mask of pending completion interrupts
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FqWriteDone(void *CallBackRef, u32 InterruptTypes)
+{
+	XAxiVdma_FrameQueue *FqPtr = (XAxiVdma_FrameQueue *)CallBackRef;
+	u8 Queue;
+	int Done;
+	int Next;
+	int HwRead;
+
+	if (!(InterruptTypes & XAXIVDMA_IXR_FRMCNT_MASK)) {
+		return;
+	}
+
+	Queue = (FqPtr->Flags & XAXIVDMA_FQ_CPU_STAGE) ?
+		XAXIVDMA_FQ_CAPTURED : XAXIVDMA_FQ_READY;
+
+	Done = FqPtr->WriteIdx;
+	FqPtr->Frame[Done].Seq = ++FqPtr->Seq;
+	FqPtr->Frame[Done].State = Queue;
+	FqPtr->Stats.Captured++;
+
+	HwRead = XAxiVdma_FqHwFrame(FqPtr, XAXIVDMA_READ);
+
+	Next = XAxiVdma_FqFind(FqPtr, XAXIVDMA_FQ_FREE, 0, HwRead);
+	if (Next < 0) {
+		Next = XAxiVdma_FqFind(FqPtr, Queue, 0, HwRead);
+		if (Next < 0) {
+			Next = Done;
+		}
+		FqPtr->Stats.Dropped++;
+	}
+
+	FqPtr->Frame[Next].State = XAXIVDMA_FQ_WRITE;
+	FqPtr->WriteIdx = Next;
+
+	if (Next == Done) {
+		return;
+	}
+
+	XAxiVdma_FqPark(FqPtr, Next, XAXIVDMA_WRITE);
+
+	if (FqPtr->Handler) {
+		FqPtr->Handler(FqPtr->HandlerRef, XAXIVDMA_FQ_EVT_CAPTURED,
+			(u32)Done);
+	}
+}
+
+/*****************************************************************************/
+/*
+ * Frame count interrupt of the read channel. The frame just read is freed
+ * and the channel is parked on the next queued frame. If none is queued the
+ * channel stays on its frame, which is shown again.
+ *
+ * @param CallBackRef is the frame queue
+ * @param InterruptTypes is the mask of pending completion interrupts
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FqReadDone(void *CallBackRef, u32 InterruptTypes)
+{
+	XAxiVdma_FrameQueue *FqPtr = (XAxiVdma_FrameQueue *)CallBackRef;
+	int Next;
+
+	if (!(InterruptTypes & XAXIVDMA_IXR_FRMCNT_MASK)) {
+		return;
+	}
+
+	Next = XAxiVdma_FqTake(FqPtr, XAXIVDMA_FQ_READY);
+	if (Next < 0) {
+		FqPtr->Stats.Repeated++;
+		return;
+	}
+
+	FqPtr->Frame[FqPtr->ReadIdx].State = XAXIVDMA_FQ_FREE;
+	FqPtr->Frame[Next].State = XAXIVDMA_FQ_READ;
+	FqPtr->ReadIdx = Next;
+	FqPtr->Stats.Displayed++;
+
+	XAxiVdma_FqPark(FqPtr, Next, XAXIVDMA_READ);
+
+	if (FqPtr->Handler) {
+		FqPtr->Handler(FqPtr->HandlerRef, XAXIVDMA_FQ_EVT_DISPLAYED,
+			(u32)Next);
+	}
+}
+
+/*****************************************************************************/
+/*
+ * Error interrupt of either channel. The error is counted and passed on;
+ * recovering the channel is up to the application.
+ *
+ * @param CallBackRef is the frame queue
+ * @param ErrorMask is the mask of the errors
+ *
+ * @return
+ *   None
+ *
+ *****************************************************************************/
+static void XAxiVdma_FqError(void *CallBackRef, u32 ErrorMask)
+{
+	XAxiVdma_FrameQueue *FqPtr = (XAxiVdma_FrameQueue *)CallBackRef;
+
+	FqPtr->Stats.Errors++;
+
+	if (FqPtr->Handler) {
+		FqPtr->Handler(FqPtr->HandlerRef, XAXIVDMA_FQ_EVT_ERROR,
+			ErrorMask);
+	}
+}
+/** @} */
@@ -0,0 +1,769 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xdmaps_prog_test.c
+*
+* This file contains a host test of the DMA program generator of the XDmaPs
+* driver, xdmaps_prog.c. It does not access a device:
+*	- Programs of a single block and of a 2D transfer are compared byte by
+*	  byte against hand assembled PL330 code.
+*	- Programs of scatter-gather lists and 2D transfers are run by a small
+*	  PL330 interpreter over a simulated memory, and the result is
+*	  compared with a plain copy of the segments. This covers unaligned
+*	  heads and tails, long blocks on both loop counters, more than 256
+*	  rows, fixed source and destination addresses, rows too long for a
+*	  loop, and DMANOP padding for the instruction cache line.
+*	- Invalid commands and a too small program buffer are refused.
+*
+* The test runs on the host, for example with
+*
+*	gcc -O2 -I../src -I<bsp>/common ../src/xdmaps_prog.c
+*		<bsp>/common/xil_assert.c xdmaps_prog_test.c
+*		-o dmaps_prog_test
+*
+* where <bsp>/common holds xil_types.h, xstatus.h and xil_assert.h of the
+* standalone BSP.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  	Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.4   ag     10/19/26 First Release.
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "xdmaps_prog.h"
+
+/************************** Constant Definitions ****************************/
+
+#define TEST_CHANNEL	3		/* Channel of the generated programs */
+#define TEST_PROG_SIZE	4096		/* Size of the program buffer */
+#define TEST_MEM_SIZE	0x400000	/* Size of the simulated memory */
+#define TEST_STREAM_SIZE 0x10000	/* Bytes of a fixed address stream */
+#define TEST_MAX_STEPS	10000000	/* Instructions run per program */
+
+/**************************** Type Definitions ******************************/
+
+/** State of the simulated DMA channel */
+typedef struct {
+	u32 Sar;		/**< Source address register */
+	u32 Dar;		/**< Destination address register */
+	u32 Ccr;		/**< Channel control register */
+	u32 Lc[2];		/**< Loop counter registers */
+	unsigned FifoHead;	/**< Next byte to store from the FIFO */
+	unsigned FifoTail;	/**< Next free byte of the FIFO */
+	unsigned SrcStreamPos;	/**< Bytes read from a fixed source */
+	unsigned DstStreamPos;	/**< Bytes written to a fixed destination */
+	int Event;		/**< Event signalled by DMASEV, -1 if none */
+} TestChan;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("  %s:%d: check failed: %s\r\n",	\
+			       __FILE__, __LINE__, #Cond);		\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes *****************************/
+
+static int TestGoldenBlock(void);
+static int TestGolden2D(void);
+static int TestSg(const char *Name, XDmaPs_ChanCtrl *ChanCtrl,
+		  XDmaPs_BD *Sg, unsigned SgCount, unsigned CacheLength);
+static int Test2D(const char *Name, XDmaPs_ChanCtrl *ChanCtrl,
+		  XDmaPs_2D *Xfer, unsigned CacheLength);
+static int TestErrors(void);
+static int TestRun(XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_BD *Sg,
+		   unsigned SgCount, XDmaPs_Prog *Prog);
+static int TestExec(const u8 *Prog, unsigned Len, unsigned CacheLength);
+static void TestSetChanCtrl(XDmaPs_ChanCtrl *ChanCtrl, unsigned BurstSize,
+			    unsigned BurstLen, unsigned SrcInc,
+			    unsigned DstInc);
+static void TestFillMem(void);
+static u8 TestStreamByte(unsigned Pos);
+static u32 TestLe32(const u8 *Bytes);
+
+/************************** Variable Definitions ****************************/
+
+static u8 Mem[TEST_MEM_SIZE];		/* Memory seen by the interpreter */
+static u8 RefMem[TEST_MEM_SIZE];	/* Expected memory after the run */
+static u8 DstStream[TEST_STREAM_SIZE];	/* Stores to a fixed destination */
+static u8 RefStream[TEST_STREAM_SIZE];	/* Expected fixed destination data */
+static u8 Fifo[TEST_STREAM_SIZE];	/* Data loaded and not yet stored */
+static TestChan Chan;
+static char ProgBuf[TEST_PROG_SIZE] __attribute__ ((aligned (32)));
+static XDmaPs_BD SgList[600];
+
+/****************************************************************************/
+/**
+*
+* Main function to call the generator tests.
+*
+* @param	None.
+*
+* @return	XST_SUCCESS to indicate success, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+int main(void)
+{
+	XDmaPs_ChanCtrl ChanCtrl;
+	XDmaPs_2D Xfer;
+	unsigned CacheLength;
+	unsigned Index;
+	int Status = XST_SUCCESS;
+
+	Status |= TestGoldenBlock();
+	Status |= TestGolden2D();
+
+	for (CacheLength = 0; CacheLength <= 32; CacheLength += 32) {
+		printf("Instruction cache line %u\r\n", CacheLength);
+
+		TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 1);
+		for (Index = 0; Index < 4; Index++) {
+			SgList[Index].SrcAddr = 0x1000 + Index * 0x100;
+			SgList[Index].DstAddr = 0x20000 + Index * 0x40;
+			SgList[Index].Length = 0x40;
+		}
+		Status |= TestSg("equal rows", &ChanCtrl, SgList, 4,
+				 CacheLength);
+
+		SgList[0].SrcAddr = 0x1003;
+		SgList[0].DstAddr = 0x20003;
+		SgList[0].Length = 101;
+		SgList[1].SrcAddr = 0x3001;
+		SgList[1].DstAddr = 0x30002;
+		SgList[1].Length = 77;
+		SgList[2].SrcAddr = 0x5000;
+		SgList[2].DstAddr = 0x40000;
+		SgList[2].Length = 9;
+		Status |= TestSg("unaligned blocks", &ChanCtrl, SgList, 3,
+				 CacheLength);
+
+		SgList[0].SrcAddr = 0x10000;
+		SgList[0].DstAddr = 0x200000;
+		SgList[0].Length = 300007;
+		Status |= TestSg("long block", &ChanCtrl, SgList, 1,
+				 CacheLength);
+
+		TestSetChanCtrl(&ChanCtrl, 8, 2, 1, 1);
+		for (Index = 0; Index < 600; Index++) {
+			SgList[Index].SrcAddr = 0x10000 + Index * 32;
+			SgList[Index].DstAddr = 0x200000 + Index * 48;
+			SgList[Index].Length = 24;
+		}
+		SgList[599].Length = 20;
+		Status |= TestSg("600 rows", &ChanCtrl, SgList, 600,
+				 CacheLength);
+
+		TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 0);
+		SgList[0].SrcAddr = 0x1002;
+		SgList[0].DstAddr = 0x80000;
+		SgList[0].Length = 130;
+		SgList[1].SrcAddr = 0x2000;
+		SgList[1].DstAddr = 0x80000;
+		SgList[1].Length = 64;
+		Status |= TestSg("fixed destination", &ChanCtrl, SgList, 2,
+				 CacheLength);
+
+		TestSetChanCtrl(&ChanCtrl, 4, 4, 0, 1);
+		SgList[0].SrcAddr = 0x80000;
+		SgList[0].DstAddr = 0x20001;
+		SgList[0].Length = 70;
+		SgList[1].SrcAddr = 0x80000;
+		SgList[1].DstAddr = 0x30000;
+		SgList[1].Length = 4000;
+		Status |= TestSg("fixed source", &ChanCtrl, SgList, 2,
+				 CacheLength);
+
+		TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 1);
+		Xfer.SrcAddr = 0x1000;
+		Xfer.DstAddr = 0x100000;
+		Xfer.RowLength = 640;
+		Xfer.Rows = 300;
+		Xfer.SrcStride = 1024;
+		Xfer.DstStride = 640;
+		Status |= Test2D("2D", &ChanCtrl, &Xfer, CacheLength);
+
+		Xfer.SrcAddr = 0x1002;
+		Xfer.Rows = 5;
+		Status |= Test2D("2D unaligned rows", &ChanCtrl, &Xfer,
+				 CacheLength);
+
+		Xfer.SrcAddr = 0x10000;
+		Xfer.DstAddr = 0x200000;
+		Xfer.RowLength = 16 * 256 * 60;
+		Xfer.Rows = 3;
+		Xfer.SrcStride = 0x40000;
+		Xfer.DstStride = 0x40000;
+		Status |= Test2D("2D rows too long to loop", &ChanCtrl, &Xfer,
+				 CacheLength);
+	}
+
+	Status |= TestErrors();
+
+	if (Status != XST_SUCCESS) {
+		printf("DMA program generator test Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	printf("Successfully ran DMA program generator test\r\n");
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Check the program of a single aligned block against hand assembled code.
+*
+* @param	None.
+*
+* @return	XST_SUCCESS if the bytes match, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int TestGoldenBlock(void)
+{
+	static const u8 Expected[] = {
+		0xBC, 0x00, 0x00, 0x10, 0x00, 0x00,	/* DMAMOV SAR, 0x1000 */
+		0xBC, 0x02, 0x00, 0x20, 0x00, 0x00,	/* DMAMOV DAR, 0x2000 */
+		0xBC, 0x01, 0x35, 0x40, 0x0D, 0x00,	/* DMAMOV CCR, 4x4 inc */
+		0x20, 0x03,				/* DMALP lc0, 4 */
+		0x04,					/* DMALD */
+		0x08,					/* DMAST */
+		0x38, 0x02,				/* DMALPEND lc0 */
+		0x34, TEST_CHANNEL << 3,		/* DMASEV */
+		0x00,					/* DMAEND */
+	};
+	XDmaPs_ChanCtrl ChanCtrl;
+	XDmaPs_Prog Prog;
+	XDmaPs_BD Bd;
+
+	printf("Single block program\r\n");
+
+	TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 1);
+	TEST_CHECK(XDmaPs_ToCCRValue(&ChanCtrl) == 0x000D4035);
+
+	Bd.SrcAddr = 0x1000;
+	Bd.DstAddr = 0x2000;
+	Bd.Length = 64;
+	XDmaPs_ProgInit(&Prog, ProgBuf, sizeof(ProgBuf), 0);
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, &ChanCtrl, &Bd, 1) ==
+		   XST_SUCCESS);
+	TEST_CHECK(Prog.Len == sizeof(Expected));
+	TEST_CHECK(memcmp(ProgBuf, Expected, sizeof(Expected)) == 0);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Check the program of a looped 2D transfer against hand assembled code.
+*
+* @param	None.
+*
+* @return	XST_SUCCESS if the bytes match, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int TestGolden2D(void)
+{
+	static const u8 Expected[] = {
+		0xBC, 0x00, 0x00, 0x10, 0x00, 0x00,	/* DMAMOV SAR, 0x1000 */
+		0xBC, 0x02, 0x00, 0x20, 0x00, 0x00,	/* DMAMOV DAR, 0x2000 */
+		0xBC, 0x01, 0x35, 0x40, 0x0D, 0x00,	/* DMAMOV CCR, 4x4 inc */
+		0x22, 0x02,				/* DMALP lc1, 3 */
+		0x20, 0x01,				/* DMALP lc0, 2 */
+		0x04,					/* DMALD */
+		0x08,					/* DMAST */
+		0x38, 0x02,				/* DMALPEND lc0 */
+		0x54, 0x10, 0x00,			/* DMAADDH SAR, 16 */
+		0x56, 0x20, 0x00,			/* DMAADDH DAR, 32 */
+		0x3C, 0x0C,				/* DMALPEND lc1 */
+		0x34, TEST_CHANNEL << 3,		/* DMASEV */
+		0x00,					/* DMAEND */
+	};
+	XDmaPs_ChanCtrl ChanCtrl;
+	XDmaPs_Prog Prog;
+	XDmaPs_2D Xfer;
+
+	printf("2D program\r\n");
+
+	TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 1);
+	Xfer.SrcAddr = 0x1000;
+	Xfer.DstAddr = 0x2000;
+	Xfer.RowLength = 32;
+	Xfer.Rows = 3;
+	Xfer.SrcStride = 48;
+	Xfer.DstStride = 64;
+	XDmaPs_ProgInit(&Prog, ProgBuf, sizeof(ProgBuf), 0);
+	TEST_CHECK(XDmaPs_Prog2D(&Prog, TEST_CHANNEL, &ChanCtrl, &Xfer) ==
+		   XST_SUCCESS);
+	TEST_CHECK(Prog.Len == sizeof(Expected));
+	TEST_CHECK(memcmp(ProgBuf, Expected, sizeof(Expected)) == 0);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Generate and run the program of a scatter-gather list.
+*
+* @param	Name is the name of the test case.
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	Sg is the scatter-gather list.
+* @param	SgCount is the number of segments.
+* @param	CacheLength is the instruction cache line length, 0 for none.
+*
+* @return	XST_SUCCESS if the memory is as expected, otherwise
+*		XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int TestSg(const char *Name, XDmaPs_ChanCtrl *ChanCtrl,
+		  XDmaPs_BD *Sg, unsigned SgCount, unsigned CacheLength)
+{
+	XDmaPs_Prog Prog;
+
+	printf("  %s\r\n", Name);
+
+	XDmaPs_ProgInit(&Prog, ProgBuf, sizeof(ProgBuf), CacheLength);
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, ChanCtrl, Sg,
+				 SgCount) == XST_SUCCESS);
+
+	return TestRun(ChanCtrl, Sg, SgCount, &Prog);
+}
+
+/****************************************************************************/
+/**
+*
+* Generate and run the program of a 2D transfer.
+*
+* @param	Name is the name of the test case.
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	Xfer is the 2D transfer.
+* @param	CacheLength is the instruction cache line length, 0 for none.
+*
+* @return	XST_SUCCESS if the memory is as expected, otherwise
+*		XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int Test2D(const char *Name, XDmaPs_ChanCtrl *ChanCtrl,
+		  XDmaPs_2D *Xfer, unsigned CacheLength)
+{
+	XDmaPs_Prog Prog;
+	unsigned Row;
+
+	printf("  %s\r\n", Name);
+
+	for (Row = 0; Row < Xfer->Rows; Row++) {
+		SgList[Row].SrcAddr = Xfer->SrcAddr +
+			(ChanCtrl->SrcInc ? Row * Xfer->SrcStride : 0);
+		SgList[Row].DstAddr = Xfer->DstAddr +
+			(ChanCtrl->DstInc ? Row * Xfer->DstStride : 0);
+		SgList[Row].Length = Xfer->RowLength;
+	}
+
+	XDmaPs_ProgInit(&Prog, ProgBuf, sizeof(ProgBuf), CacheLength);
+	TEST_CHECK(XDmaPs_Prog2D(&Prog, TEST_CHANNEL, ChanCtrl, Xfer) ==
+		   XST_SUCCESS);
+
+	return TestRun(ChanCtrl, SgList, Xfer->Rows, &Prog);
+}
+
+/****************************************************************************/
+/**
+*
+* Check that invalid commands and a too small buffer are refused.
+*
+* @param	None.
+*
+* @return	XST_SUCCESS if all are refused, otherwise XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int TestErrors(void)
+{
+	XDmaPs_ChanCtrl ChanCtrl;
+	XDmaPs_Prog Prog;
+	XDmaPs_2D Xfer;
+	XDmaPs_BD Bd[2];
+
+	printf("Invalid commands\r\n");
+
+	TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 1);
+	Bd[0].SrcAddr = 0x1000;
+	Bd[0].DstAddr = 0x2000;
+	Bd[0].Length = 64;
+	Bd[1].SrcAddr = 0x1003;
+	Bd[1].DstAddr = 0x3001;
+	Bd[1].Length = 0;
+
+	XDmaPs_ProgInit(&Prog, ProgBuf, sizeof(ProgBuf), 0);
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, &ChanCtrl, Bd, 0) ==
+		   XST_INVALID_PARAM);
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, &ChanCtrl, Bd, 2) ==
+		   XST_INVALID_PARAM);
+
+	/* bursts of different sizes on both sides */
+	ChanCtrl.DstBurstLen = 2;
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, &ChanCtrl, Bd, 1) ==
+		   XST_INVALID_PARAM);
+
+	/* unaligned fixed address */
+	TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 0);
+	Bd[0].DstAddr = 0x2002;
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, &ChanCtrl, Bd, 1) ==
+		   XST_INVALID_PARAM);
+
+	/* rows overlapping in the destination */
+	TestSetChanCtrl(&ChanCtrl, 4, 4, 1, 1);
+	Xfer.SrcAddr = 0x1000;
+	Xfer.DstAddr = 0x2000;
+	Xfer.RowLength = 64;
+	Xfer.Rows = 2;
+	Xfer.SrcStride = 64;
+	Xfer.DstStride = 32;
+	TEST_CHECK(XDmaPs_Prog2D(&Prog, TEST_CHANNEL, &ChanCtrl, &Xfer) ==
+		   XST_INVALID_PARAM);
+
+	/* the program does not fit, no byte is written past the buffer */
+	Bd[0].DstAddr = 0x2000;
+	memset(ProgBuf, 0xA5, sizeof(ProgBuf));
+	XDmaPs_ProgInit(&Prog, ProgBuf, 20, 0);
+	TEST_CHECK(XDmaPs_ProgSg(&Prog, TEST_CHANNEL, &ChanCtrl, Bd, 1) ==
+		   XST_BUFFER_TOO_SMALL);
+	TEST_CHECK((u8)ProgBuf[20] == 0xA5);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Run a generated program and compare the memory with a plain copy of the
+* segments. Data read from a fixed source address is a byte stream given by
+* TestStreamByte(), and data written to a fixed destination address is
+* collected in DstStream.
+*
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	Sg is the scatter-gather list the program transfers.
+* @param	SgCount is the number of segments.
+* @param	Prog is the generated program.
+*
+* @return	XST_SUCCESS if the memory is as expected, otherwise
+*		XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int TestRun(XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_BD *Sg,
+		   unsigned SgCount, XDmaPs_Prog *Prog)
+{
+	unsigned SrcPos = 0;
+	unsigned DstPos = 0;
+	unsigned Index;
+	unsigned Byte;
+	u8 Data;
+
+	TestFillMem();
+	memcpy(RefMem, Mem, sizeof(Mem));
+	memset(DstStream, 0, sizeof(DstStream));
+	memset(RefStream, 0, sizeof(RefStream));
+
+	for (Index = 0; Index < SgCount; Index++) {
+		for (Byte = 0; Byte < Sg[Index].Length; Byte++) {
+			if (ChanCtrl->SrcInc)
+				Data = RefMem[Sg[Index].SrcAddr + Byte];
+			else
+				Data = TestStreamByte(SrcPos++);
+
+			if (ChanCtrl->DstInc)
+				RefMem[Sg[Index].DstAddr + Byte] = Data;
+			else
+				RefStream[DstPos++] = Data;
+		}
+	}
+
+	TEST_CHECK(TestExec((const u8 *)Prog->Buf, Prog->Len,
+			    Prog->CacheLength) == XST_SUCCESS);
+	TEST_CHECK(Chan.Event == TEST_CHANNEL);
+	TEST_CHECK(Chan.FifoHead == Chan.FifoTail);
+	TEST_CHECK(Chan.SrcStreamPos == SrcPos);
+	TEST_CHECK(Chan.DstStreamPos == DstPos);
+	TEST_CHECK(memcmp(Mem, RefMem, sizeof(Mem)) == 0);
+	TEST_CHECK(memcmp(DstStream, RefStream, sizeof(DstStream)) == 0);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Interpret a PL330 program with the instructions the generator emits. The
+* loop bodies of DMALD/DMAST only are checked to be within one instruction
+* cache line.
+*
+* @param	Prog is the program.
+* @param	Len is the length of the program in bytes.
+* @param	CacheLength is the instruction cache line length, 0 for none.
+*
+* @return	XST_SUCCESS if the program ran to its DMAEND, otherwise
+*		XST_FAILURE.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int TestExec(const u8 *Prog, unsigned Len, unsigned CacheLength)
+{
+	unsigned Pc = 0;
+	unsigned Steps;
+	unsigned Size;
+	unsigned Beats;
+	unsigned Beat;
+	unsigned Byte;
+	unsigned Lc;
+	u32 Addr;
+	u32 Ccr;
+	u8 Op;
+
+	memset(&Chan, 0, sizeof(Chan));
+	Chan.Event = -1;
+
+	for (Steps = 0; Steps < TEST_MAX_STEPS; Steps++) {
+		TEST_CHECK(Pc < Len);
+		Op = Prog[Pc];
+
+		if (Op == 0x00) {			/* DMAEND */
+			TEST_CHECK(Pc + 1 == Len);
+			return XST_SUCCESS;
+		} else if (Op == 0x18) {		/* DMANOP */
+			Pc += 1;
+		} else if (Op == 0xBC) {		/* DMAMOV */
+			TEST_CHECK(Pc + 6 <= Len);
+			if (Prog[Pc + 1] == 0)
+				Chan.Sar = TestLe32(&Prog[Pc + 2]);
+			else if (Prog[Pc + 1] == 1)
+				Chan.Ccr = TestLe32(&Prog[Pc + 2]);
+			else if (Prog[Pc + 1] == 2)
+				Chan.Dar = TestLe32(&Prog[Pc + 2]);
+			else
+				TEST_CHECK(0);
+			Pc += 6;
+		} else if ((Op & 0xFD) == 0x20) {	/* DMALP */
+			Chan.Lc[(Op >> 1) & 1] = Prog[Pc + 1];
+			Pc += 2;
+		} else if ((Op & 0xFB) == 0x38) {	/* DMALPEND */
+			Lc = (Op >> 2) & 1;
+			if (CacheLength != 0 && Lc == 0 &&
+			    Prog[Pc + 1] == 2)
+				TEST_CHECK((Pc - 2) / CacheLength ==
+					   (Pc + 1) / CacheLength);
+			if (Chan.Lc[Lc] != 0) {
+				Chan.Lc[Lc]--;
+				TEST_CHECK(Prog[Pc + 1] <= Pc);
+				Pc -= Prog[Pc + 1];
+			} else {
+				Pc += 2;
+			}
+		} else if ((Op & 0xFD) == 0x54) {	/* DMAADDH */
+			Addr = Prog[Pc + 1] | (Prog[Pc + 2] << 8);
+			if (Op & 2)
+				Chan.Dar += Addr;
+			else
+				Chan.Sar += Addr;
+			Pc += 3;
+		} else if (Op == 0x04) {		/* DMALD */
+			Ccr = Chan.Ccr;
+			Size = 1U << ((Ccr >> 1) & 0x7);
+			Beats = ((Ccr >> 4) & 0xF) + 1;
+			for (Beat = 0; Beat < Beats; Beat++) {
+				for (Byte = 0; Byte < Size; Byte++) {
+					TEST_CHECK(Chan.FifoTail <
+						   sizeof(Fifo));
+					if (Ccr & 1) {
+						TEST_CHECK(Chan.Sar <
+							   TEST_MEM_SIZE);
+						Fifo[Chan.FifoTail++] =
+							Mem[Chan.Sar++];
+					} else {
+						Fifo[Chan.FifoTail++] =
+							TestStreamByte(
+							Chan.SrcStreamPos++);
+					}
+				}
+			}
+			Pc += 1;
+		} else if (Op == 0x08) {		/* DMAST */
+			Ccr = Chan.Ccr;
+			Size = 1U << ((Ccr >> 15) & 0x7);
+			Beats = ((Ccr >> 18) & 0xF) + 1;
+			for (Beat = 0; Beat < Beats; Beat++) {
+				for (Byte = 0; Byte < Size; Byte++) {
+					TEST_CHECK(Chan.FifoHead <
+						   Chan.FifoTail);
+					if (Ccr & (1U << 14)) {
+						TEST_CHECK(Chan.Dar <
+							   TEST_MEM_SIZE);
+						Mem[Chan.Dar++] =
+							Fifo[Chan.FifoHead++];
+					} else {
+						TEST_CHECK(Chan.DstStreamPos <
+							   TEST_STREAM_SIZE);
+						DstStream[Chan.DstStreamPos++] =
+							Fifo[Chan.FifoHead++];
+					}
+				}
+			}
+			if (Chan.FifoHead == Chan.FifoTail) {
+				Chan.FifoHead = 0;
+				Chan.FifoTail = 0;
+			}
+			Pc += 1;
+		} else if (Op == 0x34) {		/* DMASEV */
+			Chan.Event = Prog[Pc + 1] >> 3;
+			Pc += 2;
+		} else {
+			printf("  unexpected instruction 0x%02x at %u\r\n",
+			       Op, Pc);
+			return XST_FAILURE;
+		}
+	}
+
+	printf("  program did not end\r\n");
+	return XST_FAILURE;
+}
+
+/****************************************************************************/
+/**
+*
+* Set up a channel control with the same burst on both sides.
+*
+* @param	ChanCtrl is the channel control to set up.
+* @param	BurstSize is the burst size in bytes.
+* @param	BurstLen is the burst length in beats.
+* @param	SrcInc is 1 for an incrementing source address.
+* @param	DstInc is 1 for an incrementing destination address.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void TestSetChanCtrl(XDmaPs_ChanCtrl *ChanCtrl, unsigned BurstSize,
+			    unsigned BurstLen, unsigned SrcInc,
+			    unsigned DstInc)
+{
+	memset(ChanCtrl, 0, sizeof(*ChanCtrl));
+	ChanCtrl->SrcBurstSize = BurstSize;
+	ChanCtrl->SrcBurstLen = BurstLen;
+	ChanCtrl->SrcInc = SrcInc;
+	ChanCtrl->DstBurstSize = BurstSize;
+	ChanCtrl->DstBurstLen = BurstLen;
+	ChanCtrl->DstInc = DstInc;
+}
+
+/****************************************************************************/
+/**
+*
+* Fill the simulated memory with a pattern that differs from byte to byte.
+*
+* @param	None.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void TestFillMem(void)
+{
+	unsigned Index;
+
+	for (Index = 0; Index < TEST_MEM_SIZE; Index++)
+		Mem[Index] = (u8)((Index * 13) ^ (Index >> 8));
+}
+
+/****************************************************************************/
+/**
+*
+* Byte stream read from a fixed source address.
+*
+* @param	Pos is the position in the stream.
+*
+* @return	The byte at Pos.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u8 TestStreamByte(unsigned Pos)
+{
+	return (u8)(Pos * 7 + 1);
+}
+
+/****************************************************************************/
+/**
+*
+* Read a little endian 32-bit immediate of an instruction.
+*
+* @param	Bytes is the first byte of the immediate.
+*
+* @return	The immediate.
+*
+* @note		None.
+*
+*****************************************************************************/
+static u32 TestLe32(const u8 *Bytes)
+{
+	return (u32)Bytes[0] | ((u32)Bytes[1] << 8) |
+		((u32)Bytes[2] << 16) | ((u32)Bytes[3] << 24);
+}
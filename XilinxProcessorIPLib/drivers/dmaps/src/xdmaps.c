@@ -70,6 +70,9 @@
 * 2.2  mus    12/08/16   Remove definition of INLINE macro to avoid re-definition,
 *                         since it is being defined in xil_io.h
 * 2.3 kpc     14/10/16   Fixed the compiler error when optimization O0 is used.
+* 2.4 ag      10/19/26   Added the DMA program cache, XDmaPs_StartSg() and
+*                        XDmaPs_Start2D(). XDmaPs_ToCCRValue() moved to
+*                        xdmaps_prog.c.
 * </pre>
 *
 *****************************************************************************/
@@ -96,6 +99,13 @@
 
 /**************************** Type Definitions ******************************/
 
+/*
+ * Offsets of the SAR and DAR immediates in a program from
+ * XDmaPs_BuildDmaProg(), which starts with DMAMOV SAR and DMAMOV DAR
+ */
+#define XDMAPS_PROG_SAR_IMM	2
+#define XDMAPS_PROG_DAR_IMM	8
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 
@@ -115,6 +125,15 @@ static int XDmaPs_BuildDmaProg(unsigned Channel, XDmaPs_Cmd *Cmd,
 
 static void XDmaPs_Print_DmaProgBuf(char *Buf, int Length);
 
+static XDmaPs_ProgCacheEntry *XDmaPs_ProgCache_Get(
+				XDmaPs_ChannelData *ChanData,
+				XDmaPs_Cmd *Cmd, int *Hit);
+static void XDmaPs_ProgRelease(XDmaPs_ChannelData *ChanData, void *Buf);
+static int XDmaPs_Exec(XDmaPs *InstPtr, unsigned int Channel,
+			XDmaPs_Cmd *Cmd, u32 DmaProg);
+static int XDmaPs_StartProg(XDmaPs *InstPtr, unsigned int Channel,
+			     XDmaPs_Cmd *Cmd, XDmaPs_Prog *Prog);
+
 
 
 /************************** Variable Definitions ****************************/
@@ -324,8 +343,8 @@ void XDmaPs_FaultISR(XDmaPs *InstPtr)
 			if (!ChanData->HoldDmaProg) {
 				DmaProgBuf = (void *)DmaCmd->GeneratedDmaProg;
 				if (DmaProgBuf)
-					XDmaPs_BufPool_Free(ChanData->ProgBufPool,
-							     DmaProgBuf);
+					XDmaPs_ProgRelease(ChanData,
+							   DmaProgBuf);
 				DmaCmd->GeneratedDmaProg = NULL;
 			}
 
@@ -749,142 +768,6 @@ static INLINE int XDmaPs_Instr_DMAWMB(char *DmaProg)
 	return 1;
 }
 
-/****************************************************************************/
-/**
-*
-* Conversion function from the endian swap size to the bit encoding of the CCR
-*
-* @param	EndianSwapSize is the endian swap size, in terms of bits, it
-*		could be 8, 16, 32, 64, or 128(We are using DMA assembly syntax)
-*
-* @return	The endian swap size bit encoding for the CCR.
-*
-* @note	None.
-*
-*****************************************************************************/
-static INLINE unsigned XDmaPs_ToEndianSwapSizeBits(unsigned int EndianSwapSize)
-{
-	switch (EndianSwapSize) {
-	case 0:
-	case 8:
-		return 0;
-	case 16:
-		return 1;
-	case 32:
-		return 2;
-	case 64:
-		return 3;
-	case 128:
-		return 4;
-	default:
-		return 0;
-	}
-
-}
-
-/****************************************************************************/
-/**
-*
-* Conversion function from the burst size to the bit encoding of the CCR
-*
-* @param	BurstSize is the burst size. It's the data width.
-*		In terms of bytes, it could be 1, 2, 4, 8, 16, 32, 64, or 128.
-*		It must be no larger than the bus width.
-*		(We are using DMA assembly syntax.)
-*
-* @note		None.
-*
-*****************************************************************************/
-static INLINE unsigned XDmaPs_ToBurstSizeBits(unsigned BurstSize)
-{
-	switch (BurstSize) {
-	case 1:
-		return 0;
-	case 2:
-		return 1;
-	case 4:
-		return 2;
-	case 8:
-		return 3;
-	case 16:
-		return 4;
-	case 32:
-		return 5;
-	case 64:
-		return 6;
-	case 128:
-		return 7;
-	default:
-		return 0;
-	}
-}
-
-
-/****************************************************************************/
-/**
-*
-* Conversion function from PL330 bus transfer descriptors to CCR value. All the
-* values passed to the functions are in terms of assembly languages, not in
-* terms of the register bit encoding.
-*
-* @param	ChanCtrl is the Instance of XDmaPs_ChanCtrl.
-*
-* @return	The 32-bit CCR value.
-*
-* @note		None.
-*
-*****************************************************************************/
-u32 XDmaPs_ToCCRValue(XDmaPs_ChanCtrl *ChanCtrl)
-{
-	/*
-	 * Channel Control Register encoding
-	 * [31:28] - endian_swap_size
-	 * [27:25] - dst_cache_ctrl
-	 * [24:22] - dst_prot_ctrl
-	 * [21:18] - dst_burst_len
-	 * [17:15] - dst_burst_size
-	 * [14]    - dst_inc
-	 * [13:11] - src_cache_ctrl
-	 * [10:8] - src_prot_ctrl
-	 * [7:4]  - src_burst_len
-	 * [3:1]  - src_burst_size
-	 * [0]     - src_inc
-	 */
-
-	unsigned es =
-		XDmaPs_ToEndianSwapSizeBits(ChanCtrl->EndianSwapSize);
-
-	unsigned dst_burst_size =
-		XDmaPs_ToBurstSizeBits(ChanCtrl->DstBurstSize);
-	unsigned dst_burst_len = (ChanCtrl->DstBurstLen - 1) & 0x0F;
-	unsigned dst_cache_ctrl = (ChanCtrl->DstCacheCtrl & 0x03)
-		| ((ChanCtrl->DstCacheCtrl & 0x08) >> 1);
-	unsigned dst_prot_ctrl = ChanCtrl->DstProtCtrl & 0x07;
-	unsigned dst_inc_bit = ChanCtrl->DstInc & 1;
-
-	unsigned src_burst_size =
-		XDmaPs_ToBurstSizeBits(ChanCtrl->SrcBurstSize);
-	unsigned src_burst_len = (ChanCtrl->SrcBurstLen - 1) & 0x0F;
-	unsigned src_cache_ctrl = (ChanCtrl->SrcCacheCtrl & 0x03)
-		| ((ChanCtrl->SrcCacheCtrl & 0x08) >> 1);
-	unsigned src_prot_ctrl = ChanCtrl->SrcProtCtrl & 0x07;
-	unsigned src_inc_bit = ChanCtrl->SrcInc & 1;
-
-	u32 ccr_value = (es << 28)
-		| (dst_cache_ctrl << 25)
-		| (dst_prot_ctrl << 22)
-		| (dst_burst_len << 18)
-		| (dst_burst_size << 15)
-		| (dst_inc_bit << 14)
-		| (src_cache_ctrl << 11)
-		| (src_prot_ctrl << 8)
-		| (src_burst_len << 4)
-		| (src_burst_size << 1)
-		| (src_inc_bit);
-
-	return ccr_value;
-}
-
 /****************************************************************************/
 /**
 * Construct a loop with only DMALD and DMAST as the body using loop counter 0.
@@ -1338,6 +1221,8 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 	int ProgLen;
 	XDmaPs_ChannelData *ChanData;
 	XDmaPs_ChanCtrl *ChanCtrl;
+	XDmaPs_ProgCacheEntry *Entry = NULL;
+	int Hit = 0;
 
 	Xil_AssertNonvoid(InstPtr != NULL);
 	Xil_AssertNonvoid(Cmd != NULL);
@@ -1366,7 +1251,29 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 		return XST_FAILURE;
 	}
 
-	Buf = XDmaPs_BufPool_Allocate(ChanData->ProgBufPool);
+	if (ChanData->ProgCacheEnabled)
+		Entry = XDmaPs_ProgCache_Get(ChanData, Cmd, &Hit);
+
+	if (Hit) {
+		/* same shape, only the addresses change */
+		XDmaPs_Memcpy4(Entry->Buf + XDMAPS_PROG_SAR_IMM,
+				(char *)&Cmd->BD.SrcAddr);
+		XDmaPs_Memcpy4(Entry->Buf + XDMAPS_PROG_DAR_IMM,
+				(char *)&Cmd->BD.DstAddr);
+		Xil_DCacheFlushRange((u32)Entry->Buf,
+				     XDMAPS_PROG_DAR_IMM + 4);
+
+		Cmd->GeneratedDmaProg = Entry->Buf;
+		Cmd->GeneratedDmaProgLength = Entry->Len;
+		ChanData->ProgCacheHits++;
+
+		return XST_SUCCESS;
+	}
+
+	if (Entry != NULL)
+		Buf = Entry->Buf;
+	else
+		Buf = XDmaPs_BufPool_Allocate(ChanData->ProgBufPool);
 	if (Buf == NULL) {
 		return XST_FAILURE;
 	}
@@ -1383,12 +1290,20 @@ int XDmaPs_GenDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 
 	if (ProgLen <= 0) {
 		/* something wrong, release the buffer */
-		XDmaPs_BufPool_Free(ChanData->ProgBufPool, Buf);
+		if (Entry != NULL)
+			Entry->Valid = 0;
+		XDmaPs_ProgRelease(ChanData, Buf);
 		Cmd->GeneratedDmaProgLength = 0;
 		Cmd->GeneratedDmaProg = NULL;
 		return XST_FAILURE;
 	}
 
+	if (Entry != NULL) {
+		Entry->Len = ProgLen;
+		Entry->Valid = 1;
+		ChanData->ProgCacheMisses++;
+	}
+
 	return XST_SUCCESS;
 }
 
@@ -1424,7 +1339,7 @@ int XDmaPs_FreeDmaProg(XDmaPs *InstPtr, unsigned int Channel, XDmaPs_Cmd *Cmd)
 	ChanData = InstPtr->Chans + Channel;
 
 	if (Buf) {
-		XDmaPs_BufPool_Free(ChanData->ProgBufPool, Buf);
+		XDmaPs_ProgRelease(ChanData, Buf);
 		Cmd->GeneratedDmaProg = 0;
 		Cmd->GeneratedDmaProgLength = 0;
 	}
@@ -1463,7 +1378,6 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 {
 	int Status;
 	u32 DmaProg = 0;
-	u32 Inten;
 
 	Xil_AssertNonvoid(InstPtr != NULL);
 	Xil_AssertNonvoid(Cmd != NULL);
@@ -1488,18 +1402,6 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 		DmaProg = (u32)Cmd->GeneratedDmaProg;
 
 	if (DmaProg) {
-		/* enable the interrupt */
-		Inten = XDmaPs_ReadReg(InstPtr->Config.BaseAddress,
-					XDMAPS_INTEN_OFFSET);
-		Inten |= 0x01 << Channel; /* set the correpsonding bit */
-		XDmaPs_WriteReg(InstPtr->Config.BaseAddress,
-				 XDMAPS_INTEN_OFFSET,
-				 Inten);
-		Inten = XDmaPs_ReadReg(InstPtr->Config.BaseAddress,
-				XDMAPS_INTEN_OFFSET);
-
-		InstPtr->Chans[Channel].DmaCmdToHw = Cmd;
-
 		if (Cmd->ChanCtrl.SrcInc) {
 			Xil_DCacheFlushRange(Cmd->BD.SrcAddr, Cmd->BD.Length);
 		}
@@ -1508,8 +1410,7 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 					Cmd->BD.Length);
 		}
 
-		Status = XDmaPs_Exec_DMAGO(InstPtr->Config.BaseAddress,
-					    Channel, DmaProg);
+		Status = XDmaPs_Exec(InstPtr, Channel, Cmd, DmaProg);
 	}
 	else {
 		InstPtr->Chans[Channel].DmaCmdToHw = NULL;
@@ -1519,6 +1420,172 @@ int XDmaPs_Start(XDmaPs *InstPtr, unsigned int Channel,
 	return Status;
 }
 
+/****************************************************************************/
+/**
+*
+* Enable or disable the DMA program cache of a channel. With the cache
+* enabled, the programs generated for the commands of the channel are kept
+* by transfer shape and reused with patched addresses by later commands of
+* the same shape.
+*
+* @param	InstPtr is the DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Enable is 1 to enable the cache and 0 to disable it. Disabling
+*		drops the cached programs.
+*
+* @return	- XST_SUCCESS on success.
+* 		- XST_FAILURE if the channel number is invalid.
+*
+* @note		A program from the cache that is held by a command after
+*		XDmaPs_Start() with HoldDmaProg set stays with the command
+*		until XDmaPs_FreeDmaProg() is called.
+*
+*****************************************************************************/
+int XDmaPs_SetProgCache(XDmaPs *InstPtr, unsigned int Channel, int Enable)
+{
+	XDmaPs_ChannelData *ChanData;
+	int Index;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	ChanData = InstPtr->Chans + Channel;
+	ChanData->ProgCacheEnabled = Enable;
+
+	if (!Enable) {
+		for (Index = 0; Index < XDMAPS_PROG_CACHE_ENTRIES; Index++)
+			ChanData->ProgCache[Index].Valid = 0;
+	}
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Start a scatter-gather DMA transfer. All blocks of the list are transferred
+* by one DMA program with the channel control of the command, and the done
+* handler is called once when the last block is done.
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command. Only its ChanCtrl is used as input.
+*		Its UserDmaProg is set to the generated program.
+* @param	Sg is the list of blocks.
+* @param	SgCount is the number of blocks in Sg.
+* @param	Prog is the program buffer, set up with XDmaPs_ProgInit()
+*		and the CacheLength of the instance. It must stay valid
+*		until the transfer is done.
+*
+* @return
+*		- XST_SUCCESS on success
+*		- XST_DEVICE_BUSY if DMA is busy
+*		- XST_INVALID_PARAM if the command or the list is invalid
+*		- XST_BUFFER_TOO_SMALL if the program does not fit in Prog
+*		- XST_FAILURE on other failures
+*
+* @note		None.
+*
+****************************************************************************/
+int XDmaPs_StartSg(XDmaPs *InstPtr, unsigned int Channel,
+		   XDmaPs_Cmd *Cmd, XDmaPs_BD *Sg, unsigned int SgCount,
+		   XDmaPs_Prog *Prog)
+{
+	int Status;
+	unsigned int Index;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid(Sg != NULL);
+	Xil_AssertNonvoid(Prog != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	Cmd->DmaStatus = XST_FAILURE;
+
+	if (XDmaPs_IsActive(InstPtr, Channel))
+		return XST_DEVICE_BUSY;
+
+	Status = XDmaPs_ProgSg(Prog, Channel, &Cmd->ChanCtrl, Sg, SgCount);
+	if (Status != XST_SUCCESS)
+		return Status;
+
+	for (Index = 0; Index < SgCount; Index++) {
+		if (Cmd->ChanCtrl.SrcInc)
+			Xil_DCacheFlushRange(Sg[Index].SrcAddr,
+					     Sg[Index].Length);
+		if (Cmd->ChanCtrl.DstInc)
+			Xil_DCacheInvalidateRange(Sg[Index].DstAddr,
+						  Sg[Index].Length);
+	}
+
+	return XDmaPs_StartProg(InstPtr, Channel, Cmd, Prog);
+}
+
+/****************************************************************************/
+/**
+*
+* Start a 2D DMA transfer of Xfer->Rows rows of Xfer->RowLength bytes with
+* the channel control of the command. The done handler is called once when
+* the last row is done.
+*
+* @param	InstPtr is then DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command. Only its ChanCtrl is used as input.
+*		Its UserDmaProg is set to the generated program.
+* @param	Xfer is the 2D transfer.
+* @param	Prog is the program buffer, set up with XDmaPs_ProgInit()
+*		and the CacheLength of the instance. It must stay valid
+*		until the transfer is done.
+*
+* @return
+*		- XST_SUCCESS on success
+*		- XST_DEVICE_BUSY if DMA is busy
+*		- XST_INVALID_PARAM if the command or the transfer is invalid
+*		- XST_BUFFER_TOO_SMALL if the program does not fit in Prog
+*		- XST_FAILURE on other failures
+*
+* @note		None.
+*
+****************************************************************************/
+int XDmaPs_Start2D(XDmaPs *InstPtr, unsigned int Channel,
+		   XDmaPs_Cmd *Cmd, XDmaPs_2D *Xfer, XDmaPs_Prog *Prog)
+{
+	int Status;
+
+	Xil_AssertNonvoid(InstPtr != NULL);
+	Xil_AssertNonvoid(Cmd != NULL);
+	Xil_AssertNonvoid(Xfer != NULL);
+	Xil_AssertNonvoid(Prog != NULL);
+
+	if (Channel >= XDMAPS_CHANNELS_PER_DEV)
+		return XST_FAILURE;
+
+	Cmd->DmaStatus = XST_FAILURE;
+
+	if (XDmaPs_IsActive(InstPtr, Channel))
+		return XST_DEVICE_BUSY;
+
+	Status = XDmaPs_Prog2D(Prog, Channel, &Cmd->ChanCtrl, Xfer);
+	if (Status != XST_SUCCESS)
+		return Status;
+
+	/* the rows lie within the span from the first to the last row */
+	if (Cmd->ChanCtrl.SrcInc)
+		Xil_DCacheFlushRange(Xfer->SrcAddr,
+				     (Xfer->Rows - 1) * Xfer->SrcStride +
+				     Xfer->RowLength);
+	if (Cmd->ChanCtrl.DstInc)
+		Xil_DCacheInvalidateRange(Xfer->DstAddr,
+					  (Xfer->Rows - 1) * Xfer->DstStride +
+					  Xfer->RowLength);
+
+	return XDmaPs_StartProg(InstPtr, Channel, Cmd, Prog);
+}
+
 /****************************************************************************/
 /**
 *
@@ -1808,6 +1875,177 @@ static void XDmaPs_BufPool_Free(XDmaPs_ProgBuf *Pool, void *Buf)
 	}
 }
 
+/****************************************************************************/
+/**
+*
+* Find a program in the cache of a channel for the shape of a command. An
+* entry with the same shape that is not handed out is a hit. Otherwise a
+* free entry, or the least recently used one that is not handed out, is
+* given for the new program.
+*
+* @param	ChanData is the channel data.
+* @param	Cmd is the DMA command.
+* @param	Hit is set to 1 for a hit and to 0 otherwise.
+*
+* @return	The entry, marked busy, or NULL if all entries are handed out.
+*
+* @note		None.
+*
+*****************************************************************************/
+static XDmaPs_ProgCacheEntry *XDmaPs_ProgCache_Get(
+				XDmaPs_ChannelData *ChanData,
+				XDmaPs_Cmd *Cmd, int *Hit)
+{
+	XDmaPs_ProgCacheEntry *Entry;
+	XDmaPs_ProgCacheEntry *Victim = NULL;
+	XDmaPs_ChanCtrl *ChanCtrl = &Cmd->ChanCtrl;
+	u32 Ccr = XDmaPs_ToCCRValue(ChanCtrl);
+	u32 Burst = (ChanCtrl->SrcBurstSize << 24) |
+		    ((ChanCtrl->SrcBurstLen & 0xFF) << 16) |
+		    ((ChanCtrl->DstBurstSize & 0xFF) << 8) |
+		    (ChanCtrl->DstBurstLen & 0xFF);
+	u32 SrcOffset = Cmd->BD.SrcAddr % ChanCtrl->SrcBurstSize;
+	u32 DstOffset = Cmd->BD.DstAddr % ChanCtrl->DstBurstSize;
+	int Index;
+
+	*Hit = 0;
+	ChanData->ProgCacheTick++;
+
+	for (Index = 0; Index < XDMAPS_PROG_CACHE_ENTRIES; Index++) {
+		Entry = &ChanData->ProgCache[Index];
+		if (Entry->Busy)
+			continue;
+
+		if (Entry->Valid && Entry->Ccr == Ccr &&
+		    Entry->Burst == Burst &&
+		    Entry->Length == Cmd->BD.Length &&
+		    Entry->SrcOffset == SrcOffset &&
+		    Entry->DstOffset == DstOffset) {
+			*Hit = 1;
+			Victim = Entry;
+			break;
+		}
+
+		if (Victim == NULL || (Victim->Valid && (!Entry->Valid ||
+		    Entry->LastUse < Victim->LastUse)))
+			Victim = Entry;
+	}
+
+	if (Victim == NULL)
+		return NULL;
+
+	if (!*Hit) {
+		Victim->Valid = 0;
+		Victim->Ccr = Ccr;
+		Victim->Burst = Burst;
+		Victim->Length = Cmd->BD.Length;
+		Victim->SrcOffset = SrcOffset;
+		Victim->DstOffset = DstOffset;
+	}
+
+	Victim->Busy = 1;
+	Victim->LastUse = ChanData->ProgCacheTick;
+
+	return Victim;
+}
+
+/****************************************************************************/
+/**
+*
+* Release a generated DMA program, either to the program buffer pool or to
+* the program cache of the channel.
+*
+* @param	ChanData is the channel data.
+* @param	Buf is the DMA program buffer to be released.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgRelease(XDmaPs_ChannelData *ChanData, void *Buf)
+{
+	int Index;
+
+	for (Index = 0; Index < XDMAPS_PROG_CACHE_ENTRIES; Index++) {
+		if (ChanData->ProgCache[Index].Buf == Buf) {
+			ChanData->ProgCache[Index].Busy = 0;
+			return;
+		}
+	}
+
+	XDmaPs_BufPool_Free(ChanData->ProgBufPool, Buf);
+}
+
+/****************************************************************************/
+/**
+*
+* Hand a DMA program for a command to the DMAC: enable the done interrupt of
+* the channel and execute DMAGO.
+*
+* @param	InstPtr is the DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command.
+* @param	DmaProg is the DMA program address.
+*
+* @return	0 on success, -1 on time out
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_Exec(XDmaPs *InstPtr, unsigned int Channel,
+			XDmaPs_Cmd *Cmd, u32 DmaProg)
+{
+	u32 Inten;
+
+	/* enable the interrupt */
+	Inten = XDmaPs_ReadReg(InstPtr->Config.BaseAddress,
+				XDMAPS_INTEN_OFFSET);
+	Inten |= 0x01 << Channel; /* set the correpsonding bit */
+	XDmaPs_WriteReg(InstPtr->Config.BaseAddress,
+			 XDMAPS_INTEN_OFFSET,
+			 Inten);
+
+	InstPtr->Chans[Channel].DmaCmdToHw = Cmd;
+
+	return XDmaPs_Exec_DMAGO(InstPtr->Config.BaseAddress,
+				  Channel, DmaProg);
+}
+
+/****************************************************************************/
+/**
+*
+* Start a command with a program from the generator in xdmaps_prog.c.
+*
+* @param	InstPtr is the DMA instance.
+* @param	Channel is the DMA channel number.
+* @param	Cmd is the DMA command.
+* @param	Prog is the generated program.
+*
+* @return	XST_SUCCESS on success, XST_FAILURE otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_StartProg(XDmaPs *InstPtr, unsigned int Channel,
+			     XDmaPs_Cmd *Cmd, XDmaPs_Prog *Prog)
+{
+	Xil_DCacheFlushRange((u32)Prog->Buf, Prog->Len);
+
+	Cmd->UserDmaProg = Prog->Buf;
+	Cmd->UserDmaProgLength = Prog->Len;
+	Cmd->GeneratedDmaProg = NULL;
+	Cmd->GeneratedDmaProgLength = 0;
+	InstPtr->Chans[Channel].HoldDmaProg = 0;
+
+	if (XDmaPs_Exec(InstPtr, Channel, Cmd, (u32)Prog->Buf)) {
+		InstPtr->Chans[Channel].DmaCmdToHw = NULL;
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 * XDmaPs_Exec_DMAGO - Execute the DMAGO to start a channel.
@@ -1916,8 +2154,7 @@ static void XDmaPs_DoneISR_n(XDmaPs *InstPtr, unsigned Channel)
 		if (!ChanData->HoldDmaProg) {
 			DmaProgBuf = (void *)DmaCmd->GeneratedDmaProg;
 			if (DmaProgBuf)
-				XDmaPs_BufPool_Free(ChanData->ProgBufPool,
-						     DmaProgBuf);
+				XDmaPs_ProgRelease(ChanData, DmaProgBuf);
 			DmaCmd->GeneratedDmaProg = NULL;
 		}
 
@@ -37,6 +37,22 @@
 * @{
 * @details
 *
+* <b>DMA Program Cache</b>
+*
+* XDmaPs_Start() generates a DMA program for every command. With the program
+* cache of a channel enabled by XDmaPs_SetProgCache(), the programs are kept
+* by transfer shape: the channel control, the length and the alignment of
+* the source and destination addresses. A command with the shape of a cached
+* program reuses it with only the DMAMOV SAR and DAR immediates patched,
+* which suits repeated transfers such as ping-pong buffers.
+*
+* <b>Scatter-Gather and 2D Transfers</b>
+*
+* XDmaPs_StartSg() runs a list of blocks and XDmaPs_Start2D() runs a strided
+* transfer of rows, each as a single DMA program with a single done
+* interrupt. The program is generated into a buffer supplied by the caller
+* by the generator in xdmaps_prog.c, which has no device access and can be
+* used on its own, for instance to check programs on a host.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -83,6 +99,9 @@
 *                       for CR-965028.
 *       ms     03/17/17 Added readme.txt file in examples folder for doxygen
 *                       generation.
+* 2.4   ag     10/19/26 Added the per channel DMA program cache and the
+*			scatter-gather and 2D transfers. XDmaPs_ChanCtrl
+*			and XDmaPs_BD moved to xdmaps_prog.h.
 * </pre>
 *
 *****************************************************************************/
@@ -102,6 +121,7 @@ extern "C" {
 #include "xstatus.h"
 
 #include "xdmaps_hw.h"
+#include "xdmaps_prog.h"
 
 /************************** Constant Definitions ****************************/
 
@@ -116,33 +136,6 @@ typedef struct {
 } XDmaPs_Config;
 
 
-/** DMA channle control structure. It's for AXI bus transaction.
- * This struct will be translated into a 32-bit channel control register value.
- */
-typedef struct {
-	unsigned int EndianSwapSize;	/**< Endian swap size. */
-	unsigned int DstCacheCtrl;	/**< Destination cache control */
-	unsigned int DstProtCtrl;	/**< Destination protection control */
-	unsigned int DstBurstLen;	/**< Destination burst length */
-	unsigned int DstBurstSize;	/**< Destination burst size */
-	unsigned int DstInc;		/**< Destination incrementing or fixed
-					 *   address */
-	unsigned int SrcCacheCtrl;	/**< Source cache control */
-	unsigned int SrcProtCtrl;	/**< Source protection control */
-	unsigned int SrcBurstLen;	/**< Source burst length */
-	unsigned int SrcBurstSize;	/**< Source burst size */
-	unsigned int SrcInc;		/**< Source incrementing or fixed
-					 *   address */
-} XDmaPs_ChanCtrl;
-
-/** DMA block descriptor stucture.
- */
-typedef struct {
-	u32 SrcAddr;		/**< Source starting address */
-	u32 DstAddr;		/**< Destination starting address */
-	unsigned int Length;	/**< Number of bytes for the block */
-} XDmaPs_BD;
-
 /**
  * A DMA command consisits of a channel control struct, a block descriptor,
  * a user defined program, a pointer pointing to generated DMA program, and
@@ -217,6 +210,31 @@ typedef struct {
 					  *  buffer is allocated or not */
 } XDmaPs_ProgBuf;
 
+#ifndef XDMAPS_PROG_CACHE_ENTRIES
+#define XDMAPS_PROG_CACHE_ENTRIES	4	/**< Cached programs per
+						  *  channel */
+#endif
+
+/**
+ * The XDmaPs_ProgCacheEntry is a DMA program kept by the program cache with
+ * the transfer shape it was generated for.
+ */
+typedef struct {
+	char Buf[XDMAPS_CHAN_BUF_LEN];	/**< The DMA program */
+	unsigned Len;			/**< The length of the program */
+	u32 Ccr;			/**< CCR value of the channel control */
+	u32 Burst;			/**< Burst sizes and lengths */
+	unsigned int Length;		/**< Transfer length */
+	u32 SrcOffset;			/**< Source address modulo the source
+					  *  burst size */
+	u32 DstOffset;			/**< Destination address modulo the
+					  *  destination burst size */
+	u32 LastUse;			/**< Use stamp for replacement */
+	int Valid;			/**< The entry holds a program */
+	int Busy;			/**< The program is handed out to a
+					  *  command */
+} XDmaPs_ProgCacheEntry;
+
 /**
  * The XDmaPs_ChannelData is a struct to book keep individual channel of
  * the DMAC.
@@ -235,6 +253,12 @@ typedef struct {
 	int HoldDmaProg;		/**< A tag indicating whether to hold the
 					  *  DMA program after the DMA is done.
 					  */
+	int ProgCacheEnabled;		/**< The program cache is in use */
+	XDmaPs_ProgCacheEntry ProgCache[XDMAPS_PROG_CACHE_ENTRIES];
+					/**< Cached DMA programs */
+	u32 ProgCacheTick;		/**< Use stamp of the last lookup */
+	u32 ProgCacheHits;		/**< Programs reused from the cache */
+	u32 ProgCacheMisses;		/**< Programs generated */
 
 } XDmaPs_ChannelData;
 
@@ -273,6 +297,13 @@ int XDmaPs_FreeDmaProg(XDmaPs *InstPtr, unsigned int Channel,
 			XDmaPs_Cmd *Cmd);
 void XDmaPs_Print_DmaProg(XDmaPs_Cmd *Cmd);
 
+int XDmaPs_SetProgCache(XDmaPs *InstPtr, unsigned int Channel, int Enable);
+int XDmaPs_StartSg(XDmaPs *InstPtr, unsigned int Channel,
+		   XDmaPs_Cmd *Cmd, XDmaPs_BD *Sg, unsigned int SgCount,
+		   XDmaPs_Prog *Prog);
+int XDmaPs_Start2D(XDmaPs *InstPtr, unsigned int Channel,
+		   XDmaPs_Cmd *Cmd, XDmaPs_2D *Xfer, XDmaPs_Prog *Prog);
+
 
 int XDmaPs_ResetManager(XDmaPs *InstPtr);
 int XDmaPs_ResetChannel(XDmaPs *InstPtr, unsigned int Channel);
@@ -308,8 +339,6 @@ extern INLINE int XDmaPs_Instr_DMARMB(char *DmaProg);
 extern INLINE int XDmaPs_Instr_DMASEV(char *DmaProg, unsigned int EventNumber);
 extern INLINE int XDmaPs_Instr_DMAST(char *DmaProg);
 extern INLINE int XDmaPs_Instr_DMAWMB(char *DmaProg);
-extern INLINE unsigned XDmaPs_ToEndianSwapSizeBits(unsigned int EndianSwapSize);
-extern INLINE unsigned XDmaPs_ToBurstSizeBits(unsigned BurstSize);
 #endif
 
 /**
@@ -0,0 +1,1105 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal 
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF 
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xdmaps_prog.c
+* @addtogroup dmaps_v2_3
+* @{
+*
+* This file contains the DMA program generator for scatter-gather and 2D
+* transfers. Refer to the header file xdmaps_prog.h for more detailed
+* information.
+*
+* The instructions are emitted through XDmaPs_Prog, which checks the size of
+* the buffer and the range of loop jumps, so that long scatter-gather lists
+* fail cleanly instead of overrunning the buffer.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  	Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.4   ag     10/19/26 First release. XDmaPs_ToCCRValue() moved here from
+*			xdmaps.c.
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xdmaps_prog.h"
+
+/************************** Constant Definitions ****************************/
+
+/*
+ * Register number for the DMAMOV instruction
+ */
+#define XDMAPS_PROG_MOV_SAR	0x0
+#define XDMAPS_PROG_MOV_CCR	0x1
+#define XDMAPS_PROG_MOV_DAR	0x2
+
+/*
+ * Register number for the DMAADDH instruction
+ */
+#define XDMAPS_PROG_ADDH_SAR	0x0
+#define XDMAPS_PROG_ADDH_DAR	0x1
+
+#define XDMAPS_PROG_MAX_JUMP	0xFF	/* DMALPEND backward jump */
+#define XDMAPS_PROG_MAX_ADD	0xFFFF	/* DMAADDH immediate */
+
+/**************************** Type Definitions ******************************/
+
+/*
+ * Values derived once from the channel control of a transfer
+ */
+typedef struct {
+	XDmaPs_ChanCtrl *ChanCtrl;
+	u32 BurstCcr;		/* CCR of the burst loops */
+	u32 ByteCcr;		/* CCR of single byte transfers */
+	unsigned BurstBytes;	/* Bytes moved by one DMALD/DMAST burst */
+} XDmaPs_ProgXfer;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+
+/************************** Function Prototypes *****************************/
+
+static int XDmaPs_ProgXferInit(XDmaPs_ProgXfer *Xfer,
+			       XDmaPs_ChanCtrl *ChanCtrl);
+static int XDmaPs_ProgCheckAddr(XDmaPs_ChanCtrl *ChanCtrl, u32 SrcAddr,
+				u32 DstAddr, unsigned Length);
+static int XDmaPs_ProgCanLoop(XDmaPs_ChanCtrl *ChanCtrl, u32 SrcAddr,
+			      u32 DstAddr, u32 SrcStride, u32 DstStride,
+			      unsigned RowLength);
+static void XDmaPs_ProgBlock(XDmaPs_Prog *Prog, XDmaPs_ProgXfer *Xfer,
+			     u32 SrcAddr, u32 DstAddr, unsigned Length);
+static void XDmaPs_ProgRows(XDmaPs_Prog *Prog, XDmaPs_ProgXfer *Xfer,
+			    u32 SrcAddr, u32 DstAddr, unsigned RowLength,
+			    unsigned Rows, u32 SrcStride, u32 DstStride);
+static void XDmaPs_ProgCopy(XDmaPs_Prog *Prog, XDmaPs_ProgXfer *Xfer,
+			    u32 SrcAddr, u32 DstAddr, unsigned Length,
+			    int UseLc1);
+static void XDmaPs_ProgBeats(XDmaPs_Prog *Prog, unsigned Beats, int UseLc1);
+static void XDmaPs_ProgLoop(XDmaPs_Prog *Prog, unsigned Iterations);
+static char *XDmaPs_ProgAlloc(XDmaPs_Prog *Prog, unsigned Bytes);
+static void XDmaPs_ProgMov(XDmaPs_Prog *Prog, unsigned Rd, u32 Imm);
+static void XDmaPs_ProgSetCcr(XDmaPs_Prog *Prog, u32 Ccr);
+static void XDmaPs_ProgAddh(XDmaPs_Prog *Prog, unsigned Ra, u32 Bytes);
+static void XDmaPs_ProgLp(XDmaPs_Prog *Prog, unsigned Lc,
+			  unsigned Iterations);
+static void XDmaPs_ProgLpEnd(XDmaPs_Prog *Prog, unsigned Lc,
+			     unsigned BodyStart);
+static void XDmaPs_ProgByte(XDmaPs_Prog *Prog, u8 Byte);
+static void XDmaPs_ProgAlign(XDmaPs_Prog *Prog, unsigned Bytes);
+
+/************************** Variable Definitions ****************************/
+
+
+/****************************************************************************/
+/**
+*
+* Conversion function from the endian swap size to the bit encoding of the CCR
+*
+* @param	EndianSwapSize is the endian swap size, in terms of bits, it
+*		could be 8, 16, 32, 64, or 128(We are using DMA assembly syntax)
+*
+* @return	The endian swap size bit encoding for the CCR.
+*
+* @note	None.
+*
+*****************************************************************************/
+static unsigned XDmaPs_ToEndianSwapSizeBits(unsigned int EndianSwapSize)
+{
+	switch (EndianSwapSize) {
+	case 0:
+	case 8:
+		return 0;
+	case 16:
+		return 1;
+	case 32:
+		return 2;
+	case 64:
+		return 3;
+	case 128:
+		return 4;
+	default:
+		return 0;
+	}
+
+}
+
+/****************************************************************************/
+/**
+*
+* Conversion function from the burst size to the bit encoding of the CCR
+*
+* @param	BurstSize is the burst size. It's the data width.
+*		In terms of bytes, it could be 1, 2, 4, 8, 16, 32, 64, or 128.
+*		It must be no larger than the bus width.
+*		(We are using DMA assembly syntax.)
+*
+* @note		None.
+*
+*****************************************************************************/
+static unsigned XDmaPs_ToBurstSizeBits(unsigned BurstSize)
+{
+	switch (BurstSize) {
+	case 1:
+		return 0;
+	case 2:
+		return 1;
+	case 4:
+		return 2;
+	case 8:
+		return 3;
+	case 16:
+		return 4;
+	case 32:
+		return 5;
+	case 64:
+		return 6;
+	case 128:
+		return 7;
+	default:
+		return 0;
+	}
+}
+
+
+/****************************************************************************/
+/**
+*
+* Conversion function from PL330 bus transfer descriptors to CCR value. All the
+* values passed to the functions are in terms of assembly languages, not in
+* terms of the register bit encoding.
+*
+* @param	ChanCtrl is the Instance of XDmaPs_ChanCtrl.
+*
+* @return	The 32-bit CCR value.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XDmaPs_ToCCRValue(XDmaPs_ChanCtrl *ChanCtrl)
+{
+	/*
+	 * Channel Control Register encoding
+	 * [31:28] - endian_swap_size
+	 * [27:25] - dst_cache_ctrl
+	 * [24:22] - dst_prot_ctrl
+	 * [21:18] - dst_burst_len
+	 * [17:15] - dst_burst_size
+	 * [14]    - dst_inc
+	 * [13:11] - src_cache_ctrl
+	 * [10:8] - src_prot_ctrl
+	 * [7:4]  - src_burst_len
+	 * [3:1]  - src_burst_size
+	 * [0]     - src_inc
+	 */
+
+	unsigned es =
+		XDmaPs_ToEndianSwapSizeBits(ChanCtrl->EndianSwapSize);
+
+	unsigned dst_burst_size =
+		XDmaPs_ToBurstSizeBits(ChanCtrl->DstBurstSize);
+	unsigned dst_burst_len = (ChanCtrl->DstBurstLen - 1) & 0x0F;
+	unsigned dst_cache_ctrl = (ChanCtrl->DstCacheCtrl & 0x03)
+		| ((ChanCtrl->DstCacheCtrl & 0x08) >> 1);
+	unsigned dst_prot_ctrl = ChanCtrl->DstProtCtrl & 0x07;
+	unsigned dst_inc_bit = ChanCtrl->DstInc & 1;
+
+	unsigned src_burst_size =
+		XDmaPs_ToBurstSizeBits(ChanCtrl->SrcBurstSize);
+	unsigned src_burst_len = (ChanCtrl->SrcBurstLen - 1) & 0x0F;
+	unsigned src_cache_ctrl = (ChanCtrl->SrcCacheCtrl & 0x03)
+		| ((ChanCtrl->SrcCacheCtrl & 0x08) >> 1);
+	unsigned src_prot_ctrl = ChanCtrl->SrcProtCtrl & 0x07;
+	unsigned src_inc_bit = ChanCtrl->SrcInc & 1;
+
+	u32 ccr_value = (es << 28)
+		| (dst_cache_ctrl << 25)
+		| (dst_prot_ctrl << 22)
+		| (dst_burst_len << 18)
+		| (dst_burst_size << 15)
+		| (dst_inc_bit << 14)
+		| (src_cache_ctrl << 11)
+		| (src_prot_ctrl << 8)
+		| (src_burst_len << 4)
+		| (src_burst_size << 1)
+		| (src_inc_bit);
+
+	return ccr_value;
+}
+
+/****************************************************************************/
+/**
+*
+* Set the buffer a DMA program is generated into.
+*
+* @param	Prog is the DMA program.
+* @param	Buf is the program buffer. The DMAC fetches the program from
+*		it, so it must stay valid until the transfer is done.
+* @param	Size is the size of Buf in bytes.
+* @param	CacheLength is the instruction cache line length of the DMAC
+*		in bytes, the CacheLength field of the XDmaPs instance. Loop
+*		bodies are padded with DMANOP to keep them within a line. It
+*		is 0 to turn the padding off.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XDmaPs_ProgInit(XDmaPs_Prog *Prog, char *Buf, unsigned Size,
+		     unsigned CacheLength)
+{
+	Xil_AssertVoid(Prog != NULL);
+	Xil_AssertVoid(Buf != NULL);
+
+	Prog->Buf = Buf;
+	Prog->Size = Size;
+	Prog->Len = 0;
+	Prog->CacheLength = CacheLength;
+	Prog->Ccr = 0;
+	Prog->CcrValid = 0;
+	Prog->Status = XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Generate one DMA program for a scatter-gather list. The segments are
+* transferred in order with the same channel control, and the program
+* signals the event of the channel when all of them are done.
+*
+* @param	Prog is the DMA program, set up with XDmaPs_ProgInit(). Any
+*		earlier content is replaced.
+* @param	Channel is the DMA channel number.
+* @param	ChanCtrl is the channel control for all segments.
+* @param	Sg is the scatter-gather list.
+* @param	SgCount is the number of segments in Sg.
+*
+* @return
+*		- XST_SUCCESS on success, Prog->Len is the program length.
+*		- XST_INVALID_PARAM if the channel control or a segment is
+*		  invalid. Fixed addresses must be aligned to the burst size
+*		  as for XDmaPs_Start().
+*		- XST_BUFFER_TOO_SMALL if the program does not fit.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XDmaPs_ProgSg(XDmaPs_Prog *Prog, unsigned int Channel,
+		  XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_BD *Sg,
+		  unsigned int SgCount)
+{
+	XDmaPs_ProgXfer Xfer;
+	XDmaPs_BD *BdPtr;
+	u32 SrcStride = 0;
+	u32 DstStride = 0;
+	unsigned int Index;
+	unsigned int Rows;
+
+	Xil_AssertNonvoid(Prog != NULL);
+	Xil_AssertNonvoid(ChanCtrl != NULL);
+	Xil_AssertNonvoid(Sg != NULL);
+
+	if (SgCount == 0 ||
+	    XDmaPs_ProgXferInit(&Xfer, ChanCtrl) != XST_SUCCESS)
+		return XST_INVALID_PARAM;
+
+	for (Index = 0; Index < SgCount; Index++) {
+		if (XDmaPs_ProgCheckAddr(ChanCtrl, Sg[Index].SrcAddr,
+					 Sg[Index].DstAddr,
+					 Sg[Index].Length) != XST_SUCCESS)
+			return XST_INVALID_PARAM;
+	}
+
+	Prog->Len = 0;
+	Prog->CcrValid = 0;
+	Prog->Status = XST_SUCCESS;
+
+	for (Index = 0; Index < SgCount; Index += Rows) {
+		BdPtr = &Sg[Index];
+		Rows = 1;
+
+		/*
+		 * Gather the following segments that continue a 2D pattern
+		 * with this one into a single row loop
+		 */
+		if (Index + 1 < SgCount && Sg[Index + 1].Length == BdPtr->Length) {
+			SrcStride = Sg[Index + 1].SrcAddr - BdPtr->SrcAddr;
+			DstStride = Sg[Index + 1].DstAddr - BdPtr->DstAddr;
+
+			if (XDmaPs_ProgCanLoop(ChanCtrl, BdPtr->SrcAddr,
+					       BdPtr->DstAddr, SrcStride,
+					       DstStride, BdPtr->Length)) {
+				Rows = 2;
+				while (Index + Rows < SgCount &&
+				       BdPtr[Rows].Length == BdPtr->Length &&
+				       BdPtr[Rows].SrcAddr -
+				       BdPtr[Rows - 1].SrcAddr == SrcStride &&
+				       BdPtr[Rows].DstAddr -
+				       BdPtr[Rows - 1].DstAddr == DstStride)
+					Rows++;
+			}
+		}
+
+		if (Rows > 1)
+			XDmaPs_ProgRows(Prog, &Xfer, BdPtr->SrcAddr,
+					BdPtr->DstAddr, BdPtr->Length, Rows,
+					SrcStride, DstStride);
+		else
+			XDmaPs_ProgBlock(Prog, &Xfer, BdPtr->SrcAddr,
+					 BdPtr->DstAddr, BdPtr->Length);
+	}
+
+	/* DMASEV for the channel event, then DMAEND */
+	XDmaPs_ProgByte(Prog, 0x34);
+	XDmaPs_ProgByte(Prog, (u8)(Channel << 3));
+	XDmaPs_ProgByte(Prog, 0x00);
+
+	return Prog->Status;
+}
+
+/****************************************************************************/
+/**
+*
+* Generate a DMA program for a 2D transfer. The rows are transferred in
+* loops of up to 256 rows on loop counter 1 when the row starts keep the
+* alignment of the burst size, and one after the other otherwise.
+*
+* @param	Prog is the DMA program, set up with XDmaPs_ProgInit(). Any
+*		earlier content is replaced.
+* @param	Channel is the DMA channel number.
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	Xfer is the 2D transfer. The strides of incrementing
+*		addresses must not be less than the row length.
+*
+* @return
+*		- XST_SUCCESS on success, Prog->Len is the program length.
+*		- XST_INVALID_PARAM if the channel control or the transfer is
+*		  invalid.
+*		- XST_BUFFER_TOO_SMALL if the program does not fit.
+*
+* @note		None.
+*
+*****************************************************************************/
+int XDmaPs_Prog2D(XDmaPs_Prog *Prog, unsigned int Channel,
+		  XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_2D *Xfer)
+{
+	XDmaPs_ProgXfer ProgXfer;
+	u32 SrcStride;
+	u32 DstStride;
+	unsigned int Row;
+
+	Xil_AssertNonvoid(Prog != NULL);
+	Xil_AssertNonvoid(ChanCtrl != NULL);
+	Xil_AssertNonvoid(Xfer != NULL);
+
+	if (Xfer->Rows == 0 ||
+	    XDmaPs_ProgXferInit(&ProgXfer, ChanCtrl) != XST_SUCCESS ||
+	    XDmaPs_ProgCheckAddr(ChanCtrl, Xfer->SrcAddr, Xfer->DstAddr,
+				 Xfer->RowLength) != XST_SUCCESS)
+		return XST_INVALID_PARAM;
+
+	SrcStride = ChanCtrl->SrcInc ? Xfer->SrcStride : 0;
+	DstStride = ChanCtrl->DstInc ? Xfer->DstStride : 0;
+
+	if ((ChanCtrl->SrcInc && SrcStride < Xfer->RowLength) ||
+	    (ChanCtrl->DstInc && DstStride < Xfer->RowLength))
+		return XST_INVALID_PARAM;
+
+	Prog->Len = 0;
+	Prog->CcrValid = 0;
+	Prog->Status = XST_SUCCESS;
+
+	if (Xfer->Rows > 1 &&
+	    XDmaPs_ProgCanLoop(ChanCtrl, Xfer->SrcAddr, Xfer->DstAddr,
+			       SrcStride, DstStride, Xfer->RowLength)) {
+		XDmaPs_ProgRows(Prog, &ProgXfer, Xfer->SrcAddr, Xfer->DstAddr,
+				Xfer->RowLength, Xfer->Rows, SrcStride,
+				DstStride);
+	} else {
+		for (Row = 0; Row < Xfer->Rows; Row++)
+			XDmaPs_ProgBlock(Prog, &ProgXfer,
+					 Xfer->SrcAddr + Row * SrcStride,
+					 Xfer->DstAddr + Row * DstStride,
+					 Xfer->RowLength);
+	}
+
+	/* DMASEV for the channel event, then DMAEND */
+	XDmaPs_ProgByte(Prog, 0x34);
+	XDmaPs_ProgByte(Prog, (u8)(Channel << 3));
+	XDmaPs_ProgByte(Prog, 0x00);
+
+	return Prog->Status;
+}
+
+/****************************************************************************/
+/**
+*
+* Check the channel control of a transfer and derive the CCR values used by
+* the program.
+*
+* @param	Xfer is the transfer to be set up.
+* @param	ChanCtrl is the channel control of the transfer.
+*
+* @return	XST_SUCCESS if the channel control can be used, XST_FAILURE
+*		if the burst sizes are invalid or the source and destination
+*		bursts differ in length.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_ProgXferInit(XDmaPs_ProgXfer *Xfer,
+			       XDmaPs_ChanCtrl *ChanCtrl)
+{
+	if (ChanCtrl->SrcBurstSize == 0 || ChanCtrl->DstBurstSize == 0 ||
+	    ChanCtrl->SrcBurstSize * ChanCtrl->SrcBurstLen !=
+	    ChanCtrl->DstBurstSize * ChanCtrl->DstBurstLen)
+		return XST_FAILURE;
+
+	Xfer->ChanCtrl = ChanCtrl;
+	Xfer->BurstCcr = XDmaPs_ToCCRValue(ChanCtrl);
+	Xfer->ByteCcr = (ChanCtrl->SrcInc & 1) | ((ChanCtrl->DstInc & 1) << 14);
+	Xfer->BurstBytes = ChanCtrl->SrcBurstSize * ChanCtrl->SrcBurstLen;
+
+	if (Xfer->BurstBytes == 0)
+		return XST_FAILURE;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Check a block of a transfer. Unaligned fixed addresses are not supported.
+*
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	SrcAddr is the source address of the block.
+* @param	DstAddr is the destination address of the block.
+* @param	Length is the length of the block in bytes.
+*
+* @return	XST_SUCCESS if the block can be transferred, XST_FAILURE
+*		otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_ProgCheckAddr(XDmaPs_ChanCtrl *ChanCtrl, u32 SrcAddr,
+				u32 DstAddr, unsigned Length)
+{
+	if (Length == 0)
+		return XST_FAILURE;
+
+	if (!ChanCtrl->SrcInc && SrcAddr % ChanCtrl->SrcBurstSize)
+		return XST_FAILURE;
+
+	if (!ChanCtrl->DstInc && DstAddr % ChanCtrl->DstBurstSize)
+		return XST_FAILURE;
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Check whether rows can be transferred in a loop. Every row must start
+* aligned to the burst size, so that all rows run the same instructions, a
+* fixed address must not move, and the step from the end of a row to the
+* start of the next must fit in XDMAPS_PROG_MAX_ADDH DMAADDH instructions.
+*
+* @param	ChanCtrl is the channel control of the transfer.
+* @param	SrcAddr is the source address of the first row.
+* @param	DstAddr is the destination address of the first row.
+* @param	SrcStride is the source distance between rows.
+* @param	DstStride is the destination distance between rows.
+* @param	RowLength is the length of a row in bytes.
+*
+* @return	1 if the rows can be looped, 0 otherwise.
+*
+* @note		None.
+*
+*****************************************************************************/
+static int XDmaPs_ProgCanLoop(XDmaPs_ChanCtrl *ChanCtrl, u32 SrcAddr,
+			      u32 DstAddr, u32 SrcStride, u32 DstStride,
+			      unsigned RowLength)
+{
+	if (ChanCtrl->SrcInc) {
+		if (SrcAddr % ChanCtrl->SrcBurstSize ||
+		    SrcStride % ChanCtrl->SrcBurstSize ||
+		    SrcStride < RowLength ||
+		    SrcStride - RowLength >
+		    XDMAPS_PROG_MAX_ADDH * XDMAPS_PROG_MAX_ADD)
+			return 0;
+	} else if (SrcStride != 0) {
+		return 0;
+	}
+
+	if (ChanCtrl->DstInc) {
+		if (DstAddr % ChanCtrl->DstBurstSize ||
+		    DstStride % ChanCtrl->DstBurstSize ||
+		    DstStride < RowLength ||
+		    DstStride - RowLength >
+		    XDMAPS_PROG_MAX_ADDH * XDMAPS_PROG_MAX_ADD)
+			return 0;
+	} else if (DstStride != 0) {
+		return 0;
+	}
+
+	return 1;
+}
+
+/****************************************************************************/
+/**
+*
+* Emit the transfer of a single block with its own source and destination
+* addresses, using both loop counters for long blocks.
+*
+* @param	Prog is the DMA program.
+* @param	Xfer is the transfer.
+* @param	SrcAddr is the source address of the block.
+* @param	DstAddr is the destination address of the block.
+* @param	Length is the length of the block in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgBlock(XDmaPs_Prog *Prog, XDmaPs_ProgXfer *Xfer,
+			     u32 SrcAddr, u32 DstAddr, unsigned Length)
+{
+	XDmaPs_ProgMov(Prog, XDMAPS_PROG_MOV_SAR, SrcAddr);
+	XDmaPs_ProgMov(Prog, XDMAPS_PROG_MOV_DAR, DstAddr);
+	XDmaPs_ProgCopy(Prog, Xfer, SrcAddr, DstAddr, Length, 1);
+}
+
+/****************************************************************************/
+/**
+*
+* Emit the transfer of rows that satisfy XDmaPs_ProgCanLoop(). The rows run
+* in DMALP loops on loop counter 1, with the row itself on loop counter 0
+* and DMAADDH moving the addresses on to the next row. If a row is too long
+* for the 8-bit backward jump of DMALPEND, the rows are emitted as blocks.
+*
+* @param	Prog is the DMA program.
+* @param	Xfer is the transfer.
+* @param	SrcAddr is the source address of the first row.
+* @param	DstAddr is the destination address of the first row.
+* @param	RowLength is the length of a row in bytes.
+* @param	Rows is the number of rows.
+* @param	SrcStride is the source distance between rows.
+* @param	DstStride is the destination distance between rows.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgRows(XDmaPs_Prog *Prog, XDmaPs_ProgXfer *Xfer,
+			    u32 SrcAddr, u32 DstAddr, unsigned RowLength,
+			    unsigned Rows, u32 SrcStride, u32 DstStride)
+{
+	XDmaPs_ChanCtrl *ChanCtrl = Xfer->ChanCtrl;
+	unsigned StartLen = Prog->Len;
+	unsigned Done = 0;
+	unsigned Count;
+	unsigned Body;
+	u32 SrcGap = ChanCtrl->SrcInc ? SrcStride - RowLength : 0;
+	u32 DstGap = ChanCtrl->DstInc ? DstStride - RowLength : 0;
+	int SingleCcr = (RowLength % Xfer->BurstBytes) == 0;
+
+	XDmaPs_ProgMov(Prog, XDMAPS_PROG_MOV_SAR, SrcAddr);
+	XDmaPs_ProgMov(Prog, XDMAPS_PROG_MOV_DAR, DstAddr);
+
+	/*
+	 * A row made of whole bursts leaves the CCR as it found it, so the
+	 * CCR can be set once in front of the loop
+	 */
+	if (SingleCcr)
+		XDmaPs_ProgSetCcr(Prog, Xfer->BurstCcr);
+
+	while (Done < Rows) {
+		Count = Rows - Done;
+		if (Count > XDMAPS_PROG_MAX_LOOP)
+			Count = XDMAPS_PROG_MAX_LOOP;
+
+		Body = 0;
+		if (Count > 1) {
+			XDmaPs_ProgLp(Prog, 1, Count);
+			Body = Prog->Len;
+		}
+
+		if (!SingleCcr)
+			Prog->CcrValid = 0;
+
+		XDmaPs_ProgCopy(Prog, Xfer, SrcAddr, DstAddr, RowLength, 0);
+		XDmaPs_ProgAddh(Prog, XDMAPS_PROG_ADDH_SAR, SrcGap);
+		XDmaPs_ProgAddh(Prog, XDMAPS_PROG_ADDH_DAR, DstGap);
+
+		if (Count > 1)
+			XDmaPs_ProgLpEnd(Prog, 1, Body);
+
+		Done += Count;
+	}
+
+	if (Prog->Status == XST_FAILURE) {
+		/* the row does not fit in a loop, emit it row by row */
+		Prog->Len = StartLen;
+		Prog->CcrValid = 0;
+		Prog->Status = XST_SUCCESS;
+
+		for (Done = 0; Done < Rows; Done++)
+			XDmaPs_ProgBlock(Prog, Xfer,
+					 SrcAddr + Done * SrcStride,
+					 DstAddr + Done * DstStride,
+					 RowLength);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Emit the DMALD/DMAST pairs for a block after SAR and DAR are set. As in
+* XDmaPs_BuildDmaProg(), an unaligned head is transferred in bytes, then
+* full bursts, then the tail in single beats of the burst size and in bytes.
+* If the source and destination cannot be aligned together, the block is
+* transferred in bytes.
+*
+* @param	Prog is the DMA program.
+* @param	Xfer is the transfer.
+* @param	SrcAddr is the source address of the block.
+* @param	DstAddr is the destination address of the block.
+* @param	Length is the length of the block in bytes.
+* @param	UseLc1 is 1 if loop counter 1 is free for the block.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgCopy(XDmaPs_Prog *Prog, XDmaPs_ProgXfer *Xfer,
+			    u32 SrcAddr, u32 DstAddr, unsigned Length,
+			    int UseLc1)
+{
+	XDmaPs_ChanCtrl *ChanCtrl = Xfer->ChanCtrl;
+	XDmaPs_ChanCtrl WordChanCtrl;
+	unsigned SrcUnaligned = 0;
+	unsigned DstUnaligned = 0;
+	unsigned MemBurstSize = 1;
+	u32 MemAddr = 0;
+	unsigned Count;
+
+	if (ChanCtrl->SrcInc)
+		SrcUnaligned = SrcAddr % ChanCtrl->SrcBurstSize;
+
+	if (ChanCtrl->DstInc)
+		DstUnaligned = DstAddr % ChanCtrl->DstBurstSize;
+
+	if ((SrcUnaligned && ChanCtrl->DstInc) ||
+	    (DstUnaligned && ChanCtrl->SrcInc)) {
+		XDmaPs_ProgSetCcr(Prog, Xfer->ByteCcr);
+		XDmaPs_ProgBeats(Prog, Length, UseLc1);
+		return;
+	}
+
+	if (ChanCtrl->SrcInc) {
+		MemBurstSize = ChanCtrl->SrcBurstSize;
+		MemAddr = SrcAddr;
+	} else if (ChanCtrl->DstInc) {
+		MemBurstSize = ChanCtrl->DstBurstSize;
+		MemAddr = DstAddr;
+	}
+
+	/* unaligned head in bytes */
+	Count = MemAddr % MemBurstSize;
+	if (Count) {
+		Count = MemBurstSize - Count;
+		if (Count > Length)
+			Count = Length;
+
+		XDmaPs_ProgSetCcr(Prog, Xfer->ByteCcr);
+		XDmaPs_ProgBeats(Prog, Count, UseLc1);
+		Length -= Count;
+	}
+
+	/* full bursts */
+	Count = Length / Xfer->BurstBytes;
+	if (Count) {
+		XDmaPs_ProgSetCcr(Prog, Xfer->BurstCcr);
+		XDmaPs_ProgBeats(Prog, Count, UseLc1);
+	}
+	Length %= Xfer->BurstBytes;
+
+	/* tail in single beats of the burst size */
+	Count = Length / MemBurstSize;
+	if (Count) {
+		WordChanCtrl = *ChanCtrl;
+		WordChanCtrl.SrcBurstSize = MemBurstSize;
+		WordChanCtrl.SrcBurstLen = 1;
+		WordChanCtrl.DstBurstSize = MemBurstSize;
+		WordChanCtrl.DstBurstLen = 1;
+
+		XDmaPs_ProgSetCcr(Prog, XDmaPs_ToCCRValue(&WordChanCtrl));
+		XDmaPs_ProgBeats(Prog, Count, UseLc1);
+	}
+	Length %= MemBurstSize;
+
+	/* tail in bytes */
+	if (Length) {
+		XDmaPs_ProgSetCcr(Prog, Xfer->ByteCcr);
+		XDmaPs_ProgBeats(Prog, Length, UseLc1);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Emit Beats DMALD/DMAST pairs with the CCR in effect. Up to 65536 pairs are
+* covered by one loop nest when loop counter 1 is free, otherwise by one
+* loop per 256 pairs.
+*
+* @param	Prog is the DMA program.
+* @param	Beats is the number of DMALD/DMAST pairs.
+* @param	UseLc1 is 1 if loop counter 1 may be used.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgBeats(XDmaPs_Prog *Prog, unsigned Beats, int UseLc1)
+{
+	unsigned Outer;
+	unsigned Body;
+
+	while (UseLc1 && Beats >= 2 * XDMAPS_PROG_MAX_LOOP) {
+		Outer = Beats / XDMAPS_PROG_MAX_LOOP;
+		if (Outer > XDMAPS_PROG_MAX_LOOP)
+			Outer = XDMAPS_PROG_MAX_LOOP;
+
+		XDmaPs_ProgLp(Prog, 1, Outer);
+		Body = Prog->Len;
+		XDmaPs_ProgLoop(Prog, XDMAPS_PROG_MAX_LOOP);
+		XDmaPs_ProgLpEnd(Prog, 1, Body);
+
+		Beats -= Outer * XDMAPS_PROG_MAX_LOOP;
+	}
+
+	while (Beats >= XDMAPS_PROG_MAX_LOOP) {
+		XDmaPs_ProgLoop(Prog, XDMAPS_PROG_MAX_LOOP);
+		Beats -= XDMAPS_PROG_MAX_LOOP;
+	}
+
+	if (Beats > 1) {
+		XDmaPs_ProgLoop(Prog, Beats);
+	} else if (Beats == 1) {
+		/* DMALD, DMAST */
+		XDmaPs_ProgByte(Prog, 0x04);
+		XDmaPs_ProgByte(Prog, 0x08);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Emit a loop with only DMALD and DMAST as the body using loop counter 0.
+* Like XDmaPs_ConstructSingleLoop(), the body and the DMALPEND are kept in
+* the same instruction cache line.
+*
+* @param	Prog is the DMA program.
+* @param	Iterations is the loop count, 1 to 256.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgLoop(XDmaPs_Prog *Prog, unsigned Iterations)
+{
+	unsigned Body;
+
+	XDmaPs_ProgLp(Prog, 0, Iterations);
+	XDmaPs_ProgAlign(Prog, 4);
+	Body = Prog->Len;
+	XDmaPs_ProgByte(Prog, 0x04);
+	XDmaPs_ProgByte(Prog, 0x08);
+	XDmaPs_ProgLpEnd(Prog, 0, Body);
+}
+
+/****************************************************************************/
+/**
+*
+* Reserve space for an instruction in the program.
+*
+* @param	Prog is the DMA program.
+* @param	Bytes is the length of the instruction.
+*
+* @return	The start of the instruction, NULL if the program has failed
+*		or the buffer is full.
+*
+* @note		None.
+*
+*****************************************************************************/
+static char *XDmaPs_ProgAlloc(XDmaPs_Prog *Prog, unsigned Bytes)
+{
+	char *Instr;
+
+	if (Prog->Status != XST_SUCCESS)
+		return NULL;
+
+	if (Prog->Len + Bytes > Prog->Size) {
+		Prog->Status = XST_BUFFER_TOO_SMALL;
+		return NULL;
+	}
+
+	Instr = Prog->Buf + Prog->Len;
+	Prog->Len += Bytes;
+
+	return Instr;
+}
+
+/****************************************************************************/
+/**
+*
+* Emit a DMAMOV instruction.
+*
+* @param	Prog is the DMA program.
+* @param	Rd is the register id, 0 for SAR, 1 for CCR, and 2 for DAR.
+* @param	Imm is the 32-bit immediate number.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgMov(XDmaPs_Prog *Prog, unsigned Rd, u32 Imm)
+{
+	/*
+	 * DMAMOV encoding
+	 * 15 4 3 2 1 10 ... 8 7 6 5 4 3 2 1 0
+	 *  0 0 0 0 0 |rd[2:0]|1 0 1 1 1 1 0 0
+	 *
+	 * 47 ... 16
+	 *  imm[32:0], little endian
+	 */
+	char *Instr = XDmaPs_ProgAlloc(Prog, 6);
+
+	if (Instr == NULL)
+		return;
+
+	*Instr = (char)0xBC;
+	*(Instr + 1) = (char)(Rd & 0x7);
+	*(Instr + 2) = (char)(Imm & 0xFF);
+	*(Instr + 3) = (char)((Imm >> 8) & 0xFF);
+	*(Instr + 4) = (char)((Imm >> 16) & 0xFF);
+	*(Instr + 5) = (char)((Imm >> 24) & 0xFF);
+}
+
+/****************************************************************************/
+/**
+*
+* Emit a DMAMOV CCR unless the CCR already holds the value.
+*
+* @param	Prog is the DMA program.
+* @param	Ccr is the CCR value.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgSetCcr(XDmaPs_Prog *Prog, u32 Ccr)
+{
+	if (Prog->CcrValid && Prog->Ccr == Ccr)
+		return;
+
+	XDmaPs_ProgMov(Prog, XDMAPS_PROG_MOV_CCR, Ccr);
+	Prog->Ccr = Ccr;
+	Prog->CcrValid = 1;
+}
+
+/****************************************************************************/
+/**
+*
+* Emit DMAADDH instructions that add Bytes to SAR or DAR.
+*
+* @param	Prog is the DMA program.
+* @param	Ra is 0 for SAR and 1 for DAR.
+* @param	Bytes is the value to add. Nothing is emitted for 0.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgAddh(XDmaPs_Prog *Prog, unsigned Ra, u32 Bytes)
+{
+	/*
+	 * DMAADDH encoding
+	 * 23 ... 8   7 6 5 4 3 2 1  0
+	 * imm[15:0] |0 1 0 1 0 1 ra 0
+	 */
+	char *Instr;
+	u32 Imm;
+
+	while (Bytes) {
+		Imm = (Bytes > XDMAPS_PROG_MAX_ADD) ?
+			XDMAPS_PROG_MAX_ADD : Bytes;
+
+		Instr = XDmaPs_ProgAlloc(Prog, 3);
+		if (Instr == NULL)
+			return;
+
+		*Instr = (char)(0x54 | ((Ra & 1) << 1));
+		*(Instr + 1) = (char)(Imm & 0xFF);
+		*(Instr + 2) = (char)((Imm >> 8) & 0xFF);
+
+		Bytes -= Imm;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Emit a DMALP instruction.
+*
+* @param	Prog is the DMA program.
+* @param	Lc is the loop counter register, 0 or 1.
+* @param	Iterations is the number of iterations, 1 to 256.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgLp(XDmaPs_Prog *Prog, unsigned Lc,
+			  unsigned Iterations)
+{
+	/*
+	 * DMALP encoding
+	 * 15   ...   8 7 6 5 4 3 2 1  0
+	 * | iter[7:0] |0 0 1 0 0 0 lc 0
+	 */
+	XDmaPs_ProgByte(Prog, (u8)(0x20 | ((Lc & 1) << 1)));
+	XDmaPs_ProgByte(Prog, (u8)(Iterations - 1));
+}
+
+/****************************************************************************/
+/**
+*
+* Emit a DMALPEND instruction. The program fails with XST_FAILURE if the
+* loop body is too long for the backward jump.
+*
+* @param	Prog is the DMA program.
+* @param	Lc is the loop counter register, 0 or 1.
+* @param	BodyStart is the offset of the first instruction of the loop
+*		body in the program.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgLpEnd(XDmaPs_Prog *Prog, unsigned Lc,
+			     unsigned BodyStart)
+{
+	/*
+	 * DMALPEND encoding
+	 * 15       ...        8 7 6 5 4  3 2  1  0
+	 * | backward_jump[7:0] |0 0 1 nf 1 lc bs x
+	 */
+	unsigned Jump = Prog->Len - BodyStart;
+
+	if (Prog->Status == XST_SUCCESS && Jump > XDMAPS_PROG_MAX_JUMP) {
+		Prog->Status = XST_FAILURE;
+		return;
+	}
+
+	XDmaPs_ProgByte(Prog, (u8)(0x38 | ((Lc & 1) << 2)));
+	XDmaPs_ProgByte(Prog, (u8)Jump);
+}
+
+/****************************************************************************/
+/**
+*
+* Emit one byte of an instruction.
+*
+* @param	Prog is the DMA program.
+* @param	Byte is the byte.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgByte(XDmaPs_Prog *Prog, u8 Byte)
+{
+	char *Instr = XDmaPs_ProgAlloc(Prog, 1);
+
+	if (Instr != NULL)
+		*Instr = (char)Byte;
+}
+
+/****************************************************************************/
+/**
+*
+* Pad the program with DMANOP so that the next Bytes bytes do not cross an
+* instruction cache line.
+*
+* @param	Prog is the DMA program.
+* @param	Bytes is the length of the code to keep within a line.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XDmaPs_ProgAlign(XDmaPs_Prog *Prog, unsigned Bytes)
+{
+	unsigned NumNops;
+
+	if (Prog->CacheLength == 0 || Bytes > Prog->CacheLength)
+		return;
+
+	if (Prog->Len / Prog->CacheLength ==
+	    (Prog->Len + Bytes - 1) / Prog->CacheLength)
+		return;
+
+	NumNops = Prog->CacheLength - Prog->Len % Prog->CacheLength;
+	while (NumNops--)
+		XDmaPs_ProgByte(Prog, 0x18);
+}
+/** @} */
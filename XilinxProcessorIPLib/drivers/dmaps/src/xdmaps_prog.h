@@ -0,0 +1,163 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal 
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF 
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xdmaps_prog.h
+* @addtogroup dmaps_v2_3
+* @{
+*
+* This file contains the DMA program generator of the XDmaPs driver for
+* scatter-gather and 2D transfers. The generator only writes PL330
+* instructions into a buffer; it does not access the device or the caches,
+* so it can be compiled and checked on a host as well as on the target.
+*
+* A scatter-gather list compiles into one program. Runs of segments of equal
+* length with a constant distance between them are emitted as rows of a 2D
+* transfer: an outer DMALP on loop counter 1 around the burst loop on loop
+* counter 0, with DMAADDH stepping the addresses from row to row. Other
+* segments get their own DMAMOV SAR/DAR and a loop nest of their own.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  	Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.4   ag     10/19/26 First release. XDmaPs_ChanCtrl, XDmaPs_BD and
+*			XDmaPs_ToCCRValue() moved here from xdmaps.h and
+*			xdmaps.c.
+* </pre>
+*
+*****************************************************************************/
+
+#ifndef XDMAPS_PROG_H		/* prevent circular inclusions */
+#define XDMAPS_PROG_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ****************************/
+
+#define XDMAPS_PROG_MAX_LOOP	256	/**< Iterations of one DMALP */
+#define XDMAPS_PROG_MAX_ADDH	4	/**< DMAADDH per address per row, a
+					  *  row step is at most 4 * 0xFFFF
+					  *  bytes beyond the row length */
+
+/**************************** Type Definitions ******************************/
+
+/** DMA channle control structure. It's for AXI bus transaction.
+ * This struct will be translated into a 32-bit channel control register value.
+ */
+typedef struct {
+	unsigned int EndianSwapSize;	/**< Endian swap size. */
+	unsigned int DstCacheCtrl;	/**< Destination cache control */
+	unsigned int DstProtCtrl;	/**< Destination protection control */
+	unsigned int DstBurstLen;	/**< Destination burst length */
+	unsigned int DstBurstSize;	/**< Destination burst size */
+	unsigned int DstInc;		/**< Destination incrementing or fixed
+					 *   address */
+	unsigned int SrcCacheCtrl;	/**< Source cache control */
+	unsigned int SrcProtCtrl;	/**< Source protection control */
+	unsigned int SrcBurstLen;	/**< Source burst length */
+	unsigned int SrcBurstSize;	/**< Source burst size */
+	unsigned int SrcInc;		/**< Source incrementing or fixed
+					 *   address */
+} XDmaPs_ChanCtrl;
+
+/** DMA block descriptor stucture.
+ */
+typedef struct {
+	u32 SrcAddr;		/**< Source starting address */
+	u32 DstAddr;		/**< Destination starting address */
+	unsigned int Length;	/**< Number of bytes for the block */
+} XDmaPs_BD;
+
+/**
+ * A 2D transfer copies Rows rows of RowLength bytes. The start of a row is
+ * SrcStride bytes after the start of the previous row in the source, and
+ * DstStride bytes in the destination. The stride of a fixed address side is
+ * ignored.
+ */
+typedef struct {
+	u32 SrcAddr;		/**< Source address of the first row */
+	u32 DstAddr;		/**< Destination address of the first row */
+	unsigned int RowLength;	/**< Number of bytes in a row */
+	unsigned int Rows;	/**< Number of rows */
+	u32 SrcStride;		/**< Source distance between rows in bytes */
+	u32 DstStride;		/**< Destination distance between rows */
+} XDmaPs_2D;
+
+/**
+ * The XDmaPs_Prog is a DMA program being generated into a buffer supplied
+ * by the caller.
+ */
+typedef struct {
+	char *Buf;		/**< Program buffer */
+	unsigned Size;		/**< Size of the program buffer in bytes */
+	unsigned Len;		/**< Length of the program in bytes */
+	unsigned CacheLength;	/**< Instruction cache line length of the
+				  *  DMAC in bytes, 0 if loops need not be
+				  *  kept within a line */
+	u32 Ccr;		/**< CCR value in effect, for internal use */
+	int CcrValid;		/**< Ccr is known, for internal use */
+	int Status;		/**< XST_SUCCESS, or the first error */
+} XDmaPs_Prog;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+/*
+ * Functions implemented in xdmaps_prog.c
+ */
+u32 XDmaPs_ToCCRValue(XDmaPs_ChanCtrl *ChanCtrl);
+
+void XDmaPs_ProgInit(XDmaPs_Prog *Prog, char *Buf, unsigned Size,
+		     unsigned CacheLength);
+int XDmaPs_ProgSg(XDmaPs_Prog *Prog, unsigned int Channel,
+		  XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_BD *Sg,
+		  unsigned int SgCount);
+int XDmaPs_Prog2D(XDmaPs_Prog *Prog, unsigned int Channel,
+		  XDmaPs_ChanCtrl *ChanCtrl, XDmaPs_2D *Xfer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/** @} */
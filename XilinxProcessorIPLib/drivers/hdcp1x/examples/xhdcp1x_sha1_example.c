@@ -0,0 +1,643 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xhdcp1x_sha1_example.c
+*
+* This file contains tests and a benchmark of the SHA-1 functions used by the
+* hdcp1x driver to compute V and V'.
+*	- SHA-1 known answer tests with the FIPS 180-1 example messages,
+*	  including the one million 'a' message hashed in parts.
+*	- Digests of random messages, fed in random sized parts, compared
+*	  against the byte oriented SHA-1 the driver used before (kept in this
+*	  file as the reference).
+*	- V computed with SHA1KsvListInput and SHA1KsvListResult compared
+*	  against a full recompute of KSV list || BStatus || M0, for KSV lists
+*	  that grow, shrink and change between calls.
+*	- Throughput of the driver and the reference SHA-1 over a large buffer,
+*	  and the time to compute V for 127 KSVs with a full recompute and when
+*	  one KSV is appended.
+*
+* The example runs on the host, for example with
+*
+*	gcc -O2 -I../src ../src/sha1.c xhdcp1x_sha1_example.c -o sha1_example
+*
+* It can also be built for a processor whose BSP provides clock().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 4.1   ag   10/19/26 First Release.
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sha1.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Number of random messages compared against the reference */
+#ifndef TEST_MESSAGES
+#define TEST_MESSAGES		20000
+#endif
+
+/* Largest random message in bytes */
+#define TEST_MESSAGE_MAX	1024
+
+/* Number of KSV lists hashed in the resume test */
+#ifndef TEST_KSV_LISTS
+#define TEST_KSV_LISTS		2000
+#endif
+
+/* Size of the octets hashed after the KSV list, BStatus || M0 */
+#define KSV_TAIL_SIZE		10
+
+/* Size of the buffer used to measure SHA-1 in bytes */
+#define BENCH_SHA_SIZE		(64 * 1024)
+
+/* Number of passes over the SHA-1 buffer */
+#ifndef BENCH_SHA_PASSES
+#define BENCH_SHA_PASSES	256
+#endif
+
+/* Number of V computations measured */
+#ifndef BENCH_V_COUNT
+#define BENCH_V_COUNT		20000
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/** State of the reference SHA-1 */
+typedef struct {
+	uint32_t Hash[5];	/**< Intermediate hash */
+	uint32_t Length;	/**< Message length in bytes */
+	int Index;		/**< Index into Block */
+	uint8_t Block[64];	/**< Message block */
+} RefSha1Ctx;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+#define REF_ROTL(Bits, Word) (((Word) << (Bits)) | ((Word) >> (32 - (Bits))))
+
+/************************** Function Prototypes *****************************/
+
+static void RefSha1Reset(RefSha1Ctx *Ctx);
+static void RefSha1Input(RefSha1Ctx *Ctx, const uint8_t *Data, unsigned Size);
+static void RefSha1Result(RefSha1Ctx *Ctx, uint8_t *Digest);
+static void RefSha1Block(RefSha1Ctx *Ctx);
+static void Sha1Hash(const uint8_t *Data, unsigned Size, uint8_t *Digest);
+static void RefSha1Hash(const uint8_t *Data, unsigned Size, uint8_t *Digest);
+static int Sha1Check(const char *Name, const uint8_t *Digest,
+		const char *Expected);
+static int Sha1Compare(const char *Name, int Failures, int Count);
+static void Sha1Random(uint8_t *Data, unsigned Size);
+static double Sha1Seconds(clock_t Start);
+
+/************************** Variable Definitions ****************************/
+
+static uint8_t Sha1Buffer[BENCH_SHA_SIZE];
+
+/************************** Function Definitions ****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function runs the tests and the benchmark.
+*
+* @param	None.
+*
+* @return	0 if all tests pass, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	SHA1Context Sha;
+	SHA1KsvListContext KsvSha;
+	SHA1KsvListContext SavedSha;
+	uint8_t Message[TEST_MESSAGE_MAX];
+	uint8_t KsvList[SHA1KsvListMaxSize];
+	uint8_t PrevList[SHA1KsvListMaxSize];
+	uint8_t Tail[KSV_TAIL_SIZE];
+	uint8_t Digest[SHA1HashSize];
+	uint8_t RefDigest[SHA1HashSize];
+	unsigned Size;
+	unsigned Offset;
+	unsigned Part;
+	unsigned KsvCount;
+	unsigned Expected;
+	unsigned PrevSize;
+	unsigned Resumed = 0;
+	clock_t Start;
+	double Seconds;
+	double Rate;
+	int Failures;
+	int Errors = 0;
+	int i;
+
+	srand(1);
+
+	/* Known answer tests */
+	Sha1Hash((const uint8_t *)"abc", 3, Digest);
+	Errors += Sha1Check("FIPS 180-1 abc", Digest,
+			"a9993e364706816aba3e25717850c26c9cd0d89d");
+	Sha1Hash((const uint8_t *)
+			"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+			56, Digest);
+	Errors += Sha1Check("FIPS 180-1 448 bit", Digest,
+			"84983e441c3bd26ebaae4aa1f95129e5e54670f1");
+
+	/* One million 'a', hashed in parts that do not align with blocks */
+	memset(Sha1Buffer, 'a', 1000);
+	SHA1Reset(&Sha);
+	for (i = 0; i < 1000; i++) {
+		SHA1Input(&Sha, Sha1Buffer, 1000);
+	}
+	SHA1Result(&Sha, Digest);
+	Errors += Sha1Check("FIPS 180-1 million a", Digest,
+			"34aa973cd4c4daa4f61eeb2bdbad27316534016f");
+
+	/* Random messages in random parts against the reference */
+	Failures = 0;
+	for (i = 0; i < TEST_MESSAGES; i++) {
+		Size = (unsigned)rand() % (TEST_MESSAGE_MAX + 1);
+		Sha1Random(Message, Size);
+
+		SHA1Reset(&Sha);
+		for (Offset = 0; Offset < Size; Offset += Part) {
+			Part = 1 + (unsigned)rand() % 200;
+			if (Part > Size - Offset) {
+				Part = Size - Offset;
+			}
+			SHA1Input(&Sha, &Message[Offset], Part);
+		}
+		SHA1Result(&Sha, Digest);
+
+		RefSha1Hash(Message, Size, RefDigest);
+		Failures += (memcmp(Digest, RefDigest, SHA1HashSize) != 0);
+	}
+	Errors += Sha1Compare("Random messages", Failures, TEST_MESSAGES);
+
+	/*
+	 * KSV lists that mostly grow by a few KSVs, as when devices are added
+	 * to the topology, and sometimes shrink or change, which must fall
+	 * back to a full recompute. PrevList holds the list hashed last time.
+	 */
+	Failures = 0;
+	KsvCount = 0;
+	PrevSize = 0;
+	SHA1KsvListReset(&KsvSha);
+	Sha1Random(KsvList, SHA1KsvListMaxSize);
+	for (i = 0; i < TEST_KSV_LISTS; i++) {
+		switch (rand() % 8) {
+		case 0:
+			/* Change one bit anywhere in the list */
+			if (KsvCount > 0) {
+				Offset = (unsigned)rand() %
+					(KsvCount * SHA1KsvSize);
+				KsvList[Offset] ^= (uint8_t)(1 << (rand() % 8));
+			}
+			break;
+		case 1:
+			/* Start over with a shorter list */
+			KsvCount = (unsigned)rand() % (KsvCount + 1);
+			break;
+		default:
+			/* Append KSVs */
+			KsvCount += (unsigned)rand() % 4;
+			if (KsvCount > SHA1KsvListMaxSize / SHA1KsvSize) {
+				KsvCount = 1;
+			}
+			break;
+		}
+		Size = KsvCount * SHA1KsvSize;
+		Sha1Random(Tail, KSV_TAIL_SIZE);
+
+		SHA1KsvListInput(&KsvSha, KsvList, Size);
+		SHA1KsvListResult(&KsvSha, Tail, KSV_TAIL_SIZE, Digest);
+
+		/* Full recompute of KSV list || BStatus || M0 */
+		memcpy(Message, KsvList, Size);
+		memcpy(&Message[Size], Tail, KSV_TAIL_SIZE);
+		RefSha1Hash(Message, Size + KSV_TAIL_SIZE, RefDigest);
+		Failures += (memcmp(Digest, RefDigest, SHA1HashSize) != 0);
+
+		/* Only a non-empty prefix of the new list is resumed */
+		Expected = 0;
+		if ((PrevSize != 0) && (PrevSize <= Size) &&
+				(memcmp(PrevList, KsvList, PrevSize) == 0)) {
+			Expected = PrevSize;
+		}
+		Failures += (KsvSha.Reused != Expected);
+		Resumed += (Expected != 0);
+
+		memcpy(PrevList, KsvList, Size);
+		PrevSize = Size;
+	}
+	Errors += Sha1Compare("KSV list resume", Failures, TEST_KSV_LISTS);
+	printf("KSV lists resumed:   %10u of %d\n", Resumed, TEST_KSV_LISTS);
+
+	/* Throughput of the driver SHA-1 */
+	Sha1Random(Sha1Buffer, BENCH_SHA_SIZE);
+	Start = clock();
+	for (i = 0; i < BENCH_SHA_PASSES; i++) {
+		Sha1Hash(Sha1Buffer, BENCH_SHA_SIZE, Digest);
+	}
+	Seconds = Sha1Seconds(Start);
+	Rate = ((double)BENCH_SHA_SIZE * BENCH_SHA_PASSES) /
+			(Seconds * 1024.0 * 1024.0);
+	printf("SHA1Input:           %10.2f MB/s\n", Rate);
+
+	/* Throughput of the reference SHA-1 */
+	Start = clock();
+	for (i = 0; i < BENCH_SHA_PASSES; i++) {
+		RefSha1Hash(Sha1Buffer, BENCH_SHA_SIZE, RefDigest);
+	}
+	Seconds = Sha1Seconds(Start);
+	printf("Reference:           %10.2f MB/s (driver %.2fx)\n",
+			((double)BENCH_SHA_SIZE * BENCH_SHA_PASSES) /
+			(Seconds * 1024.0 * 1024.0),
+			Rate / (((double)BENCH_SHA_SIZE * BENCH_SHA_PASSES) /
+			(Seconds * 1024.0 * 1024.0)));
+	Errors += Sha1Compare("Benchmark digest",
+			memcmp(Digest, RefDigest, SHA1HashSize) != 0, 1);
+
+	/* V for 127 KSVs, recomputed from scratch every time */
+	Size = SHA1KsvListMaxSize;
+	Sha1Random(KsvList, Size);
+	Sha1Random(Tail, KSV_TAIL_SIZE);
+	Start = clock();
+	for (i = 0; i < BENCH_V_COUNT; i++) {
+		SHA1KsvListReset(&KsvSha);
+		SHA1KsvListInput(&KsvSha, KsvList, Size);
+		SHA1KsvListResult(&KsvSha, Tail, KSV_TAIL_SIZE, Digest);
+	}
+	Seconds = Sha1Seconds(Start);
+	Rate = Seconds * 1e6 / BENCH_V_COUNT;
+	printf("V, 127 KSVs, full:   %10.2f us\n", Rate);
+
+	/* V for 127 KSVs when the last KSV is appended to 126 hashed KSVs */
+	SHA1KsvListReset(&SavedSha);
+	SHA1KsvListInput(&SavedSha, KsvList, Size - SHA1KsvSize);
+	Start = clock();
+	for (i = 0; i < BENCH_V_COUNT; i++) {
+		KsvSha = SavedSha;
+		SHA1KsvListInput(&KsvSha, KsvList, Size);
+		SHA1KsvListResult(&KsvSha, Tail, KSV_TAIL_SIZE, RefDigest);
+	}
+	Seconds = Sha1Seconds(Start);
+	printf("V, 127 KSVs, resume: %10.2f us (%.2fx)\n",
+			Seconds * 1e6 / BENCH_V_COUNT,
+			Rate / (Seconds * 1e6 / BENCH_V_COUNT));
+	Errors += Sha1Compare("Resumed V digest",
+			(memcmp(Digest, RefDigest, SHA1HashSize) != 0) ||
+			(KsvSha.Reused != Size - SHA1KsvSize), 1);
+
+	printf("%s\n", (Errors == 0) ? "All tests passed" : "Tests failed");
+
+	return (Errors == 0) ? 0 : 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function hashes a message with the driver SHA-1.
+*
+* @param	Data is the message.
+* @param	Size is the message length in bytes.
+* @param	Digest is where the 20 byte digest is returned.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void Sha1Hash(const uint8_t *Data, unsigned Size, uint8_t *Digest)
+{
+	SHA1Context Sha;
+
+	SHA1Reset(&Sha);
+	SHA1Input(&Sha, Data, Size);
+	SHA1Result(&Sha, Digest);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function hashes a message with the reference SHA-1.
+*
+* @param	Data is the message.
+* @param	Size is the message length in bytes.
+* @param	Digest is where the 20 byte digest is returned.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void RefSha1Hash(const uint8_t *Data, unsigned Size, uint8_t *Digest)
+{
+	RefSha1Ctx Ref;
+
+	RefSha1Reset(&Ref);
+	RefSha1Input(&Ref, Data, Size);
+	RefSha1Result(&Ref, Digest);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the reference SHA-1.
+*
+* @param	Ctx is the reference SHA-1 state.
+*
+* @return	None.
+*
+* @note		The reference is the byte oriented implementation of
+*		RFC 3174 that the driver used before, reduced to the
+*		operations needed by this example.
+*
+******************************************************************************/
+static void RefSha1Reset(RefSha1Ctx *Ctx)
+{
+	Ctx->Hash[0] = 0x67452301;
+	Ctx->Hash[1] = 0xEFCDAB89;
+	Ctx->Hash[2] = 0x98BADCFE;
+	Ctx->Hash[3] = 0x10325476;
+	Ctx->Hash[4] = 0xC3D2E1F0;
+	Ctx->Length = 0;
+	Ctx->Index = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds message bytes to the reference SHA-1, one byte at a
+* time.
+*
+* @param	Ctx is the reference SHA-1 state.
+* @param	Data is the message part.
+* @param	Size is the length of the part in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void RefSha1Input(RefSha1Ctx *Ctx, const uint8_t *Data, unsigned Size)
+{
+	while (Size--) {
+		Ctx->Block[Ctx->Index++] = *Data++;
+		Ctx->Length++;
+		if (Ctx->Index == 64) {
+			RefSha1Block(Ctx);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function pads the message and returns the reference SHA-1 digest.
+*
+* @param	Ctx is the reference SHA-1 state.
+* @param	Digest is where the 20 byte digest is returned.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void RefSha1Result(RefSha1Ctx *Ctx, uint8_t *Digest)
+{
+	uint32_t Bits = Ctx->Length * 8;
+	int i;
+
+	Ctx->Block[Ctx->Index++] = 0x80;
+	if (Ctx->Index > 56) {
+		while (Ctx->Index < 64) {
+			Ctx->Block[Ctx->Index++] = 0;
+		}
+		RefSha1Block(Ctx);
+	}
+	while (Ctx->Index < 56) {
+		Ctx->Block[Ctx->Index++] = 0;
+	}
+
+	/* Messages of this example are shorter than 2^29 bytes */
+	Ctx->Block[56] = 0;
+	Ctx->Block[57] = 0;
+	Ctx->Block[58] = 0;
+	Ctx->Block[59] = (uint8_t)(Ctx->Length >> 29);
+	Ctx->Block[60] = (uint8_t)(Bits >> 24);
+	Ctx->Block[61] = (uint8_t)(Bits >> 16);
+	Ctx->Block[62] = (uint8_t)(Bits >> 8);
+	Ctx->Block[63] = (uint8_t)Bits;
+	RefSha1Block(Ctx);
+
+	for (i = 0; i < SHA1HashSize; i++) {
+		Digest[i] = (uint8_t)(Ctx->Hash[i >> 2] >> (8 * (3 - (i & 3))));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function processes one message block of the reference SHA-1 with an
+* 80 word message schedule and looped rounds.
+*
+* @param	Ctx is the reference SHA-1 state.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void RefSha1Block(RefSha1Ctx *Ctx)
+{
+	static const uint32_t K[] = {
+		0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+	};
+	uint32_t W[80];
+	uint32_t A, B, C, D, E, Temp;
+	int t;
+
+	for (t = 0; t < 16; t++) {
+		W[t] = ((uint32_t)Ctx->Block[t * 4] << 24) |
+			((uint32_t)Ctx->Block[t * 4 + 1] << 16) |
+			((uint32_t)Ctx->Block[t * 4 + 2] << 8) |
+			((uint32_t)Ctx->Block[t * 4 + 3]);
+	}
+	for (t = 16; t < 80; t++) {
+		W[t] = REF_ROTL(1, W[t - 3] ^ W[t - 8] ^ W[t - 14] ^ W[t - 16]);
+	}
+
+	A = Ctx->Hash[0];
+	B = Ctx->Hash[1];
+	C = Ctx->Hash[2];
+	D = Ctx->Hash[3];
+	E = Ctx->Hash[4];
+
+	for (t = 0; t < 80; t++) {
+		Temp = REF_ROTL(5, A) + E + W[t] + K[t / 20];
+		if (t < 20) {
+			Temp += (B & C) | ((~B) & D);
+		} else if (t < 40 || t >= 60) {
+			Temp += B ^ C ^ D;
+		} else {
+			Temp += (B & C) | (B & D) | (C & D);
+		}
+		E = D;
+		D = C;
+		C = REF_ROTL(30, B);
+		B = A;
+		A = Temp;
+	}
+
+	Ctx->Hash[0] += A;
+	Ctx->Hash[1] += B;
+	Ctx->Hash[2] += C;
+	Ctx->Hash[3] += D;
+	Ctx->Hash[4] += E;
+	Ctx->Index = 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares a digest against the expected hexadecimal value
+* and reports a mismatch.
+*
+* @param	Name is the name of the test.
+* @param	Digest is the 20 byte computed digest.
+* @param	Expected is the expected digest in hexadecimal.
+*
+* @return	0 if the values match, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int Sha1Check(const char *Name, const uint8_t *Digest,
+		const char *Expected)
+{
+	char Hex[2 * SHA1HashSize + 1];
+	int i;
+
+	for (i = 0; i < SHA1HashSize; i++) {
+		sprintf(&Hex[2 * i], "%02x", Digest[i]);
+	}
+
+	if (strcmp(Hex, Expected) != 0) {
+		printf("%s: FAILED\n", Name);
+		return 1;
+	}
+
+	printf("%s: passed\n", Name);
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reports the result of a randomized comparison.
+*
+* @param	Name is the name of the test.
+* @param	Failures is the number of mismatches.
+* @param	Count is the number of comparisons.
+*
+* @return	0 if there was no mismatch, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int Sha1Compare(const char *Name, int Failures, int Count)
+{
+	if (Failures != 0) {
+		printf("%s: FAILED, %d of %d\n", Name, Failures, Count);
+		return 1;
+	}
+
+	printf("%s: passed, %d\n", Name, Count);
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a buffer with pseudo random bytes.
+*
+* @param	Data is the buffer.
+* @param	Size is the buffer length in bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void Sha1Random(uint8_t *Data, unsigned Size)
+{
+	while (Size--) {
+		*Data++ = (uint8_t)rand();
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time elapsed since Start.
+*
+* @param	Start is the clock value at the start of the measurement.
+*
+* @return	Elapsed time in seconds, at least one clock tick.
+*
+* @note		None.
+*
+******************************************************************************/
+static double Sha1Seconds(clock_t Start)
+{
+	clock_t Ticks = clock() - Start;
+
+	if (Ticks == 0) {
+		Ticks = 1;
+	}
+
+	return (double)Ticks / (double)CLOCKS_PER_SEC;
+}
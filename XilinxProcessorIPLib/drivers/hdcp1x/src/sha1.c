@@ -27,6 +27,16 @@
  *      implementation only works with messages with a length that is
  *      a multiple of the size of an 8-bit character.
  *
+ *  Implementation Notes:
+ *      The compression function works on 32-bit words with a 16 word
+ *      circular message schedule and fully unrolled rounds, and full
+ *      message blocks are hashed directly from the caller's buffer.
+ *      There are no data dependent branches or table lookups.
+ *
+ *      The SHA1KsvList functions keep the state after hashing an HDCP
+ *      1.x KSV list, so that V' can be recomputed from that state
+ *      when a later KSV list only appends KSVs to the hashed one.
+ *
  */
 
 #include "sha1.h"
@@ -37,9 +47,42 @@
 #define SHA1CircularShift(bits,word) \
                 (((word) << (bits)) | ((word) >> (32-(bits))))
 
+/*
+ *  Define the SHA1 round functions, rewritten with fewer operations
+ */
+#define SHA1F0(b,c,d)   ((d) ^ ((b) & ((c) ^ (d))))
+#define SHA1F1(b,c,d)   ((b) ^ (c) ^ (d))
+#define SHA1F2(b,c,d)   (((b) & (c)) | ((d) & ((b) | (c))))
+
+/*
+ *  Define the message schedule on a 16 word circular buffer, W[t] for
+ *  t < 16 is loaded big endian from the block, later words are expanded
+ */
+#define SHA1Load(t) \
+                (W[t] = ((uint32_t)block[(t) * 4] << 24) | \
+                        ((uint32_t)block[(t) * 4 + 1] << 16) | \
+                        ((uint32_t)block[(t) * 4 + 2] << 8) | \
+                        ((uint32_t)block[(t) * 4 + 3]))
+#define SHA1Expand(t) \
+                (W[(t) & 15] = SHA1CircularShift(1, \
+                        W[((t) - 3) & 15] ^ W[((t) - 8) & 15] ^ \
+                        W[((t) - 14) & 15] ^ W[(t) & 15]))
+
+/*
+ *  Define one SHA1 round, the word buffers are renamed by the caller
+ *  instead of being moved
+ */
+#define SHA1Round(a,b,c,d,e,f,k,w) \
+                do { \
+                    (e) += SHA1CircularShift(5,a) + f(b,c,d) + (k) + (w); \
+                    (b) = SHA1CircularShift(30,b); \
+                } while (0)
+
 /* Local Function Prototyptes */
 void SHA1PadMessage(SHA1Context *);
 void SHA1ProcessMessageBlock(SHA1Context *);
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block);
 
 /*
  *  SHA1Reset
@@ -183,28 +226,64 @@ int SHA1Input(    SHA1Context    *context,
     {
          return context->Corrupted;
     }
-    while(length-- && !context->Corrupted)
-    {
-    context->Message_Block[context->Message_Block_Index++] =
-                    (*message_array & 0xFF);
-
-    context->Length_Low += 8;
-    if (context->Length_Low == 0)
+    /*
+     *  Update the length at once, SHA-1 is limited to 2^64 - 1 bits
+     */
+    if ((context->Length_Low + ((uint32_t)length << 3)) < context->Length_Low)
     {
         context->Length_High++;
         if (context->Length_High == 0)
         {
-            /* Message is too long */
             context->Corrupted = 1;
         }
     }
+    context->Length_High += (uint32_t)length >> 29;
+    context->Length_Low += (uint32_t)length << 3;
+    if (context->Corrupted)
+    {
+        return context->Corrupted;
+    }
+
+    /*
+     *  Complete a partially filled message block first
+     */
+    if (context->Message_Block_Index)
+    {
+        unsigned fill = 64 - context->Message_Block_Index;
+
+        if (fill > length)
+        {
+            fill = length;
+        }
+        memcpy(&context->Message_Block[context->Message_Block_Index],
+               message_array, fill);
+        context->Message_Block_Index += fill;
+        message_array += fill;
+        length -= fill;
+
+        if (context->Message_Block_Index == 64)
+        {
+            SHA1ProcessMessageBlock(context);
+        }
+    }
 
-    if (context->Message_Block_Index == 64)
+    /*
+     *  Hash full blocks straight from the message array
+     */
+    while (length >= 64)
     {
-        SHA1ProcessMessageBlock(context);
+        SHA1ProcessBlock(context->Intermediate_Hash, message_array);
+        message_array += 64;
+        length -= 64;
     }
 
-    message_array++;
+    /*
+     *  Keep the rest for the next call
+     */
+    if (length)
+    {
+        memcpy(context->Message_Block, message_array, length);
+        context->Message_Block_Index = length;
     }
 
     return shaSuccess;
@@ -223,99 +302,134 @@ int SHA1Input(    SHA1Context    *context,
  *  Returns:
  *      Nothing.
  *
- *  Comments:
+ */
+void SHA1ProcessMessageBlock(SHA1Context *context)
+{
+    SHA1ProcessBlock(context->Intermediate_Hash, context->Message_Block);
 
+    context->Message_Block_Index = 0;
+}
+
+/*
+ *  SHA1ProcessBlock
+ *
+ *  Description:
+ *      This function will process 512 bits of the message and update
+ *      the intermediate hash with the result.
+ *
+ *  Parameters:
+ *      Intermediate_Hash: [in/out]
+ *          The intermediate hash to update.
+ *      block: [in]
+ *          The 64 octets of the message to process.
+ *
+ *  Returns:
+ *      Nothing.
+ *
+ *  Comments:
  *      Many of the variable names in this code, especially the
  *      single character names, were used because those were the
  *      names used in the publication.
  *
- *
  */
-void SHA1ProcessMessageBlock(SHA1Context *context)
+static void SHA1ProcessBlock(uint32_t Intermediate_Hash[SHA1HashSize/4],
+                             const uint8_t *block)
 {
-    const uint32_t K[] =    {       /* Constants defined in SHA-1   */
-                            0x5A827999,
-                            0x6ED9EBA1,
-                            0x8F1BBCDC,
-                            0xCA62C1D6
-                            };
-    int           t;                 /* Loop counter                */
-    uint32_t      temp;              /* Temporary word value        */
-    uint32_t      W[80];             /* Word sequence               */
+    uint32_t      W[16];             /* Word sequence               */
     uint32_t      A, B, C, D, E;     /* Word buffers                */
 
-    /*
-     *  Initialize the first 16 words in the array W
-     */
-    for(t = 0; t < 16; t++)
-    {
-        W[t] = context->Message_Block[t * 4] << 24;
-        W[t] |= context->Message_Block[t * 4 + 1] << 16;
-        W[t] |= context->Message_Block[t * 4 + 2] << 8;
-        W[t] |= context->Message_Block[t * 4 + 3];
-    }
-
-    for(t = 16; t < 80; t++)
-    {
-       W[t] = SHA1CircularShift(1,W[t-3] ^ W[t-8] ^ W[t-14] ^ W[t-16]);
-    }
-
-    A = context->Intermediate_Hash[0];
-    B = context->Intermediate_Hash[1];
-    C = context->Intermediate_Hash[2];
-    D = context->Intermediate_Hash[3];
-    E = context->Intermediate_Hash[4];
-
-    for(t = 0; t < 20; t++)
-    {
-        temp =  SHA1CircularShift(5,A) +
-                ((B & C) | ((~B) & D)) + E + W[t] + K[0];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-
-        B = A;
-        A = temp;
-    }
-
-    for(t = 20; t < 40; t++)
-    {
-        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[1];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    for(t = 40; t < 60; t++)
-    {
-        temp = SHA1CircularShift(5,A) +
-               ((B & C) | (B & D) | (C & D)) + E + W[t] + K[2];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    for(t = 60; t < 80; t++)
-    {
-        temp = SHA1CircularShift(5,A) + (B ^ C ^ D) + E + W[t] + K[3];
-        E = D;
-        D = C;
-        C = SHA1CircularShift(30,B);
-        B = A;
-        A = temp;
-    }
-
-    context->Intermediate_Hash[0] += A;
-    context->Intermediate_Hash[1] += B;
-    context->Intermediate_Hash[2] += C;
-    context->Intermediate_Hash[3] += D;
-    context->Intermediate_Hash[4] += E;
-
-    context->Message_Block_Index = 0;
+    A = Intermediate_Hash[0];
+    B = Intermediate_Hash[1];
+    C = Intermediate_Hash[2];
+    D = Intermediate_Hash[3];
+    E = Intermediate_Hash[4];
+
+    SHA1Round(A, B, C, D, E, SHA1F0, 0x5A827999, SHA1Load(0));
+    SHA1Round(E, A, B, C, D, SHA1F0, 0x5A827999, SHA1Load(1));
+    SHA1Round(D, E, A, B, C, SHA1F0, 0x5A827999, SHA1Load(2));
+    SHA1Round(C, D, E, A, B, SHA1F0, 0x5A827999, SHA1Load(3));
+    SHA1Round(B, C, D, E, A, SHA1F0, 0x5A827999, SHA1Load(4));
+    SHA1Round(A, B, C, D, E, SHA1F0, 0x5A827999, SHA1Load(5));
+    SHA1Round(E, A, B, C, D, SHA1F0, 0x5A827999, SHA1Load(6));
+    SHA1Round(D, E, A, B, C, SHA1F0, 0x5A827999, SHA1Load(7));
+    SHA1Round(C, D, E, A, B, SHA1F0, 0x5A827999, SHA1Load(8));
+    SHA1Round(B, C, D, E, A, SHA1F0, 0x5A827999, SHA1Load(9));
+    SHA1Round(A, B, C, D, E, SHA1F0, 0x5A827999, SHA1Load(10));
+    SHA1Round(E, A, B, C, D, SHA1F0, 0x5A827999, SHA1Load(11));
+    SHA1Round(D, E, A, B, C, SHA1F0, 0x5A827999, SHA1Load(12));
+    SHA1Round(C, D, E, A, B, SHA1F0, 0x5A827999, SHA1Load(13));
+    SHA1Round(B, C, D, E, A, SHA1F0, 0x5A827999, SHA1Load(14));
+    SHA1Round(A, B, C, D, E, SHA1F0, 0x5A827999, SHA1Load(15));
+    SHA1Round(E, A, B, C, D, SHA1F0, 0x5A827999, SHA1Expand(16));
+    SHA1Round(D, E, A, B, C, SHA1F0, 0x5A827999, SHA1Expand(17));
+    SHA1Round(C, D, E, A, B, SHA1F0, 0x5A827999, SHA1Expand(18));
+    SHA1Round(B, C, D, E, A, SHA1F0, 0x5A827999, SHA1Expand(19));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0x6ED9EBA1, SHA1Expand(20));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0x6ED9EBA1, SHA1Expand(21));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0x6ED9EBA1, SHA1Expand(22));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0x6ED9EBA1, SHA1Expand(23));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0x6ED9EBA1, SHA1Expand(24));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0x6ED9EBA1, SHA1Expand(25));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0x6ED9EBA1, SHA1Expand(26));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0x6ED9EBA1, SHA1Expand(27));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0x6ED9EBA1, SHA1Expand(28));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0x6ED9EBA1, SHA1Expand(29));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0x6ED9EBA1, SHA1Expand(30));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0x6ED9EBA1, SHA1Expand(31));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0x6ED9EBA1, SHA1Expand(32));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0x6ED9EBA1, SHA1Expand(33));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0x6ED9EBA1, SHA1Expand(34));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0x6ED9EBA1, SHA1Expand(35));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0x6ED9EBA1, SHA1Expand(36));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0x6ED9EBA1, SHA1Expand(37));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0x6ED9EBA1, SHA1Expand(38));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0x6ED9EBA1, SHA1Expand(39));
+    SHA1Round(A, B, C, D, E, SHA1F2, 0x8F1BBCDC, SHA1Expand(40));
+    SHA1Round(E, A, B, C, D, SHA1F2, 0x8F1BBCDC, SHA1Expand(41));
+    SHA1Round(D, E, A, B, C, SHA1F2, 0x8F1BBCDC, SHA1Expand(42));
+    SHA1Round(C, D, E, A, B, SHA1F2, 0x8F1BBCDC, SHA1Expand(43));
+    SHA1Round(B, C, D, E, A, SHA1F2, 0x8F1BBCDC, SHA1Expand(44));
+    SHA1Round(A, B, C, D, E, SHA1F2, 0x8F1BBCDC, SHA1Expand(45));
+    SHA1Round(E, A, B, C, D, SHA1F2, 0x8F1BBCDC, SHA1Expand(46));
+    SHA1Round(D, E, A, B, C, SHA1F2, 0x8F1BBCDC, SHA1Expand(47));
+    SHA1Round(C, D, E, A, B, SHA1F2, 0x8F1BBCDC, SHA1Expand(48));
+    SHA1Round(B, C, D, E, A, SHA1F2, 0x8F1BBCDC, SHA1Expand(49));
+    SHA1Round(A, B, C, D, E, SHA1F2, 0x8F1BBCDC, SHA1Expand(50));
+    SHA1Round(E, A, B, C, D, SHA1F2, 0x8F1BBCDC, SHA1Expand(51));
+    SHA1Round(D, E, A, B, C, SHA1F2, 0x8F1BBCDC, SHA1Expand(52));
+    SHA1Round(C, D, E, A, B, SHA1F2, 0x8F1BBCDC, SHA1Expand(53));
+    SHA1Round(B, C, D, E, A, SHA1F2, 0x8F1BBCDC, SHA1Expand(54));
+    SHA1Round(A, B, C, D, E, SHA1F2, 0x8F1BBCDC, SHA1Expand(55));
+    SHA1Round(E, A, B, C, D, SHA1F2, 0x8F1BBCDC, SHA1Expand(56));
+    SHA1Round(D, E, A, B, C, SHA1F2, 0x8F1BBCDC, SHA1Expand(57));
+    SHA1Round(C, D, E, A, B, SHA1F2, 0x8F1BBCDC, SHA1Expand(58));
+    SHA1Round(B, C, D, E, A, SHA1F2, 0x8F1BBCDC, SHA1Expand(59));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0xCA62C1D6, SHA1Expand(60));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0xCA62C1D6, SHA1Expand(61));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0xCA62C1D6, SHA1Expand(62));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0xCA62C1D6, SHA1Expand(63));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0xCA62C1D6, SHA1Expand(64));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0xCA62C1D6, SHA1Expand(65));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0xCA62C1D6, SHA1Expand(66));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0xCA62C1D6, SHA1Expand(67));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0xCA62C1D6, SHA1Expand(68));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0xCA62C1D6, SHA1Expand(69));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0xCA62C1D6, SHA1Expand(70));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0xCA62C1D6, SHA1Expand(71));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0xCA62C1D6, SHA1Expand(72));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0xCA62C1D6, SHA1Expand(73));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0xCA62C1D6, SHA1Expand(74));
+    SHA1Round(A, B, C, D, E, SHA1F1, 0xCA62C1D6, SHA1Expand(75));
+    SHA1Round(E, A, B, C, D, SHA1F1, 0xCA62C1D6, SHA1Expand(76));
+    SHA1Round(D, E, A, B, C, SHA1F1, 0xCA62C1D6, SHA1Expand(77));
+    SHA1Round(C, D, E, A, B, SHA1F1, 0xCA62C1D6, SHA1Expand(78));
+    SHA1Round(B, C, D, E, A, SHA1F1, 0xCA62C1D6, SHA1Expand(79));
+
+    Intermediate_Hash[0] += A;
+    Intermediate_Hash[1] += B;
+    Intermediate_Hash[2] += C;
+    Intermediate_Hash[3] += D;
+    Intermediate_Hash[4] += E;
 }
 
 /*
@@ -389,3 +503,145 @@ void SHA1PadMessage(SHA1Context *context)
 
     SHA1ProcessMessageBlock(context);
 }
+
+/*
+ *  SHA1KsvListReset
+ *
+ *  Description:
+ *      This function will drop the KSV list state kept in the
+ *      SHA1KsvListContext, the next SHA1KsvListInput will hash the
+ *      whole KSV list.
+ *
+ *  Parameters:
+ *      context: [in/out]
+ *          The context to reset.
+ *
+ *  Returns:
+ *      sha Error Code.
+ *
+ */
+int SHA1KsvListReset(SHA1KsvListContext *context)
+{
+    if (!context)
+    {
+        return shaNull;
+    }
+
+    context->KsvListSize = 0;
+    context->Reused = 0;
+
+    return SHA1Reset(&context->KsvState);
+}
+
+/*
+ *  SHA1KsvListInput
+ *
+ *  Description:
+ *      This function hashes an HDCP 1.x KSV list.  If the previously
+ *      hashed KSV list is a prefix of the new one, i.e. the topology
+ *      only grew, only the appended KSVs are hashed on top of the kept
+ *      state.  Otherwise the whole KSV list is hashed again.
+ *
+ *  Parameters:
+ *      context: [in/out]
+ *          The KSV list context to update.
+ *      ksv_list: [in]
+ *          The KSV list, SHA1KsvSize octets per KSV.
+ *      length: [in]
+ *          The length of the KSV list in octets.
+ *
+ *  Returns:
+ *      sha Error Code.
+ *
+ */
+int SHA1KsvListInput(SHA1KsvListContext *context,
+                     const uint8_t *ksv_list,
+                     unsigned int length)
+{
+    unsigned int hashed;
+    int err;
+
+    if (!context || (!ksv_list && length))
+    {
+        return shaNull;
+    }
+
+    if (length > SHA1KsvListMaxSize)
+    {
+        return shaInputTooLong;
+    }
+
+    /*
+     *  The KSVs are public values, so comparing them with memcmp does
+     *  not leak anything.  An empty kept list is never resumed since
+     *  the kept state may not be initialized.
+     */
+    hashed = context->KsvListSize;
+    if (!hashed || (hashed > length) ||
+        memcmp(context->KsvList, ksv_list, hashed))
+    {
+        hashed = 0;
+        SHA1Reset(&context->KsvState);
+    }
+    context->Reused = hashed;
+
+    err = SHA1Input(&context->KsvState, ksv_list + hashed, length - hashed);
+    if (err != shaSuccess)
+    {
+        context->KsvListSize = 0;
+        return err;
+    }
+
+    memcpy(context->KsvList + hashed, ksv_list + hashed, length - hashed);
+    context->KsvListSize = length;
+
+    return shaSuccess;
+}
+
+/*
+ *  SHA1KsvListResult
+ *
+ *  Description:
+ *      This function appends the tail of the message (BInfo/BStatus
+ *      and M0 for HDCP 1.x) to the hashed KSV list and returns the
+ *      160-bit message digest.  The KSV list state is kept.
+ *
+ *  Parameters:
+ *      context: [in]
+ *          The KSV list context.
+ *      tail: [in]
+ *          The octets hashed after the KSV list.
+ *      tail_length: [in]
+ *          The length of the tail in octets.
+ *      Message_Digest: [out]
+ *          Where the digest is returned.
+ *
+ *  Returns:
+ *      sha Error Code.
+ *
+ */
+int SHA1KsvListResult(const SHA1KsvListContext *context,
+                      const uint8_t *tail,
+                      unsigned int tail_length,
+                      uint8_t Message_Digest[SHA1HashSize])
+{
+    SHA1Context sha;
+    int err;
+
+    if (!context)
+    {
+        return shaNull;
+    }
+
+    sha = context->KsvState;
+    err = SHA1Input(&sha, tail, tail_length);
+    if (err == shaSuccess)
+    {
+        err = SHA1Result(&sha, Message_Digest);
+    }
+
+    /* message may be sensitive, clear it out */
+    memset(&sha, 0, sizeof(sha));
+
+    return err;
+}
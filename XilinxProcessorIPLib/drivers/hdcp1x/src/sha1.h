@@ -41,6 +41,12 @@ enum
 #endif
 #define SHA1HashSize 20
 
+/*
+ *  Size of an HDCP 1.x KSV and of the largest KSV list (127 devices)
+ */
+#define SHA1KsvSize         5
+#define SHA1KsvListMaxSize  (127 * SHA1KsvSize)
+
 /**
  *  This structure will hold context information for the SHA-1
  *  hashing operation
@@ -59,6 +65,18 @@ typedef struct SHA1Context
     int Corrupted;                     /**< Is the message digest corrupted? */
 } SHA1Context;
 
+/**
+ *  This structure will hold the SHA-1 state after hashing an HDCP 1.x
+ *  KSV list, so that it can be resumed when KSVs are appended
+ */
+typedef struct SHA1KsvListContext
+{
+    SHA1Context KsvState;                /**< State after the KSV list     */
+    uint8_t KsvList[SHA1KsvListMaxSize]; /**< KSV list hashed in KsvState  */
+    unsigned int KsvListSize;            /**< Size of KsvList in octets    */
+    unsigned int Reused;                 /**< Octets reused by last input  */
+} SHA1KsvListContext;
+
 /*
  *  Function Prototypes
  */
@@ -70,4 +88,13 @@ int SHA1Input(  SHA1Context *,
 int SHA1Result( SHA1Context *,
                 uint8_t Message_Digest[SHA1HashSize]);
 
+int SHA1KsvListReset(  SHA1KsvListContext *);
+int SHA1KsvListInput(  SHA1KsvListContext *,
+                       const uint8_t *,
+                       unsigned int);
+int SHA1KsvListResult( const SHA1KsvListContext *,
+                       const uint8_t *,
+                       unsigned int,
+                       uint8_t Message_Digest[SHA1HashSize]);
+
 #endif
@@ -721,6 +721,7 @@
 * 4.1   yas    11/10/16 Added function XHdcp1x_SetHdmiMode.
 * 4.1   yas    08/03/17 Added flag IsAuthReqPending to the XHdcp1x_Tx data
 *                       structure to track any pending authentication requests.
+* 4.2   ag     10/19/26 Added KsvListSha to the XHdcp1x data structure.
 * </pre>
 *
 ******************************************************************************/
@@ -739,6 +740,7 @@ extern "C" {
 #include "xhdcp1x_hw.h"
 #include "xstatus.h"
 #include "xtmrctr.h"
+#include "sha1.h"
 
 /************************** Constant Definitions *****************************/
 #define XHDCP1X_KSV_SIZE	5 /**< Size of each hdcp 1.4 Public Key
@@ -1151,6 +1153,9 @@ typedef struct {
 	XHdcp1x_RepeaterExchange RepeaterValues; /**< The Repeater value to
 						   *  be exchanged between
 						   *  Tx and Rx */
+	SHA1KsvListContext KsvListSha;	/**< SHA-1 state of the last hashed
+					  *  KSV list, resumed while the
+					  *  topology only grows */
 	void *Hdcp1xRef;	/**< A void reference pointer for
 				  *  association of a external core
 				  *  in our case a timer with the
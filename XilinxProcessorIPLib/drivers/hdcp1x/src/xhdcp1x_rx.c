@@ -74,6 +74,8 @@
 *                       XHdcp1x_RxSetTopologyMaxDevsExceeded,
 *                       XHdcp1x_RxCheckEncryptionChange.
 * 4.1   yas    11/10/16 Added function XHdcp1x_RxSetHdmiMode.
+* 4.2   ag     10/19/26 Hash the KSV list with SHA1KsvListInput so that V
+*                       is resumed when the topology only grows.
 * </pre>
 *
 *****************************************************************************/
@@ -1330,8 +1332,8 @@ static void XHdcp1x_RxPollForComputations(XHdcp1x *InstancePtr,
 ******************************************************************************/
 static int XHdcp1x_RxCalculateSHA1Value(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 {
-	SHA1Context Sha1Context;
 	u8 Buf[24];
+	u8 KsvListBuf[SHA1KsvListMaxSize];
 	u32 NumToRead = 0;
 	int IsValid = FALSE;
 	u32 KsvCount;
@@ -1340,26 +1342,21 @@ static int XHdcp1x_RxCalculateSHA1Value(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 	/* Initialize Buf */
 	memset(Buf, 0, 24);
 
-	/* Initialize Sha1Context */
-	SHA1Reset(&Sha1Context);
-
 	/* Assume success */
 	IsValid = TRUE;
 
 	/* Determine theNumToRead */
 	NumToRead = ((RepeaterInfo & 0x7Fu));
 
-	/* Read one ksv at a time from the
-	 * Ksv List and send it to SHA1 Input
-	 */
+	/* Serialize the Ksv List for the SHA1 Input */
 	KsvCount = 0;
 
 	while (KsvCount < NumToRead) {
 		if (InstancePtr->RepeaterValues.DeviceCount > 0) {
 			tempKsv = InstancePtr->RepeaterValues.KsvList[KsvCount];
-			XHDCP1X_PORT_UINT_TO_BUF(Buf , tempKsv ,
-					(XHDCP1X_PORT_SIZE_BKSV*8));
-			SHA1Input(&Sha1Context , Buf , XHDCP1X_PORT_SIZE_BKSV);
+			XHDCP1X_PORT_UINT_TO_BUF((KsvListBuf +
+					(KsvCount * XHDCP1X_PORT_SIZE_BKSV)),
+					tempKsv, (XHDCP1X_PORT_SIZE_BKSV*8));
 		}
 		else {
 			IsValid = FALSE;
@@ -1367,6 +1364,15 @@ static int XHdcp1x_RxCalculateSHA1Value(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 		KsvCount++;
 	}
 
+	/* Hash the Ksv List, resuming if it only grew since last time */
+	if (IsValid) {
+		if (SHA1KsvListInput(&InstancePtr->KsvListSha, KsvListBuf,
+				(NumToRead * XHDCP1X_PORT_SIZE_BKSV)) !=
+				shaSuccess) {
+			IsValid = FALSE;
+		}
+	}
+
 	/* Check for success */
 	if (IsValid) {
 		u64 Mo = 0;
@@ -1375,16 +1381,14 @@ static int XHdcp1x_RxCalculateSHA1Value(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 		/* Insert RepeaterInfo into the SHA-1 transform */
 		Buf[0] = (u8) (RepeaterInfo & 0xFFu);
 		Buf[1] = (u8) ((RepeaterInfo >> 8) & 0xFFu);
-		SHA1Input(&Sha1Context, Buf, 2);
 
 		/* Insert the Mo into the SHA-1 transform */
 		Mo = XHdcp1x_CipherGetMo(InstancePtr);
-		XHDCP1X_PORT_UINT_TO_BUF(Buf, Mo, 64);
-
-		SHA1Input(&Sha1Context, Buf, 8);
+		XHDCP1X_PORT_UINT_TO_BUF((Buf + 2), Mo, 64);
 
 		/* Finalize the SHA-1 result and confirm success */
-		if (SHA1Result(&Sha1Context, Sha1Result) == shaSuccess) {
+		if (SHA1KsvListResult(&InstancePtr->KsvListSha, Buf, 10,
+				Sha1Result) == shaSuccess) {
 			/* Offset(XHDCP1X_PORT_OFFSET_VH0) = 0 */
 			u8 Offset = 0;
 			const u8 *Sha1Buf = Sha1Result;
@@ -73,6 +73,8 @@
 *                       Increase timeout for topology propagation.
 * 4.1   yas    08/03/17 Updated the XHdcp1x_TxIsInProgress to track any
 *                       pending authentication requests.
+* 4.2   ag     10/19/26 Hash the KSV list with SHA1KsvListInput so that V
+*                       is resumed when the topology only grows.
 * </pre>
 *
 *****************************************************************************/
@@ -1841,9 +1843,9 @@ static void XHdcp1x_TxPollForWaitForReady(XHdcp1x *InstancePtr,
 ******************************************************************************/
 static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 {
-	SHA1Context Sha1Context;
 	u8 Buf[24];
 	int NumToRead = 0;
+	int KsvListSize = 0;
 	int KsvCount = 0;
 	int IsValid = FALSE;
 
@@ -1865,14 +1867,12 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 	/* Initialize Buf */
 	memset(Buf, 0, 24);
 
-	/* Initialize Sha1Context */
-	SHA1Reset(&Sha1Context);
-
 	/* Assume success */
 	IsValid = TRUE;
 
 	/* Determine theNumToRead */
 	NumToRead = (((RepeaterInfo & 0x7Fu) * 5));
+	KsvListSize = NumToRead;
 
 #if defined(XPAR_XV_HDMITX_NUM_INSTANCES) && (XPAR_XV_HDMITX_NUM_INSTANCES > 0)
 	/* Read the ksv list */
@@ -1882,9 +1882,6 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 	if(XHdcp1x_PortRead(InstancePtr, XHDCP1X_PORT_OFFSET_KSVFIFO,
 			ksvListHolder, NumToRead) ) {
 
-		/* Update the calculation of V */
-		SHA1Input(&Sha1Context, ksvListHolder, NumToRead);
-
 		/* Update this value in the RepeaterExchange
 		 * structure to be read later by RX */
 
@@ -1949,9 +1946,6 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 		if (XHdcp1x_PortRead(InstancePtr, XHDCP1X_PORT_OFFSET_KSVFIFO,
 				Buf, NumThisTime) > 0) {
 
-			/* Update the calculation of V */
-			SHA1Input(&Sha1Context, Buf, NumThisTime);
-
 			/* Duplicate the buffer */
 			int BufReadKsvCount=0;
 			while(BufReadKsvCount < NumThisTime) {
@@ -1976,6 +1970,18 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 
 #endif
 
+	/* Hash the ksv list, resuming if it only grew since last time */
+	if (IsValid) {
+		if (SHA1KsvListInput(&InstancePtr->KsvListSha, ksvListHolder,
+				KsvListSize) != shaSuccess) {
+			IsValid = FALSE;
+		}
+		else if (InstancePtr->KsvListSha.Reused > 0) {
+			XHdcp1x_TxDebugLog(InstancePtr,
+				"ksv list hash resumed");
+		}
+	}
+
 	/* Check for success */
 	if (IsValid) {
 		u64 Mo = 0;
@@ -1991,15 +1997,14 @@ static int XHdcp1x_TxValidateKsvList(XHdcp1x *InstancePtr, u16 RepeaterInfo)
 		Buf[1] = (u8) ((RepeaterInfo >> XHDCP1X_PORT_BINFO_DEPTH_SHIFT)
 						& 0xFFu);
 #endif
-		SHA1Input(&Sha1Context, Buf, 2);
 
 		/* Insert the Mo into the SHA-1 transform */
 		Mo = XHdcp1x_CipherGetMo(InstancePtr);
-		XHDCP1X_PORT_UINT_TO_BUF(Buf, Mo, 64);
-		SHA1Input(&Sha1Context, Buf, 8);
+		XHDCP1X_PORT_UINT_TO_BUF((Buf + 2), Mo, 64);
 
 		/* Finalize the SHA-1 result and confirm success */
-		if (SHA1Result(&Sha1Context, Sha1Result) == shaSuccess) {
+		if (SHA1KsvListResult(&InstancePtr->KsvListSha, Buf, 10,
+				Sha1Result) == shaSuccess) {
 
 			u8 Offset = XHDCP1X_PORT_OFFSET_VH0;
 			const u8 *Sha1Buf = Sha1Result;
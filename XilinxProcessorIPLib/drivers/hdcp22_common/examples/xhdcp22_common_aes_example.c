@@ -0,0 +1,275 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_common_aes_example.c
+*
+* This file contains known answer tests and a throughput measurement of the
+* AES-128 functions of the hdcp22_common driver.
+*	- Known answer tests of XHdcp22Cmn_Aes128Encrypt and
+*	  XHdcp22Cmn_Aes128Decrypt with the vectors of FIPS-197 Appendix C.1
+*	  and NIST SP 800-38A F.1.1.
+*	- Known answer tests of XHdcp22Cmn_Aes128CtrEncrypt with the vectors of
+*	  NIST SP 800-38A F.5.1, including a partial last block and in place
+*	  operation.
+*	- Throughput of single block encryption, as used by the HDCP 2.2 key
+*	  derivation, and of CTR mode over a large buffer.
+*
+* The example runs on the host, for example with
+*
+*	gcc -O2 -I../src -I<bsp>/common ../src/aes.c
+*		xhdcp22_common_aes_example.c -o aes_example
+*
+* where <bsp>/common holds xil_types.h of the standalone BSP. Add
+* -DAES_CIPHER_BYTEWISE to measure the byte oriented implementation. It can
+* also be built for a processor whose BSP provides clock().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 2.02  ag   10/19/26 First Release.
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Number of single block encryptions measured */
+#ifndef BENCH_BLOCKS
+#define BENCH_BLOCKS		100000
+#endif
+
+/* Size of the buffer used to measure CTR mode in bytes */
+#define BENCH_CTR_SIZE		(64 * 1024)
+
+/* Number of passes over the CTR buffer */
+#ifndef BENCH_CTR_PASSES
+#define BENCH_CTR_PASSES	32
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/** Single block known answer test */
+typedef struct {
+	const char *Name;	/**< Name printed in the report */
+	u8 Key[16];		/**< Key */
+	u8 Plaintext[16];	/**< Plaintext */
+	u8 Ciphertext[16];	/**< Expected ciphertext */
+} AesKat;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static int AesCheck(const char *Name, const u8 *Result, const u8 *Expected,
+			u32 Size);
+static double AesSeconds(clock_t Start);
+
+/************************** Variable Definitions ****************************/
+
+static const AesKat Kats[] = {
+	{"FIPS-197 C.1",
+	 {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,
+	  0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f},
+	 {0x00,0x11,0x22,0x33,0x44,0x55,0x66,0x77,
+	  0x88,0x99,0xaa,0xbb,0xcc,0xdd,0xee,0xff},
+	 {0x69,0xc4,0xe0,0xd8,0x6a,0x7b,0x04,0x30,
+	  0xd8,0xcd,0xb7,0x80,0x70,0xb4,0xc5,0x5a}},
+	{"SP 800-38A F.1.1",
+	 {0x2b,0x7e,0x15,0x16,0x28,0xae,0xd2,0xa6,
+	  0xab,0xf7,0x15,0x88,0x09,0xcf,0x4f,0x3c},
+	 {0x6b,0xc1,0xbe,0xe2,0x2e,0x40,0x9f,0x96,
+	  0xe9,0x3d,0x7e,0x11,0x73,0x93,0x17,0x2a},
+	 {0x3a,0xd7,0x7b,0xb4,0x0d,0x7a,0x36,0x60,
+	  0xa8,0x9e,0xca,0xf3,0x24,0x66,0xef,0x97}},
+};
+
+/* NIST SP 800-38A F.5.1 CTR-AES128.Encrypt */
+static const u8 CtrKey[16] = {
+	0x2b,0x7e,0x15,0x16,0x28,0xae,0xd2,0xa6,
+	0xab,0xf7,0x15,0x88,0x09,0xcf,0x4f,0x3c
+};
+
+static const u8 CtrIv[16] = {
+	0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,
+	0xf8,0xf9,0xfa,0xfb,0xfc,0xfd,0xfe,0xff
+};
+
+static const u8 CtrPlaintext[64] = {
+	0x6b,0xc1,0xbe,0xe2,0x2e,0x40,0x9f,0x96,0xe9,0x3d,0x7e,0x11,0x73,0x93,0x17,0x2a,
+	0xae,0x2d,0x8a,0x57,0x1e,0x03,0xac,0x9c,0x9e,0xb7,0x6f,0xac,0x45,0xaf,0x8e,0x51,
+	0x30,0xc8,0x1c,0x46,0xa3,0x5c,0xe4,0x11,0xe5,0xfb,0xc1,0x19,0x1a,0x0a,0x52,0xef,
+	0xf6,0x9f,0x24,0x45,0xdf,0x4f,0x9b,0x17,0xad,0x2b,0x41,0x7b,0xe6,0x6c,0x37,0x10
+};
+
+static const u8 CtrCiphertext[64] = {
+	0x87,0x4d,0x61,0x91,0xb6,0x20,0xe3,0x26,0x1b,0xef,0x68,0x64,0x99,0x0d,0xb6,0xce,
+	0x98,0x06,0xf6,0x6b,0x79,0x70,0xfd,0xff,0x86,0x17,0x18,0x7b,0xb9,0xff,0xfd,0xff,
+	0x5a,0xe4,0xdf,0x3e,0xdb,0xd5,0xd3,0x5e,0x5b,0x4f,0x09,0x02,0x0d,0xb0,0x3e,0xab,
+	0x1e,0x03,0x1d,0xda,0x2f,0xbe,0x03,0xd1,0x79,0x21,0x70,0xa0,0xf3,0x00,0x9c,0xee
+};
+
+static u8 CtrBuffer[BENCH_CTR_SIZE];
+
+/************************** Function Definitions ****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function runs the known answer tests and the throughput measurement.
+*
+* @param	None.
+*
+* @return	0 if all known answer tests pass, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	u8 Block[16];
+	u8 Buffer[64];
+	clock_t Start;
+	double Seconds;
+	size_t i;
+	int Errors = 0;
+
+	/* Single block encryption and decryption */
+	for (i = 0; i < sizeof(Kats) / sizeof(Kats[0]); i++) {
+		XHdcp22Cmn_Aes128Encrypt(Kats[i].Plaintext, Kats[i].Key, Block);
+		Errors += AesCheck(Kats[i].Name, Block, Kats[i].Ciphertext, 16);
+
+		XHdcp22Cmn_Aes128Decrypt(Kats[i].Ciphertext, Kats[i].Key, Block);
+		Errors += AesCheck(Kats[i].Name, Block, Kats[i].Plaintext, 16);
+	}
+
+	/* CTR mode, whole blocks */
+	XHdcp22Cmn_Aes128CtrEncrypt(CtrPlaintext, 64, CtrKey, CtrIv, Buffer);
+	Errors += AesCheck("SP 800-38A F.5.1", Buffer, CtrCiphertext, 64);
+
+	/* CTR mode, partial last block */
+	memset(Buffer, 0, sizeof(Buffer));
+	XHdcp22Cmn_Aes128CtrEncrypt(CtrPlaintext, 37, CtrKey, CtrIv, Buffer);
+	Errors += AesCheck("SP 800-38A F.5.1 (37 bytes)", Buffer,
+			CtrCiphertext, 37);
+
+	/* CTR mode, in place decryption */
+	memcpy(Buffer, CtrCiphertext, 64);
+	XHdcp22Cmn_Aes128CtrEncrypt(Buffer, 64, CtrKey, CtrIv, Buffer);
+	Errors += AesCheck("SP 800-38A F.5.2 (in place)", Buffer,
+			CtrPlaintext, 64);
+
+	/* Throughput of single block encryption, including the key setup */
+	memset(Block, 0, sizeof(Block));
+	Start = clock();
+	for (i = 0; i < BENCH_BLOCKS; i++) {
+		XHdcp22Cmn_Aes128Encrypt(Block, CtrKey, Block);
+	}
+	Seconds = AesSeconds(Start);
+	printf("Aes128Encrypt:    %10.0f blocks/s\n", BENCH_BLOCKS / Seconds);
+
+	/* Throughput of CTR mode */
+	Start = clock();
+	for (i = 0; i < BENCH_CTR_PASSES; i++) {
+		XHdcp22Cmn_Aes128CtrEncrypt(CtrBuffer, BENCH_CTR_SIZE, CtrKey,
+				CtrIv, CtrBuffer);
+	}
+	Seconds = AesSeconds(Start);
+	printf("Aes128CtrEncrypt: %10.2f MB/s\n",
+			((double)BENCH_CTR_SIZE * BENCH_CTR_PASSES) /
+			(Seconds * 1024.0 * 1024.0));
+
+	printf("%s\n", (Errors == 0) ? "All known answer tests passed" :
+			"Known answer tests failed");
+
+	return (Errors == 0) ? 0 : 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares a result against the expected value and reports a
+* mismatch.
+*
+* @param	Name is the name of the test.
+* @param	Result is the computed value.
+* @param	Expected is the expected value.
+* @param	Size is the number of bytes compared.
+*
+* @return	0 if the values match, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int AesCheck(const char *Name, const u8 *Result, const u8 *Expected,
+			u32 Size)
+{
+	if (memcmp(Result, Expected, Size) != 0) {
+		printf("%s: FAILED\n", Name);
+		return 1;
+	}
+
+	printf("%s: passed\n", Name);
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time elapsed since Start.
+*
+* @param	Start is the clock value at the start of the measurement.
+*
+* @return	Elapsed time in seconds, at least one clock tick.
+*
+* @note		None.
+*
+******************************************************************************/
+static double AesSeconds(clock_t Start)
+{
+	clock_t Ticks = clock() - Start;
+
+	if (Ticks == 0) {
+		Ticks = 1;
+	}
+
+	return (double)Ticks / (double)CLOCKS_PER_SEC;
+}
@@ -0,0 +1,229 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_common_modexp_bench.c
+*
+* This file contains a benchmark of the modular exponentiation of the
+* bigdigits library used by the HDCP 2.2 drivers. It compares mpModExp(),
+* which uses Montgomery multiplication for odd moduli, against
+* mpModExp_div(), which reduces by division after every step, for the
+* operations of HDCP 2.2 authentication:
+*	- 3072-bit and 1024-bit public key operations with e = 65537, as in
+*	  the DCP LLC signature checks and the Km encryption of the
+*	  transmitter.
+*	- 512-bit and 1024-bit operations with a full length exponent, as in
+*	  the private key operation of the receiver.
+* The results of both functions are compared on every run.
+*
+* The benchmark runs on the host, for example with
+*
+*	gcc -O2 -Dxil_printf=printf -I../src -I<bsp>/common
+*		../src/bigdigits.c xhdcp22_common_modexp_bench.c
+*		-o modexp_bench
+*
+* where <bsp>/common holds xil_types.h of the standalone BSP. xil_printf is
+* mapped to printf as mpPrint() of bigdigits.c uses it. It can also be
+* built for a processor whose BSP provides clock().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 2.01  ag   10/19/26 First Release.
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <stdio.h>
+#include <time.h>
+#include "bigdigits.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Repetitions of each operation */
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS	20
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/** Operation measured by the benchmark */
+typedef struct {
+	const char *Name;	/**< Name printed in the report */
+	size_t ModBits;		/**< Length of the modulus in bits */
+	int ShortExp;		/**< Exponent is 65537 if set, else full length */
+} BenchCase;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static void BenchRandom(u32 a[], size_t ndigits);
+static double BenchTime(int (*ModExp)(u32 *, const u32 *, const u32 *,
+			u32 *, size_t), u32 y[], const u32 x[], const u32 e[],
+			u32 m[], size_t ndigits);
+
+/************************** Variable Definitions ****************************/
+
+static const BenchCase Cases[] = {
+	{"RSA-3072 verify (e=65537)", 3072, 1},
+	{"RSA-1024 encrypt (e=65537)", 1024, 1},
+	{"RSA-512 private (CRT half)", 512, 0},
+	{"RSA-1024 private", 1024, 0},
+};
+
+static u32 BenchSeed = 0x12345678;
+
+/************************** Function Definitions ****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function runs the benchmark.
+*
+* @param	None.
+*
+* @return	0 if all results match, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	u32 m[MAX_FIXED_DIGITS];
+	u32 x[MAX_FIXED_DIGITS];
+	u32 e[MAX_FIXED_DIGITS];
+	u32 yd[MAX_FIXED_DIGITS];
+	u32 ym[MAX_FIXED_DIGITS];
+	double TimeDiv;
+	double TimeMont;
+	size_t ndigits;
+	size_t i;
+	int Errors = 0;
+
+	printf("%-28s %12s %12s %8s\n", "operation", "div (ms)",
+			"mont (ms)", "speedup");
+
+	for (i = 0; i < sizeof(Cases) / sizeof(Cases[0]); i++) {
+		ndigits = Cases[i].ModBits / BITS_PER_DIGIT;
+
+		/* Odd modulus of full length, base below it */
+		BenchRandom(m, ndigits);
+		m[ndigits - 1] |= HIBITMASK;
+		m[0] |= 1;
+		BenchRandom(x, ndigits);
+		x[ndigits - 1] &= ~HIBITMASK;
+
+		if (Cases[i].ShortExp) {
+			mpSetDigit(e, 65537, ndigits);
+		} else {
+			BenchRandom(e, ndigits);
+		}
+
+		TimeDiv = BenchTime(mpModExp_div, yd, x, e, m, ndigits);
+		TimeMont = BenchTime(mpModExp, ym, x, e, m, ndigits);
+
+		if (!mpEqual(yd, ym, ndigits)) {
+			printf("%s: results differ\n", Cases[i].Name);
+			Errors++;
+		}
+
+		printf("%-28s %12.3f %12.3f %7.1fx\n", Cases[i].Name,
+				TimeDiv, TimeMont, TimeDiv / TimeMont);
+	}
+
+	return (Errors == 0) ? 0 : 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function fills a number with pseudo random digits. The sequence is
+* fixed so runs can be compared.
+*
+* @param	a is the number.
+* @param	ndigits is the length of a in digits.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void BenchRandom(u32 a[], size_t ndigits)
+{
+	size_t i;
+
+	for (i = 0; i < ndigits; i++) {
+		/* xorshift32 */
+		BenchSeed ^= BenchSeed << 13;
+		BenchSeed ^= BenchSeed >> 17;
+		BenchSeed ^= BenchSeed << 5;
+		a[i] = BenchSeed;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the average time of one modular exponentiation.
+*
+* @param	ModExp is the function measured.
+* @param	y is the result.
+* @param	x is the base.
+* @param	e is the exponent.
+* @param	m is the modulus.
+* @param	ndigits is the length of the numbers in digits.
+*
+* @return	Time of one call in milliseconds.
+*
+* @note		None.
+*
+******************************************************************************/
+static double BenchTime(int (*ModExp)(u32 *, const u32 *, const u32 *,
+			u32 *, size_t), u32 y[], const u32 x[], const u32 e[],
+			u32 m[], size_t ndigits)
+{
+	clock_t Start;
+	int i;
+
+	Start = clock();
+	for (i = 0; i < BENCH_ITERATIONS; i++) {
+		ModExp(y, x, e, m, ndigits);
+	}
+
+	return ((double)(clock() - Start) * 1000.0) /
+			((double)CLOCKS_PER_SEC * BENCH_ITERATIONS);
+}
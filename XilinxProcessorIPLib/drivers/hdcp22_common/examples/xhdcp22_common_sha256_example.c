@@ -0,0 +1,296 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* XILINX CONSORTIUM BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_common_sha256_example.c
+*
+* This file contains known answer tests and a benchmark of the SHA-256 and
+* HMAC-SHA256 functions of the hdcp22_common driver.
+*	- SHA-256 known answer tests with the FIPS 180-2 example messages,
+*	  including the one million 'a' message hashed in parts.
+*	- HMAC-SHA256 known answer tests with the RFC 4231 test cases, covering
+*	  keys longer than the block size.
+*	- Throughput of SHA-256 over a large buffer.
+*	- Rate of HMAC-SHA256 over an HDCP 2.2 sized message (the H' input
+*	  rtx || RxCaps || TxCaps with key kd), once with the key set up for
+*	  every message and once with a cached context.
+*
+* The example runs on the host, for example with
+*
+*	gcc -O2 -I../src -I<bsp>/common ../src/sha2.c ../src/hmac.c
+*		xhdcp22_common_sha256_example.c -o sha256_example
+*
+* where <bsp>/common holds xil_types.h and xstatus.h of the standalone BSP.
+* It can also be built for a processor whose BSP provides clock().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 2.03  ag   10/19/26 First Release.
+*</pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "xstatus.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Size of the buffer used to measure SHA-256 in bytes */
+#define BENCH_SHA_SIZE		(64 * 1024)
+
+/* Number of passes over the SHA-256 buffer */
+#ifndef BENCH_SHA_PASSES
+#define BENCH_SHA_PASSES	64
+#endif
+
+/* Number of HMAC computations measured */
+#ifndef BENCH_HMAC_COUNT
+#define BENCH_HMAC_COUNT	200000
+#endif
+
+/* Size of the H' message, rtx || RxCaps || TxCaps */
+#define BENCH_HPRIME_SIZE	14
+
+/**************************** Type Definitions ******************************/
+
+/** Known answer test */
+typedef struct {
+	const char *Name;	/**< Name printed in the report */
+	const char *Key;	/**< Key, NULL for a plain hash */
+	int KeySize;		/**< Key length in bytes */
+	const char *Data;	/**< Message */
+	const char *Digest;	/**< Expected digest in hexadecimal */
+} ShaKat;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static int ShaCheck(const char *Name, const u8 *Digest, const char *Expected);
+static double ShaSeconds(clock_t Start);
+
+/************************** Variable Definitions ****************************/
+
+static u8 KeyAa[131];
+
+static const ShaKat Kats[] = {
+	{"FIPS 180-2 empty", NULL, 0, "",
+	 "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+	{"FIPS 180-2 abc", NULL, 0, "abc",
+	 "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+	{"FIPS 180-2 448 bit", NULL, 0,
+	 "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+	 "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+	{"RFC 4231 case 1",
+	 "\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b"
+	 "\x0b\x0b\x0b\x0b", 20, "Hi There",
+	 "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"},
+	{"RFC 4231 case 2", "Jefe", 4, "what do ya want for nothing?",
+	 "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"},
+	{"RFC 4231 case 6", (const char *)KeyAa, sizeof(KeyAa),
+	 "Test Using Larger Than Block-Size Key - Hash Key First",
+	 "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"},
+	{"RFC 4231 case 7", (const char *)KeyAa, sizeof(KeyAa),
+	 "This is a test using a larger than block-size key and a larger than "
+	 "block-size data. The key needs to be hashed before being used by the "
+	 "HMAC algorithm.",
+	 "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2"},
+};
+
+static u8 ShaBuffer[BENCH_SHA_SIZE];
+
+/************************** Function Definitions ****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function runs the known answer tests and the benchmark.
+*
+* @param	None.
+*
+* @return	0 if all known answer tests pass, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	XHdcp22Cmn_Sha256Ctx Sha;
+	XHdcp22Cmn_HmacSha256Ctx Hmac;
+	u8 Digest[32];
+	u8 Kd[32];
+	u8 Message[BENCH_HPRIME_SIZE];
+	clock_t Start;
+	double Seconds;
+	double Rate;
+	size_t i;
+	int Errors = 0;
+
+	memset(KeyAa, 0xaa, sizeof(KeyAa));
+
+	/* Known answer tests of the one shot functions */
+	for (i = 0; i < sizeof(Kats) / sizeof(Kats[0]); i++) {
+		if (Kats[i].Key == NULL) {
+			XHdcp22Cmn_Sha256Hash((const u8 *)Kats[i].Data,
+					strlen(Kats[i].Data), Digest);
+		} else {
+			XHdcp22Cmn_HmacSha256Hash((const u8 *)Kats[i].Data,
+					strlen(Kats[i].Data), (const u8 *)Kats[i].Key,
+					Kats[i].KeySize, Digest);
+		}
+		Errors += ShaCheck(Kats[i].Name, Digest, Kats[i].Digest);
+	}
+
+	/* One million 'a', hashed in parts that do not align with blocks */
+	memset(ShaBuffer, 'a', 1000);
+	XHdcp22Cmn_Sha256Init(&Sha);
+	for (i = 0; i < 1000; i++) {
+		XHdcp22Cmn_Sha256Update(&Sha, ShaBuffer, 1000);
+	}
+	XHdcp22Cmn_Sha256Final(&Sha, Digest);
+	Errors += ShaCheck("FIPS 180-2 million a", Digest,
+		"cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+	/* Cached HMAC context used for two messages */
+	XHdcp22Cmn_HmacSha256SetKey(&Hmac, (const u8 *)"Jefe", 4);
+	XHdcp22Cmn_HmacSha256Compute(&Hmac,
+			(const u8 *)"what do ya want for nothing?", 28, Digest);
+	Errors += ShaCheck("RFC 4231 case 2 (context)", Digest,
+		"5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+	XHdcp22Cmn_HmacSha256Compute(&Hmac,
+			(const u8 *)"what do ya want for nothing?", 28, Digest);
+	Errors += ShaCheck("RFC 4231 case 2 (context reused)", Digest,
+		"5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+
+	/* Throughput of SHA-256 */
+	Start = clock();
+	for (i = 0; i < BENCH_SHA_PASSES; i++) {
+		XHdcp22Cmn_Sha256Hash(ShaBuffer, BENCH_SHA_SIZE, Digest);
+	}
+	Seconds = ShaSeconds(Start);
+	printf("Sha256Hash:          %10.2f MB/s\n",
+			((double)BENCH_SHA_SIZE * BENCH_SHA_PASSES) /
+			(Seconds * 1024.0 * 1024.0));
+
+	/* HMAC over the H' message, key set up for every message */
+	memset(Kd, 0x5a, sizeof(Kd));
+	memset(Message, 0xa5, sizeof(Message));
+	Start = clock();
+	for (i = 0; i < BENCH_HMAC_COUNT; i++) {
+		XHdcp22Cmn_HmacSha256Hash(Message, sizeof(Message), Kd,
+				sizeof(Kd), Digest);
+	}
+	Seconds = ShaSeconds(Start);
+	Rate = BENCH_HMAC_COUNT / Seconds;
+	printf("HmacSha256Hash:      %10.0f per s\n", Rate);
+
+	/* HMAC over the H' message with a cached context */
+	XHdcp22Cmn_HmacSha256SetKey(&Hmac, Kd, sizeof(Kd));
+	Start = clock();
+	for (i = 0; i < BENCH_HMAC_COUNT; i++) {
+		XHdcp22Cmn_HmacSha256Compute(&Hmac, Message, sizeof(Message),
+				Digest);
+	}
+	Seconds = ShaSeconds(Start);
+	printf("HmacSha256Compute:   %10.0f per s (%.2fx)\n",
+			BENCH_HMAC_COUNT / Seconds,
+			(BENCH_HMAC_COUNT / Seconds) / Rate);
+
+	printf("%s\n", (Errors == 0) ? "All known answer tests passed" :
+			"Known answer tests failed");
+
+	return (Errors == 0) ? 0 : 1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares a digest against the expected hexadecimal value
+* and reports a mismatch.
+*
+* @param	Name is the name of the test.
+* @param	Digest is the 32 byte computed digest.
+* @param	Expected is the expected digest in hexadecimal.
+*
+* @return	0 if the values match, 1 otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int ShaCheck(const char *Name, const u8 *Digest, const char *Expected)
+{
+	char Hex[65];
+	int i;
+
+	for (i = 0; i < 32; i++) {
+		sprintf(&Hex[2 * i], "%02x", Digest[i]);
+	}
+
+	if (strcmp(Hex, Expected) != 0) {
+		printf("%s: FAILED\n", Name);
+		return 1;
+	}
+
+	printf("%s: passed\n", Name);
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time elapsed since Start.
+*
+* @param	Start is the clock value at the start of the measurement.
+*
+* @return	Elapsed time in seconds, at least one clock tick.
+*
+* @note		None.
+*
+******************************************************************************/
+static double ShaSeconds(clock_t Start)
+{
+	clock_t Ticks = clock() - Start;
+
+	if (Ticks == 0) {
+		Ticks = 1;
+	}
+
+	return (double)Ticks / (double)CLOCKS_PER_SEC;
+}
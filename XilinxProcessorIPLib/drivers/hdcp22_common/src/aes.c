@@ -44,6 +44,12 @@
 * The CCM mode of operation is specified by NIST SP80-38 C, available at:
 * - http://csrc.nist.gov/publications/nistpubs/800-38C/SP800-38C_updated-July20_2007.pdf
 *
+* By default the cipher is computed on 32-bit columns with a combined
+* SubBytes/ShiftRows/MixColumns lookup table (one 1KB table per direction,
+* the other three are obtained by rotation). Define AES_CIPHER_BYTEWISE to
+* build the original byte oriented implementation instead, which has a
+* smaller footprint and no data dependent table lookups in MixColumns.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -51,6 +57,8 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.01  MH   01/28/17 Fixed warnings and errors.
+* 1.02  ag   10/19/26 Added the T-table implementation and the multi-block
+*                     CTR mode function XHdcp22Cmn_Aes128CtrEncrypt.
 *</pre>
 *
 *****************************************************************************/
@@ -101,6 +109,7 @@ static const u8 Aes_Invsbox[16][16] = {
 	{0x17,0x2B,0x04,0x7E,0xBA,0x77,0xD6,0x26,0xE1,0x69,0x14,0x63,0x55,0x21,0x0C,0x7D}
 };
 
+#ifdef AES_CIPHER_BYTEWISE
 /* This table stores pre-calculated values for all possible GF(2^8) calculations.This
    table is only used by the (Inv)MixColumns steps.
    USAGE: The second index (column) is the coefficient of multiplication. Only 7 different
@@ -237,17 +246,174 @@ static const u8 Aes_GfMul[256][6] = {
 	{0xe3,0x1f,0x5d,0xbe,0x80,0x9f},{0xe1,0x1c,0x54,0xb5,0x8d,0x91},
 	{0xe7,0x19,0x4f,0xa8,0x9a,0x83},{0xe5,0x1a,0x46,0xa3,0x97,0x8d}
 };
+#else
+/* Encryption T-table. Entry x holds the column {02,01,01,03}*S[x], i.e. the
+   SubBytes and MixColumns contribution of a byte in row 0. The tables for
+   rows 1 to 3 are rotations of this one. */
+static const u32 Aes_Te0[256] = {
+	0xC66363A5,0xF87C7C84,0xEE777799,0xF67B7B8D,
+	0xFFF2F20D,0xD66B6BBD,0xDE6F6FB1,0x91C5C554,
+	0x60303050,0x02010103,0xCE6767A9,0x562B2B7D,
+	0xE7FEFE19,0xB5D7D762,0x4DABABE6,0xEC76769A,
+	0x8FCACA45,0x1F82829D,0x89C9C940,0xFA7D7D87,
+	0xEFFAFA15,0xB25959EB,0x8E4747C9,0xFBF0F00B,
+	0x41ADADEC,0xB3D4D467,0x5FA2A2FD,0x45AFAFEA,
+	0x239C9CBF,0x53A4A4F7,0xE4727296,0x9BC0C05B,
+	0x75B7B7C2,0xE1FDFD1C,0x3D9393AE,0x4C26266A,
+	0x6C36365A,0x7E3F3F41,0xF5F7F702,0x83CCCC4F,
+	0x6834345C,0x51A5A5F4,0xD1E5E534,0xF9F1F108,
+	0xE2717193,0xABD8D873,0x62313153,0x2A15153F,
+	0x0804040C,0x95C7C752,0x46232365,0x9DC3C35E,
+	0x30181828,0x379696A1,0x0A05050F,0x2F9A9AB5,
+	0x0E070709,0x24121236,0x1B80809B,0xDFE2E23D,
+	0xCDEBEB26,0x4E272769,0x7FB2B2CD,0xEA75759F,
+	0x1209091B,0x1D83839E,0x582C2C74,0x341A1A2E,
+	0x361B1B2D,0xDC6E6EB2,0xB45A5AEE,0x5BA0A0FB,
+	0xA45252F6,0x763B3B4D,0xB7D6D661,0x7DB3B3CE,
+	0x5229297B,0xDDE3E33E,0x5E2F2F71,0x13848497,
+	0xA65353F5,0xB9D1D168,0x00000000,0xC1EDED2C,
+	0x40202060,0xE3FCFC1F,0x79B1B1C8,0xB65B5BED,
+	0xD46A6ABE,0x8DCBCB46,0x67BEBED9,0x7239394B,
+	0x944A4ADE,0x984C4CD4,0xB05858E8,0x85CFCF4A,
+	0xBBD0D06B,0xC5EFEF2A,0x4FAAAAE5,0xEDFBFB16,
+	0x864343C5,0x9A4D4DD7,0x66333355,0x11858594,
+	0x8A4545CF,0xE9F9F910,0x04020206,0xFE7F7F81,
+	0xA05050F0,0x783C3C44,0x259F9FBA,0x4BA8A8E3,
+	0xA25151F3,0x5DA3A3FE,0x804040C0,0x058F8F8A,
+	0x3F9292AD,0x219D9DBC,0x70383848,0xF1F5F504,
+	0x63BCBCDF,0x77B6B6C1,0xAFDADA75,0x42212163,
+	0x20101030,0xE5FFFF1A,0xFDF3F30E,0xBFD2D26D,
+	0x81CDCD4C,0x180C0C14,0x26131335,0xC3ECEC2F,
+	0xBE5F5FE1,0x359797A2,0x884444CC,0x2E171739,
+	0x93C4C457,0x55A7A7F2,0xFC7E7E82,0x7A3D3D47,
+	0xC86464AC,0xBA5D5DE7,0x3219192B,0xE6737395,
+	0xC06060A0,0x19818198,0x9E4F4FD1,0xA3DCDC7F,
+	0x44222266,0x542A2A7E,0x3B9090AB,0x0B888883,
+	0x8C4646CA,0xC7EEEE29,0x6BB8B8D3,0x2814143C,
+	0xA7DEDE79,0xBC5E5EE2,0x160B0B1D,0xADDBDB76,
+	0xDBE0E03B,0x64323256,0x743A3A4E,0x140A0A1E,
+	0x924949DB,0x0C06060A,0x4824246C,0xB85C5CE4,
+	0x9FC2C25D,0xBDD3D36E,0x43ACACEF,0xC46262A6,
+	0x399191A8,0x319595A4,0xD3E4E437,0xF279798B,
+	0xD5E7E732,0x8BC8C843,0x6E373759,0xDA6D6DB7,
+	0x018D8D8C,0xB1D5D564,0x9C4E4ED2,0x49A9A9E0,
+	0xD86C6CB4,0xAC5656FA,0xF3F4F407,0xCFEAEA25,
+	0xCA6565AF,0xF47A7A8E,0x47AEAEE9,0x10080818,
+	0x6FBABAD5,0xF0787888,0x4A25256F,0x5C2E2E72,
+	0x381C1C24,0x57A6A6F1,0x73B4B4C7,0x97C6C651,
+	0xCBE8E823,0xA1DDDD7C,0xE874749C,0x3E1F1F21,
+	0x964B4BDD,0x61BDBDDC,0x0D8B8B86,0x0F8A8A85,
+	0xE0707090,0x7C3E3E42,0x71B5B5C4,0xCC6666AA,
+	0x904848D8,0x06030305,0xF7F6F601,0x1C0E0E12,
+	0xC26161A3,0x6A35355F,0xAE5757F9,0x69B9B9D0,
+	0x17868691,0x99C1C158,0x3A1D1D27,0x279E9EB9,
+	0xD9E1E138,0xEBF8F813,0x2B9898B3,0x22111133,
+	0xD26969BB,0xA9D9D970,0x078E8E89,0x339494A7,
+	0x2D9B9BB6,0x3C1E1E22,0x15878792,0xC9E9E920,
+	0x87CECE49,0xAA5555FF,0x50282878,0xA5DFDF7A,
+	0x038C8C8F,0x59A1A1F8,0x09898980,0x1A0D0D17,
+	0x65BFBFDA,0xD7E6E631,0x844242C6,0xD06868B8,
+	0x824141C3,0x299999B0,0x5A2D2D77,0x1E0F0F11,
+	0x7BB0B0CB,0xA85454FC,0x6DBBBBD6,0x2C16163A
+};
+
+/* Decryption T-table. Entry x holds the column {0e,09,0d,0b}*InvS[x]. */
+static const u32 Aes_Td0[256] = {
+	0x51F4A750,0x7E416553,0x1A17A4C3,0x3A275E96,
+	0x3BAB6BCB,0x1F9D45F1,0xACFA58AB,0x4BE30393,
+	0x2030FA55,0xAD766DF6,0x88CC7691,0xF5024C25,
+	0x4FE5D7FC,0xC52ACBD7,0x26354480,0xB562A38F,
+	0xDEB15A49,0x25BA1B67,0x45EA0E98,0x5DFEC0E1,
+	0xC32F7502,0x814CF012,0x8D4697A3,0x6BD3F9C6,
+	0x038F5FE7,0x15929C95,0xBF6D7AEB,0x955259DA,
+	0xD4BE832D,0x587421D3,0x49E06929,0x8EC9C844,
+	0x75C2896A,0xF48E7978,0x99583E6B,0x27B971DD,
+	0xBEE14FB6,0xF088AD17,0xC920AC66,0x7DCE3AB4,
+	0x63DF4A18,0xE51A3182,0x97513360,0x62537F45,
+	0xB16477E0,0xBB6BAE84,0xFE81A01C,0xF9082B94,
+	0x70486858,0x8F45FD19,0x94DE6C87,0x527BF8B7,
+	0xAB73D323,0x724B02E2,0xE31F8F57,0x6655AB2A,
+	0xB2EB2807,0x2FB5C203,0x86C57B9A,0xD33708A5,
+	0x302887F2,0x23BFA5B2,0x02036ABA,0xED16825C,
+	0x8ACF1C2B,0xA779B492,0xF307F2F0,0x4E69E2A1,
+	0x65DAF4CD,0x0605BED5,0xD134621F,0xC4A6FE8A,
+	0x342E539D,0xA2F355A0,0x058AE132,0xA4F6EB75,
+	0x0B83EC39,0x4060EFAA,0x5E719F06,0xBD6E1051,
+	0x3E218AF9,0x96DD063D,0xDD3E05AE,0x4DE6BD46,
+	0x91548DB5,0x71C45D05,0x0406D46F,0x605015FF,
+	0x1998FB24,0xD6BDE997,0x894043CC,0x67D99E77,
+	0xB0E842BD,0x07898B88,0xE7195B38,0x79C8EEDB,
+	0xA17C0A47,0x7C420FE9,0xF8841EC9,0x00000000,
+	0x09808683,0x322BED48,0x1E1170AC,0x6C5A724E,
+	0xFD0EFFFB,0x0F853856,0x3DAED51E,0x362D3927,
+	0x0A0FD964,0x685CA621,0x9B5B54D1,0x24362E3A,
+	0x0C0A67B1,0x9357E70F,0xB4EE96D2,0x1B9B919E,
+	0x80C0C54F,0x61DC20A2,0x5A774B69,0x1C121A16,
+	0xE293BA0A,0xC0A02AE5,0x3C22E043,0x121B171D,
+	0x0E090D0B,0xF28BC7AD,0x2DB6A8B9,0x141EA9C8,
+	0x57F11985,0xAF75074C,0xEE99DDBB,0xA37F60FD,
+	0xF701269F,0x5C72F5BC,0x44663BC5,0x5BFB7E34,
+	0x8B432976,0xCB23C6DC,0xB6EDFC68,0xB8E4F163,
+	0xD731DCCA,0x42638510,0x13972240,0x84C61120,
+	0x854A247D,0xD2BB3DF8,0xAEF93211,0xC729A16D,
+	0x1D9E2F4B,0xDCB230F3,0x0D8652EC,0x77C1E3D0,
+	0x2BB3166C,0xA970B999,0x119448FA,0x47E96422,
+	0xA8FC8CC4,0xA0F03F1A,0x567D2CD8,0x223390EF,
+	0x87494EC7,0xD938D1C1,0x8CCAA2FE,0x98D40B36,
+	0xA6F581CF,0xA57ADE28,0xDAB78E26,0x3FADBFA4,
+	0x2C3A9DE4,0x5078920D,0x6A5FCC9B,0x547E4662,
+	0xF68D13C2,0x90D8B8E8,0x2E39F75E,0x82C3AFF5,
+	0x9F5D80BE,0x69D0937C,0x6FD52DA9,0xCF2512B3,
+	0xC8AC993B,0x10187DA7,0xE89C636E,0xDB3BBB7B,
+	0xCD267809,0x6E5918F4,0xEC9AB701,0x834F9AA8,
+	0xE6956E65,0xAAFFE67E,0x21BCCF08,0xEF15E8E6,
+	0xBAE79BD9,0x4A6F36CE,0xEA9F09D4,0x29B07CD6,
+	0x31A4B2AF,0x2A3F2331,0xC6A59430,0x35A266C0,
+	0x744EBC37,0xFC82CAA6,0xE090D0B0,0x33A7D815,
+	0xF104984A,0x41ECDAF7,0x7FCD500E,0x1791F62F,
+	0x764DD68D,0x43EFB04D,0xCCAA4D54,0xE49604DF,
+	0x9ED1B5E3,0x4C6A881B,0xC12C1FB8,0x4665517F,
+	0x9D5EEA04,0x018C355D,0xFA877473,0xFB0B412E,
+	0xB3671D5A,0x92DBD252,0xE9105633,0x6DD64713,
+	0x9AD7618C,0x37A10C7A,0x59F8148E,0xEB133C89,
+	0xCEA927EE,0xB761C935,0xE11CE5ED,0x7A47B13C,
+	0x9CD2DF59,0x55F2733F,0x1814CE79,0x73C737BF,
+	0x53F7CDEA,0x5FFDAA5B,0xDF3D6F14,0x7844DB86,
+	0xCAAFF381,0xB968C43E,0x3824342C,0xC2A3405F,
+	0x161DC372,0xBCE2250C,0x283C498B,0xFF0D9541,
+	0x39A80171,0x080CB3DE,0xD8B4E49C,0x6456C190,
+	0x7BCB8461,0xD532B670,0x486C5C74,0xD0B85742
+};
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 // The least significant byte of the word is rotated to the end.
 #define AES_BLOCK_SIZE 16 /* AES operates on 16 bytes at a time */
 #define KE_ROTWORD(x) (((x) << 8) | ((x) >> 24))
+#define AES_CTR_BLOCKS 4  /* Keystream blocks generated per pass in CTR mode */
+
+#ifndef AES_CIPHER_BYTEWISE
+#define AES_ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define AES_SBOX(x) (((const u8 *)Aes_Sbox)[(x)])
+#define AES_INVSBOX(x) (((const u8 *)Aes_Invsbox)[(x)])
+#define AES_GETU32(p) (((u32)(p)[0] << 24) | ((u32)(p)[1] << 16) | \
+                       ((u32)(p)[2] << 8) | ((u32)(p)[3]))
+#define AES_PUTU32(p, v) do { (p)[0] = (u8)((v) >> 24); (p)[1] = (u8)((v) >> 16); \
+                              (p)[2] = (u8)((v) >> 8); (p)[3] = (u8)(v); } while (0)
+/* One column of a full round: row r of the result takes its byte from column
+   (c + r) for encryption and (c - r) for decryption. */
+#define AES_TE_COL(a, b, c, d) (Aes_Te0[(a) >> 24] ^ AES_ROR(Aes_Te0[((b) >> 16) & 0xFF], 8) ^ \
+                                AES_ROR(Aes_Te0[((c) >> 8) & 0xFF], 16) ^ AES_ROR(Aes_Te0[(d) & 0xFF], 24))
+#define AES_TD_COL(a, b, c, d) (Aes_Td0[(a) >> 24] ^ AES_ROR(Aes_Td0[((b) >> 16) & 0xFF], 8) ^ \
+                                AES_ROR(Aes_Td0[((c) >> 8) & 0xFF], 16) ^ AES_ROR(Aes_Td0[(d) & 0xFF], 24))
+#endif
 
 /**************************** Type Definitions *******************************/
 
 /************************** Function Prototypes ******************************/
 static u32  AesSubWord(u32 Word);
 static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits);
+#ifdef AES_CIPHER_BYTEWISE
 static void AesAddRoundKey(u8 State[][4], const u32 W[]);
 static void AesSubBytes(u8 State[][4]);
 static void AesInvSubBytes(u8 State[][4]);
@@ -255,16 +421,15 @@ static void AesShiftRows(u8 State[][4]);
 static void AesInvShiftRows(u8 State[][4]);
 static void AesMixColumns(u8 State[][4]);
 static void AesInvMixColumns(u8 State[][4]);
+#else
+static void AesKeySetupDec(u32 W[], int KeySizeBits);
+#endif
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
-#ifdef AES_CIPHER_CTR_MODE
 static void Xor(u8 *C, const u8 *A, const u8 *B, u32 Size);
 static void AesIncrementIv(u8 Iv[], int CounterSize);
 static void AesEncryptCtr(const u8 In[], size_t InLen, u8 Out[],
 								  const u32 Key[], int KeySize, const u8 Iv[]);
-static void AesDecryptCtr(const u8 In[], size_t InLen, u8 Out[],
-								 const u32 Key[], int KeySize, const u8 Iv[]);
-#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -312,11 +477,45 @@ void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output)
 
 	/* Setup the AES internal key */
 	AesKeySetup(Key, KeySchedule, 128);
+#ifndef AES_CIPHER_BYTEWISE
+	AesKeySetupDec(KeySchedule, 128);
+#endif
 	/* Encrypt 128-bits*/
 	AesDecrypt(Data, Output, KeySchedule, 128);
 }
 
-#ifdef AES_CIPHER_CTR_MODE
+/*****************************************************************************/
+/**
+*
+* This function encrypts or decrypts data of any length in CTR mode with a
+* key of size 128 bits. The key schedule is computed once per call and the
+* keystream is generated AES_CTR_BLOCKS blocks at a time. The whole 16 byte
+* counter block is incremented as a big-endian integer after each block.
+*
+* @param	Data is the input data
+* @param	DataSize is the length of the input data in bytes
+* @param	Key is the 16 byte key
+* @param	Iv is the 16 byte initial counter block
+* @param	Output is the output data, DataSize bytes long. It may be the
+*			same buffer as Data.
+*
+* @return	None.
+*
+* @note		CTR mode is its own inverse, so this function is used for both
+*			encryption and decryption.
+*
+******************************************************************************/
+void XHdcp22Cmn_Aes128CtrEncrypt(const u8 *Data, u32 DataSize, const u8 *Key,
+                                 const u8 *Iv, u8 *Output)
+{
+	u32 KeySchedule[60];
+
+	/* Setup the AES internal key */
+	AesKeySetup(Key, KeySchedule, 128);
+	/* Encrypt in CTR mode */
+	AesEncryptCtr(Data, DataSize, Output, KeySchedule, 128, Iv);
+}
+
 /****************************************************************************/
 /**
 *
@@ -342,7 +541,6 @@ static void Xor(u8 *C, const u8 *A, const u8 *B, u32 Size)
 		C[Size] = A[Size] ^ B[Size];
 	}
 }
-#endif
 
 /*****************************************************************************/
 /**
@@ -411,6 +609,7 @@ static void AesKeySetup(const u8 Key[], u32 W[], int KeySizeBits)
 	}
 }
 
+#ifdef AES_CIPHER_BYTEWISE
 /*****************************************************************************/
 /**
 *
@@ -818,8 +1017,8 @@ static void AesInvMixColumns(u8 State[][4])
 	State[3][3] ^= Aes_GfMul[Col[2]][2];
 	State[3][3] ^= Aes_GfMul[Col[3]][5];
 }
+#endif
 
-#ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
 /**
 *
@@ -845,8 +1044,8 @@ static void AesIncrementIv(u8 Iv[], int CounterSize)
 			break;
 	}
 }
-#endif
 
+#ifdef AES_CIPHER_BYTEWISE
 /*****************************************************************************/
 /**
 *
@@ -1051,73 +1250,192 @@ static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 	Out[15] = State[3][3];
 }
 
+#else
+/*****************************************************************************/
+/**
+*
+* This function converts an encryption key schedule into the key schedule of
+* the equivalent inverse cipher by applying InvMixColumns to the round keys
+* of rounds 1 to Nr-1.
+*
+* @param	W is the key schedule, converted in place.
+* @param	KeySizeBits is the length in bits of the key, 128, 192, or 256.
+*
+* @return	None.
+*
+* @note		InvMixColumns of a byte b equals Td0[S[b]], as the decryption
+* 			table includes the inverse S-Box.
+*
+******************************************************************************/
+static void AesKeySetupDec(u32 W[], int KeySizeBits)
+{
+	int Idx, Nr;
+	u32 Temp;
+
+	Nr = (KeySizeBits / 32) + 6;
+
+	for (Idx = 4; Idx < 4 * Nr; Idx++) {
+		Temp = W[Idx];
+		W[Idx] = Aes_Td0[AES_SBOX(Temp >> 24)] ^
+				AES_ROR(Aes_Td0[AES_SBOX((Temp >> 16) & 0xFF)], 8) ^
+				AES_ROR(Aes_Td0[AES_SBOX((Temp >> 8) & 0xFF)], 16) ^
+				AES_ROR(Aes_Td0[AES_SBOX(Temp & 0xFF)], 24);
+	}
+}
 
-#ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
 /**
 *
-* This function encrypts using AES and a counter.
+* This function encrypts using AES encryption. Each full round computes a
+* column of the State with four lookups in the T-table.
 *
-* @param	In is the plaintext
-* @param	InLen is any bytes length
-* @param	Out is is the ciphertext, same length as plaintext
+* @param	In is 16 bytes of plaintext
+* @param	Out is 16 bytes of ciphertext
 * @param	Key is from the key setup
-* @param	KeySize is the bit length of the key
-* @param	Iv must be AES_BLOCK_SIZE bytes long
+* @param	KeySize is the bit length of the key, 128, 192, or 256
 *
 * @return	None.
 *
-* @note		None.
+* @note		Key setup must be done before any AES en/de-cryption functions
+* 			can be used.
 *
 ******************************************************************************/
-static void AesEncryptCtr(const u8 In[], size_t InLen, u8 Out[],
-								  const u32 Key[], int KeySize, const u8 Iv[])
+static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
 {
-	size_t Idx = 0, LastBlockLength;
-	u8 iv_buf[AES_BLOCK_SIZE], out_buf[AES_BLOCK_SIZE];
+	u32 S0, S1, S2, S3, T0, T1, T2, T3;
+	int Round, Nr;
 
-	if (In != Out)
-		memcpy(Out, In, InLen);
+	Nr = (KeySize / 32) + 6;
 
-	memcpy(iv_buf, Iv, AES_BLOCK_SIZE);
-	LastBlockLength = InLen - AES_BLOCK_SIZE;
+	// The State is held as four big-endian columns. The round key is added first.
+	S0 = AES_GETU32(In) ^ Key[0];
+	S1 = AES_GETU32(In + 4) ^ Key[1];
+	S2 = AES_GETU32(In + 8) ^ Key[2];
+	S3 = AES_GETU32(In + 12) ^ Key[3];
 
-	if (InLen > AES_BLOCK_SIZE) {
-		for (Idx = 0; Idx < LastBlockLength; Idx += AES_BLOCK_SIZE) {
-			AesEncrypt(iv_buf, out_buf, Key, KeySize);
-			Xor(&Out[Idx], out_buf, &Out[Idx], AES_BLOCK_SIZE);
-			AesIncrementIv(iv_buf, AES_BLOCK_SIZE);
-		}
+	for (Round = 1; Round < Nr; Round++) {
+		Key += 4;
+		T0 = AES_TE_COL(S0, S1, S2, S3) ^ Key[0];
+		T1 = AES_TE_COL(S1, S2, S3, S0) ^ Key[1];
+		T2 = AES_TE_COL(S2, S3, S0, S1) ^ Key[2];
+		T3 = AES_TE_COL(S3, S0, S1, S2) ^ Key[3];
+		S0 = T0; S1 = T1; S2 = T2; S3 = T3;
 	}
 
-	AesEncrypt(iv_buf, out_buf, Key, KeySize);
-	/* Use the Most Significant bytes. */
-	Xor(&Out[Idx], out_buf, &Out[Idx], InLen - Idx);
+	// The last round does not perform the MixColumns step.
+	Key += 4;
+	T0 = ((u32)AES_SBOX(S0 >> 24) << 24) ^ ((u32)AES_SBOX((S1 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_SBOX((S2 >> 8) & 0xFF) << 8) ^ (u32)AES_SBOX(S3 & 0xFF) ^ Key[0];
+	T1 = ((u32)AES_SBOX(S1 >> 24) << 24) ^ ((u32)AES_SBOX((S2 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_SBOX((S3 >> 8) & 0xFF) << 8) ^ (u32)AES_SBOX(S0 & 0xFF) ^ Key[1];
+	T2 = ((u32)AES_SBOX(S2 >> 24) << 24) ^ ((u32)AES_SBOX((S3 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_SBOX((S0 >> 8) & 0xFF) << 8) ^ (u32)AES_SBOX(S1 & 0xFF) ^ Key[2];
+	T3 = ((u32)AES_SBOX(S3 >> 24) << 24) ^ ((u32)AES_SBOX((S0 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_SBOX((S1 >> 8) & 0xFF) << 8) ^ (u32)AES_SBOX(S2 & 0xFF) ^ Key[3];
+
+	AES_PUTU32(Out, T0);
+	AES_PUTU32(Out + 4, T1);
+	AES_PUTU32(Out + 8, T2);
+	AES_PUTU32(Out + 12, T3);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function decrypts using AES with the equivalent inverse cipher.
+*
+* @param	In is 16 bytes of ciphertext
+* @param	Out is 16 bytes of plaintext
+* @param	Key is from the key setup, converted by AesKeySetupDec
+* @param	KeySize is the bit length of the key, 128, 192, or 256
+*
+* @return	None.
+*
+* @note		Key setup must be done before any AES en/de-cryption functions
+* 			can be used.
+*
+******************************************************************************/
+static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize)
+{
+	u32 S0, S1, S2, S3, T0, T1, T2, T3;
+	int Round, Nr;
+
+	Nr = (KeySize / 32) + 6;
+	Key += 4 * Nr;
+
+	// The round keys are applied in reverse order, the last one first.
+	S0 = AES_GETU32(In) ^ Key[0];
+	S1 = AES_GETU32(In + 4) ^ Key[1];
+	S2 = AES_GETU32(In + 8) ^ Key[2];
+	S3 = AES_GETU32(In + 12) ^ Key[3];
+
+	for (Round = 1; Round < Nr; Round++) {
+		Key -= 4;
+		T0 = AES_TD_COL(S0, S3, S2, S1) ^ Key[0];
+		T1 = AES_TD_COL(S1, S0, S3, S2) ^ Key[1];
+		T2 = AES_TD_COL(S2, S1, S0, S3) ^ Key[2];
+		T3 = AES_TD_COL(S3, S2, S1, S0) ^ Key[3];
+		S0 = T0; S1 = T1; S2 = T2; S3 = T3;
+	}
+
+	// The last round does not perform the InvMixColumns step.
+	Key -= 4;
+	T0 = ((u32)AES_INVSBOX(S0 >> 24) << 24) ^ ((u32)AES_INVSBOX((S3 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_INVSBOX((S2 >> 8) & 0xFF) << 8) ^ (u32)AES_INVSBOX(S1 & 0xFF) ^ Key[0];
+	T1 = ((u32)AES_INVSBOX(S1 >> 24) << 24) ^ ((u32)AES_INVSBOX((S0 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_INVSBOX((S3 >> 8) & 0xFF) << 8) ^ (u32)AES_INVSBOX(S2 & 0xFF) ^ Key[1];
+	T2 = ((u32)AES_INVSBOX(S2 >> 24) << 24) ^ ((u32)AES_INVSBOX((S1 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_INVSBOX((S0 >> 8) & 0xFF) << 8) ^ (u32)AES_INVSBOX(S3 & 0xFF) ^ Key[2];
+	T3 = ((u32)AES_INVSBOX(S3 >> 24) << 24) ^ ((u32)AES_INVSBOX((S2 >> 16) & 0xFF) << 16) ^
+	     ((u32)AES_INVSBOX((S1 >> 8) & 0xFF) << 8) ^ (u32)AES_INVSBOX(S0 & 0xFF) ^ Key[3];
+
+	AES_PUTU32(Out, T0);
+	AES_PUTU32(Out + 4, T1);
+	AES_PUTU32(Out + 8, T2);
+	AES_PUTU32(Out + 12, T3);
 }
 #endif
 
-#ifdef AES_CIPHER_CTR_MODE
 /*****************************************************************************/
 /**
 *
-* This function does a AES-CTR decryption (is the same as encryption)
+* This function encrypts using AES and a counter. The keystream is generated
+* for up to AES_CTR_BLOCKS blocks per pass and then XOR'd with the input in
+* one step.
 *
-* @param	In is the ciphertext
-* @param	InLen is any byte length
-* @param	Out is the ciphertext, same length as plaintext
+* @param	In is the plaintext
+* @param	InLen is any bytes length
+* @param	Out is is the ciphertext, same length as plaintext
 * @param	Key is from the key setup
-* @param	KeySize is the bit length of the key, 128, 192, or 256
+* @param	KeySize is the bit length of the key
 * @param	Iv must be AES_BLOCK_SIZE bytes long
 *
 * @return	None.
 *
-* @note		None.
+* @note		CTR encryption is its own inverse function.
 *
 ******************************************************************************/
-static void AesDecryptCtr(const u8 In[], size_t InLen, u8 Out[],
-								 const u32 Key[], int KeySize, const u8 Iv[])
+static void AesEncryptCtr(const u8 In[], size_t InLen, u8 Out[],
+								  const u32 Key[], int KeySize, const u8 Iv[])
 {
-	// CTR encryption is its own inverse function.
-	AesEncryptCtr(In, InLen, Out, Key, KeySize, Iv);
+	size_t Idx, Len, Blk;
+	u8 iv_buf[AES_BLOCK_SIZE];
+	u8 out_buf[AES_CTR_BLOCKS * AES_BLOCK_SIZE];
+
+	memcpy(iv_buf, Iv, AES_BLOCK_SIZE);
+
+	for (Idx = 0; Idx < InLen; Idx += Len) {
+		Len = InLen - Idx;
+		if (Len > sizeof(out_buf))
+			Len = sizeof(out_buf);
+
+		/* Generate the keystream for the blocks of this pass */
+		for (Blk = 0; Blk < Len; Blk += AES_BLOCK_SIZE) {
+			AesEncrypt(iv_buf, &out_buf[Blk], Key, KeySize);
+			AesIncrementIv(iv_buf, AES_BLOCK_SIZE);
+		}
+
+		/* The last pass uses the most significant bytes of the keystream */
+		Xor(&Out[Idx], &In[Idx], out_buf, Len);
+	}
 }
-#endif
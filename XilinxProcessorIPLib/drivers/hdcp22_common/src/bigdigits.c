@@ -2467,8 +2467,13 @@ u32 spSimpleRand(u32 lower, u32 upper)
 	mpModExp_1 is the earlier version [<2.2] now using macros for modular squaring & mult
 */
 
-#ifdef NO_ALLOCS
+/*	[xlnx] With NO_ALLOCS, odd moduli use Montgomery multiplication,
+	see mpMontModExp(). mpModExp_1 is left for even moduli.
+*/
+
 static int mpModExp_1(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits);
+#ifdef NO_ALLOCS
+static MONT_CTX_T *mpMontLookup(const u32 m[], size_t ndigits);
 #else
 static int mpModExp_windowed(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits);
 #endif
@@ -2477,12 +2482,24 @@ int mpModExp(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits)
 	/* Computes y = x^n mod d */
 {
 #ifdef NO_ALLOCS
+	MONT_CTX_T *ctx;
+
+	ctx = mpMontLookup(d, ndigits);
+	if (ctx != NULL)
+		return mpMontModExp(y, x, n, ctx);
+
 	return mpModExp_1(y, x, n, d, ndigits);
 #else
 	return mpModExp_windowed(y, x, n, d, ndigits);
 #endif
 }
 
+int mpModExp_div(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits)
+	/* Computes y = x^n mod d, reducing by division after every step */
+{
+	return mpModExp_1(y, x, n, d, ndigits);
+}
+
 /* MACROS TO DO MODULAR SQUARING AND MULTIPLICATION USING PRE-ALLOCATED TEMPS */
 /* Required lengths |y|=|t1|=|t2|=2*n, |m|=n; but final |y|=n */
 /* Square: y = (y * y) mod m */
@@ -2647,6 +2664,248 @@ done:
 }
 
 
+#ifdef NO_ALLOCS
+/******************************************/
+/* MONTGOMERY MODULAR EXPONENTIATION      */
+/******************************************/
+/*	[xlnx] Montgomery multiplication replaces the division after every
+	square and multiply by a reduction that costs about one more
+	multiplication. Ref: Koc, Acar and Kaliski, "Analyzing and Comparing
+	Montgomery Multiplication Algorithms", IEEE Micro 1996 (CIOS method).
+*/
+
+/* Number of moduli whose constants mpModExp() keeps, at least 1 */
+#ifndef MPMONT_CACHE_SIZE
+#define MPMONT_CACHE_SIZE 2
+#endif
+
+/* Odd powers x, x^3, ..., x^15 kept for the 4-bit sliding window */
+#define MPMONT_WINDOW_BITS 4
+#define MPMONT_TABLE_SIZE (1 << (MPMONT_WINDOW_BITS - 1))
+
+#define mpMONTBIT(e, i) (((e)[(i) / BITS_PER_DIGIT] >> ((i) % BITS_PER_DIGIT)) & 1)
+
+static MONT_CTX_T mpMontCache[MPMONT_CACHE_SIZE];
+static size_t mpMontCacheNext;
+
+int mpMontSetModulus(MONT_CTX_T *ctx, const u32 m[], size_t ndigits)
+{	/*	Computes the Montgomery constants of odd modulus m,
+		minv = -m^{-1} mod 2^32 and rr = R^2 mod m with R = 2^(32*ndigits)
+	*/
+	u32 q[MAX_FIXED_DIGITS * 2];
+	u32 r[MAX_FIXED_DIGITS * 2];
+	u32 u[MAX_FIXED_DIGITS * 2];
+	u32 inv;
+	int i;
+
+	assert(ndigits <= MAX_FIXED_DIGITS);
+
+	ctx->ndigits = 0;
+	if (ndigits == 0 || mpISEVEN(m, ndigits))
+		return -1;
+
+	mpSetEqual(ctx->m, m, ndigits);
+
+	/* Newton iteration, each step doubles the correct low bits (3 to 48) */
+	inv = m[0];
+	for (i = 0; i < 4; i++)
+		inv *= 2 - m[0] * inv;
+	ctx->minv = ~inv + 1;
+
+	/* r = R mod m */
+	mpSetZero(u, ndigits + 1);
+	u[ndigits] = 1;
+	mpDivide(q, r, u, ndigits + 1, ctx->m, ndigits);
+
+	/* rr = (R mod m)^2 mod m */
+	mpSquare(u, r, ndigits);
+	mpDivide(q, r, u, ndigits * 2, ctx->m, ndigits);
+	mpSetEqual(ctx->rr, r, ndigits);
+
+	ctx->ndigits = ndigits;
+
+	return 0;
+}
+
+void mpMontMultiply(u32 w[], const u32 x[], const u32 y[], const MONT_CTX_T *ctx)
+{	/*	Computes w = x * y * R^{-1} mod m
+		where x, y < m. w may overlap x or y.
+	*/
+	u32 t[MAX_FIXED_DIGITS + 2];
+	const u32 *m = ctx->m;
+	size_t n = ctx->ndigits;
+	size_t i, j;
+	u64 c;
+	u32 q;
+
+	for (j = 0; j < n + 2; j++)
+		t[j] = 0;
+
+	for (i = 0; i < n; i++)
+	{
+		/* t = t + x * y[i] */
+		c = 0;
+		for (j = 0; j < n; j++)
+		{
+			c += (u64)x[j] * y[i] + t[j];
+			t[j] = (u32)c;
+			c >>= BITS_PER_DIGIT;
+		}
+		c += t[n];
+		t[n] = (u32)c;
+		t[n+1] = (u32)(c >> BITS_PER_DIGIT);
+
+		/* t = (t + q * m) / 2^32, choosing q so the low digit is zero */
+		q = t[0] * ctx->minv;
+		c = (u64)q * m[0] + t[0];
+		c >>= BITS_PER_DIGIT;
+		for (j = 1; j < n; j++)
+		{
+			c += (u64)q * m[j] + t[j];
+			t[j-1] = (u32)c;
+			c >>= BITS_PER_DIGIT;
+		}
+		c += t[n];
+		t[n-1] = (u32)c;
+		t[n] = t[n+1] + (u32)(c >> BITS_PER_DIGIT);
+	}
+
+	/* t < 2m, so one subtraction is enough */
+	if (t[n] != 0 || mpCompare_q(t, m, n) >= 0)
+		mpSubtract(w, t, m, n);
+	else
+		mpSetEqual(w, t, n);
+
+	mpDESTROY(t, n + 2);
+}
+
+int mpMontModExp(u32 yout[], const u32 x[], const u32 e[], const MONT_CTX_T *ctx)
+{	/*	Computes y = x^e mod m in the Montgomery domain.
+		Left-to-right binary method for one digit exponents such as
+		F4 = 65537 (16 squarings and one multiplication), otherwise
+		sliding window. Ref: Menezes, chap 14, Algorithm 14.85.
+	*/
+	u32 xm[MAX_FIXED_DIGITS];
+	u32 y[MAX_FIXED_DIGITS];
+	u32 tbl[MPMONT_TABLE_SIZE * MAX_FIXED_DIGITS];
+	size_t n = ctx->ndigits;
+	size_t nbits;
+	long i, l;
+	u32 win;
+	int first;
+
+	assert(n != 0);
+
+	nbits = mpBitLength(e, n);
+	/* Catch e==0 => x^0=1 */
+	if (0 == nbits)
+	{
+		mpSetDigit(yout, 1, n);
+		return 0;
+	}
+
+	/* xm = (x mod m) * R mod m */
+	if (mpCompare_q(x, ctx->m, n) >= 0)
+	{
+		mpSetEqual(y, ctx->m, n);
+		mpModulo(xm, x, n, y, n);
+	}
+	else
+	{
+		mpSetEqual(xm, x, n);
+	}
+	mpMontMultiply(xm, xm, ctx->rr, ctx);
+
+	if (nbits <= BITS_PER_DIGIT)
+	{
+		mpSetEqual(y, xm, n);
+		for (i = (long)nbits - 2; i >= 0; i--)
+		{
+			mpMontMultiply(y, y, y, ctx);
+			if ((e[0] >> i) & 1)
+				mpMontMultiply(y, y, xm, ctx);
+		}
+	}
+	else
+	{
+		/* tbl[k] = x^(2k+1) */
+		mpSetEqual(tbl, xm, n);
+		mpMontMultiply(y, xm, xm, ctx);
+		for (l = 1; l < MPMONT_TABLE_SIZE; l++)
+			mpMontMultiply(&tbl[l * n], &tbl[(l - 1) * n], y, ctx);
+
+		first = 1;
+		i = (long)nbits - 1;
+		while (i >= 0)
+		{
+			if (!mpMONTBIT(e, i))
+			{
+				mpMontMultiply(y, y, y, ctx);
+				i--;
+				continue;
+			}
+
+			/* Longest window e_i..e_l of at most 4 bits ending in a 1 */
+			l = (i >= MPMONT_WINDOW_BITS - 1) ? i - (MPMONT_WINDOW_BITS - 1) : 0;
+			while (!mpMONTBIT(e, l))
+				l++;
+
+			for (win = 0; i >= l; i--)
+			{
+				win = (win << 1) | mpMONTBIT(e, i);
+				if (!first)
+					mpMontMultiply(y, y, y, ctx);
+			}
+
+			if (first)
+			{	/* The top bit is set, so the first window starts y */
+				mpSetEqual(y, &tbl[(win >> 1) * n], n);
+				first = 0;
+			}
+			else
+			{
+				mpMontMultiply(y, y, &tbl[(win >> 1) * n], ctx);
+			}
+		}
+	}
+
+	/* Leave the Montgomery domain, y * 1 * R^{-1} */
+	mpSetDigit(xm, 1, n);
+	mpMontMultiply(yout, y, xm, ctx);
+
+	mpDESTROY(xm, n);
+	mpDESTROY(y, n);
+	mpDESTROY(tbl, MPMONT_TABLE_SIZE * n);
+
+	return 0;
+}
+
+static MONT_CTX_T *mpMontLookup(const u32 m[], size_t ndigits)
+{	/*	Returns the cached Montgomery constants of m, computing them if
+		m is not cached. Returns NULL if m is even.
+	*/
+	MONT_CTX_T *ctx;
+	size_t i;
+
+	if (mpISEVEN(m, ndigits))
+		return NULL;
+
+	for (i = 0; i < MPMONT_CACHE_SIZE; i++)
+	{
+		ctx = &mpMontCache[i];
+		if (ctx->ndigits == ndigits && mpEqual_q(ctx->m, m, ndigits))
+			return ctx;
+	}
+
+	ctx = &mpMontCache[mpMontCacheNext];
+	mpMontCacheNext = (mpMontCacheNext + 1) % MPMONT_CACHE_SIZE;
+
+	if (mpMontSetModulus(ctx, m, ndigits) != 0)
+		return NULL;
+
+	return ctx;
+}
+#endif /* NO_ALLOCS */
 
 /* Use sliding window alternative only if NO_ALLOCS not defined */
 #ifndef NO_ALLOCS
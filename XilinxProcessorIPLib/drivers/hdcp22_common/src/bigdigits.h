@@ -206,6 +206,42 @@ int mpModExp_ct(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigit
 /** Computes a = (x * y) mod m */
 int mpModMult(u32 a[], const u32 x[], const u32 y[], u32 m[], size_t ndigits);
 
+/**	Computes y = x^e mod m reducing by division after every step
+ *  @remark The method used by mpModExp() before Montgomery multiplication
+ *  was added. Kept for even moduli and for comparison.
+ */
+int mpModExp_div(u32 y[], const u32 x[], const u32 e[], u32 m[], size_t ndigits);
+
+#ifdef NO_ALLOCS
+/* [xlnx] Montgomery multiplication for odd moduli.
+ * mpModExp() uses it for odd moduli and keeps the constants of the last
+ * MPMONT_CACHE_SIZE moduli, so repeated operations with the same key do not
+ * recompute them. A caller can also keep its own context.
+ */
+
+/** Montgomery constants of an odd modulus, set by mpMontSetModulus() */
+typedef struct
+{
+	u32 m[MAX_FIXED_DIGITS];	/**< Modulus */
+	u32 rr[MAX_FIXED_DIGITS];	/**< R^2 mod m, where R = 2^(32*ndigits) */
+	u32 minv;			/**< -m^{-1} mod 2^32 */
+	size_t ndigits;			/**< Length of m in digits, 0 if not set */
+} MONT_CTX_T;
+
+/** Sets the Montgomery constants of modulus m, returns -1 if m is even */
+int mpMontSetModulus(MONT_CTX_T *ctx, const u32 m[], size_t ndigits);
+
+/** Computes w = x * y * R^{-1} mod m for x, y < m */
+void mpMontMultiply(u32 w[], const u32 x[], const u32 y[], const MONT_CTX_T *ctx);
+
+/**	Computes y = x^e mod m with Montgomery multiplication
+ *  @remark e is ctx->ndigits long. Exponents of one digit, such as 65537,
+ *  use the binary method; longer ones a sliding window of 4 bits.
+ *  Not constant time.
+ */
+int mpMontModExp(u32 y[], const u32 x[], const u32 e[], const MONT_CTX_T *ctx);
+#endif
+
 /** Computes the inverse of `u` modulo `m`, inv = u^{-1} mod m */
 int mpModInv(u32 inv[], const u32 u[], const u32 m[], size_t ndigits);
 
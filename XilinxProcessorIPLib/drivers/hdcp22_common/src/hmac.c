@@ -42,6 +42,10 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
+* 1.01  ag   10/19/26 Added HMAC contexts with precomputed key pads and
+*                     removed the 192 byte limit on the message size.
+*       ag   10/19/26 Cleared the hashed key and the one-shot context
+*                     before returning.
 *</pre>
 *
 *****************************************************************************/
@@ -54,6 +58,7 @@
 
 /************************** Constant Definitions *****************************/
 #define SHA256_SIZE		256/8	/**< SHA256 Hash size */
+#define SHA256_BLOCK_SIZE	64	/**< SHA256 block size */
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -82,58 +87,121 @@
 * @param	HashedData is the output of this function.
 *
 * @return	- XST_SUCCESS if no errors occured
-*			- XST_FAILURE if the datasize execeeds the size of the local buffer.
+*			- XST_FAILURE if the data or key size is negative.
 *
-* @note		None.
+* @note		Use XHdcp22Cmn_HmacSha256SetKey and XHdcp22Cmn_HmacSha256Compute
+*			when several messages are authenticated with the same key.
 *
 ******************************************************************************/
 int XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData)
 {
-	u8 Ipad[65];   /* inner padding-key XORd with ipad */
-	u8 Opad[65];   /* outer padding-key XORd with opad */
+	XHdcp22Cmn_HmacSha256Ctx Ctx;
+	int Status;
+
+	if(XHdcp22Cmn_HmacSha256SetKey(&Ctx, Key, KeySize) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XHdcp22Cmn_HmacSha256Compute(&Ctx, Data, DataSize, HashedData);
+
+	memset(&Ctx, 0, sizeof(Ctx));
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prepares a HMAC_SHA256 context for a key by absorbing
+* (K XOR ipad) and (K XOR opad) into the inner and outer hash states.
+*
+* @param	Ctx is the HMAC context to initialize.
+* @param	Key is the hash-key to use.
+* @param	KeySize is the size of the hash key.
+*
+* @return	- XST_SUCCESS if no errors occured
+*			- XST_FAILURE if the key size is negative.
+*
+* @note		The context holds key material and should be cleared by the
+*			caller when it is no longer needed.
+*
+******************************************************************************/
+int XHdcp22Cmn_HmacSha256SetKey(XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Key, int KeySize)
+{
+	u8 Pad[SHA256_BLOCK_SIZE];
 	u8 Ktemp[SHA256_SIZE];
-	u8 Ktemp2[SHA256_SIZE];
-	u8 BufferIn[256];
-	u8 BufferOut[256];
 	int i;
 
-	memset(BufferIn, 0x00, 256);
-	memset(BufferOut, 0x00, 256);
-
-	/* If the input size exceeds the local buffers, return an error */
-	if(DataSize + 64 >  256) {
+	if(KeySize < 0) {
 		return XST_FAILURE;
 	}
 
 	/* If key is longer than 64 bytes reset it to Key=sha256(Key) */
-	if(KeySize > 64) {
-		XHdcp22Cmn_Sha256Hash(Key, KeySize, Ktemp );
+	if(KeySize > SHA256_BLOCK_SIZE) {
+		XHdcp22Cmn_Sha256Hash(Key, KeySize, Ktemp);
 		Key     = Ktemp;
 		KeySize = SHA256_SIZE;
 	}
 
-	/* start out by storing Key in pads */
-	memset(Ipad, 0, sizeof Ipad );
-	memset(Opad, 0, sizeof Opad );
-	memcpy(Ipad, Key, KeySize );
-	memcpy(Opad, Key, KeySize );
+	/* Inner state: SHA256(K XOR ipad, ...) */
+	memset(Pad, 0x36, sizeof(Pad));
+	for(i = 0; i < KeySize; i++) {
+		Pad[i] ^= Key[i];
+	}
+	XHdcp22Cmn_Sha256Init(&Ctx->Inner);
+	XHdcp22Cmn_Sha256Update(&Ctx->Inner, Pad, sizeof(Pad));
 
-	/* XOR Key with Ipad and Opad values */
-	for(i = 0; i < 64; i++) {
-		Ipad[i] ^= 0x36;
-		Opad[i] ^= 0x5c;
+	/* Outer state: SHA256(K XOR opad, ...) */
+	memset(Pad, 0x5c, sizeof(Pad));
+	for(i = 0; i < KeySize; i++) {
+		Pad[i] ^= Key[i];
+	}
+	XHdcp22Cmn_Sha256Init(&Ctx->Outer);
+	XHdcp22Cmn_Sha256Update(&Ctx->Outer, Pad, sizeof(Pad));
+
+	memset(Pad, 0, sizeof(Pad));
+	memset(Ktemp, 0, sizeof(Ktemp));
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the HMAC_SHA256 of a message with a context
+* prepared by XHdcp22Cmn_HmacSha256SetKey. The context is not modified and
+* can be reused for further messages.
+*
+* @param	Ctx is the HMAC context of the key.
+* @param	Data is the input data.
+* @param	DataSize is the size of the data buffer.
+* @param	HashedData is the output of this function.
+*
+* @return	- XST_SUCCESS if no errors occured
+*			- XST_FAILURE if the data size is negative.
+*
+* @note		None.
+*
+******************************************************************************/
+int XHdcp22Cmn_HmacSha256Compute(const XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Data,
+                                 int DataSize, u8 *HashedData)
+{
+	XHdcp22Cmn_Sha256Ctx Sha;
+	u8 InnerHash[SHA256_SIZE];
+
+	if(DataSize < 0) {
+		return XST_FAILURE;
 	}
 
 	/* Execute inner SHA256 */
-	memcpy(BufferIn, Ipad, 64 );
-	memcpy(BufferIn + 64, Data, DataSize );
-	XHdcp22Cmn_Sha256Hash(BufferIn, 64 + DataSize, Ktemp2 );
+	Sha = Ctx->Inner;
+	XHdcp22Cmn_Sha256Update(&Sha, Data, DataSize);
+	XHdcp22Cmn_Sha256Final(&Sha, InnerHash);
 
 	/* Execute outer SHA256 */
-	memcpy(BufferOut, Opad, 64);
-	memcpy(BufferOut + 64, Ktemp2, SHA256_SIZE );
-	XHdcp22Cmn_Sha256Hash(BufferOut, 64 + SHA256_SIZE,
-						(u8 *)HashedData );
+	Sha = Ctx->Outer;
+	XHdcp22Cmn_Sha256Update(&Sha, InnerHash, SHA256_SIZE);
+	XHdcp22Cmn_Sha256Final(&Sha, HashedData);
 
 	return XST_SUCCESS;
 }
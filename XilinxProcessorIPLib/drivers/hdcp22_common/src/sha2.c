@@ -41,6 +41,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
+* 1.01  ag   10/19/26 Added word loads and block-wise updates, and exported
+*                     the streaming interface for the HMAC contexts.
 *</pre>
 *
 *****************************************************************************/
@@ -48,14 +50,7 @@
 /***************************** Include Files ********************************/
 #include "string.h"
 #include "xil_types.h"
-
-/**************************** Type Definitions ******************************/
-typedef struct {
-   u8 data[64];
-   u32 datalen;
-   u32 bitlen[2];
-   u32 state[8];
-} Sha256Type;
+#include "xhdcp22_common.h"
 
 /***************** Macros (Inline Functions) Definitions ********************/
 // DBL_INT_ADD treats two unsigned ints a and b as one 64-bit integer and adds c to it
@@ -70,6 +65,16 @@ typedef struct {
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
+// Big-endian word load. On little-endian GCC targets this is a word load
+// followed by a byte swap, which also copes with unaligned input.
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SHA256_GETU32(p) Sha256LoadBe(p)
+#else
+#define SHA256_GETU32(p) (((u32)(p)[0] << 24) | ((u32)(p)[1] << 16) | \
+                          ((u32)(p)[2] << 8) | ((u32)(p)[3]))
+#endif
+
 /************************** Variable Definitions ****************************/
 static const u32 k[64] = {
    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
@@ -85,13 +90,32 @@ static const u32 k[64] = {
 /************************** Function Prototypes *****************************/
 
 /* SHA-256 Hashing */
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data);
-static void Sha256Init(Sha256Type *Ctx);
-static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len);
-static void Sha256Final(Sha256Type *Ctx, u8 *Hash);
+static void Sha256Transform(XHdcp22Cmn_Sha256Ctx *Ctx, const u8 *Data);
 
 /************************** Function Implementation *****************************/
 
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+/*****************************************************************************/
+/**
+* This function loads a big-endian 32-bit word from a byte array.
+*
+* @param  p points to the first byte of the word, with any alignment.
+*
+* @return The word in host byte order.
+*
+* @note   None.
+*
+******************************************************************************/
+static inline u32 Sha256LoadBe(const u8 *p)
+{
+	u32 Word;
+
+	memcpy(&Word, p, sizeof(Word));
+	return __builtin_bswap32(Word);
+}
+#endif
+
 /*****************************************************************************/
 /**
 *
@@ -108,12 +132,12 @@ static void Sha256Final(Sha256Type *Ctx, u8 *Hash);
 ******************************************************************************/
 void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 {
-	Sha256Type Ctx;
+	XHdcp22Cmn_Sha256Ctx Ctx;
 
-	Sha256Init(&Ctx);
+	XHdcp22Cmn_Sha256Init(&Ctx);
 
-	Sha256Update(&Ctx, Data, DataSize);
-	Sha256Final(&Ctx, HashedData);
+	XHdcp22Cmn_Sha256Update(&Ctx, Data, DataSize);
+	XHdcp22Cmn_Sha256Final(&Ctx, HashedData);
 }
 
 /*****************************************************************************/
@@ -121,30 +145,30 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 * This function executes a SHA256 transformation.
 *
 * @param  Ctx is the context data for SHA256.
-* @param  Data is the data to transform.
+* @param  Data is the 64 byte block to transform.
 *
 * @return None.
 *
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
+static void Sha256Transform(XHdcp22Cmn_Sha256Ctx *Ctx, const u8 *Data)
 {
-   u32 a,b,c,d,e,f,g,h,i,j,t1,t2,m[64];
+   u32 a,b,c,d,e,f,g,h,i,t1,t2,m[64];
 
-   for (i=0,j=0; i < 16; ++i, j += 4)
-      m[i] = (Data[j] << 24) | (Data[j+1] << 16) | (Data[j+2] << 8) | (Data[j+3]);
+   for (i=0; i < 16; ++i)
+      m[i] = SHA256_GETU32(Data + 4*i);
    for ( ; i < 64; ++i)
       m[i] = SIG1(m[i-2]) + m[i-7] + SIG0(m[i-15]) + m[i-16];
 
-   a = Ctx->state[0];
-   b = Ctx->state[1];
-   c = Ctx->state[2];
-   d = Ctx->state[3];
-   e = Ctx->state[4];
-   f = Ctx->state[5];
-   g = Ctx->state[6];
-   h = Ctx->state[7];
+   a = Ctx->State[0];
+   b = Ctx->State[1];
+   c = Ctx->State[2];
+   d = Ctx->State[3];
+   e = Ctx->State[4];
+   f = Ctx->State[5];
+   g = Ctx->State[6];
+   h = Ctx->State[7];
 
    for (i = 0; i < 64; ++i) {
       t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
@@ -159,14 +183,14 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
       a = t1 + t2;
    }
 
-   Ctx->state[0] += a;
-   Ctx->state[1] += b;
-   Ctx->state[2] += c;
-   Ctx->state[3] += d;
-   Ctx->state[4] += e;
-   Ctx->state[5] += f;
-   Ctx->state[6] += g;
-   Ctx->state[7] += h;
+   Ctx->State[0] += a;
+   Ctx->State[1] += b;
+   Ctx->State[2] += c;
+   Ctx->State[3] += d;
+   Ctx->State[4] += e;
+   Ctx->State[5] += f;
+   Ctx->State[6] += g;
+   Ctx->State[7] += h;
 }
 
 /*****************************************************************************/
@@ -180,25 +204,27 @@ static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Init(Sha256Type *Ctx)
+void XHdcp22Cmn_Sha256Init(XHdcp22Cmn_Sha256Ctx *Ctx)
 {
-   Ctx->datalen = 0;
-   Ctx->bitlen[0] = 0;
-   Ctx->bitlen[1] = 0;
-   Ctx->state[0] = 0x6a09e667;
-   Ctx->state[1] = 0xbb67ae85;
-   Ctx->state[2] = 0x3c6ef372;
-   Ctx->state[3] = 0xa54ff53a;
-   Ctx->state[4] = 0x510e527f;
-   Ctx->state[5] = 0x9b05688c;
-   Ctx->state[6] = 0x1f83d9ab;
-   Ctx->state[7] = 0x5be0cd19;
+	Ctx->DataLen = 0;
+	Ctx->BitLen[0] = 0;
+	Ctx->BitLen[1] = 0;
+	Ctx->State[0] = 0x6a09e667;
+	Ctx->State[1] = 0xbb67ae85;
+	Ctx->State[2] = 0x3c6ef372;
+	Ctx->State[3] = 0xa54ff53a;
+	Ctx->State[4] = 0x510e527f;
+	Ctx->State[5] = 0x9b05688c;
+	Ctx->State[6] = 0x1f83d9ab;
+	Ctx->State[7] = 0x5be0cd19;
 }
 
 /*****************************************************************************/
 /**
 *
-* This function updates the SHA data before adding padding data.
+* This function updates the SHA data before adding padding data. Complete
+* 64 byte blocks are transformed directly from the input, only a partial
+* block is copied into the context.
 *
 * @param  Ctx is the context data for SHA256.
 * @param  Data is the input data.
@@ -209,19 +235,40 @@ static void Sha256Init(Sha256Type *Ctx)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
+void XHdcp22Cmn_Sha256Update(XHdcp22Cmn_Sha256Ctx *Ctx, const u8 *Data, u32 Len)
 {
-   u32 i;
+	u32 Fill;
 
-   for (i=0; i < Len; ++i) {
-      Ctx->data[Ctx->datalen] = Data[i];
-      Ctx->datalen++;
-      if (Ctx->datalen == 64) {
-	  Sha256Transform(Ctx,Ctx->data);
-         DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
-         Ctx->datalen = 0;
-      }
-   }
+	if (Len == 0)
+		return;
+
+	// Complete a partially filled block first.
+	if (Ctx->DataLen != 0) {
+		Fill = 64 - Ctx->DataLen;
+		if (Len < Fill) {
+			memcpy(&Ctx->Data[Ctx->DataLen], Data, Len);
+			Ctx->DataLen += Len;
+			return;
+		}
+		memcpy(&Ctx->Data[Ctx->DataLen], Data, Fill);
+		Sha256Transform(Ctx, Ctx->Data);
+		DBL_INT_ADD(Ctx->BitLen[0], Ctx->BitLen[1], 512);
+		Ctx->DataLen = 0;
+		Data += Fill;
+		Len -= Fill;
+	}
+
+	while (Len >= 64) {
+		Sha256Transform(Ctx, Data);
+		DBL_INT_ADD(Ctx->BitLen[0], Ctx->BitLen[1], 512);
+		Data += 64;
+		Len -= 64;
+	}
+
+	if (Len != 0) {
+		memcpy(Ctx->Data, Data, Len);
+		Ctx->DataLen = Len;
+	}
 }
 
 /*****************************************************************************/
@@ -237,48 +284,48 @@ static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Final(Sha256Type *Ctx, u8 *Hash)
+void XHdcp22Cmn_Sha256Final(XHdcp22Cmn_Sha256Ctx *Ctx, u8 *Hash)
 {
    u32 i;
 
-   i = Ctx->datalen;
+   i = Ctx->DataLen;
 
    // Pad whatever data is left in the buffer.
-   if (Ctx->datalen < 56) {
-      Ctx->data[i++] = 0x80;
+   if (Ctx->DataLen < 56) {
+      Ctx->Data[i++] = 0x80;
       while (i < 56)
-         Ctx->data[i++] = 0x00;
+         Ctx->Data[i++] = 0x00;
    }
    else {
-      Ctx->data[i++] = 0x80;
+      Ctx->Data[i++] = 0x80;
       while (i < 64)
-         Ctx->data[i++] = 0x00;
-      Sha256Transform(Ctx,Ctx->data);
-      memset(Ctx->data,0,56);
+         Ctx->Data[i++] = 0x00;
+      Sha256Transform(Ctx,Ctx->Data);
+      memset(Ctx->Data,0,56);
    }
 
    // Append to the padding the total message's length in bits and transform.
-   DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],Ctx->datalen * 8);
-   Ctx->data[63] = Ctx->bitlen[0];
-   Ctx->data[62] = Ctx->bitlen[0] >> 8;
-   Ctx->data[61] = Ctx->bitlen[0] >> 16;
-   Ctx->data[60] = Ctx->bitlen[0] >> 24;
-   Ctx->data[59] = Ctx->bitlen[1];
-   Ctx->data[58] = Ctx->bitlen[1] >> 8;
-   Ctx->data[57] = Ctx->bitlen[1] >> 16;
-   Ctx->data[56] = Ctx->bitlen[1] >> 24;
-   Sha256Transform(Ctx,Ctx->data);
+   DBL_INT_ADD(Ctx->BitLen[0],Ctx->BitLen[1],Ctx->DataLen * 8);
+   Ctx->Data[63] = Ctx->BitLen[0];
+   Ctx->Data[62] = Ctx->BitLen[0] >> 8;
+   Ctx->Data[61] = Ctx->BitLen[0] >> 16;
+   Ctx->Data[60] = Ctx->BitLen[0] >> 24;
+   Ctx->Data[59] = Ctx->BitLen[1];
+   Ctx->Data[58] = Ctx->BitLen[1] >> 8;
+   Ctx->Data[57] = Ctx->BitLen[1] >> 16;
+   Ctx->Data[56] = Ctx->BitLen[1] >> 24;
+   Sha256Transform(Ctx,Ctx->Data);
 
    // Since this implementation uses little endian byte ordering and SHA uses big endian,
    // reverse all the bytes when copying the final state to the output hash.
    for (i=0; i < 4; ++i) {
-      Hash[i]    = (Ctx->state[0] >> (24-i*8)) & 0x000000ff;
-      Hash[i+4]  = (Ctx->state[1] >> (24-i*8)) & 0x000000ff;
-      Hash[i+8]  = (Ctx->state[2] >> (24-i*8)) & 0x000000ff;
-      Hash[i+12] = (Ctx->state[3] >> (24-i*8)) & 0x000000ff;
-      Hash[i+16] = (Ctx->state[4] >> (24-i*8)) & 0x000000ff;
-      Hash[i+20] = (Ctx->state[5] >> (24-i*8)) & 0x000000ff;
-      Hash[i+24] = (Ctx->state[6] >> (24-i*8)) & 0x000000ff;
-      Hash[i+28] = (Ctx->state[7] >> (24-i*8)) & 0x000000ff;
+      Hash[i]    = (Ctx->State[0] >> (24-i*8)) & 0x000000ff;
+      Hash[i+4]  = (Ctx->State[1] >> (24-i*8)) & 0x000000ff;
+      Hash[i+8]  = (Ctx->State[2] >> (24-i*8)) & 0x000000ff;
+      Hash[i+12] = (Ctx->State[3] >> (24-i*8)) & 0x000000ff;
+      Hash[i+16] = (Ctx->State[4] >> (24-i*8)) & 0x000000ff;
+      Hash[i+20] = (Ctx->State[5] >> (24-i*8)) & 0x000000ff;
+      Hash[i+24] = (Ctx->State[6] >> (24-i*8)) & 0x000000ff;
+      Hash[i+28] = (Ctx->State[7] >> (24-i*8)) & 0x000000ff;
    }
 }
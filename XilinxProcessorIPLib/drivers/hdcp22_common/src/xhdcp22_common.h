@@ -43,6 +43,11 @@
 * 1.00  MH   10/30/15 First Release.
 * 1.01  MH   01/15/16 Added prefix to function names.
 * 2.00  MH   06/21/17 Changed DIGIT_T type to u32 for ARM support.
+* 2.01  ag   10/19/26 Added Montgomery modular exponentiation to bigdigits.c
+*                     and the modular exponentiation benchmark example.
+* 2.02  ag   10/19/26 Added XHdcp22Cmn_Aes128CtrEncrypt.
+* 2.03  ag   10/19/26 Added the SHA-256 streaming interface and HMAC-SHA256
+*                     contexts with precomputed key pads.
 *</pre>
 *
 *****************************************************************************/
@@ -61,15 +66,44 @@ extern "C" {
 
 /**************************** Type Definitions ******************************/
 
+/**
+* SHA-256 context for hashing data supplied in several parts.
+*/
+typedef struct {
+	u8  Data[64];       /**< Partially filled input block */
+	u32 DataLen;        /**< Number of bytes in Data */
+	u32 BitLen[2];      /**< Length of the processed blocks in bits,
+	                         low word first */
+	u32 State[8];       /**< Intermediate hash value */
+} XHdcp22Cmn_Sha256Ctx;
+
+/**
+* HMAC-SHA256 context. It holds the hash states after the inner and outer
+* key pads have been absorbed, so that each message authenticated with the
+* same key saves two SHA-256 compressions.
+*/
+typedef struct {
+	XHdcp22Cmn_Sha256Ctx Inner; /**< State after (K XOR ipad) */
+	XHdcp22Cmn_Sha256Ctx Outer; /**< State after (K XOR opad) */
+} XHdcp22Cmn_HmacSha256Ctx;
+
 /***************** Macros (Inline Functions) Definitions ********************/
 
 /************************** Function Prototypes *****************************/
 
 /* Cryptographic functions */
 void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData);
+void XHdcp22Cmn_Sha256Init(XHdcp22Cmn_Sha256Ctx *Ctx);
+void XHdcp22Cmn_Sha256Update(XHdcp22Cmn_Sha256Ctx *Ctx, const u8 *Data, u32 Len);
+void XHdcp22Cmn_Sha256Final(XHdcp22Cmn_Sha256Ctx *Ctx, u8 *Hash);
 int  XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData);
+int  XHdcp22Cmn_HmacSha256SetKey(XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Key, int KeySize);
+int  XHdcp22Cmn_HmacSha256Compute(const XHdcp22Cmn_HmacSha256Ctx *Ctx, const u8 *Data,
+                                  int DataSize, u8 *HashedData);
 void XHdcp22Cmn_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output);
 void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output);
+void XHdcp22Cmn_Aes128CtrEncrypt(const u8 *Data, u32 DataSize, const u8 *Key,
+                                 const u8 *Iv, u8 *Output);
 
 #ifdef __cplusplus
 }
@@ -57,6 +57,9 @@
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
 * 2.20  MH   06/08/17 Updated for 64 bit support.
+* 2.21  ag   10/19/26 Added RSA CRT stage events to XHdcp22Rx_LogDisplay.
+*                     Key the HMAC-SHA256 contexts of the session once
+*                     with H' and use them for L', V' and M'.
 *</pre>
 *
 *****************************************************************************/
@@ -1769,6 +1772,9 @@ static void XHdcp22Rx_ResetParams(XHdcp22_Rx *InstancePtr)
 	memset(InstancePtr->Params.SeqNumM,      0, sizeof(InstancePtr->Params.SeqNumM));
 	memset(InstancePtr->Params.StreamIdType, 0, sizeof(InstancePtr->Params.StreamIdType));
 	memset(InstancePtr->Params.MPrime,       0, sizeof(InstancePtr->Params.MPrime));
+	memset(&InstancePtr->Params.KdHmac,      0, sizeof(InstancePtr->Params.KdHmac));
+	memset(&InstancePtr->Params.LPrimeHmac,  0, sizeof(InstancePtr->Params.LPrimeHmac));
+	memset(&InstancePtr->Params.MPrimeHmac,  0, sizeof(InstancePtr->Params.MPrimeHmac));
 }
 
 /*****************************************************************************/
@@ -3122,8 +3128,11 @@ static int XHdcp22Rx_SendMessageAKESendHPrime(XHdcp22_Rx *InstancePtr)
 
 	/* Compute H Prime */
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME);
-	XHdcp22Rx_ComputeHPrime(InstancePtr->Params.Rrx, InstancePtr->Params.RxCaps,
-			InstancePtr->Params.Rtx, InstancePtr->Params.TxCaps, InstancePtr->Params.Km,
+	XHdcp22Rx_ComputeKdHmac(InstancePtr->Params.Rrx, InstancePtr->Params.Rtx,
+			InstancePtr->Params.Km, &InstancePtr->Params.KdHmac,
+			&InstancePtr->Params.LPrimeHmac, &InstancePtr->Params.MPrimeHmac);
+	XHdcp22Rx_ComputeHPrime(&InstancePtr->Params.KdHmac, InstancePtr->Params.RxCaps,
+			InstancePtr->Params.Rtx, InstancePtr->Params.TxCaps,
 			MsgPtr->AKESendHPrime.HPrime);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME_DONE);
 
@@ -3278,8 +3287,8 @@ static int XHdcp22Rx_SendMessageLCSendLPrime(XHdcp22_Rx *InstancePtr)
 
 	/* Compute LPrime */
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_LPRIME);
-	XHdcp22Rx_ComputeLPrime(InstancePtr->Params.Rn, InstancePtr->Params.Km, InstancePtr->Params.Rrx,
-		InstancePtr->Params.Rtx, MsgPtr->LCSendLPrime.LPrime);
+	XHdcp22Rx_ComputeLPrime(&InstancePtr->Params.LPrimeHmac, InstancePtr->Params.Rn,
+		MsgPtr->LCSendLPrime.LPrime);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_LPRIME_DONE);
 
 	/* Generate LC_Send_L_prime message */
@@ -3427,9 +3436,7 @@ static int XHdcp22Rx_SendMessageRepeaterAuthSendRxIdList(XHdcp22_Rx *InstancePtr
 			InstancePtr->Topology.DeviceCnt,
 			MsgPtr->RepeaterAuthSendRxIdList.RxInfo,
 			MsgPtr->RepeaterAuthSendRxIdList.SeqNumV,
-			InstancePtr->Params.Km,
-			InstancePtr->Params.Rrx,
-			InstancePtr->Params.Rtx,
+			&InstancePtr->Params.KdHmac,
 			InstancePtr->Params.VPrime);
 		XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_VPRIME_DONE);
 
@@ -3596,8 +3603,7 @@ static int XHdcp22Rx_SendMessageRepeaterAuthStreamReady(XHdcp22_Rx *InstancePtr)
 	/* Compute MPrime */
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_MPRIME);
 	XHdcp22Rx_ComputeMPrime(InstancePtr->Params.StreamIdType, InstancePtr->Params.SeqNumM,
-		InstancePtr->Params.Km, InstancePtr->Params.Rrx, InstancePtr->Params.Rtx,
-		MsgPtr->RepeaterAuthStreamReady.MPrime);
+		&InstancePtr->Params.MPrimeHmac, MsgPtr->RepeaterAuthStreamReady.MPrime);
 	XHdcp22Rx_LogWr(InstancePtr, XHDCP22_RX_LOG_EVT_DEBUG, XHDCP22_RX_LOG_DEBUG_COMPUTE_MPRIME_DONE);
 
 	/* Generate RepeaterAuth_Stream_Ready message */
@@ -4071,6 +4077,12 @@ void XHdcp22Rx_LogDisplay(XHdcp22_Rx *InstancePtr)
 				strcpy(str, "COMPUTE_RSA"); break;
 			case XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_DONE:
 				strcpy(str, "COMPUTE_RSA_DONE"); break;
+			case XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_MODP_DONE:
+				strcpy(str, "COMPUTE_RSA_MODP_DONE"); break;
+			case XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_MODQ_DONE:
+				strcpy(str, "COMPUTE_RSA_MODQ_DONE"); break;
+			case XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_CRT_DONE:
+				strcpy(str, "COMPUTE_RSA_CRT_DONE"); break;
 			case XHDCP22_RX_LOG_DEBUG_COMPUTE_KM:
 				strcpy(str, "COMPUTE_KM"); break;
 			case XHDCP22_RX_LOG_DEBUG_COMPUTE_KM_DONE:
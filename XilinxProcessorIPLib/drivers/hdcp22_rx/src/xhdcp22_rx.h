@@ -102,6 +102,8 @@
 *                     to array. Added function XHDCP22Rx_GetVersion.
 * 2.00  MH   04/14/16 Updated for repeater upstream support.
 * 2.01  MH   02/28/17 Fixed compiler warnings.
+* 2.21  ag   10/19/26 Added the kd keyed HMAC-SHA256 contexts to
+*                     XHdcp22_Rx_Parameters.
 *</pre>
 *
 *****************************************************************************/
@@ -122,6 +124,7 @@ extern "C" {
 #include "xhdcp22_rng.h"
 #include "xhdcp22_mmult.h"
 #include "xhdcp22_cipher.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions ****************************/
 #define XHDCP22_RX_MAX_MESSAGE_SIZE           534  /**< Maximum message size */
@@ -430,6 +433,9 @@ typedef struct
 	u8 SeqNumM[3];
 	u8 StreamIdType[2];
 	u8 MPrime[32];
+	XHdcp22Cmn_HmacSha256Ctx KdHmac;     /**< HMAC keyed with kd */
+	XHdcp22Cmn_HmacSha256Ctx LPrimeHmac; /**< HMAC keyed with kd xor Rrx */
+	XHdcp22Cmn_HmacSha256Ctx MPrimeHmac; /**< HMAC keyed with SHA256(kd) */
 } XHdcp22_Rx_Parameters;
 
 /**
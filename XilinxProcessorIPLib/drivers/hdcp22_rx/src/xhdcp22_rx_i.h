@@ -48,6 +48,7 @@
 * 1.01  MH   03/02/16 Moved prototype of XHdcp22Rx_CalcMontNPrime to
 *                     to internal functions.
 * 1.02  MH   04/14/16 Updated for repeater upstream support.
+* 2.21  ag   10/19/26 Added RSA CRT stage debug log events.
 *</pre>
 *
 *****************************************************************************/
@@ -179,6 +180,9 @@ typedef enum
 	XHDCP22_RX_LOG_DEBUG_READ_MESSAGE_COMPLETE,    /**< Read message complete */
 	XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA,              /**< RSA decryption of Km computation start */
 	XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_DONE,         /**< RSA decryption of Km computation done */
+	XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_MODP_DONE,    /**< RSA decryption CRT exponentiation modulo p done */
+	XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_MODQ_DONE,    /**< RSA decryption CRT exponentiation modulo q done */
+	XHDCP22_RX_LOG_DEBUG_COMPUTE_RSA_CRT_DONE,     /**< RSA decryption CRT recombination done */
 	XHDCP22_RX_LOG_DEBUG_COMPUTE_KM,               /**< Authentication Km computation start */
 	XHDCP22_RX_LOG_DEBUG_COMPUTE_KM_DONE,          /**< Authentication Km computation done */
 	XHDCP22_RX_LOG_DEBUG_COMPUTE_HPRIME,           /**< Authentication HPrime computation start */
@@ -450,17 +454,21 @@ int  XHdcp22Rx_RsaesOaepEncrypt(const XHdcp22_Rx_KpubRx *KpubRx, const u8 *Messa
 			const u32 MessageLen, const u8 *MaskingSeed, u8 *EncryptedMessage);
 int  XHdcp22Rx_RsaesOaepDecrypt(XHdcp22_Rx *InstancePtr, const XHdcp22_Rx_KprivRx *KprivRx,
 			 u8 *EncryptedMessage, u8 *Message, int *MessageLen);
-void XHdcp22Rx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps, const u8* Rtx,
-	     const u8 *TxCaps, const u8 *Km, u8 *HPrime);
+void XHdcp22Rx_ComputeKdHmac(const u8 *Rrx, const u8 *Rtx, const u8 *Km,
+	     XHdcp22Cmn_HmacSha256Ctx *KdHmac, XHdcp22Cmn_HmacSha256Ctx *LPrimeHmac,
+	     XHdcp22Cmn_HmacSha256Ctx *MPrimeHmac);
+void XHdcp22Rx_ComputeHPrime(const XHdcp22Cmn_HmacSha256Ctx *KdHmac, const u8 *RxCaps,
+	     const u8* Rtx, const u8 *TxCaps, u8 *HPrime);
 void XHdcp22Rx_ComputeEkh(const u8 *KprivRx, const u8 *Km, const u8 *M, u8 *Ekh);
-void XHdcp22Rx_ComputeLPrime(const u8 *Rn, const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *LPrime);
+void XHdcp22Rx_ComputeLPrime(const XHdcp22Cmn_HmacSha256Ctx *LPrimeHmac, const u8 *Rn,
+	     u8 *LPrime);
 void XHdcp22Rx_ComputeKs(const u8* Rrx, const u8* Rtx, const u8 *Km, const u8 *Rn,
 			 const u8 *Eks, u8 * Ks);
 void XHdcp22Rx_ComputeVPrime(const u8 *ReceiverIdList, u32 ReceiverIdListSize,
-       const u8 *RxInfo, const u8 *SeqNumV, const u8 *Km, const u8 *Rrx,
-       const u8 *Rtx, u8 *VPrime);
+       const u8 *RxInfo, const u8 *SeqNumV, const XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+       u8 *VPrime);
 void XHdcp22Rx_ComputeMPrime(const u8 *StreamIdType, const u8 *SeqNumM,
-       const u8 *Km, const u8 *Rrx, const u8 *Rtx, u8 *MPrime);
+       const XHdcp22Cmn_HmacSha256Ctx *MPrimeHmac, u8 *MPrime);
 
 #ifdef _XHDCP22_RX_TEST_
 /* External functions used for self-testing */
@@ -75,6 +75,10 @@
 *                          buffer.
 *                       6. Check return status of DDC write/read when polling
 *                          RxStatus register.
+*       ag     10/19/26 Key the kd HMAC-SHA256 contexts once when H' is
+*                       verified and reuse them for L', V and M.
+*       ag     10/19/26 Clear the kd HMAC-SHA256 contexts on reset, when
+*                       authentication restarts and with the pairing info.
 * </pre>
 *
 ******************************************************************************/
@@ -198,6 +202,7 @@ static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
                                              const u8* ReceiverId);
 static XHdcp22_Tx_PairingInfo *XHdcp22Tx_UpdatePairingInfo(XHdcp22_Tx *InstancePtr,
                               const XHdcp22_Tx_PairingInfo *PairingInfo, u8 Ready);
+static void XHdcp22Tx_ClearKdHmac(XHdcp22_Tx *InstancePtr);
 
 /* Timer functions */
 static void XHdcp22Tx_TimerHandler(void *CallbackRef, u8 TmrCntNumber);
@@ -1086,6 +1091,9 @@ int XHdcp22Tx_Reset(XHdcp22_Tx *InstancePtr)
 	/* Clear Topology Available flag */
 	InstancePtr->Info.IsTopologyAvailable = (FALSE);
 
+	/* Clear the session keys derived from Km */
+	XHdcp22Tx_ClearKdHmac(InstancePtr);
+
 	/* Disable encryption */
 	XHdcp22Tx_DisableEncryption(InstancePtr);
 
@@ -1585,6 +1593,10 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA0(XHdcp22_Tx *InstancePtr)
 {
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_STATE, (u16)XHDCP22_TX_STATE_A0);
 
+	/* A failed or restarted authentication ends the session, clear the
+	   keys derived from Km */
+	XHdcp22Tx_ClearKdHmac(InstancePtr);
+
 	/* Check if HDCP2Capable flag is true */
 	if (!InstancePtr->IsReceiverHDCP2Capable) {
 		InstancePtr->Info.AuthenticationStatus = XHDCP22_TX_INCOMPATIBLE_RX;
@@ -1897,9 +1909,12 @@ static XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_Nsk0(XHdcp22_Tx *InstancePtr)
 	/* Verify the received H' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
                   XHDCP22_TX_LOG_DBG_COMPUTE_H);
-	XHdcp22Tx_ComputeHPrime(PairingInfoPtr->Rrx, PairingInfoPtr->RxCaps,
-	                        PairingInfoPtr->Rtx, XHdcp22_Tx_TxCaps,
-	                        PairingInfoPtr->Km, HPrime);
+	XHdcp22Tx_ComputeKdHmac(PairingInfoPtr->Rrx, PairingInfoPtr->Rtx,
+	                        PairingInfoPtr->Km, &InstancePtr->Info.KdHmac,
+	                        &InstancePtr->Info.LPrimeHmac,
+	                        &InstancePtr->Info.MHmac);
+	XHdcp22Tx_ComputeHPrime(&InstancePtr->Info.KdHmac, PairingInfoPtr->RxCaps,
+	                        PairingInfoPtr->Rtx, XHdcp22_Tx_TxCaps, HPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	                XHDCP22_TX_LOG_DBG_COMPUTE_H_DONE);
 
@@ -2032,9 +2047,12 @@ static XHdcp22_Tx_StateType Xhdcp22Tx_StateA1_Sk0(XHdcp22_Tx *InstancePtr)
 	/* Verify the received H' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 								 XHDCP22_TX_LOG_DBG_COMPUTE_H);
-	XHdcp22Tx_ComputeHPrime(InstancePtr->Info.Rrx, PairingInfoPtr->RxCaps,
-							InstancePtr->Info.Rtx, XHdcp22_Tx_TxCaps,
-							PairingInfoPtr->Km, HPrime);
+	XHdcp22Tx_ComputeKdHmac(InstancePtr->Info.Rrx, InstancePtr->Info.Rtx,
+							PairingInfoPtr->Km, &InstancePtr->Info.KdHmac,
+							&InstancePtr->Info.LPrimeHmac,
+							&InstancePtr->Info.MHmac);
+	XHdcp22Tx_ComputeHPrime(&InstancePtr->Info.KdHmac, PairingInfoPtr->RxCaps,
+							InstancePtr->Info.Rtx, XHdcp22_Tx_TxCaps, HPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 								 XHDCP22_TX_LOG_DBG_COMPUTE_H_DONE);
 
@@ -2119,8 +2137,6 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx *InstancePtr)
 	int Result = XST_SUCCESS;
 	u8 LPrime[XHDCP22_TX_H_PRIME_SIZE];
 
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-	                       (XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 	                      (XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 
@@ -2156,8 +2172,7 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA2_1(XHdcp22_Tx *InstancePtr)
 	/* Verify the received L' */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 	XHDCP22_TX_LOG_DBG_COMPUTE_L);
-	XHdcp22Tx_ComputeLPrime(InstancePtr->Info.Rn, PairingInfoPtr->Km,
-	                        InstancePtr->Info.Rrx, InstancePtr->Info.Rtx,
+	XHdcp22Tx_ComputeLPrime(&InstancePtr->Info.LPrimeHmac, InstancePtr->Info.Rn,
 	                        LPrime);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG,
 		XHDCP22_TX_LOG_DBG_COMPUTE_L_DONE);
@@ -2373,8 +2388,6 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA6_A7_A8(XHdcp22_Tx *InstancePtr)
 	 * so clear the topology available flag */
 	InstancePtr->Info.IsTopologyAvailable = (FALSE);
 
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-		(XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage *MsgPtr =
 		(XHdcp22_Tx_DDCMessage *)InstancePtr->MessageBuffer;
 	/* Wait for the receiver to respond within 3 secs.
@@ -2435,13 +2448,11 @@ static XHdcp22_Tx_StateType XHdcp22Tx_StateA6_A7_A8(XHdcp22_Tx *InstancePtr)
 
 	/* Verify the received VPrime */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_V);
-	XHdcp22Tx_ComputeV(InstancePtr->Info.Rn, InstancePtr->Info.Rrx,
+	XHdcp22Tx_ComputeV(&InstancePtr->Info.KdHmac,
 		MsgPtr->Message.RepeatAuthSendRecvIDList.RxInfo,
-		InstancePtr->Info.Rtx,
 		(u8 *)MsgPtr->Message.RepeatAuthSendRecvIDList.ReceiverIDs,
 		DeviceCount,
 		MsgPtr->Message.RepeatAuthSendRecvIDList.SeqNum_V,
-		PairingInfoPtr->Km,
 		V);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_V_DONE);
 
@@ -3723,8 +3734,6 @@ static int XHdcp22Tx_WriteRepeaterAuth_Send_Ack(XHdcp22_Tx *InstancePtr, const u
 ******************************************************************************/
 static int XHdcp22Tx_WriteRepeaterAuth_Stream_Manage(XHdcp22_Tx *InstancePtr)
 {
-	XHdcp22_Tx_PairingInfo *PairingInfoPtr =
-		(XHdcp22_Tx_PairingInfo *)InstancePtr->Info.StateContext;
 	XHdcp22_Tx_DDCMessage* MsgPtr =
 		(XHdcp22_Tx_DDCMessage*)InstancePtr->MessageBuffer;
 
@@ -3749,13 +3758,10 @@ static int XHdcp22Tx_WriteRepeaterAuth_Stream_Manage(XHdcp22_Tx *InstancePtr)
 	/* To make verifying the MPrime from the repeater easier,
 	 * the M is calculated and stored before executing the write */
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_M);
-	XHdcp22Tx_ComputeM(InstancePtr->Info.Rn,
-		InstancePtr->Info.Rrx,
-		InstancePtr->Info.Rtx,
+	XHdcp22Tx_ComputeM(&InstancePtr->Info.MHmac,
 		MsgPtr->Message.RepeatAuthStreamManage.StreamID_Type,
 		MsgPtr->Message.RepeatAuthStreamManage.K,
 		MsgPtr->Message.RepeatAuthStreamManage.SeqNum_M,
-		PairingInfoPtr->Km,
 		InstancePtr->Info.M);
 	XHdcp22Tx_LogWr(InstancePtr, XHDCP22_TX_LOG_EVT_DBG, XHDCP22_TX_LOG_DBG_COMPUTE_M_DONE);
 
@@ -3852,6 +3858,7 @@ int XHdcp22Tx_ClearPairingInfo(XHdcp22_Tx *InstancePtr)
 
 	memset(InstancePtr->Info.PairingInfo, 0x00,
 	       sizeof(InstancePtr->Info.PairingInfo));
+	XHdcp22Tx_ClearKdHmac(InstancePtr);
 
 	return XST_SUCCESS;
 }
@@ -3968,6 +3975,28 @@ static void XHdcp22Tx_InvalidatePairingInfo(XHdcp22_Tx *InstancePtr,
 	}
 	/* clear the found structure */
 	memset(InfoPtr, 0x00, sizeof(XHdcp22_Tx_PairingInfo));
+	XHdcp22Tx_ClearKdHmac(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the HMAC-SHA256 contexts keyed with kd and the
+* keys derived from it.
+*
+* @param  InstancePtr is a pointer to the XHdcp22_Tx core instance.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+static void XHdcp22Tx_ClearKdHmac(XHdcp22_Tx *InstancePtr)
+{
+	memset(&InstancePtr->Info.KdHmac, 0x00, sizeof(InstancePtr->Info.KdHmac));
+	memset(&InstancePtr->Info.LPrimeHmac, 0x00,
+	       sizeof(InstancePtr->Info.LPrimeHmac));
+	memset(&InstancePtr->Info.MHmac, 0x00, sizeof(InstancePtr->Info.MHmac));
 }
 
 /*****************************************************************************/
@@ -86,6 +86,8 @@
 * 2.01  MH     02/28/17 Fixed compiler warnings.
 * 2.20  MH     04/12/17 Added function XHdcp22Tx_IsDwnstrmCapable.
 * 2.30  MH     07/06/17 Changed default polling value to 10 ms.
+*       ag     10/19/26 Added the kd keyed HMAC-SHA256 contexts to
+*                       XHdcp22_Tx_Info.
 * </pre>
 *
 ******************************************************************************/
@@ -108,6 +110,7 @@ extern "C" {
 #include "xtmrctr.h"
 #include "xhdcp22_cipher.h"
 #include "xhdcp22_rng.h"
+#include "xhdcp22_common.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -333,6 +336,9 @@ typedef struct
 	u8 Rtx[8];                          /**< Internal used Rtx. */
 	u8 Rrx[8];                          /**< Internal used Rrx. */
 	u8 Rn[8];                           /**< Internal used Rn. */
+	XHdcp22Cmn_HmacSha256Ctx KdHmac;     /**< HMAC keyed with kd, for H' and V. */
+	XHdcp22Cmn_HmacSha256Ctx LPrimeHmac; /**< HMAC keyed with kd XOR Rrx, for L'. */
+	XHdcp22Cmn_HmacSha256Ctx MHmac;      /**< HMAC keyed with SHA256(kd), for M. */
 	void *StateContext;                 /**< Context used internally by the state machine. */
 	u16  LocalityCheckCounter;          /**< Locality may attempt 1024 times. */
 	u8 MsgAvailable;                    /**< Message is available for reading. */
@@ -49,6 +49,9 @@
 * 2.00  MH     06/28/16 Updated for repeater downstream support.
 * 2.30  MH     05/16/16 1. Reduced BD_MAX_MOD_SIZE to optimize stack size.
 *                       2. Updated for 64 bit support.
+*       ag     10/19/26 Added XHdcp22Tx_ComputeKdHmac. HPrime, LPrime, V and
+*                       M use the HMAC-SHA256 contexts it keys once per
+*                       session instead of deriving kd every time.
 * </pre>
 *
 ******************************************************************************/
@@ -484,41 +487,47 @@ int XHdcp22Tx_VerifySRM(const u8* SrmPtr, int SrmSize,
 /*****************************************************************************/
 /**
 *
-* This function computes HPrime
+* This function derives kd from Km and keys the HMAC-SHA256 contexts used for
+* HPrime, LPrime, V and M. kd only changes with Km, Rtx and Rrx, so the
+* contexts are keyed once per authentication and each of the values then
+* costs two SHA256 compressions less. This matters most for the locality
+* check, which may compute LPrime several times.
 *
 * @param  Rrx is the Rx random generated value on start of authentication.
-* @param  RxCaps are the capabilities of the receiver.
 * @param  Rtx is the Tx random generated value start of authentication.
-* @param  TxCaps are the capabilities of the receiver.
 * @param  Km is the master key generated by tx.
-* @param  HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+* @param  KdHmac is the context keyed with kd, used for HPrime and V.
+* @param  LPrimeHmac is the context keyed with kd XOR Rrx, used for LPrime.
+* @param  MHmac is the context keyed with SHA256(kd), used for M.
 *
 * @return None.
 *
 * @note   None.
 *
 ******************************************************************************/
-void XHdcp22Tx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps,
-                             const u8* Rtx, const u8 *TxCaps,
-                             const u8 *Km, u8 *HPrime)
+void XHdcp22Tx_ComputeKdHmac(const u8 *Rrx, const u8 *Rtx, const u8 *Km,
+                             XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+                             XHdcp22Cmn_HmacSha256Ctx *LPrimeHmac,
+                             XHdcp22Cmn_HmacSha256Ctx *MHmac)
 {
 	/* Verify arguments */
 	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(RxCaps != NULL);
 	Xil_AssertVoid(Rtx != NULL);
-	Xil_AssertVoid(TxCaps != NULL);
 	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(HPrime != NULL);
+	Xil_AssertVoid(KdHmac != NULL);
+	Xil_AssertVoid(LPrimeHmac != NULL);
+	Xil_AssertVoid(MHmac != NULL);
 
 	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
 	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
 	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
+	u8 HashKey[XHDCP22_TX_SHA256_HASH_SIZE];
 
-	u8 HashInput[XHDCP22_TX_RTX_SIZE + XHDCP22_TX_RXCAPS_SIZE +
-               XHDCP22_TX_TXCAPS_SIZE];
-	int Idx = 0;
-
-	/* Normally we should do: Key XOR with Rn, but Rn is 0. */
+	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
+	 * Note: Protocol says we should use incoming Rn and XOR it with Km,
+	 * but then the output does not match the errata output.
+	 * For now we use for Rn 0, which matches the test vectors.
+	 */
 	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
 
 	/* Determine dkey0. */
@@ -528,11 +537,60 @@ void XHdcp22Tx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps,
 	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
 	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
 
-
 	/* Determine dkey1, counter is 1: Rrx | 0x01. */
 	Aes_Iv[15] ^= 0x01; /* big endian! */
 	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
 
+	/* HashKey for HPrime and V:	Kd */
+	XHdcp22Cmn_HmacSha256SetKey(KdHmac, Kd, sizeof(Kd));
+
+	/* HashKey for LPrime:	Kd XOR Rrx (least sign. 64 bits). */
+	memset(HashKey, 0x00, XHDCP22_TX_SHA256_HASH_SIZE);
+	memcpy(&HashKey[XHDCP22_TX_SHA256_HASH_SIZE-XHDCP22_TX_RRX_SIZE], Rrx,
+	       XHDCP22_TX_RRX_SIZE);
+	XHdcp22Tx_MemXor(HashKey, HashKey, Kd, XHDCP22_TX_SHA256_HASH_SIZE);
+	XHdcp22Cmn_HmacSha256SetKey(LPrimeHmac, HashKey, sizeof(HashKey));
+
+	/* HashKey for M:	SHA256(Kd) */
+	XHdcp22Cmn_Sha256Hash(Kd, sizeof(Kd), HashKey);
+	XHdcp22Cmn_HmacSha256SetKey(MHmac, HashKey, sizeof(HashKey));
+
+	/* Do not leave the keys on the stack. */
+	memset(Aes_Key, 0x00, sizeof(Aes_Key));
+	memset(Kd, 0x00, sizeof(Kd));
+	memset(HashKey, 0x00, sizeof(HashKey));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes HPrime
+*
+* @param  KdHmac is the context keyed with kd by #XHdcp22Tx_ComputeKdHmac.
+* @param  RxCaps are the capabilities of the receiver.
+* @param  Rtx is the Tx random generated value start of authentication.
+* @param  TxCaps are the capabilities of the receiver.
+* @param  HPrime is a pointer to the HPrime hash from the HDCP2.2 receiver.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+void XHdcp22Tx_ComputeHPrime(const XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+                             const u8 *RxCaps, const u8* Rtx,
+                             const u8 *TxCaps, u8 *HPrime)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(KdHmac != NULL);
+	Xil_AssertVoid(RxCaps != NULL);
+	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(TxCaps != NULL);
+	Xil_AssertVoid(HPrime != NULL);
+
+	u8 HashInput[XHDCP22_TX_RTX_SIZE + XHDCP22_TX_RXCAPS_SIZE +
+               XHDCP22_TX_TXCAPS_SIZE];
+	int Idx = 0;
 
 	/* Create hash with HMAC-SHA256. */
 	/* Input: Rtx || RxCaps || TxCaps. */
@@ -543,21 +601,16 @@ void XHdcp22Tx_ComputeHPrime(const u8* Rrx, const u8 *RxCaps,
 	memcpy(&HashInput[Idx], TxCaps, XHDCP22_TX_TXCAPS_SIZE);
 
 	/* HashKey:	Kd*/
-	XHdcp22Cmn_HmacSha256Hash(HashInput, sizeof(HashInput), Kd,
-                           sizeof(Kd), HPrime);
+	XHdcp22Cmn_HmacSha256Compute(KdHmac, HashInput, sizeof(HashInput), HPrime);
 }
 
 /*****************************************************************************/
 /**
 *
-* This function computes EdkeyKs. Kd is calculated as in
-* #XHdcp22Tx_ComputeHPrime, but could also be stored the first time.
-* This could save some computing time.
-* According protocol however, only Rrx and Rtx are supposed to be stored.
+* This function computes EdkeyKs.
 *
 * @param  Rn is a pseudo-random nonce.
-* @param  Km is the master key generated by tx..
-*         See also #XHdcp22Tx_ComputeHPrime
+* @param  Km is the master key generated by tx.
 * @param  Ks is the session key.
 * @param  Rrx is the random value generated by rx.
 * @param  Rtx is the random value generated by tx.
@@ -612,66 +665,29 @@ void XHdcp22Tx_ComputeEdkeyKs(const u8* Rn, const u8* Km,
 /*****************************************************************************/
 /**
 *
-* This function computes LPrime. Kd is calculated as in
-* #XHdcp22Tx_ComputeHPrime, but could also be stored the first time.
-* This could save some computing time.
-* According protocol however, only Rrx and Rtx are supposed to be stored.
+* This function computes LPrime.
 *
+* @param  LPrimeHmac is the context keyed with kd XOR Rrx by
+*         #XHdcp22Tx_ComputeKdHmac.
 * @param  Rn is a pseudo-random nonce.
-* @param  Km is the master key generated by tx and previouslyd stored.
-* @param  Rrx is the random value generated by rx.
-* @param  Rtx is the random value generated by tx.
 * @param  LPrime is a pointer to the computed LPrime hash.
 *
 * @return None.
 *
 * @note   None.
 ******************************************************************************/
-void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
-                             const u8 *Rrx, const u8 *Rtx,
-                             u8 *LPrime)
+void XHdcp22Tx_ComputeLPrime(const XHdcp22Cmn_HmacSha256Ctx *LPrimeHmac,
+                             const u8* Rn, u8 *LPrime)
 {
 	/* Verify arguments */
+	Xil_AssertVoid(LPrimeHmac != NULL);
 	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Km != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
 	Xil_AssertVoid(LPrime != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
-	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
-	u8 HashKey[XHDCP22_TX_SHA256_HASH_SIZE];
-
-	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
-	 * Note: Protocol says we should use incoming Rn and XOR it with Km,
-	 * but then the output does not match the errata output.
-	 * For now we use for Rn 0, which matches the test vectors.
-	 */
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
-
-	/* Compute Dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Rrx XOR Ctr0, where Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
-
-
-	/* Compute Dkey0 , counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
-
-
 	/* Create hash with HMAC-SHA256. */
 	/* Input: Rn. */
 	/* Key:	Kd XOR Rrx (least sign. 64 bits). */
-	memset(HashKey, 0x00, XHDCP22_TX_SHA256_HASH_SIZE);
-	memcpy(&HashKey[XHDCP22_TX_SHA256_HASH_SIZE-XHDCP22_TX_RRX_SIZE], Rrx,
-         XHDCP22_TX_RRX_SIZE);
-	XHdcp22Tx_MemXor(HashKey, HashKey, Kd, XHDCP22_TX_SHA256_HASH_SIZE);
-	XHdcp22Cmn_HmacSha256Hash(Rn, XHDCP22_TX_RN_SIZE, HashKey,
-                           XHDCP22_TX_SHA256_HASH_SIZE, LPrime);
+	XHdcp22Cmn_HmacSha256Compute(LPrimeHmac, Rn, XHDCP22_TX_RN_SIZE, LPrime);
 }
 
 /*****************************************************************************/
@@ -679,7 +695,11 @@ void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
 *
 * This function computes V
 *
-* @param
+* @param  KdHmac is the context keyed with kd by #XHdcp22Tx_ComputeKdHmac.
+* @param  RxInfo is the RxInfo field of the receiver ID list message.
+* @param  RecvIDList is the list of receiver IDs.
+* @param  RecvIDCount is the number of receiver IDs in RecvIDList.
+* @param  SeqNum_V is the seq_num_V field of the receiver ID list message.
 * @param  V is a pointer to the computed V hash.
 *
 * @return None.
@@ -687,44 +707,20 @@ void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
 * @note   None.
 *
 ******************************************************************************/
-void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
-	const u8* Rtx, const u8* RecvIDList, const u8 RecvIDCount,
-	const u8* SeqNum_V, const u8* Km, u8* V)
+void XHdcp22Tx_ComputeV(const XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+	const u8* RxInfo, const u8* RecvIDList, const u8 RecvIDCount,
+	const u8* SeqNum_V, u8* V)
 {
 	/* Verify arguments */
-	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Rrx != NULL);
+	Xil_AssertVoid(KdHmac != NULL);
 	Xil_AssertVoid(RxInfo != NULL);
 	Xil_AssertVoid(SeqNum_V != NULL);
-	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(V != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
-	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
-
 	u8 HashInput[(XHDCP22_TX_REPEATER_MAX_DEVICE_COUNT * XHDCP22_TX_RCVID_SIZE) +
 		XHDCP22_TX_RXINFO_SIZE + XHDCP22_TX_SEQ_NUM_V_SIZE];
 	int Idx = 0;
 
-	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
-	* Note: Protocol says we should use incoming Rn and XOR it with Km,
-	* but then the output does not match the errata output.
-	* For now we use for Rn 0, which matches the test vectors.
-	*/
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
-
-	/* Determine dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Normally we should do Rrx XOR with Ctr0, but Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
-
-	/* Determine dkey1, counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
-
 	/* Create hash with HMAC-SHA256. */
 	/* Input: ReceiverID list || RxInfo || seq_num_V. */
 	memcpy(HashInput, RecvIDList, (RecvIDCount*XHDCP22_TX_RCVID_SIZE));
@@ -734,7 +730,7 @@ void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
 	memcpy(&HashInput[Idx], SeqNum_V, XHDCP22_TX_SEQ_NUM_V_SIZE);
 	Idx += XHDCP22_TX_SEQ_NUM_V_SIZE;
 	/* HashKey:	Kd*/
-	XHdcp22Cmn_HmacSha256Hash(HashInput, Idx, Kd, sizeof(Kd), V);
+	XHdcp22Cmn_HmacSha256Compute(KdHmac, HashInput, Idx, V);
 }
 
 /*****************************************************************************/
@@ -742,7 +738,11 @@ void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
 *
 * This function computes M
 *
-* @param
+* @param  MHmac is the context keyed with SHA256(kd) by
+*         #XHdcp22Tx_ComputeKdHmac.
+* @param  StreamIDType is the list of StreamID_Type values.
+* @param  k is the number of StreamID_Type values, big endian.
+* @param  SeqNum_M is the seq_num_M value.
 * @param  M is a pointer to the computed M hash.
 *
 * @return None.
@@ -750,26 +750,16 @@ void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
 * @note   None.
 *
 ******************************************************************************/
-void XHdcp22Tx_ComputeM(const u8* Rn, const u8* Rrx, const u8* Rtx,
-	const u8* StreamIDType, const u8* k,
-	const u8* SeqNum_M, const u8* Km, u8* M)
+void XHdcp22Tx_ComputeM(const XHdcp22Cmn_HmacSha256Ctx *MHmac,
+	const u8* StreamIDType, const u8* k, const u8* SeqNum_M, u8* M)
 {
 	/* Verify arguments */
-	Xil_AssertVoid(Rn != NULL);
-	Xil_AssertVoid(Rrx != NULL);
-	Xil_AssertVoid(Rtx != NULL);
+	Xil_AssertVoid(MHmac != NULL);
 	Xil_AssertVoid(StreamIDType != NULL);
 	Xil_AssertVoid(k != NULL);
 	Xil_AssertVoid(SeqNum_M != NULL);
-	Xil_AssertVoid(Km != NULL);
 	Xil_AssertVoid(M != NULL);
 
-	u8 Aes_Iv[XHDCP22_TX_AES128_SIZE];
-	u8 Aes_Key[XHDCP22_TX_AES128_SIZE];
-	u8 Kd[2 * XHDCP22_TX_AES128_SIZE]; /* Dkey0 || Dkey 1. */
-
-	u8 SHA256_Kd[XHDCP22_TX_SHA256_HASH_SIZE];
-
 	u16 StreamIDCount;
 
 	/* K value is in big endian format */
@@ -780,27 +770,6 @@ void XHdcp22Tx_ComputeM(const u8* Rn, const u8* Rrx, const u8* Rtx,
 		XHDCP22_TX_RXINFO_SIZE + XHDCP22_TX_SEQ_NUM_M_SIZE];
 	int Idx = 0;
 
-	/* For key derivation, use Km XOR Rn as AES key where Rn=0 during AKE.
-	* Note: Protocol says we should use incoming Rn and XOR it with Km,
-	* but then the output does not match the errata output.
-	* For now we use for Rn 0, which matches the test vectors.
-	*/
-	memcpy(Aes_Key, Km, XHDCP22_TX_KM_SIZE);
-
-	/* Determine dkey0. */
-	/* Add m = Rtx || Rrx. */
-	memcpy(Aes_Iv, Rtx, XHDCP22_TX_RTX_SIZE);
-	/* Normally we should do Rrx XOR with Ctr0, but Ctr0 is 0. */
-	memcpy(&Aes_Iv[XHDCP22_TX_RTX_SIZE], Rrx, XHDCP22_TX_RRX_SIZE);
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, Kd);
-
-	/* Determine dkey1, counter is 1: Rrx | 0x01. */
-	Aes_Iv[15] ^= 0x01; /* big endian! */
-	XHdcp22Cmn_Aes128Encrypt(Aes_Iv, Aes_Key, &Kd[XHDCP22_TX_KM_SIZE]);
-
-	/* Create hash with SHA256 */
-	XHdcp22Cmn_Sha256Hash(Kd, sizeof(Kd), SHA256_Kd);
-
 	/* Create hash with HMAC-SHA256. */
 	/* Input: StreamID_Type list || seq_num_M. */
 	memcpy(HashInput, StreamIDType, (StreamIDCount*XHDCP22_TX_STREAMID_TYPE_SIZE));
@@ -808,7 +777,7 @@ void XHdcp22Tx_ComputeM(const u8* Rn, const u8* Rrx, const u8* Rtx,
 	memcpy(&HashInput[Idx], SeqNum_M, XHDCP22_TX_SEQ_NUM_M_SIZE);
 	Idx += XHDCP22_TX_SEQ_NUM_M_SIZE;
 	/* HashKey:	SHA256(Kd) */
-	XHdcp22Cmn_HmacSha256Hash(HashInput, Idx, SHA256_Kd, sizeof(SHA256_Kd), M);
+	XHdcp22Cmn_HmacSha256Compute(MHmac, HashInput, Idx, M);
 }
 
 /*****************************************************************************/
@@ -52,6 +52,8 @@
 * 2.01  MH     02/13/17 1. Updated maximum locality check count
 *                       from 128 to 8 to avoid delays in re-auth.
 *                       2. Added log events for failures.
+* 2.30  ag     10/19/26 HPrime, LPrime, V and M take the HMAC-SHA256 contexts
+*                       keyed by XHdcp22Tx_ComputeKdHmac.
 * </pre>
 *
 ******************************************************************************/
@@ -497,18 +499,21 @@ int XHdcp22Tx_VerifyCertificate(const XHdcp22_Tx_CertRx *CertificatePtr,
 int XHdcp22Tx_VerifySRM(const u8* SrmPtr, int SrmSize,
                         const u8* KpubDcpNPtr, int KpubDcpNSize,
                         const u8* KpubDcpEPtr, int KpubDcpESize);
-void XHdcp22Tx_ComputeHPrime(const u8 *Rrx, const u8 *RxCaps,
-                             const u8* Rtx,  const u8 *TxCaps,
-                             const u8 *Km, u8 *HPrime);
-void XHdcp22Tx_ComputeLPrime(const u8* Rn, const u8 *Km,
-                             const u8 *Rrx, const u8 *Rtx,
-                             u8 *LPrime);
-void XHdcp22Tx_ComputeV(const u8* Rn, const u8* Rrx, const u8* RxInfo,
-	                    const u8* Rtx, const u8* RecvIDList, const u8 RecvIDCount,
-	                    const u8* SeqNum_V, const u8* Km, u8* V);
-void XHdcp22Tx_ComputeM(const u8* Rn, const u8* Rrx, const u8* Rtx,
+void XHdcp22Tx_ComputeKdHmac(const u8 *Rrx, const u8 *Rtx, const u8 *Km,
+                             XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+                             XHdcp22Cmn_HmacSha256Ctx *LPrimeHmac,
+                             XHdcp22Cmn_HmacSha256Ctx *MHmac);
+void XHdcp22Tx_ComputeHPrime(const XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+                             const u8 *RxCaps, const u8* Rtx,
+                             const u8 *TxCaps, u8 *HPrime);
+void XHdcp22Tx_ComputeLPrime(const XHdcp22Cmn_HmacSha256Ctx *LPrimeHmac,
+                             const u8* Rn, u8 *LPrime);
+void XHdcp22Tx_ComputeV(const XHdcp22Cmn_HmacSha256Ctx *KdHmac,
+                        const u8* RxInfo, const u8* RecvIDList,
+                        const u8 RecvIDCount, const u8* SeqNum_V, u8* V);
+void XHdcp22Tx_ComputeM(const XHdcp22Cmn_HmacSha256Ctx *MHmac,
                         const u8* StreamIDType, const u8* k,
-                        const u8* SeqNum_M, const u8* Km, u8* M);
+                        const u8* SeqNum_M, u8* M);
 void XHdcp22Tx_ComputeEdkeyKs(const u8* Rn, const u8* Km,
                               const u8 *Ks, const u8 *Rrx,
                               const u8 *Rtx,  u8 *EdkeyKs);
@@ -0,0 +1,728 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xllfifo_bench_example.c
+ * This file measures the cost of moving frames through the AXI Streaming FIFO
+ * with XLlFifo_Write() and XLlFifo_Read() and reports it in CPU cycles per
+ * byte.
+ *
+ * It assumes that at the h/w level the FIFO is connected in loopback. Frames
+ * of several sizes are sent and received with
+ *	- 32 bit aligned buffers,
+ *	- unaligned buffers (byte offsets SRC_OFFSET and DST_OFFSET), which go
+ *	  through the shift/merge bulk path of the byte streamer,
+ *	- 32 bit aligned buffers with the transfers offloaded to an AXI CDMA or
+ *	  ZynqMP ZDMA, when one is present and the FIFO uses the AXI4 data
+ *	  interface.
+ * Every received frame is compared with the transmitted one.
+ *
+ * Cycle counts are derived from the global timer on ARM processors. On other
+ * processors the frames are still checked but no timing is reported.
+ *
+ * Note: FRAME_MAX_LEN must not exceed the depth of the transmit and receive
+ * FIFOs in bytes.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 5.3   ag   10/18/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+#include "xllfifo.h"
+#include "xstatus.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#if defined (__arm__) || defined (__aarch64__)
+#include "xtime_l.h"
+#endif
+
+#if defined (XPAR_XAXICDMA_NUM_INSTANCES)
+#include "xaxicdma.h"
+#define BENCH_DMA_CDMA
+#elif defined (XPAR_XZDMA_NUM_INSTANCES)
+#include "xzdma.h"
+#define BENCH_DMA_ZDMA
+#endif
+
+/************************** Constant Definitions *****************************/
+
+#define FIFO_DEV_ID		XPAR_AXI_FIFO_0_DEVICE_ID
+
+#ifdef BENCH_DMA_CDMA
+#define DMA_DEV_ID		XPAR_AXICDMA_0_DEVICE_ID
+#endif
+#ifdef BENCH_DMA_ZDMA
+#define DMA_DEV_ID		XPAR_XZDMA_0_DEVICE_ID
+#endif
+
+/*
+ * CPU clock, used to convert global timer counts to CPU cycles.
+ */
+#if !defined (__arm__) && !defined (__aarch64__)
+/* No global timer */
+#elif defined (XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ)
+#define CPU_CLK_FREQ_HZ		XPAR_CPU_CORTEXA53_0_CPU_CLK_FREQ_HZ
+#elif defined (XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ)
+#define CPU_CLK_FREQ_HZ		XPAR_CPU_CORTEXA9_0_CPU_CLK_FREQ_HZ
+#elif defined (XPAR_CPU_CORTEXR5_0_CPU_CLK_FREQ_HZ)
+#define CPU_CLK_FREQ_HZ		XPAR_CPU_CORTEXR5_0_CPU_CLK_FREQ_HZ
+#endif
+
+#define FRAME_MAX_LEN		2048	/* Largest frame in bytes */
+#define ITERATIONS		16	/* Frames per size and mode */
+
+#define SRC_OFFSET		1	/* Byte offset of unaligned tx buffer */
+#define DST_OFFSET		3	/* Byte offset of unaligned rx buffer */
+
+/*
+ * Transfers of at least this many bytes are given to the DMA engine.
+ */
+#define OFFLOAD_THRESHOLD	256
+
+#define RX_TIMEOUT		1000000
+
+#define DMA_TIMEOUT		1000000
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * Buffer placement and transfer mode of one benchmark pass.
+ */
+typedef struct {
+	const char *Name;	/* Printed name of the mode */
+	u32 SrcOffset;		/* Byte offset of the tx buffer */
+	u32 DstOffset;		/* Byte offset of the rx buffer */
+	int Offload;		/* Use the DMA engine for large transfers */
+} BenchMode;
+
+/************************** Function Prototypes ******************************/
+
+int XLlFifoBenchExample(XLlFifo *InstancePtr, u16 DeviceId);
+static int BenchFrames(XLlFifo *InstancePtr, const BenchMode *ModePtr,
+		       u32 FrameLen);
+static int SendReceive(XLlFifo *InstancePtr, u8 *SrcPtr, u8 *DstPtr,
+		       u32 FrameLen, u64 *TxCyclesPtr, u64 *RxCyclesPtr);
+static void PrintCyclesPerByte(u64 Cycles, u32 Bytes);
+static void StartCycles(void);
+static u64 ElapsedCycles(void);
+#ifdef DMA_DEV_ID
+static int DmaSetup(void);
+static int DmaTransfer(UINTPTR SrcAddr, UINTPTR DstAddr, u32 Bytes);
+static int DmaRead(void *FifoRef, void *BufPtr, unsigned WordCount);
+static int DmaWrite(void *FifoRef, void *BufPtr, unsigned WordCount);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+XLlFifo FifoInstance;
+
+#ifdef BENCH_DMA_CDMA
+XAxiCdma DmaInstance;
+#endif
+#ifdef BENCH_DMA_ZDMA
+XZDma DmaInstance;
+#endif
+
+/*
+ * Buffers are padded so that they can be used at any of the byte offsets.
+ */
+u32 SourceBuffer[(FRAME_MAX_LEN / 4) + 2] __attribute__ ((aligned(64)));
+u32 DestinationBuffer[(FRAME_MAX_LEN / 4) + 2] __attribute__ ((aligned(64)));
+
+static const u32 FrameLens[] = { 64, 256, 1024, FRAME_MAX_LEN };
+
+static const BenchMode Modes[] = {
+	{ "aligned  ", 0, 0, FALSE },
+	{ "unaligned", SRC_OFFSET, DST_OFFSET, FALSE },
+	{ "offload  ", 0, 0, TRUE },
+};
+
+#ifdef CPU_CLK_FREQ_HZ
+static XTime StartTime;
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the Axi FIFO benchmark.
+*
+* @param	None
+*
+* @return
+*		- XST_SUCCESS if tests pass
+* 		- XST_FAILURE if fails.
+*
+* @note		None
+*
+******************************************************************************/
+int main()
+{
+	int Status;
+
+	xil_printf("--- Entering main() ---\n\r");
+
+	Status = XLlFifoBenchExample(&FifoInstance, FIFO_DEV_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Axi Streaming FIFO Bench Example Test Failed\n\r");
+		xil_printf("--- Exiting main() ---\n\r");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran Axi Streaming FIFO Bench Example\n\r");
+	xil_printf("--- Exiting main() ---\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function initializes the FIFO and runs every benchmark mode over the
+* frame sizes in FrameLens, printing the transmit and receive cost in CPU
+* cycles per byte.
+*
+* @param	InstancePtr is a pointer to the instance of the
+*		XLlFifo component.
+* @param	DeviceId is Device ID of the Axi Fifo Deive instance,
+*		typically XPAR_<AXI_FIFO_instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+******************************************************************************/
+int XLlFifoBenchExample(XLlFifo *InstancePtr, u16 DeviceId)
+{
+	XLlFifo_Config *Config;
+	int Status;
+	u32 ModeIndex;
+	u32 LenIndex;
+	int CanOffload = FALSE;
+
+	Config = XLlFfio_LookupConfig(DeviceId);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", DeviceId);
+		return XST_FAILURE;
+	}
+
+	Status = XLlFifo_CfgInitialize(InstancePtr, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed\n\r");
+		return Status;
+	}
+
+	XLlFifo_IntClear(InstancePtr, 0xffffffff);
+	if (XLlFifo_Status(InstancePtr) != 0x0) {
+		xil_printf("\n ERROR : Reset value of ISR0 : 0x%x\t"
+			    "Expected : 0x0\n\r",
+			    XLlFifo_Status(InstancePtr));
+		return XST_FAILURE;
+	}
+
+#ifdef DMA_DEV_ID
+	/*
+	 * Only the AXI4 data interface accepts bursts from a DMA engine.
+	 */
+	if (InstancePtr->Datainterface) {
+		Status = DmaSetup();
+		if (Status != XST_SUCCESS) {
+			xil_printf("DMA initialization failed\n\r");
+			return XST_FAILURE;
+		}
+		CanOffload = TRUE;
+	}
+#endif
+
+#ifndef CPU_CLK_FREQ_HZ
+	xil_printf("No cycle counter, frames are checked but not timed\n\r");
+#endif
+	xil_printf("mode       bytes   tx cycles/byte   rx cycles/byte\n\r");
+
+	for (ModeIndex = 0; ModeIndex < sizeof(Modes) / sizeof(Modes[0]);
+			ModeIndex++) {
+		if (Modes[ModeIndex].Offload && !CanOffload) {
+			xil_printf("%s  skipped, no DMA on the AXI4 data "
+				   "interface\n\r", Modes[ModeIndex].Name);
+			continue;
+		}
+
+		for (LenIndex = 0;
+			LenIndex < sizeof(FrameLens) / sizeof(FrameLens[0]);
+			LenIndex++) {
+			Status = BenchFrames(InstancePtr, &Modes[ModeIndex],
+					     FrameLens[LenIndex]);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends and receives ITERATIONS frames of FrameLen bytes in the
+* given mode and prints the average transmit and receive cost.
+*
+* @param	InstancePtr is a pointer to the XLlFifo instance.
+* @param	ModePtr is the buffer placement and transfer mode.
+* @param	FrameLen is the frame length in bytes.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE if a frame was lost or corrupted
+*
+******************************************************************************/
+static int BenchFrames(XLlFifo *InstancePtr, const BenchMode *ModePtr,
+		       u32 FrameLen)
+{
+	u8 *SrcPtr = (u8 *)SourceBuffer + ModePtr->SrcOffset;
+	u8 *DstPtr = (u8 *)DestinationBuffer + ModePtr->DstOffset;
+	u64 TxCycles = 0;
+	u64 RxCycles = 0;
+	u32 Iteration;
+	u32 Index;
+	int Status;
+
+#ifdef DMA_DEV_ID
+	if (ModePtr->Offload) {
+		XLlFifo_TxSetOffload(InstancePtr, DmaWrite, InstancePtr,
+				     OFFLOAD_THRESHOLD);
+		XLlFifo_RxSetOffload(InstancePtr, DmaRead, InstancePtr,
+				     OFFLOAD_THRESHOLD);
+	}
+#endif
+
+	for (Iteration = 0; Iteration < ITERATIONS; Iteration++) {
+		for (Index = 0; Index < FrameLen; Index++) {
+			SrcPtr[Index] = (u8)(Index + Iteration);
+			DstPtr[Index] = 0;
+		}
+
+		Status = SendReceive(InstancePtr, SrcPtr, DstPtr, FrameLen,
+				     &TxCycles, &RxCycles);
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+
+		for (Index = 0; Index < FrameLen; Index++) {
+			if (SrcPtr[Index] != DstPtr[Index]) {
+				xil_printf("%s %d: data mismatch at byte %d\n\r",
+					   ModePtr->Name, FrameLen, Index);
+				Status = XST_FAILURE;
+				break;
+			}
+		}
+		if (Status != XST_SUCCESS) {
+			break;
+		}
+	}
+
+	XLlFifo_TxSetOffload(InstancePtr, NULL, NULL, 0);
+	XLlFifo_RxSetOffload(InstancePtr, NULL, NULL, 0);
+
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	xil_printf("%s  %5d   ", ModePtr->Name, FrameLen);
+	PrintCyclesPerByte(TxCycles, FrameLen * ITERATIONS);
+	xil_printf("           ");
+	PrintCyclesPerByte(RxCycles, FrameLen * ITERATIONS);
+	xil_printf("\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes one frame to the FIFO, waits for it to loop back and
+* reads it. Only the XLlFifo_Write() and XLlFifo_Read() calls are timed.
+*
+* @param	InstancePtr is a pointer to the XLlFifo instance.
+* @param	SrcPtr is the frame to send.
+* @param	DstPtr is the buffer the frame is received into.
+* @param	FrameLen is the frame length in bytes.
+* @param	TxCyclesPtr is incremented by the cycles spent writing.
+* @param	RxCyclesPtr is incremented by the cycles spent reading.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE if the frame did not loop back or a DMA transfer
+*		 of the frame failed
+*
+******************************************************************************/
+static int SendReceive(XLlFifo *InstancePtr, u8 *SrcPtr, u8 *DstPtr,
+		       u32 FrameLen, u64 *TxCyclesPtr, u64 *RxCyclesPtr)
+{
+	u32 Timeout = RX_TIMEOUT;
+	u32 RxLen;
+
+	StartCycles();
+	XLlFifo_Write(InstancePtr, SrcPtr, FrameLen);
+	*TxCyclesPtr += ElapsedCycles();
+
+	if (XLlFifo_TxOffloadStatus(InstancePtr) != XST_SUCCESS) {
+		/* Drop the partly written frame instead of sending it */
+		XLlFifo_TxDiscard(InstancePtr);
+		xil_printf("DMA failed writing a frame of %d bytes\n\r",
+			   FrameLen);
+		return XST_FAILURE;
+	}
+
+	XLlFifo_TxSetLen(InstancePtr, FrameLen);
+	while (!XLlFifo_IsTxDone(InstancePtr)) {
+	}
+
+	while ((XLlFifo_iRxOccupancy(InstancePtr) == 0) && (Timeout != 0)) {
+		Timeout--;
+	}
+	if (Timeout == 0) {
+		xil_printf("Frame of %d bytes did not loop back\n\r", FrameLen);
+		return XST_FAILURE;
+	}
+
+	RxLen = XLlFifo_RxGetLen(InstancePtr);
+	if (RxLen != FrameLen) {
+		xil_printf("Received %d bytes, expected %d\n\r", RxLen,
+			   FrameLen);
+		return XST_FAILURE;
+	}
+
+	StartCycles();
+	XLlFifo_Read(InstancePtr, DstPtr, RxLen);
+	*RxCyclesPtr += ElapsedCycles();
+
+	if (XLlFifo_RxOffloadStatus(InstancePtr) != XST_SUCCESS) {
+		/* Drop what is left of the frame so the next one starts clean */
+		XLlFifo_RxReset(InstancePtr);
+		xil_printf("DMA failed reading a frame of %d bytes\n\r",
+			   FrameLen);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints Cycles / Bytes with two decimals, as xil_printf has no
+* floating point support.
+*
+* @param	Cycles is the number of CPU cycles.
+* @param	Bytes is the number of bytes moved in those cycles.
+*
+* @return	None
+*
+******************************************************************************/
+static void PrintCyclesPerByte(u64 Cycles, u32 Bytes)
+{
+#ifdef CPU_CLK_FREQ_HZ
+	u32 Hundredths = (u32)((Cycles * 100U) / Bytes);
+
+	xil_printf("%4d.%02d", Hundredths / 100U, Hundredths % 100U);
+#else
+	(void)Cycles;
+	(void)Bytes;
+	xil_printf("    n/a");
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function records the start of a timed section.
+*
+* @param	None
+*
+* @return	None
+*
+******************************************************************************/
+static void StartCycles(void)
+{
+#ifdef CPU_CLK_FREQ_HZ
+	XTime_GetTime(&StartTime);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the CPU cycles spent since the last call to
+* StartCycles().
+*
+* @param	None
+*
+* @return	Elapsed CPU cycles, 0 if no cycle counter is available.
+*
+******************************************************************************/
+static u64 ElapsedCycles(void)
+{
+#ifdef CPU_CLK_FREQ_HZ
+	XTime Now;
+
+	XTime_GetTime(&Now);
+	return ((u64)(Now - StartTime) * (CPU_CLK_FREQ_HZ / 1000U)) /
+		(COUNTS_PER_SECOND / 1000U);
+#else
+	return 0;
+#endif
+}
+
+#ifdef DMA_DEV_ID
+/*****************************************************************************/
+/**
+*
+* This function initializes the DMA engine used for the offload mode in
+* polled simple transfer mode.
+*
+* @param	None
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE to indicate failure
+*
+******************************************************************************/
+static int DmaSetup(void)
+{
+#ifdef BENCH_DMA_CDMA
+	XAxiCdma_Config *CfgPtr;
+
+	CfgPtr = XAxiCdma_LookupConfig(DMA_DEV_ID);
+	if (!CfgPtr) {
+		return XST_FAILURE;
+	}
+
+	if (XAxiCdma_CfgInitialize(&DmaInstance, CfgPtr,
+				   CfgPtr->BaseAddress) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XAxiCdma_IntrDisable(&DmaInstance, XAXICDMA_XR_IRQ_ALL_MASK);
+#else
+	XZDma_Config *CfgPtr;
+
+	CfgPtr = XZDma_LookupConfig(DMA_DEV_ID);
+	if (!CfgPtr) {
+		return XST_FAILURE;
+	}
+
+	if (XZDma_CfgInitialize(&DmaInstance, CfgPtr,
+				CfgPtr->BaseAddress) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (XZDma_SetMode(&DmaInstance, FALSE, XZDMA_NORMAL_MODE) !=
+			XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+#endif
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies Bytes bytes from SrcAddr to DstAddr with the DMA
+* engine and waits for the copy to complete.
+*
+* @param	SrcAddr is the source bus address.
+* @param	DstAddr is the destination bus address.
+* @param	Bytes is the number of bytes to copy.
+*
+* @return
+*		-XST_SUCCESS to indicate success
+*		-XST_FAILURE if the transfer could not be started, no data
+*		 was moved
+*		-XST_DMA_ERROR if the transfer failed or timed out, part of
+*		 the data may have been moved. The engine is reset.
+*
+******************************************************************************/
+static int DmaTransfer(UINTPTR SrcAddr, UINTPTR DstAddr, u32 Bytes)
+{
+	u32 Timeout = DMA_TIMEOUT;
+
+#ifdef BENCH_DMA_CDMA
+	if (XAxiCdma_SimpleTransfer(&DmaInstance, SrcAddr, DstAddr, Bytes,
+				    NULL, NULL) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	while (XAxiCdma_IsBusy(&DmaInstance) && (Timeout != 0)) {
+		Timeout--;
+	}
+
+	if ((Timeout == 0) || (XAxiCdma_GetError(&DmaInstance) != 0x0)) {
+		XAxiCdma_Reset(&DmaInstance);
+		while (!XAxiCdma_ResetIsDone(&DmaInstance)) {
+		}
+		XAxiCdma_IntrDisable(&DmaInstance, XAXICDMA_XR_IRQ_ALL_MASK);
+		return XST_DMA_ERROR;
+	}
+
+	return XST_SUCCESS;
+#else
+	XZDma_Transfer Data;
+	u32 IntrStatus;
+
+	Data.SrcAddr = SrcAddr;
+	Data.DstAddr = DstAddr;
+	Data.Size = Bytes;
+	Data.SrcCoherent = 0;
+	Data.DstCoherent = 0;
+	Data.Pause = 0;
+
+	if (XZDma_Start(&DmaInstance, &Data, 1) != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Polled mode: wait for done and mark the channel idle, as the
+	 * interrupt handler would, so that the next XZDma_Start() is accepted.
+	 */
+	do {
+		IntrStatus = XZDma_IntrGetStatus(&DmaInstance);
+		Timeout--;
+	} while (((IntrStatus & XZDMA_IXR_DMA_DONE_MASK) == 0U) &&
+		 (Timeout != 0));
+	XZDma_IntrClear(&DmaInstance, XZDMA_IXR_ALL_INTR_MASK);
+
+	if ((Timeout == 0) ||
+	    ((IntrStatus & (XZDMA_IXR_AXI_WR_DATA_MASK |
+			    XZDMA_IXR_AXI_RD_DATA_MASK)) != 0U)) {
+		XZDma_Reset(&DmaInstance);
+		(void)XZDma_SetMode(&DmaInstance, FALSE, XZDMA_NORMAL_MODE);
+		return XST_DMA_ERROR;
+	}
+	DmaInstance.ChannelState = XZDMA_IDLE;
+
+	return XST_SUCCESS;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Byte streamer offload routine for the receive channel. It copies WordCount
+* words from the receive data port of the FIFO to BufPtr with the DMA engine.
+*
+* @param	FifoRef is the XLlFifo instance.
+* @param	BufPtr is the destination buffer.
+* @param	WordCount is the number of 32 bit words to copy.
+*
+* @return
+*		-XST_SUCCESS if the words were copied
+*		-XST_DMA_ERROR if the transfer failed after it had started,
+*		 the streamer then fails the frame
+*		-XST_FAILURE to decline, the streamer then reads the words
+*
+******************************************************************************/
+static int DmaRead(void *FifoRef, void *BufPtr, unsigned WordCount)
+{
+	XLlFifo *InstancePtr = (XLlFifo *)FifoRef;
+	u32 Bytes = WordCount * 4;
+	int Status;
+
+#ifdef BENCH_DMA_CDMA
+	/*
+	 * Without the data realignment engine the CDMA needs buffers aligned
+	 * to its data width.
+	 */
+	if (!DmaInstance.HasDRE &&
+	    (((UINTPTR)BufPtr & (DmaInstance.WordLength - 1)) != 0)) {
+		return XST_FAILURE;
+	}
+#endif
+
+	Xil_DCacheInvalidateRange((UINTPTR)BufPtr, Bytes);
+	Status = DmaTransfer(XLlFifo_RxDataAddr(InstancePtr), (UINTPTR)BufPtr,
+			     Bytes);
+	if (Status == XST_FAILURE) {
+		return XST_FAILURE;
+	}
+	Xil_DCacheInvalidateRange((UINTPTR)BufPtr, Bytes);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Byte streamer offload routine for the transmit channel. It copies WordCount
+* words from BufPtr to the transmit data port of the FIFO with the DMA engine.
+*
+* @param	FifoRef is the XLlFifo instance.
+* @param	BufPtr is the source buffer.
+* @param	WordCount is the number of 32 bit words to copy.
+*
+* @return
+*		-XST_SUCCESS if the words were copied
+*		-XST_DMA_ERROR if the transfer failed after it had started,
+*		 the streamer then fails the frame
+*		-XST_FAILURE to decline, the streamer then writes the words
+*
+******************************************************************************/
+static int DmaWrite(void *FifoRef, void *BufPtr, unsigned WordCount)
+{
+	XLlFifo *InstancePtr = (XLlFifo *)FifoRef;
+	u32 Bytes = WordCount * 4;
+
+#ifdef BENCH_DMA_CDMA
+	if (!DmaInstance.HasDRE &&
+	    (((UINTPTR)BufPtr & (DmaInstance.WordLength - 1)) != 0)) {
+		return XST_FAILURE;
+	}
+#endif
+
+	Xil_DCacheFlushRange((UINTPTR)BufPtr, Bytes);
+
+	return DmaTransfer((UINTPTR)BufPtr, XLlFifo_TxDataAddr(InstancePtr),
+			   Bytes);
+}
+#endif
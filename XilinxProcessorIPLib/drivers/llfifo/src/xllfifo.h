@@ -123,6 +123,14 @@
  * twice in a row. Each frame must be written by writting the data for one
  * frame and then calling iTxSetLen().
  *
+ * <h3>DMA Offload</h3>
+ * XLlFifo_Read() and XLlFifo_Write() accept buffers of any alignment. When
+ * the FIFO uses the AXI4 data interface, large transfers may additionally be
+ * handed to a DMA engine (AXI CDMA, ZynqMP ZDMA) by registering a transfer
+ * routine with XLlFifo_RxSetOffload()/XLlFifo_TxSetOffload(). The routine
+ * moves whole 32-bit words between the buffer and the address returned by
+ * XLlFifo_RxDataAddr()/XLlFifo_TxDataAddr(). See xstreamer.h for details.
+ *
  * <h2>Interrupts</h2>
  * This driver does not handle interrupts from the FIFO hardware. The
  * software layer above may make use of the interrupts by setting up its
@@ -187,6 +195,13 @@
  * 5.2 adk    03/07/17 CR#978769 Fix doxygen issues in the driver.
  *		       Updated comments in the usage section as per example code.
  *		       Fix doxygen warnings in the driver.
+ * 5.3  ag    10/18/26 Added unaligned bulk transfers in the byte streamer and
+ *		       the XLlFifo_RxSetOffload, XLlFifo_TxSetOffload,
+ *		       XLlFifo_RxDataAddr and XLlFifo_TxDataAddr macros for DMA
+ *		       offload of large transfers.
+ *      ag    10/19/26 Added the XLlFifo_RxOffloadStatus,
+ *		       XLlFifo_TxOffloadStatus and XLlFifo_TxDiscard macros to
+ *		       report and drop frames failed by the offload routine.
  * </pre>
  *
  *****************************************************************************/
@@ -661,6 +676,155 @@ extern u32 _xllfifo_ipis_value;
 #define XLlFifo_Write(InstancePtr, BufPtr, Bytes) \
 	XStrm_Write(&((InstancePtr)->TxStreamer), (BufPtr), (Bytes))
 
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxSetOffload registers a routine that XLlFifo_Read() uses to move
+* transfers of at least <i>Threshold</i> bytes out of the receive channel of
+* the FIFO, typically with a DMA engine reading XLlFifo_RxDataAddr().
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    OffloadFn is the transfer routine, or NULL to disable offload.
+* @param    OffloadRef is passed to OffloadFn as its first argument.
+* @param    Threshold is the smallest transfer in bytes given to OffloadFn.
+*
+* @return   N/A
+*
+* @note
+* C Signature: void XLlFifo_RxSetOffload(XLlFifo *InstancePtr,
+*			XStrm_XferFnType OffloadFn, void *OffloadRef,
+*			unsigned Threshold)
+*
+******************************************************************************/
+#define XLlFifo_RxSetOffload(InstancePtr, OffloadFn, OffloadRef, Threshold) \
+	XStrm_RxSetOffload(&((InstancePtr)->RxStreamer), (OffloadFn), \
+			   (OffloadRef), (Threshold))
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_TxSetOffload registers a routine that XLlFifo_Write() uses to move
+* transfers of at least <i>Threshold</i> bytes into the transmit channel of
+* the FIFO, typically with a DMA engine writing XLlFifo_TxDataAddr().
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    OffloadFn is the transfer routine, or NULL to disable offload.
+* @param    OffloadRef is passed to OffloadFn as its first argument.
+* @param    Threshold is the smallest transfer in bytes given to OffloadFn.
+*
+* @return   N/A
+*
+* @note
+* C Signature: void XLlFifo_TxSetOffload(XLlFifo *InstancePtr,
+*			XStrm_XferFnType OffloadFn, void *OffloadRef,
+*			unsigned Threshold)
+*
+******************************************************************************/
+#define XLlFifo_TxSetOffload(InstancePtr, OffloadFn, OffloadRef, Threshold) \
+	XStrm_TxSetOffload(&((InstancePtr)->TxStreamer), (OffloadFn), \
+			   (OffloadRef), (Threshold))
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxOffloadStatus returns XST_DMA_ERROR if the receive offload routine
+* failed a transfer of the frame being read, in which case the data read is
+* not valid, and XST_SUCCESS otherwise. The status is cleared by
+* XLlFifo_RxGetLen().
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   XST_SUCCESS or XST_DMA_ERROR.
+*
+* @note
+* C Signature: int XLlFifo_RxOffloadStatus(XLlFifo *InstancePtr)
+*
+******************************************************************************/
+#define XLlFifo_RxOffloadStatus(InstancePtr) \
+	XStrm_RxOffloadStatus(&((InstancePtr)->RxStreamer))
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_TxOffloadStatus returns XST_DMA_ERROR if the transmit offload
+* routine failed a transfer of the frame being written, in which case the
+* frame must be dropped with XLlFifo_TxDiscard() instead of being sent with
+* XLlFifo_TxSetLen(), and XST_SUCCESS otherwise.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   XST_SUCCESS or XST_DMA_ERROR.
+*
+* @note
+* C Signature: int XLlFifo_TxOffloadStatus(XLlFifo *InstancePtr)
+*
+******************************************************************************/
+#define XLlFifo_TxOffloadStatus(InstancePtr) \
+	XStrm_TxOffloadStatus(&((InstancePtr)->TxStreamer))
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_TxDiscard drops the frame being written to the transmit channel of
+* the FIFO. The channel is reset and the bytes held by the byte streamer and
+* its offload status are cleared.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   N/A
+*
+* @note
+* C Signature: void XLlFifo_TxDiscard(XLlFifo *InstancePtr)
+*
+******************************************************************************/
+#define XLlFifo_TxDiscard(InstancePtr) \
+{ \
+	XLlFifo_TxReset(InstancePtr); \
+	XStrm_TxDiscard(&((InstancePtr)->TxStreamer)); \
+}
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_RxDataAddr returns the address of the receive data port of the FIFO
+* for use by a DMA engine.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   The bus address of the receive data port.
+*
+* @note
+* Bursts are only supported by the AXI4 data interface.
+*
+* C Signature: UINTPTR XLlFifo_RxDataAddr(XLlFifo *InstancePtr)
+*
+******************************************************************************/
+#define XLlFifo_RxDataAddr(InstancePtr) \
+	((UINTPTR)(InstancePtr)->Axi4BaseAddress + \
+	 ((InstancePtr)->Datainterface ? XLLF_AXI4_RDFD_OFFSET : \
+					  XLLF_RDFD_OFFSET))
+
+/****************************************************************************/
+/**
+*
+* XLlFifo_TxDataAddr returns the address of the transmit data port of the
+* FIFO for use by a DMA engine.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+*
+* @return   The bus address of the transmit data port.
+*
+* @note
+* Bursts are only supported by the AXI4 data interface.
+*
+* C Signature: UINTPTR XLlFifo_TxDataAddr(XLlFifo *InstancePtr)
+*
+******************************************************************************/
+#define XLlFifo_TxDataAddr(InstancePtr) \
+	((UINTPTR)(InstancePtr)->Axi4BaseAddress + \
+	 ((InstancePtr)->Datainterface ? XLLF_AXI4_TDFD_OFFSET : \
+					  XLLF_TDFD_OFFSET))
+
 
 /*****************************************************************************/
 /**
@@ -48,6 +48,14 @@
 * 2.00a hbm  01/20/10  Hal phase 1 support, bump up major release
 * 2.02a asa  12/28/11  The function XStrm_Read is changed to reset HeadIndex
 *		       to zero when all the bytes are read.
+* 5.3   ag   10/18/26  Added the unaligned bulk paths to XStrm_Read and
+*		       XStrm_Write which move bursts of FIFO words through a
+*		       bounce buffer and shift/merge them to or from the user
+*		       buffer. Added the optional DMA offload of large
+*		       transfers with XStrm_RxSetOffload/XStrm_TxSetOffload.
+*       ag   10/19/26  A transfer failed by the offload routine with
+*		       XST_DMA_ERROR is recorded in OffloadStatus instead of
+*		       being retried by the CPU. Added XStrm_TxDiscard.
 * </pre>
 ******************************************************************************/
 
@@ -55,6 +63,7 @@
 
 #include "xstreamer.h"
 #include "xil_assert.h"
+#include "xstatus.h"
 
 /*
  * Implementation Notes
@@ -107,6 +116,12 @@
  *
  * repeat this process ^^^
  *
+ * When the buffer given is not aligned, whole fifo words are still read a
+ * burst at a time: the burst is read into an aligned bounce buffer on the
+ * stack and then copied to the target buffer by shifting and merging pairs
+ * of adjacent words into aligned stores. Only the first and last few bytes
+ * of each burst are copied one at a time.
+ *
  *
  * --- Transmit ---
  *
@@ -153,12 +168,51 @@
  *                              index
  *
  * repeat this process ^^^
+ *
+ * Unaligned source buffers are handled the same way as on receive: aligned
+ * words are assembled in a bounce buffer by shifting and merging the source
+ * words and the bounce buffer is written to the fifo as one burst.
+ *
+ * --- Offload ---
+ *
+ * When an offload routine is registered, transfers of at least the offload
+ * threshold that start with an empty holding buffer are first offered to it.
+ * The routine moves whole fifo words and may decline the transfer, in which
+ * case the bytes go through the paths described above. A transfer which the
+ * routine started but could not complete (XST_DMA_ERROR) is not retried, as
+ * part of it may already have been moved through the fifo. The words are
+ * counted as moved and the error is kept in OffloadStatus for the caller.
  */
 
 #ifndef min
 #define min(x, y) (((x) < (y)) ? (x) : (y))
 #endif
 
+/*
+ * Shift a word so that its bytes move towards the start (lower addresses) or
+ * the end (higher addresses) of memory by the given number of bytes, and
+ * place a single byte at a byte lane of a word.
+ */
+#if (defined (__MICROBLAZE__) && !defined (__LITTLE_ENDIAN__)) || \
+	defined (__PPC__)
+#define XSTRM_TOWARD_START(Word, Bytes)	((Word) << (8U * (Bytes)))
+#define XSTRM_TOWARD_END(Word, Bytes)	((Word) >> (8U * (Bytes)))
+#define XSTRM_BYTE_LANE(Byte, Lane)	((u32)(Byte) << (8U * (3U - (Lane))))
+#else
+#define XSTRM_TOWARD_START(Word, Bytes)	((Word) >> (8U * (Bytes)))
+#define XSTRM_TOWARD_END(Word, Bytes)	((Word) << (8U * (Bytes)))
+#define XSTRM_BYTE_LANE(Byte, Lane)	((u32)(Byte) << (8U * (Lane)))
+#endif
+
+/************************** Function Prototypes ******************************/
+
+static void XStrm_CopyToUnaligned(u8 *DestPtr, const u32 *SrcWords,
+				  unsigned Bytes);
+static void XStrm_CopyFromUnaligned(u32 *DestWords, const u8 *SrcPtr,
+				    unsigned Bytes);
+static int XStrm_Offload(XStrm_XferFnType OffloadFn, void *OffloadInstance,
+			 void *BufPtr, unsigned WordCount, int *StatusPtr);
+
 xdbg_stmnt(u32 _xstrm_ro_value;)
 xdbg_stmnt(u32 _xstrm_buffered;)
 
@@ -204,6 +258,10 @@ void XStrm_RxInitialize(XStrm_RxFifoStreamer *InstancePtr, unsigned FifoWidth,
 	InstancePtr->ReadFn = ReadFn;
 	InstancePtr->GetLenFn = GetLenFn;
 	InstancePtr->GetOccupancyFn = GetOccupancyFn;
+	InstancePtr->OffloadFn = NULL;
+	InstancePtr->OffloadInstance = NULL;
+	InstancePtr->OffloadThreshold = 0;
+	InstancePtr->OffloadStatus = XST_SUCCESS;
 }
 
 /*****************************************************************************/
@@ -248,6 +306,84 @@ void XStrm_TxInitialize(XStrm_TxFifoStreamer *InstancePtr, unsigned FifoWidth,
 	InstancePtr->WriteFn = WriteFn;
 	InstancePtr->SetLenFn = SetLenFn;
 	InstancePtr->GetVacancyFn = GetVacancyFn;
+	InstancePtr->OffloadFn = NULL;
+	InstancePtr->OffloadInstance = NULL;
+	InstancePtr->OffloadThreshold = 0;
+	InstancePtr->OffloadStatus = XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* XStrm_RxSetOffload registers a routine, typically driving a DMA engine, that
+* XStrm_Read() uses to move large transfers out of the FIFO.
+*
+* The routine is called with <i>OffloadInstance</i>, the target buffer and the
+* number of whole FIFO words to move. It must complete the transfer, including
+* any cache maintenance of the buffer, before returning XST_SUCCESS. If the
+* transfer fails after it has started, the routine returns XST_DMA_ERROR. The
+* words are then counted as moved and the error is recorded for the frame.
+* Any other return value declines the transfer and the streamer reads the
+* words itself.
+*
+* @param    InstancePtr references the rx streamer on which to operate.
+*
+* @param    OffloadFn specifies the offload routine, or NULL to disable
+*           offload.
+*
+* @param    OffloadInstance is passed to OffloadFn as its first argument.
+*
+* @param    Threshold is the smallest transfer in bytes offered to OffloadFn.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XStrm_RxSetOffload(XStrm_RxFifoStreamer *InstancePtr,
+			XStrm_XferFnType OffloadFn, void *OffloadInstance,
+			unsigned Threshold)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->OffloadFn = OffloadFn;
+	InstancePtr->OffloadInstance = OffloadInstance;
+	InstancePtr->OffloadThreshold = Threshold;
+}
+
+/*****************************************************************************/
+/**
+*
+* XStrm_TxSetOffload registers a routine, typically driving a DMA engine, that
+* XStrm_Write() uses to move large transfers into the FIFO.
+*
+* The routine is called with <i>OffloadInstance</i>, the source buffer and the
+* number of whole FIFO words to move. It must complete the transfer, including
+* any cache maintenance of the buffer, before returning XST_SUCCESS. If the
+* transfer fails after it has started, the routine returns XST_DMA_ERROR. The
+* words are then counted as moved and the error is recorded for the frame.
+* Any other return value declines the transfer and the streamer writes the
+* words itself.
+*
+* @param    InstancePtr references the tx streamer on which to operate.
+*
+* @param    OffloadFn specifies the offload routine, or NULL to disable
+*           offload.
+*
+* @param    OffloadInstance is passed to OffloadFn as its first argument.
+*
+* @param    Threshold is the smallest transfer in bytes offered to OffloadFn.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XStrm_TxSetOffload(XStrm_TxFifoStreamer *InstancePtr,
+			XStrm_XferFnType OffloadFn, void *OffloadInstance,
+			unsigned Threshold)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->OffloadFn = OffloadFn;
+	InstancePtr->OffloadInstance = OffloadInstance;
+	InstancePtr->OffloadThreshold = Threshold;
 }
 
 /*****************************************************************************/
@@ -273,6 +409,7 @@ u32 XStrm_RxGetLen(XStrm_RxFifoStreamer *InstancePtr)
 	InstancePtr->HeadIndex = InstancePtr->FifoWidth;
 	len = (*InstancePtr->GetLenFn)(InstancePtr->FifoInstance);
 	InstancePtr->FrmByteCnt = len;
+	InstancePtr->OffloadStatus = XST_SUCCESS;
 	return len;
 }
 
@@ -303,6 +440,7 @@ void XStrm_Read(XStrm_RxFifoStreamer *InstancePtr, void *BufPtr,
 	unsigned FifoWordsToXfer;
 	unsigned PartialBytes;
 	unsigned i;
+	u32 Bounce[XSTRM_BOUNCE_WORDS];
 
 	while (BytesRemaining) {
 		xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: BytesRemaining: %d\n", BytesRemaining);
@@ -329,6 +467,30 @@ void XStrm_Read(XStrm_RxFifoStreamer *InstancePtr, void *BufPtr,
 			}
 		}
 		/* Case 2: There are no more bytes in the holding buffer and
+		 *         an offload routine is registered and
+		 *         the number of bytes remaining to transfer is at least
+		 *         the offload threshold and the fifo width.
+		 *
+		 *   1) Offer the whole fifo words to the offload routine.
+		 *   2) If it accepts, loop back around to transfer the last few
+		 *      bytes. Otherwise fall through to the cases below.
+		 */
+		else if ((InstancePtr->OffloadFn != NULL) &&
+			 (BytesRemaining >= InstancePtr->OffloadThreshold) &&
+			 (BytesRemaining >= InstancePtr->FifoWidth) &&
+			 (XStrm_Offload(InstancePtr->OffloadFn,
+				InstancePtr->OffloadInstance, DestPtr,
+				BytesRemaining / InstancePtr->FifoWidth,
+				&InstancePtr->OffloadStatus) == XST_SUCCESS)) {
+			xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: Case 2: offloaded %d bytes\n",
+				    BytesRemaining);
+			PartialBytes = (BytesRemaining / InstancePtr->FifoWidth) *
+					InstancePtr->FifoWidth;
+			DestPtr += PartialBytes;
+			BytesRemaining -= PartialBytes;
+			InstancePtr->FrmByteCnt -= PartialBytes;
+		}
+		/* Case 3: There are no more bytes in the holding buffer and
 		 *         the target buffer is 32 bit aligned and
 		 *         the number of bytes remaining to transfer is greater
 		 *         than or equal to the fifo width.
@@ -337,9 +499,9 @@ void XStrm_Read(XStrm_RxFifoStreamer *InstancePtr, void *BufPtr,
 		 *      of the fifo into the target buffer.
 		 *   2) Loop back around to transfer the last few bytes.
 		 */
-		else if ((((unsigned)DestPtr & 3) == 0) &&
+		else if ((((UINTPTR)DestPtr & 3) == 0) &&
 			 (BytesRemaining >= InstancePtr->FifoWidth)) {
-			xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: Case 2: DestPtr: %p, BytesRemaining: %d, InstancePtr->FifoWidth: %d\n",
+			xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: Case 3: DestPtr: %p, BytesRemaining: %d, InstancePtr->FifoWidth: %d\n",
 				    DestPtr, BytesRemaining, InstancePtr->FifoWidth);
 			FifoWordsToXfer =
 			    BytesRemaining / InstancePtr->FifoWidth;
@@ -352,16 +514,44 @@ void XStrm_Read(XStrm_RxFifoStreamer *InstancePtr, void *BufPtr,
 			InstancePtr->FrmByteCnt -=
 				FifoWordsToXfer * InstancePtr->FifoWidth;
 		}
-		/* Case 3: There are no more bytes in the holding buffer and
+		/* Case 4: There are no more bytes in the holding buffer and
+		 *         the target buffer is not 32 bit aligned and
+		 *         the number of bytes remaining to transfer is greater
+		 *         than or equal to the fifo width.
+		 *
+		 *   1) Read bursts of fifo words into the bounce buffer and
+		 *      shift/merge them into the target buffer until less than
+		 *      one fifo word is left.
+		 *   2) Loop back around to transfer the last few bytes.
+		 */
+		else if (BytesRemaining >= InstancePtr->FifoWidth) {
+			xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: Case 4: DestPtr: %p, BytesRemaining: %d\n",
+				    DestPtr, BytesRemaining);
+			do {
+				FifoWordsToXfer = min(BytesRemaining,
+						sizeof(Bounce)) /
+						InstancePtr->FifoWidth;
+				(*InstancePtr->ReadFn) (InstancePtr->FifoInstance,
+							Bounce,
+							FifoWordsToXfer);
+				PartialBytes = FifoWordsToXfer *
+						InstancePtr->FifoWidth;
+				XStrm_CopyToUnaligned(DestPtr, Bounce,
+						      PartialBytes);
+				DestPtr += PartialBytes;
+				BytesRemaining -= PartialBytes;
+				InstancePtr->FrmByteCnt -= PartialBytes;
+			} while (BytesRemaining >= InstancePtr->FifoWidth);
+		}
+		/* Case 5: There are no more bytes in the holding buffer and
 		 *         the number of bytes remaining to transfer is less than
-		 *         the fifo width or
-		 *         things just don't line up.
+		 *         the fifo width.
 		 *
 		 *   1) Fill the holding buffer.
 		 *   2) Loop back around and handle the rest of the transfer.
 		 */
 		else {
-			xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: Case 3\n");
+			xdbg_printf(XDBG_DEBUG_FIFO_RX, "XStrm_Read: Case 5\n");
 			/*
 			 * At the tail end, read one fifo word into the local holding
 			 * buffer and loop back around to take care of the transfer.
@@ -408,6 +598,31 @@ void XStrm_TxSetLen(XStrm_TxFifoStreamer *InstancePtr, u32 Bytes)
 	 * Kick off the hw write
 	 */
 	(*(InstancePtr)->SetLenFn) (InstancePtr->FifoInstance, Bytes);
+	InstancePtr->OffloadStatus = XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* XStrm_TxDiscard drops the frame being written to the streamer, specified by
+* <i>InstancePtr</i>, typically after XStrm_TxOffloadStatus() reported that
+* the offload routine failed. The bytes held in the internal buffer are
+* dropped and the offload status is cleared.
+*
+* The words already written to the FIFO are not affected, the caller must
+* reset the transmit channel of the FIFO as well.
+*
+* @param    InstancePtr references the FIFO Streamer on which to operate.
+*
+* @return   N/A
+*
+******************************************************************************/
+void XStrm_TxDiscard(XStrm_TxFifoStreamer *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->TailIndex = 0;
+	InstancePtr->OffloadStatus = XST_SUCCESS;
 }
 
 /*****************************************************************************/
@@ -438,6 +653,7 @@ void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
 	unsigned FifoWordsToXfer;
 	unsigned PartialBytes;
 	unsigned i;
+	u32 Bounce[XSTRM_BOUNCE_WORDS];
 
 	while (BytesRemaining) {
 		xdbg_printf(XDBG_DEBUG_FIFO_TX,
@@ -459,6 +675,31 @@ void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
 			InstancePtr->TailIndex = 0;
 		}
 		/* Case 2: There are no bytes in the holding buffer and
+		 *         an offload routine is registered and
+		 *         the number of bytes remaining to transfer is at least
+		 *         the offload threshold and the fifo width.
+		 *
+		 *   1) Offer the whole fifo words to the offload routine.
+		 *   2) If it accepts, loop back around to transfer the last few
+		 *      bytes. Otherwise fall through to the cases below.
+		 */
+		if ((InstancePtr->TailIndex == 0) &&
+		    (InstancePtr->OffloadFn != NULL) &&
+		    (BytesRemaining >= InstancePtr->OffloadThreshold) &&
+		    (BytesRemaining >= InstancePtr->FifoWidth) &&
+		    (XStrm_Offload(InstancePtr->OffloadFn,
+				InstancePtr->OffloadInstance, SrcPtr,
+				BytesRemaining / InstancePtr->FifoWidth,
+				&InstancePtr->OffloadStatus) == XST_SUCCESS)) {
+			xdbg_printf(XDBG_DEBUG_FIFO_TX,
+				    "XStrm_Write: (case 2) offloaded %d bytes\n",
+				    BytesRemaining);
+			PartialBytes = (BytesRemaining / InstancePtr->FifoWidth) *
+					InstancePtr->FifoWidth;
+			SrcPtr += PartialBytes;
+			BytesRemaining -= PartialBytes;
+		}
+		/* Case 3: There are no bytes in the holding buffer and
 		 *         the target buffer is 32 bit aligned and
 		 *         the number of bytes remaining to transfer is greater
 		 *         than or equal to the fifo width.
@@ -467,13 +708,13 @@ void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
 		 *      of the source buffer into the fifo.
 		 *   2) Loop back around to transfer the last few bytes.
 		 */
-		if ((InstancePtr->TailIndex == 0) &&
+		else if ((InstancePtr->TailIndex == 0) &&
 		    (BytesRemaining >= InstancePtr->FifoWidth) &&
-		    (((unsigned)SrcPtr & 3) == 0)) {
+		    (((UINTPTR)SrcPtr & 3) == 0)) {
 			FifoWordsToXfer =
 				BytesRemaining / InstancePtr->FifoWidth;
 
-			xdbg_printf(XDBG_DEBUG_FIFO_TX, "XStrm_Write: (case 2) TailIndex: %d; BytesRemaining: %d; FifoWidth: %d; SrcPtr: %p;\n InstancePtr: %p; WriteFn: %p ,\nFifoWordsToXfer: %d (BytesRemaining: %d)\n",
+			xdbg_printf(XDBG_DEBUG_FIFO_TX, "XStrm_Write: (case 3) TailIndex: %d; BytesRemaining: %d; FifoWidth: %d; SrcPtr: %p;\n InstancePtr: %p; WriteFn: %p ,\nFifoWordsToXfer: %d (BytesRemaining: %d)\n",
 				    InstancePtr->TailIndex, BytesRemaining,
 				    InstancePtr->FifoWidth, SrcPtr,
 				    InstancePtr, InstancePtr->WriteFn,
@@ -485,11 +726,41 @@ void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
 			SrcPtr += FifoWordsToXfer * InstancePtr->FifoWidth;
 			BytesRemaining -=
 				FifoWordsToXfer * InstancePtr->FifoWidth;
-			xdbg_printf(XDBG_DEBUG_FIFO_TX, "XStrm_Write: (end case 2) TailIndex: %d; BytesRemaining: %d; SrcPtr: %p\n",
+			xdbg_printf(XDBG_DEBUG_FIFO_TX, "XStrm_Write: (end case 3) TailIndex: %d; BytesRemaining: %d; SrcPtr: %p\n",
 				    InstancePtr->TailIndex, BytesRemaining, SrcPtr);
 		}
-		/* Case 3: The alignment of the "galaxies" didn't occur in
-		 *         Case 2 above, so we must pump the bytes through the
+		/* Case 4: There are no bytes in the holding buffer and
+		 *         the source buffer is not 32 bit aligned and
+		 *         the number of bytes remaining to transfer is greater
+		 *         than or equal to the fifo width.
+		 *
+		 *   1) Shift/merge the source bytes into whole words in the
+		 *      bounce buffer and write them to the fifo a burst at a
+		 *      time until less than one fifo word is left.
+		 *   2) Loop back around to transfer the last few bytes.
+		 */
+		else if ((InstancePtr->TailIndex == 0) &&
+			 (BytesRemaining >= InstancePtr->FifoWidth)) {
+			xdbg_printf(XDBG_DEBUG_FIFO_TX,
+				    "XStrm_Write: (case 4) SrcPtr: %p; BytesRemaining: %d\n",
+				    SrcPtr, BytesRemaining);
+			do {
+				FifoWordsToXfer = min(BytesRemaining,
+						sizeof(Bounce)) /
+						InstancePtr->FifoWidth;
+				PartialBytes = FifoWordsToXfer *
+						InstancePtr->FifoWidth;
+				XStrm_CopyFromUnaligned(Bounce, SrcPtr,
+							PartialBytes);
+				(*InstancePtr->WriteFn) (InstancePtr->FifoInstance,
+							 Bounce,
+							 FifoWordsToXfer);
+				SrcPtr += PartialBytes;
+				BytesRemaining -= PartialBytes;
+			} while (BytesRemaining >= InstancePtr->FifoWidth);
+		}
+		/* Case 5: The alignment of the "galaxies" didn't occur in
+		 *         the cases above, so we must pump the bytes through the
 		 *         holding buffer.
 		 *
 		 *   1) Write bytes from the source buffer to the holding buffer
@@ -505,7 +776,7 @@ void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
 			BytesRemaining -= PartialBytes;
 			InstancePtr->TailIndex += PartialBytes;
 			while (PartialBytes--) {
-				xdbg_printf(XDBG_DEBUG_FIFO_TX, "XStrm_Write: (case 3) PartialBytes: %d\n",
+				xdbg_printf(XDBG_DEBUG_FIFO_TX, "XStrm_Write: (case 5) PartialBytes: %d\n",
 					    PartialBytes);
 				InstancePtr->AlignedBuffer.bytes[i] = *SrcPtr;
 				i++;
@@ -514,4 +785,130 @@ void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
 		}
 	}
 }
+
+/*****************************************************************************/
+/**
+*
+* XStrm_CopyToUnaligned copies <i>Bytes</i> bytes from the 32 bit aligned
+* words at <i>SrcWords</i> to the byte buffer at <i>DestPtr</i>, which is not
+* 32 bit aligned. The destination is written with aligned word stores, each
+* built by merging the tail of one source word with the head of the next.
+*
+* @param    DestPtr is the unaligned destination buffer.
+*
+* @param    SrcWords is the aligned source buffer.
+*
+* @param    Bytes is the number of bytes to copy, a non-zero multiple of 4.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XStrm_CopyToUnaligned(u8 *DestPtr, const u32 *SrcWords,
+				  unsigned Bytes)
+{
+	const u8 *SrcBytes = (const u8 *)SrcWords;
+	unsigned Head = 4U - ((UINTPTR)DestPtr & 3U);
+	unsigned Tail = 4U - Head;
+	unsigned Words = (Bytes / 4U) - 1U;
+	u32 *DestWords;
+	unsigned i;
+
+	/* Bytes up to the first aligned destination word */
+	for (i = 0U; i < Head; i++) {
+		DestPtr[i] = SrcBytes[i];
+	}
+
+	DestWords = (u32 *)(void *)(DestPtr + Head);
+	for (i = 0U; i < Words; i++) {
+		DestWords[i] = XSTRM_TOWARD_START(SrcWords[i], Head) |
+				XSTRM_TOWARD_END(SrcWords[i + 1U], Tail);
+	}
+
+	/* Bytes after the last aligned destination word */
+	for (i = Bytes - Tail; i < Bytes; i++) {
+		DestPtr[i] = SrcBytes[i];
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XStrm_CopyFromUnaligned copies <i>Bytes</i> bytes from the byte buffer at
+* <i>SrcPtr</i>, which is not 32 bit aligned, to the 32 bit aligned words at
+* <i>DestWords</i>. The source is read with aligned word loads and every
+* destination word is built from the carried tail of the previous source word
+* and the head of the next one, without reading outside the source buffer.
+*
+* @param    DestWords is the aligned destination buffer.
+*
+* @param    SrcPtr is the unaligned source buffer.
+*
+* @param    Bytes is the number of bytes to copy, a non-zero multiple of 4.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XStrm_CopyFromUnaligned(u32 *DestWords, const u8 *SrcPtr,
+				    unsigned Bytes)
+{
+	unsigned Head = 4U - ((UINTPTR)SrcPtr & 3U);
+	unsigned Tail = 4U - Head;
+	unsigned Words = (Bytes / 4U) - 1U;
+	const u32 *SrcWords = (const u32 *)(const void *)(SrcPtr + Head);
+	u32 Carry = 0U;
+	u32 Word;
+	unsigned i;
+
+	/* Bytes up to the first aligned source word */
+	for (i = 0U; i < Head; i++) {
+		Carry |= XSTRM_BYTE_LANE(SrcPtr[i], i);
+	}
+
+	for (i = 0U; i < Words; i++) {
+		Word = SrcWords[i];
+		DestWords[i] = Carry | XSTRM_TOWARD_END(Word, Head);
+		Carry = XSTRM_TOWARD_START(Word, Tail);
+	}
+
+	/* Bytes after the last aligned source word */
+	for (i = 0U; i < Tail; i++) {
+		Carry |= XSTRM_BYTE_LANE(SrcPtr[Bytes - Tail + i], Head + i);
+	}
+	DestWords[Words] = Carry;
+}
+
+/*****************************************************************************/
+/**
+*
+* XStrm_Offload offers <i>WordCount</i> FIFO words to an offload routine. A
+* transfer the routine failed after starting it is counted as moved and
+* XST_DMA_ERROR is stored at <i>StatusPtr</i>.
+*
+* @param    OffloadFn is the offload routine.
+*
+* @param    OffloadInstance is passed to OffloadFn as its first argument.
+*
+* @param    BufPtr is the buffer to transfer to or from.
+*
+* @param    WordCount is the number of FIFO words to transfer.
+*
+* @param    StatusPtr references the offload status of the streamer.
+*
+* @return   XST_SUCCESS if the words were moved or failed by the routine,
+*           otherwise the value with which the routine declined them.
+*
+******************************************************************************/
+static int XStrm_Offload(XStrm_XferFnType OffloadFn, void *OffloadInstance,
+			 void *BufPtr, unsigned WordCount, int *StatusPtr)
+{
+	int Status;
+
+	Status = (*OffloadFn) (OffloadInstance, BufPtr, WordCount);
+	if (Status == XST_DMA_ERROR) {
+		*StatusPtr = XST_DMA_ERROR;
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
 /** @} */
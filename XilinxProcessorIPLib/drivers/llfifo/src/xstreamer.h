@@ -108,6 +108,29 @@
  * Other restrictions on the sequence of API calls may apply depending on
  * the specific FIFO driver used by this byte streamer driver.
  *
+ * <h3>Unaligned Buffers and Offload</h3>
+ * Buffers of any alignment are moved through the FIFO a burst at a time.
+ * When the buffer is not 32 bit aligned, the streamer transfers a burst of
+ * FIFO words through an aligned bounce buffer on the stack and shifts/merges
+ * the words to or from the user buffer, so only the leading and trailing
+ * bytes of each burst are handled one at a time. The size of the bounce
+ * buffer is set with XSTRM_BOUNCE_WORDS.
+ *
+ * Large transfers may optionally be handed to a DMA engine (for example an
+ * AXI CDMA or ZynqMP ZDMA attached to the AXI4 data interface of the FIFO)
+ * through XStrm_RxSetOffload() and XStrm_TxSetOffload(). The offload routine
+ * has the same signature as the FIFO read/write routines, must complete the
+ * transfer before returning and may decline it (for example because of the
+ * buffer alignment) by returning a value other than XST_SUCCESS, in which
+ * case the streamer moves the data itself.
+ *
+ * An offload routine which has started a transfer cannot decline it any
+ * more. If the transfer then fails, the routine returns XST_DMA_ERROR: the
+ * words are treated as moved and the streamer records the error for the
+ * frame. The caller checks it with XStrm_RxOffloadStatus() after reading a
+ * frame, or with XStrm_TxOffloadStatus() before XStrm_TxSetLen(), and drops
+ * a bad transmit frame with XStrm_TxDiscard().
+ *
  * <pre>
  * MODIFICATION HISTORY:
  *
@@ -118,6 +141,13 @@
  * 2.00a hbm  01/20/10  Hal phase 1 support, bump up major release
  * 2.02a asa  12/28/11  The macro XStrm_IsRxInternalEmpty is changed to use
  *			FrmByteCnt instead of HeadIndex.
+ * 5.3   ag   10/18/26  Added the unaligned bulk read/write paths and the
+ *			optional DMA offload of large transfers, added
+ *			XStrm_RxSetOffload and XStrm_TxSetOffload.
+*       ag   10/19/26  An offload routine returning XST_DMA_ERROR fails the
+*			frame instead of declining the transfer. Added
+*			XStrm_RxOffloadStatus, XStrm_TxOffloadStatus and
+*			XStrm_TxDiscard.
  * </pre>
  *
  *****************************************************************************/
@@ -138,6 +168,15 @@ extern "C" {
  */
 #define LARGEST_FIFO_KEYHOLE_SIZE_WORDS 4
 
+/*
+ * Size in 32 bit words of the stack bounce buffer used to move bursts of
+ * FIFO words to and from unaligned buffers. Must be a multiple of
+ * LARGEST_FIFO_KEYHOLE_SIZE_WORDS.
+ */
+#ifndef XSTRM_BOUNCE_WORDS
+#define XSTRM_BOUNCE_WORDS 32
+#endif
+
 /*
  * This union is used simply to force a 32bit alignment on the
  * buffer. Only the 'bytes' member is really used.
@@ -184,6 +223,20 @@ typedef struct XStrm_RxFifoStreamer {
 	                                          *   to get the occupancy from
 	                                          *   the FIFO.
 	                                          */
+	XStrm_XferFnType OffloadFn;  /**< OffloadFn is the optional routine
+	                              *   used to receive large transfers
+	                              *   with a DMA engine, NULL if unused.
+	                              */
+	void *OffloadInstance;       /**< OffloadInstance is passed to
+	                              *   OffloadFn in place of FifoInstance.
+	                              */
+	unsigned OffloadThreshold;   /**< OffloadThreshold is the smallest
+	                              *   transfer in bytes given to OffloadFn.
+	                              */
+	int OffloadStatus;           /**< OffloadStatus is XST_DMA_ERROR if
+	                              *   OffloadFn failed a transfer of the
+	                              *   current frame, XST_SUCCESS otherwise.
+	                              */
 } XStrm_RxFifoStreamer;
 
 /**
@@ -212,6 +265,20 @@ typedef struct XStrm_TxFifoStreamer {
 	                                      *   the streamer uses to get the
 	                                      *   vacancy from the FIFO.
 	                                      */
+	XStrm_XferFnType OffloadFn;  /**< OffloadFn is the optional routine
+	                              *   used to transmit large transfers
+	                              *   with a DMA engine, NULL if unused.
+	                              */
+	void *OffloadInstance;       /**< OffloadInstance is passed to
+	                              *   OffloadFn in place of FifoInstance.
+	                              */
+	unsigned OffloadThreshold;   /**< OffloadThreshold is the smallest
+	                              *   transfer in bytes given to OffloadFn.
+	                              */
+	int OffloadStatus;           /**< OffloadStatus is XST_DMA_ERROR if
+	                              *   OffloadFn failed a transfer of the
+	                              *   current frame, XST_SUCCESS otherwise.
+	                              */
 } XStrm_TxFifoStreamer;
 
 /*****************************************************************************/
@@ -307,6 +374,48 @@ extern u32 _xstrm_buffered;
 #define XStrm_IsRxInternalEmpty(InstancePtr) \
 	(((InstancePtr)->FrmByteCnt == 0) ? TRUE : FALSE)
 
+/****************************************************************************/
+/*
+*
+* XStrm_RxOffloadStatus returns whether the offload routine of the streamer,
+* specified by <i>InstancePtr</i>, failed a transfer of the frame being
+* received. The status is cleared by XStrm_RxGetLen().
+*
+* @param    InstancePtr references the streamer on which to operate.
+*
+* @return   XST_DMA_ERROR if the offload routine failed a transfer of the
+*           frame, in which case the data read is not valid. Otherwise
+*           XST_SUCCESS.
+*
+* @note
+* C-style signature:
+*    int XStrm_RxOffloadStatus(XStrm_RxFifoStreamer *InstancePtr)
+*
+*****************************************************************************/
+#define XStrm_RxOffloadStatus(InstancePtr) \
+	((InstancePtr)->OffloadStatus)
+
+/****************************************************************************/
+/*
+*
+* XStrm_TxOffloadStatus returns whether the offload routine of the streamer,
+* specified by <i>InstancePtr</i>, failed a transfer of the frame being
+* written. The status is cleared by XStrm_TxSetLen() and XStrm_TxDiscard().
+*
+* @param    InstancePtr references the streamer on which to operate.
+*
+* @return   XST_DMA_ERROR if the offload routine failed a transfer of the
+*           frame, in which case the frame must not be sent. Otherwise
+*           XST_SUCCESS.
+*
+* @note
+* C-style signature:
+*    int XStrm_TxOffloadStatus(XStrm_TxFifoStreamer *InstancePtr)
+*
+*****************************************************************************/
+#define XStrm_TxOffloadStatus(InstancePtr) \
+	((InstancePtr)->OffloadStatus)
+
 void XStrm_RxInitialize(XStrm_RxFifoStreamer *InstancePtr,
                         unsigned FifoWidth, void *FifoInstance,
                         XStrm_XferFnType ReadFn,
@@ -319,7 +428,16 @@ void XStrm_TxInitialize(XStrm_TxFifoStreamer *InstancePtr,
                         XStrm_SetLenFnType SetLenFn,
                         XStrm_GetVacancyFnType GetVacancyFn);
 
+void XStrm_RxSetOffload(XStrm_RxFifoStreamer *InstancePtr,
+                        XStrm_XferFnType OffloadFn, void *OffloadInstance,
+                        unsigned Threshold);
+
+void XStrm_TxSetOffload(XStrm_TxFifoStreamer *InstancePtr,
+                        XStrm_XferFnType OffloadFn, void *OffloadInstance,
+                        unsigned Threshold);
+
 void XStrm_TxSetLen(XStrm_TxFifoStreamer *InstancePtr, u32 Bytes);
+void XStrm_TxDiscard(XStrm_TxFifoStreamer *InstancePtr);
 void XStrm_Write(XStrm_TxFifoStreamer *InstancePtr, void *BufPtr,
                     unsigned bytes);
 
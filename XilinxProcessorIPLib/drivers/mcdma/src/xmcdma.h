@@ -106,6 +106,40 @@
 *
 * </pre>
 *
+* <b> Adaptive Interrupt Coalescing </b>
+*
+* XMcdma_ChanAdaptInit() starts the online tuning of the coalesce counter
+* and delay timer of a channel within the given bounds. The application
+* calls XMcdma_ChanAdaptUpdate() periodically with the elapsed time; the
+* driver measures the packet rate of the channel from XMcdma_BdChainFromHW()
+* and sets the counter to the packets expected within the latency bound.
+* Above the polling rate the completion interrupts of the channel are
+* disabled and XMcdma_ChanAdaptIsPolled() returns TRUE until the rate falls
+* below half of it. XMcdma_ChanAdaptGetStats() returns the current settings
+* and rates.
+*
+* <b> Multi-Channel Engine </b>
+*
+* XMcdma_Engine services all channels of a device on top of the per channel
+* API:
+*
+* - XMcdma_EngineIntrHandler() walks the TX and RX interrupt serviced-channel
+*   registers and retrieves, reports and frees the completed BDs of every
+*   channel flagged there, so one interrupt serves all channels. Without
+*   interrupts XMcdma_EnginePoll() does the same for all channels.
+*
+* - XMcdma_EngineSubmit() prepares a batch of buffers on a channel and hands
+*   it to the hardware with one tail descriptor write.
+*
+* - Buffers queued with XMcdma_EngineTxQueue() are submitted by
+*   XMcdma_EngineTxSchedule() with deficit round robin across the TX
+*   channels, in proportion to the weights set with XMcdma_EngineSetWeight().
+*   This is independent of the weighted round robin of the hardware set with
+*   XMCdma_SetChan_Weight().
+*
+* - Packets, bytes and the latency from tail descriptor write to completion
+*   are counted per channel and returned by XMcdma_EngineGetStats().
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -137,6 +171,9 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- ------------------------------------------------------
 * 1.0   adk 	18/07/17 Initial version.
+* 1.1   ag  	18/10/26 Added adaptive interrupt coalescing of a channel,
+*			 see xmcdma_adapt.c.
+*       ag  	19/10/26 Added the multi-channel engine, see xmcdma_engine.c.
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -163,6 +200,33 @@ extern "C" {
 #define XMCDMA_CHAN_BUSY		2
 #define XMCDMA_BD_MINIMUM_ALIGNMENT	0x40
 #define XMCDMA_AXCACHE			0xB
+#define XMCDMA_ADAPT_MAX_COUNTER	0xFF
+#define XMCDMA_ADAPT_MAX_TIMER		0xFF
+
+/* Weight of a new sample in the smoothed completion rate is
+ * 1/XMCDMA_ADAPT_WEIGHT
+ */
+#ifndef XMCDMA_ADAPT_WEIGHT
+#define XMCDMA_ADAPT_WEIGHT		4
+#endif
+
+/* Multi-channel engine */
+#define XMCDMA_ENGINE_MAX_CHAN		16	/**< Channels per direction */
+#define XMCDMA_ENGINE_MAX_WEIGHT	255	/**< Largest TX weight */
+#define XMCDMA_ENGINE_RX_RECYCLE	0x1	/**< Resubmit RX buffers after
+						  *  the done handler */
+#ifndef XMCDMA_ENGINE_QUEUE_DEPTH
+#define XMCDMA_ENGINE_QUEUE_DEPTH	16	/**< Queued TX buffers per
+						  *  channel */
+#endif
+#ifndef XMCDMA_ENGINE_MAX_BATCHES
+#define XMCDMA_ENGINE_MAX_BATCHES	8	/**< Batches timed per
+						  *  channel */
+#endif
+#ifndef XMCDMA_ENGINE_QUANTUM
+#define XMCDMA_ENGINE_QUANTUM		1536	/**< TX bytes per weight unit
+						  *  and scheduling round */
+#endif
 
 /* Direction flags */
 #define XMCDMA_DEV_TO_MEM		0
@@ -195,12 +259,69 @@ typedef void (*XMcdma_ChanDoneHandler) (void *CallBackRef);
 typedef void (*XMcdma_ChanErrorHandler) (void *CallBackRef, u32 ErrorMask);
 typedef void (*XMcdma_ChanPktDropHandler) (void *CallBackRef);
 
+typedef enum {
+	XMCDMA_ENGINE_HANDLER_DONE,	/**< For Done Handler */
+	XMCDMA_ENGINE_HANDLER_ERROR,	/**< For Error Handler */
+	XMCDMA_ENGINE_HANDLER_TIME,	/**< For latency time source */
+} XMcdma_EngineHandler;
+
+typedef void (*XMcdma_EngineDoneHandler) (void *CallBackRef, u32 Direction,
+					  u32 Chan_Id, XMcdma_Bd *BdPtr,
+					  int BdCount);
+typedef void (*XMcdma_EngineErrorHandler) (void *CallBackRef, u32 Direction,
+					   u32 Chan_Id, u32 ErrorMask);
+typedef u32 (*XMcdma_EngineTimeFn) (void *CallBackRef);
+
 typedef enum {
 	XMCDMA_FIXED_PRIORITY,
 	XMCDMA_WRR,
 	XMCDMA_WRR_PRIORITY,
 } XMcdma_QScheduler;
 
+/**
+ * Bounds of the adaptive interrupt coalescing of a channel, see
+ * XMcdma_ChanAdaptInit()
+ */
+typedef struct {
+	u32 MinCounter;		/**< Smallest coalesce counter, 1 to 255 */
+	u32 MaxCounter;		/**< Largest coalesce counter, MinCounter
+				  *  to 255 */
+	u32 MaxLatencyUs;	/**< Longest time in microseconds a completed
+				  *  packet may wait for its interrupt */
+	u32 TimerUnitNs;	/**< Duration of one delay timer count in
+				  *  nanoseconds (125 SG clock periods) */
+	u32 PollRate;		/**< Packets per millisecond from which the
+				  *  channel is polled, 0 never polls */
+} XMcdma_AdaptCfg;
+
+/**
+ * Current settings and statistics of the adaptive interrupt coalescing of a
+ * channel
+ */
+typedef struct {
+	u32 Counter;		/**< Coalesce counter in use */
+	u32 Timer;		/**< Delay timer in use */
+	u32 Polled;		/**< Whether completion interrupts are off
+				  *  and the channel is polled */
+	u32 Rate;		/**< Smoothed packets per millisecond */
+	u32 PeakRate;		/**< Highest smoothed rate seen */
+	u32 Packets;		/**< Packets completed since init */
+	u32 Interrupts;		/**< Interrupts counted since init */
+	u32 Retunes;		/**< Number of coalescing changes */
+	u32 ModeSwitches;	/**< Number of interrupt/polled switches */
+} XMcdma_AdaptStats;
+
+/**
+ * Adaptive interrupt coalescing state of a channel
+ */
+typedef struct {
+	XMcdma_AdaptCfg Cfg;	/**< Bounds given at init */
+	XMcdma_AdaptStats Stats; /**< Current settings and statistics */
+	u32 Enabled;		/**< Whether the channel is being tuned */
+	u32 Packets;		/**< Packets completed in this sample */
+	u32 Interrupts;		/**< Interrupts counted in this sample */
+} XMcdma_Adapt;
+
 typedef struct {
 	UINTPTR ChanBase;
 	u32 Chan_id;		/* Channel Number */
@@ -242,6 +363,9 @@ typedef struct {
 	                                     * interrupt callback */
 	XMcdma_ChanPktDropHandler PktdropHandler;
 	void *PktDropRef;
+
+	XMcdma_Adapt Adapt;		/**< Adaptive interrupt coalescing
+					  *  state */
 } XMcdma_ChanCtrl;
 
 typedef struct {
@@ -292,6 +416,77 @@ typedef struct {
 	                                     * interrupt callback */
 
 } XMcdma;
+
+/**
+ * Buffer given to XMcdma_EngineSubmit() and XMcdma_EngineTxQueue()
+ */
+typedef struct {
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Buffer length in bytes */
+} XMcdma_Buf;
+
+/**
+ * Counters of a channel of the multi-channel engine. Latencies are in ticks
+ * of the time source, from the tail descriptor write of a batch to the
+ * retrieval of its last BD.
+ */
+typedef struct {
+	u32 Packets;		/**< Packets completed */
+	u64 Bytes;		/**< Bytes completed */
+	u32 Batches;		/**< Batches given to the hardware */
+	u32 Errors;		/**< Error interrupts */
+	u32 PktDrops;		/**< Packet drop interrupts */
+	u32 LatencyLast;	/**< Latency of the last batch */
+	u32 LatencyMin;		/**< Smallest batch latency */
+	u32 LatencyMax;		/**< Largest batch latency */
+	u64 LatencySum;		/**< Sum of the batch latencies */
+	u32 LatencyCnt;		/**< Number of batch latencies summed */
+} XMcdma_ChanStats;
+
+/**
+ * Batch in flight on a channel of the multi-channel engine
+ */
+typedef struct {
+	u32 Time;		/**< Time of the tail descriptor write */
+	u32 BdCount;		/**< BDs of the batch not yet completed */
+} XMcdma_EngineBatch;
+
+/**
+ * Channel of the multi-channel engine
+ */
+typedef struct {
+	XMcdma_ChanStats Stats;
+	XMcdma_EngineBatch Batch[XMCDMA_ENGINE_MAX_BATCHES];
+	u32 BatchHead;		/**< Oldest batch in flight */
+	u32 BatchCnt;		/**< Number of batches in flight */
+	XMcdma_Buf Queue[XMCDMA_ENGINE_QUEUE_DEPTH]; /**< TX buffers waiting
+						       *  for the scheduler */
+	u32 QueueHead;		/**< Oldest queued TX buffer */
+	u32 QueueCnt;		/**< Number of queued TX buffers */
+	u32 Weight;		/**< TX scheduling weight */
+	u32 Deficit;		/**< TX bytes the channel may still send */
+} XMcdma_EngineChan;
+
+/**
+ * Multi-channel engine, see XMcdma_EngineInit()
+ */
+typedef struct {
+	XMcdma *InstancePtr;	/**< Device the engine runs */
+	u32 Options;		/**< XMCDMA_ENGINE_* options */
+	XMcdma_EngineChan Tx[XMCDMA_ENGINE_MAX_CHAN];
+	XMcdma_EngineChan Rx[XMCDMA_ENGINE_MAX_CHAN];
+	u32 NextTx;		/**< Index of the TX channel served first
+				  *  in the next scheduling round */
+	XMcdma_EngineDoneHandler DoneHandler; /**< Call back for completed
+					       *  BDs */
+	void *DoneRef;		/**< To be passed to the done callback */
+	XMcdma_EngineErrorHandler ErrorHandler; /**< Call back for error
+						 *  interrupt */
+	void *ErrorRef;		/**< To be passed to the error callback */
+	XMcdma_EngineTimeFn TimeFn; /**< Time source of the latency
+				     *  counters */
+	void *TimeRef;		/**< To be passed to the time source */
+} XMcdma_Engine;
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -380,6 +575,23 @@ typedef struct {
 				       XMCDMA_NXTCHAN_OFFSET + XMCDMA_CR_OFFSET) & \
 				       ~((Mask) & XMCDMA_IRQ_ALL_MASK)))
 
+/*****************************************************************************/
+/**
+ * This function checks whether the adaptive interrupt coalescing has turned
+ * off the completion interrupts of the channel. Completed BDs must then be
+ * retrieved by polling XMcdma_BdChainFromHW().
+ *
+ * @param	Chan is the MCDMA Channel to be worked on.
+ *
+ * @return	TRUE if the channel is polled, FALSE otherwise.
+ *
+ * @note	C-style signature:
+ * 		u32 XMcdma_ChanAdaptIsPolled(XMcdma_ChanCtrl *Chan)
+ *
+ *****************************************************************************/
+#define XMcdma_ChanAdaptIsPolled(Chan) \
+	((Chan)->Adapt.Stats.Polled ? TRUE : FALSE)
+
 /*****************************************************************************/
 /**
 * Get's global Packet drop Count
@@ -619,10 +831,38 @@ u32 XMcDma_ChanSubmit(XMcdma_ChanCtrl *Chan, UINTPTR BufAddr, u32 len);
 u32 XMcDma_ChanToHw(XMcdma_ChanCtrl *Chan);
 int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit,
 			 XMcdma_Bd **BdSetPtr);
+int XMcdma_BdChainFree(XMcdma_ChanCtrl *Chan, int BdCount,
+		       XMcdma_Bd *BdSetPtr);
 u32 XMcdma_BdSetBufAddr(XMcdma_Bd *BdPtr, UINTPTR Addr);
 void XMcDma_BdSetCtrl(XMcdma_Bd *BdPtr, u32 Data);
 void XMcDma_DumpBd(XMcdma_Bd* BdPtr);
 
+/* Adaptive interrupt coalescing */
+u32 XMcdma_ChanAdaptInit(XMcdma_ChanCtrl *Chan, XMcdma_AdaptCfg *CfgPtr);
+u32 XMcdma_ChanAdaptUpdate(XMcdma_ChanCtrl *Chan, u32 ElapsedUs);
+void XMcdma_ChanAdaptDisable(XMcdma_ChanCtrl *Chan);
+void XMcdma_ChanAdaptGetStats(XMcdma_ChanCtrl *Chan,
+			      XMcdma_AdaptStats *StatsPtr);
+
+/* Multi-channel engine */
+s32 XMcdma_EngineInit(XMcdma_Engine *EnginePtr, XMcdma *InstancePtr,
+		      u32 Options);
+s32 XMcdma_EngineSetCallBack(XMcdma_Engine *EnginePtr,
+			     XMcdma_EngineHandler HandlerType,
+			     void *CallBackFunc, void *CallBackRef);
+u32 XMcdma_EngineSubmit(XMcdma_Engine *EnginePtr, u32 Direction, u32 ChanId,
+			XMcdma_Buf *Bufs, u32 Count);
+u32 XMcdma_EngineSetWeight(XMcdma_Engine *EnginePtr, u32 ChanId, u32 Weight);
+u32 XMcdma_EngineTxQueue(XMcdma_Engine *EnginePtr, u32 ChanId,
+			 UINTPTR BufAddr, u32 Len);
+u32 XMcdma_EngineTxSchedule(XMcdma_Engine *EnginePtr);
+void XMcdma_EngineIntrHandler(void *Instance);
+void XMcdma_EnginePoll(XMcdma_Engine *EnginePtr);
+void XMcdma_EngineGetStats(XMcdma_Engine *EnginePtr, u32 Direction,
+			   u32 ChanId, XMcdma_ChanStats *StatsPtr);
+void XMcdma_EngineResetStats(XMcdma_Engine *EnginePtr, u32 Direction,
+			     u32 ChanId);
+
 /* Gloabal OR'ed Single interrupt */
 void XMcdma_IntrHandler(void *Instance);
 void XMcdma_TxIntrHandler(void *Instance);
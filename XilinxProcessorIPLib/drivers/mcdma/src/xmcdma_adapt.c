@@ -0,0 +1,304 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_adapt.c
+* @addtogroup mcdma_v1_0
+* @{
+*
+* This file implements the adaptive interrupt coalescing of an MCDMA channel.
+*
+* The packets completed by XMcdma_BdChainFromHW() and the completion
+* interrupts seen by the interrupt handlers are counted per channel. Each
+* XMcdma_ChanAdaptUpdate() call turns the count into a packet rate and sets
+* the coalesce counter to the packets expected within the latency bound, with
+* the delay timer at the latency bound so that the end of a burst is not held
+* back. From the polling rate on the completion interrupts are disabled and
+* the channel is polled instead.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.1    ag     18/10/26 First release.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/************************** Constant Definitions *****************************/
+
+/* Completion interrupts turned off in polled mode */
+#define XMCDMA_ADAPT_IRQ_MASK	(XMCDMA_IRQ_IOC_MASK | XMCDMA_IRQ_DELAY_MASK)
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static u32 XMcdma_AdaptTimer(XMcdma_AdaptCfg *CfgPtr);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function starts the adaptive interrupt coalescing of a channel. The
+* channel starts in interrupt mode with the smallest coalesce counter and its
+* statistics are cleared.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	CfgPtr points to the bounds of the tuning. It is copied.
+*
+* @return
+*		- XST_SUCCESS if the tuning is started.
+*		- XST_INVALID_PARAM if the counter range or the delay timer
+*		  unit is invalid.
+*		- XST_FAILURE if the coalescing could not be set.
+*
+******************************************************************************/
+u32 XMcdma_ChanAdaptInit(XMcdma_ChanCtrl *Chan, XMcdma_AdaptCfg *CfgPtr)
+{
+	XMcdma_Adapt *AdaptPtr;
+	u32 Timer;
+
+	Xil_AssertNonvoid(Chan != NULL);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+
+	if (CfgPtr->MinCounter == 0 ||
+	    CfgPtr->MinCounter > CfgPtr->MaxCounter ||
+	    CfgPtr->MaxCounter > XMCDMA_ADAPT_MAX_COUNTER ||
+	    CfgPtr->TimerUnitNs == 0) {
+		xil_printf("Invalid adaptive coalescing bounds\n\r");
+		return XST_INVALID_PARAM;
+	}
+
+	AdaptPtr = &Chan->Adapt;
+
+	/* Give back the completion interrupts if a previous run polled */
+	XMcdma_ChanAdaptDisable(Chan);
+
+	Timer = XMcdma_AdaptTimer(CfgPtr);
+	if (XMcdma_SetChanCoalesceDelay(Chan, CfgPtr->MinCounter, Timer) !=
+	    XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	AdaptPtr->Cfg = *CfgPtr;
+	memset(&AdaptPtr->Stats, 0, sizeof(XMcdma_AdaptStats));
+	AdaptPtr->Stats.Counter = CfgPtr->MinCounter;
+	AdaptPtr->Stats.Timer = Timer;
+	AdaptPtr->Packets = 0;
+	AdaptPtr->Interrupts = 0;
+	AdaptPtr->Enabled = TRUE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function closes a sample of the adaptive interrupt coalescing of a
+* channel and retunes the channel from it.
+*
+* The packets completed since the previous call give the packet rate of the
+* sample, which is smoothed into the rate of the channel. From the smoothed
+* rate the channel is switched between interrupt and polled mode, and in
+* interrupt mode the coalesce counter is set. The control register is only
+* written when the counter changes.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	ElapsedUs is the time in microseconds since the previous call,
+*		or since XMcdma_ChanAdaptInit().
+*
+* @return
+*		- XST_SUCCESS if the sample was taken.
+*		- XST_FAILURE if the tuning is not started or the coalescing
+*		  could not be set.
+*
+* @note		The interval between calls should be a few times the latency
+*		bound so that each sample covers several interrupts.
+*
+******************************************************************************/
+u32 XMcdma_ChanAdaptUpdate(XMcdma_ChanCtrl *Chan, u32 ElapsedUs)
+{
+	XMcdma_Adapt *AdaptPtr;
+	XMcdma_AdaptStats *StatsPtr;
+	XMcdma_AdaptCfg *CfgPtr;
+	u32 Sample;
+	u32 Counter;
+	u64 Expected;
+
+	Xil_AssertNonvoid(Chan != NULL);
+
+	AdaptPtr = &Chan->Adapt;
+	StatsPtr = &AdaptPtr->Stats;
+	CfgPtr = &AdaptPtr->Cfg;
+
+	if (!AdaptPtr->Enabled)
+		return XST_FAILURE;
+
+	if (ElapsedUs == 0)
+		return XST_SUCCESS;
+
+	/* Packets per millisecond in this sample, smoothed into the rate */
+	Sample = (u32)(((u64)AdaptPtr->Packets * 1000U) / ElapsedUs);
+	StatsPtr->Rate = (u32)((((u64)StatsPtr->Rate *
+			(XMCDMA_ADAPT_WEIGHT - 1)) + Sample) /
+			XMCDMA_ADAPT_WEIGHT);
+	if (StatsPtr->Rate > StatsPtr->PeakRate)
+		StatsPtr->PeakRate = StatsPtr->Rate;
+
+	StatsPtr->Packets += AdaptPtr->Packets;
+	StatsPtr->Interrupts += AdaptPtr->Interrupts;
+	AdaptPtr->Packets = 0;
+	AdaptPtr->Interrupts = 0;
+
+	/* Switch between interrupt and polled mode with hysteresis */
+	if (CfgPtr->PollRate != 0) {
+		if (!StatsPtr->Polled && StatsPtr->Rate >= CfgPtr->PollRate) {
+			XMcdma_IntrDisable(Chan, XMCDMA_ADAPT_IRQ_MASK);
+			StatsPtr->Polled = TRUE;
+			StatsPtr->ModeSwitches++;
+		} else if (StatsPtr->Polled &&
+			   StatsPtr->Rate < CfgPtr->PollRate / 2) {
+			XMcdma_IntrEnable(Chan, XMCDMA_ADAPT_IRQ_MASK);
+			StatsPtr->Polled = FALSE;
+			StatsPtr->ModeSwitches++;
+		}
+	}
+
+	if (StatsPtr->Polled)
+		return XST_SUCCESS;
+
+	/* Packets expected within the latency bound */
+	Expected = ((u64)StatsPtr->Rate * CfgPtr->MaxLatencyUs) / 1000U;
+	if (Expected < CfgPtr->MinCounter)
+		Counter = CfgPtr->MinCounter;
+	else if (Expected > CfgPtr->MaxCounter)
+		Counter = CfgPtr->MaxCounter;
+	else
+		Counter = (u32)Expected;
+
+	if (Counter != StatsPtr->Counter) {
+		if (XMcdma_SetChanCoalesceDelay(Chan, Counter,
+						StatsPtr->Timer) != XST_SUCCESS)
+			return XST_FAILURE;
+
+		StatsPtr->Counter = Counter;
+		StatsPtr->Retunes++;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stops the adaptive interrupt coalescing of a channel. A
+* polled channel gets its completion interrupts back. The coalescing last set
+* is kept.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_ChanAdaptDisable(XMcdma_ChanCtrl *Chan)
+{
+	Xil_AssertVoid(Chan != NULL);
+
+	if (Chan->Adapt.Enabled && Chan->Adapt.Stats.Polled) {
+		XMcdma_IntrEnable(Chan, XMCDMA_ADAPT_IRQ_MASK);
+		Chan->Adapt.Stats.Polled = FALSE;
+	}
+
+	Chan->Adapt.Enabled = FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retrieves the current settings and statistics of the adaptive
+* interrupt coalescing of a channel. The packets and interrupts of the sample
+* in progress are not included.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	StatsPtr points to a memory location where the settings and
+*		statistics are written.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_ChanAdaptGetStats(XMcdma_ChanCtrl *Chan,
+			      XMcdma_AdaptStats *StatsPtr)
+{
+	Xil_AssertVoid(Chan != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	*StatsPtr = Chan->Adapt.Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function converts the latency bound into delay timer counts. The MCDMA
+* delay timer cannot be disabled, so the timer stays at the latency bound for
+* all counter values.
+*
+* @param	CfgPtr points to the bounds of the tuning.
+*
+* @return	Delay timer value, 1 to XMCDMA_ADAPT_MAX_TIMER.
+*
+******************************************************************************/
+static u32 XMcdma_AdaptTimer(XMcdma_AdaptCfg *CfgPtr)
+{
+	u64 Timer;
+
+	Timer = ((u64)CfgPtr->MaxLatencyUs * 1000U) / CfgPtr->TimerUnitNs;
+	if (Timer == 0)
+		Timer = 1;
+	else if (Timer > XMCDMA_ADAPT_MAX_TIMER)
+		Timer = XMCDMA_ADAPT_MAX_TIMER;
+
+	return (u32)Timer;
+}
+/** @} */
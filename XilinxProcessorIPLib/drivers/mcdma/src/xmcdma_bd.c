@@ -44,6 +44,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 *  1.0  adk  18/07/17 Initial Version.
+*  1.1  ag   18/10/26 XMcdma_BdChainFromHW() counts completed packets for
+*                     the adaptive interrupt coalescing.
 ******************************************************************************/
 
 #include "xmcdma.h"
@@ -399,12 +401,14 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 	XMcdma_Bd *CurBdPtr;
 	u32 BdCount;
 	int BdPartialCount;
+	u32 Packets;
 	volatile u32 BdSts;
 	volatile u32 BdCr;
 
 	CurBdPtr = Chan->BdHead;
 	BdCount = 0;
 	BdPartialCount = 0;
+	Packets = 0;
 	BdSts = 0;
 	BdCr = 0;
 
@@ -437,6 +441,7 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 		if ((!(Chan->IsRxChan) && (BdCr & XMCDMA_BD_CTRL_EOF_MASK)) ||
 		    (Chan->IsRxChan && (BdSts & XMCDMA_BD_STS_RXEOF_MASK))) {
 			BdPartialCount = 0;
+			Packets++;
 		} else {
 			BdPartialCount++;
 		}
@@ -451,6 +456,7 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 	BdCount -= BdPartialCount;
 
 	if (BdCount) {
+		Chan->Adapt.Packets += Packets;
 		*BdSetPtr = Chan->BdHead;
 		Chan->BdSubmitCnt -= BdCount;
 		Chan->BdCnt += BdCount;
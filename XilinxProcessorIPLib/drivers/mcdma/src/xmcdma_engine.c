@@ -0,0 +1,962 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xmcdma_engine.c
+* @addtogroup mcdma_v1_0
+* @{
+*
+* This file implements the multi-channel engine of the MCDMA driver. The
+* engine services the completions of all channels from one interrupt, submits
+* batches of buffers with one tail descriptor write per channel, schedules TX
+* buffers across channels by weight and keeps per channel counters. See
+* xmcdma.h for an overview.
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.1    ag     19/10/26 First release.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xmcdma.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XMCDMA_ENGINE_ALL_BDS	0xFFFFFFFFU
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/*****************************************************************************/
+/**
+* Number of BDs XMcDma_ChanSubmit() uses for a buffer of Len bytes.
+*
+* @note		C-style signature:
+*		u32 XMcdma_EngineBdsNeeded(XMcdma_ChanCtrl *Chan, u32 Len)
+*****************************************************************************/
+#define XMcdma_EngineBdsNeeded(Chan, Len) \
+	(((Len) > (Chan)->MaxTransferLen) ? \
+	 (((Len) + ((Chan)->MaxTransferLen - 1)) / (Chan)->MaxTransferLen) : 1U)
+
+/************************** Function Prototypes ******************************/
+
+static XMcdma_ChanCtrl *XMcdma_EngineGetChan(XMcdma_Engine *EnginePtr,
+					     u32 Direction, u32 ChanId,
+					     XMcdma_EngineChan **EChanPtr);
+static void XMcdma_EngineServiceChan(XMcdma_Engine *EnginePtr,
+				     u32 Direction, u32 ChanId, u32 IsIntr);
+static void XMcdma_EngineReap(XMcdma_Engine *EnginePtr, XMcdma_ChanCtrl *Chan,
+			      XMcdma_EngineChan *EChan, u32 Direction);
+static u32 XMcdma_EngineRecycle(XMcdma_Engine *EnginePtr,
+				XMcdma_ChanCtrl *Chan, XMcdma_Bd *BdPtr,
+				int BdCount);
+static void XMcdma_EngineBatchDone(XMcdma_Engine *EnginePtr,
+				   XMcdma_EngineChan *EChan, u32 BdCount);
+static void XMcdma_EngineUndoSubmit(XMcdma_ChanCtrl *Chan,
+				    XMcdma_Bd *RestartPtr, XMcdma_Bd *TailPtr,
+				    u32 BdCount);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a multi-channel engine on an initialized MCDMA
+* instance. All TX channels start with weight 1 and all counters are cleared.
+* The BD chains of the channels must be created with XMcDma_ChanBdCreate()
+* before buffers are submitted.
+*
+* @param	EnginePtr is a pointer to the engine to be initialized.
+* @param	InstancePtr is a pointer to the MCDMA instance to be run.
+* @param	Options is a bitwise OR of XMCDMA_ENGINE_* options.
+*		XMCDMA_ENGINE_RX_RECYCLE hands the buffers of completed RX BDs
+*		back to the hardware after the done handler returns.
+*
+* @return
+*		- XST_SUCCESS if the engine is initialized.
+*		- XST_INVALID_PARAM if the device has more channels than
+*		  XMCDMA_ENGINE_MAX_CHAN.
+*
+******************************************************************************/
+s32 XMcdma_EngineInit(XMcdma_Engine *EnginePtr, XMcdma *InstancePtr,
+		      u32 Options)
+{
+	u32 i;
+
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if ((InstancePtr->Config.HasMM2S &&
+	     InstancePtr->Config.TxNumChannels > XMCDMA_ENGINE_MAX_CHAN) ||
+	    (InstancePtr->Config.HasS2MM &&
+	     InstancePtr->Config.RxNumChannels > XMCDMA_ENGINE_MAX_CHAN)) {
+		xil_printf("Engine supports %d channels\n\r",
+			   XMCDMA_ENGINE_MAX_CHAN);
+		return XST_INVALID_PARAM;
+	}
+
+	memset(EnginePtr, 0, sizeof(XMcdma_Engine));
+	EnginePtr->InstancePtr = InstancePtr;
+	EnginePtr->Options = Options;
+
+	for (i = 0; i < XMCDMA_ENGINE_MAX_CHAN; i++) {
+		EnginePtr->Tx[i].Weight = 1;
+		EnginePtr->Tx[i].Stats.LatencyMin = 0xFFFFFFFFU;
+		EnginePtr->Rx[i].Stats.LatencyMin = 0xFFFFFFFFU;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This routine installs a callback function of the engine for the given
+* HandlerType.
+*
+* <pre>
+* HandlerType                   Callback Function Type
+* ----------------------------  ---------------------------------------------
+* XMCDMA_ENGINE_HANDLER_DONE    XMcdma_EngineDoneHandler, called with the
+*                               completed BDs of a channel before they are
+*                               freed
+* XMCDMA_ENGINE_HANDLER_ERROR   XMcdma_EngineErrorHandler
+* XMCDMA_ENGINE_HANDLER_TIME    XMcdma_EngineTimeFn, returns a free running
+*                               tick count for the latency counters
+* </pre>
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	HandlerType specifies which callback is to be attached.
+* @param	CallBackFunc is the address of the callback function.
+* @param	CallBackRef is a user data item that will be passed to the
+*		callback function when it is invoked.
+*
+* @return
+*		- XST_SUCCESS when handler is installed.
+*		- XST_INVALID_PARAM when HandlerType is invalid.
+*
+* @note		Without a time source the latency counters stay at zero.
+*
+******************************************************************************/
+s32 XMcdma_EngineSetCallBack(XMcdma_Engine *EnginePtr,
+			     XMcdma_EngineHandler HandlerType,
+			     void *CallBackFunc, void *CallBackRef)
+{
+	s32 Status = XST_SUCCESS;
+
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(CallBackFunc != NULL);
+
+	switch (HandlerType) {
+	case XMCDMA_ENGINE_HANDLER_DONE:
+		EnginePtr->DoneHandler =
+			(XMcdma_EngineDoneHandler)((void *)CallBackFunc);
+		EnginePtr->DoneRef = CallBackRef;
+		break;
+
+	case XMCDMA_ENGINE_HANDLER_ERROR:
+		EnginePtr->ErrorHandler =
+			(XMcdma_EngineErrorHandler)((void *)CallBackFunc);
+		EnginePtr->ErrorRef = CallBackRef;
+		break;
+
+	case XMCDMA_ENGINE_HANDLER_TIME:
+		EnginePtr->TimeFn = (XMcdma_EngineTimeFn)((void *)CallBackFunc);
+		EnginePtr->TimeRef = CallBackRef;
+		break;
+
+	default:
+		Status = XST_INVALID_PARAM;
+		break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prepares a batch of buffers on a channel and gives it to the
+* hardware with one tail descriptor write. Each TX buffer is sent as one
+* packet; buffers longer than the maximum transfer length span several BDs.
+*
+* The batch is all or nothing: if the channel does not have enough free BDs
+* for all buffers, or a buffer cannot be prepared or the hardware cannot be
+* started, none is submitted and the BDs prepared for the batch are given
+* back to the channel.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV (TX) or XMCDMA_DEV_TO_MEM (RX).
+* @param	ChanId is the channel to submit on, starting at 1.
+* @param	Bufs is the array of buffers to submit.
+* @param	Count is the number of buffers in Bufs.
+*
+* @return
+*		- XST_SUCCESS if the batch was given to the hardware.
+*		- XST_INVALID_PARAM if the channel or a length is invalid.
+*		- XST_FAILURE if the channel does not have enough free BDs or
+*		  the hardware could not be started.
+*
+******************************************************************************/
+u32 XMcdma_EngineSubmit(XMcdma_Engine *EnginePtr, u32 Direction, u32 ChanId,
+			XMcdma_Buf *Bufs, u32 Count)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_EngineChan *EChan;
+	XMcdma_EngineBatch *BatchPtr;
+	XMcdma_Bd *FirstBdPtr;
+	XMcdma_Bd *RestartPtr;
+	XMcdma_Bd *TailPtr;
+	u32 BdCount = 0;
+	u32 BdsTaken = 0;
+	u32 NewBatch;
+	u32 Status;
+	u32 i;
+
+	Xil_AssertNonvoid(EnginePtr != NULL);
+	Xil_AssertNonvoid(Bufs != NULL);
+
+	Chan = XMcdma_EngineGetChan(EnginePtr, Direction, ChanId, &EChan);
+	if (Chan == NULL)
+		return XST_INVALID_PARAM;
+
+	if (Count == 0)
+		return XST_SUCCESS;
+
+	for (i = 0; i < Count; i++) {
+		if (Bufs[i].Len == 0)
+			return XST_INVALID_PARAM;
+
+		BdCount += XMcdma_EngineBdsNeeded(Chan, Bufs[i].Len);
+	}
+
+	if (BdCount > Chan->BdCnt)
+		return XST_FAILURE;
+
+	/* The hardware sees none of the BDs until the tail is written */
+	RestartPtr = XMcdma_GetChanCurBd(Chan);
+	TailPtr = Chan->BdTail;
+
+	for (i = 0; i < Count; i++) {
+		FirstBdPtr = XMcdma_GetChanCurBd(Chan);
+
+		Status = XMcDma_ChanSubmit(Chan, Bufs[i].BufAddr, Bufs[i].Len);
+		if (Status != XST_SUCCESS) {
+			XMcdma_EngineUndoSubmit(Chan, RestartPtr, TailPtr,
+						BdsTaken);
+			return XST_FAILURE;
+		}
+		BdsTaken += XMcdma_EngineBdsNeeded(Chan, Bufs[i].Len);
+
+		/* A TX buffer is one packet */
+		if (!Chan->IsRxChan) {
+			if (FirstBdPtr == Chan->BdTail) {
+				XMcDma_BdSetCtrl(FirstBdPtr,
+						 XMCDMA_BD_CTRL_SOF_MASK |
+						 XMCDMA_BD_CTRL_EOF_MASK);
+			} else {
+				XMcDma_BdSetCtrl(FirstBdPtr,
+						 XMCDMA_BD_CTRL_SOF_MASK);
+				XMcDma_BdSetCtrl(Chan->BdTail,
+						 XMCDMA_BD_CTRL_EOF_MASK);
+				XMCDMA_CACHE_FLUSH((UINTPTR)Chan->BdTail);
+			}
+			XMCDMA_CACHE_FLUSH((UINTPTR)FirstBdPtr);
+		}
+	}
+
+	/* Record the batch before the hardware can complete it */
+	NewBatch = (EChan->BatchCnt < XMCDMA_ENGINE_MAX_BATCHES);
+	if (NewBatch) {
+		BatchPtr = &EChan->Batch[(EChan->BatchHead + EChan->BatchCnt) %
+					 XMCDMA_ENGINE_MAX_BATCHES];
+		BatchPtr->BdCount = BdCount;
+		BatchPtr->Time = (EnginePtr->TimeFn != NULL) ?
+			EnginePtr->TimeFn(EnginePtr->TimeRef) : 0;
+		EChan->BatchCnt++;
+	} else {
+		/* Too many batches in flight, time it with the newest one */
+		BatchPtr = &EChan->Batch[(EChan->BatchHead +
+					  XMCDMA_ENGINE_MAX_BATCHES - 1) %
+					 XMCDMA_ENGINE_MAX_BATCHES];
+		BatchPtr->BdCount += BdCount;
+	}
+
+	Status = XMcDma_ChanToHw(Chan);
+	if (Status != XST_SUCCESS) {
+		/* The tail was not written, take the batch back */
+		if (NewBatch)
+			EChan->BatchCnt--;
+		else
+			BatchPtr->BdCount -= BdCount;
+		XMcdma_EngineUndoSubmit(Chan, RestartPtr, TailPtr, BdCount);
+		return XST_FAILURE;
+	}
+
+	EChan->Stats.Batches++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the scheduling weight of a TX channel. In every
+* scheduling round a channel may send Weight * XMCDMA_ENGINE_QUANTUM bytes of
+* its queued buffers; unused credit carries over while buffers are queued.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	ChanId is the TX channel, starting at 1.
+* @param	Weight is the weight, 1 to XMCDMA_ENGINE_MAX_WEIGHT.
+*
+* @return
+*		- XST_SUCCESS if the weight is set.
+*		- XST_INVALID_PARAM if the channel or the weight is invalid.
+*
+******************************************************************************/
+u32 XMcdma_EngineSetWeight(XMcdma_Engine *EnginePtr, u32 ChanId, u32 Weight)
+{
+	XMcdma_EngineChan *EChan;
+
+	Xil_AssertNonvoid(EnginePtr != NULL);
+
+	if (XMcdma_EngineGetChan(EnginePtr, XMCDMA_MEM_TO_DEV, ChanId,
+				 &EChan) == NULL)
+		return XST_INVALID_PARAM;
+
+	if (Weight == 0 || Weight > XMCDMA_ENGINE_MAX_WEIGHT) {
+		xil_printf("Invalid Weight to Configure\n\r");
+		return XST_INVALID_PARAM;
+	}
+
+	EChan->Weight = Weight;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a TX buffer for XMcdma_EngineTxSchedule(). The buffer
+* is sent as one packet.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	ChanId is the TX channel, starting at 1.
+* @param	BufAddr is the address of the buffer.
+* @param	Len is the length of the buffer in bytes.
+*
+* @return
+*		- XST_SUCCESS if the buffer is queued.
+*		- XST_INVALID_PARAM if the channel or the length is invalid.
+*		- XST_FAILURE if the queue of the channel is full.
+*
+* @note		The queue is shared with the interrupt handler, which runs
+*		the scheduler. Disable the MCDMA interrupts around this call
+*		when it is made outside the interrupt context.
+*
+******************************************************************************/
+u32 XMcdma_EngineTxQueue(XMcdma_Engine *EnginePtr, u32 ChanId,
+			 UINTPTR BufAddr, u32 Len)
+{
+	XMcdma_EngineChan *EChan;
+	XMcdma_Buf *BufPtr;
+
+	Xil_AssertNonvoid(EnginePtr != NULL);
+
+	if (XMcdma_EngineGetChan(EnginePtr, XMCDMA_MEM_TO_DEV, ChanId,
+				 &EChan) == NULL || Len == 0)
+		return XST_INVALID_PARAM;
+
+	if (EChan->QueueCnt == XMCDMA_ENGINE_QUEUE_DEPTH)
+		return XST_FAILURE;
+
+	BufPtr = &EChan->Queue[(EChan->QueueHead + EChan->QueueCnt) %
+			       XMCDMA_ENGINE_QUEUE_DEPTH];
+	BufPtr->BufAddr = BufAddr;
+	BufPtr->Len = Len;
+	EChan->QueueCnt++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs one deficit round robin round over the TX channels. Each
+* channel with queued buffers gets Weight * XMCDMA_ENGINE_QUANTUM bytes of
+* credit and submits the queued buffers that fit in its credit and its free
+* BDs as one batch. The channel served first rotates from round to round.
+*
+* The interrupt handler and XMcdma_EnginePoll() run a round after freeing TX
+* BDs; the application runs one after queueing buffers.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+*
+* @return	Number of buffers submitted.
+*
+******************************************************************************/
+u32 XMcdma_EngineTxSchedule(XMcdma_Engine *EnginePtr)
+{
+	XMcdma *InstancePtr;
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_EngineChan *EChan;
+	XMcdma_Buf Bufs[XMCDMA_ENGINE_QUEUE_DEPTH];
+	XMcdma_Buf *BufPtr;
+	u32 NumChan;
+	u32 ChanId;
+	u32 Quantum;
+	u32 FreeBds;
+	u32 Bds;
+	u32 Count;
+	u32 Submitted = 0;
+	u32 n;
+	u32 i;
+
+	Xil_AssertNonvoid(EnginePtr != NULL);
+
+	InstancePtr = EnginePtr->InstancePtr;
+	if (!InstancePtr->Config.HasMM2S)
+		return 0;
+
+	NumChan = InstancePtr->Config.TxNumChannels;
+	if (NumChan == 0)
+		return 0;
+
+	for (n = 0; n < NumChan; n++) {
+		ChanId = ((EnginePtr->NextTx + n) % NumChan) + 1;
+		EChan = &EnginePtr->Tx[ChanId - 1];
+
+		if (EChan->QueueCnt == 0) {
+			EChan->Deficit = 0;
+			continue;
+		}
+
+		Chan = XMcdma_GetMcdmaTxChan(InstancePtr, ChanId);
+		Quantum = EChan->Weight * XMCDMA_ENGINE_QUANTUM;
+		EChan->Deficit += Quantum;
+		FreeBds = Chan->BdCnt;
+
+		for (Count = 0; Count < EChan->QueueCnt; Count++) {
+			BufPtr = &EChan->Queue[(EChan->QueueHead + Count) %
+					       XMCDMA_ENGINE_QUEUE_DEPTH];
+			if (BufPtr->Len > EChan->Deficit)
+				break;
+
+			Bds = XMcdma_EngineBdsNeeded(Chan, BufPtr->Len);
+			if (Bds > FreeBds) {
+				/*
+				 * Out of BDs rather than credit: do not let
+				 * the credit grow while the channel waits
+				 */
+				if (EChan->Deficit > Quantum &&
+				    EChan->Deficit > BufPtr->Len)
+					EChan->Deficit = (Quantum > BufPtr->Len) ?
+						Quantum : BufPtr->Len;
+				break;
+			}
+
+			Bufs[Count] = *BufPtr;
+			EChan->Deficit -= BufPtr->Len;
+			FreeBds -= Bds;
+		}
+
+		if (Count == 0)
+			continue;
+
+		if (XMcdma_EngineSubmit(EnginePtr, XMCDMA_MEM_TO_DEV, ChanId,
+					Bufs, Count) != XST_SUCCESS) {
+			/* Give the credit back, the buffers stay queued */
+			for (i = 0; i < Count; i++)
+				EChan->Deficit += Bufs[i].Len;
+			break;
+		}
+
+		EChan->QueueHead = (EChan->QueueHead + Count) %
+				   XMCDMA_ENGINE_QUEUE_DEPTH;
+		EChan->QueueCnt -= Count;
+		if (EChan->QueueCnt == 0)
+			EChan->Deficit = 0;
+
+		Submitted += Count;
+	}
+
+	EnginePtr->NextTx = (EnginePtr->NextTx + 1) % NumChan;
+
+	return Submitted;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of the multi-channel engine. It can
+* be connected to the MM2S and the S2MM interrupts, or to the single
+* interrupt of the core.
+*
+* The handler reads the TX and RX interrupt serviced-channel registers and,
+* for every channel flagged there, acknowledges the interrupts, reports
+* errors, and retrieves the completed BDs, passes them to the done handler
+* and frees them. Freed TX BDs are refilled by a scheduling round.
+*
+* @param	Instance is a pointer to the XMcdma_Engine to be worked on.
+*
+* @return	None.
+*
+* @note		To generate interrupt required interrupts should be enabled.
+*
+******************************************************************************/
+void XMcdma_EngineIntrHandler(void *Instance)
+{
+	XMcdma_Engine *EnginePtr = (XMcdma_Engine *)((void *)Instance);
+	XMcdma *InstancePtr = EnginePtr->InstancePtr;
+	UINTPTR BaseAddr = InstancePtr->Config.BaseAddress;
+	u32 ChanMask;
+	u32 Chan_SerMask;
+	u32 ChanId;
+	u32 TxServiced = 0;
+
+	if (InstancePtr->Config.HasMM2S) {
+		ChanMask = (1U << InstancePtr->Config.TxNumChannels) - 1;
+
+		while ((Chan_SerMask = XMcdma_ReadReg(BaseAddr,
+				XMCDMA_TXINT_SER_OFFSET) & ChanMask) != 0) {
+			for (ChanId = 1; Chan_SerMask != 0;
+			     ChanId++, Chan_SerMask >>= 1) {
+				if (Chan_SerMask & 1)
+					XMcdma_EngineServiceChan(EnginePtr,
+						XMCDMA_MEM_TO_DEV, ChanId, 1);
+			}
+			TxServiced = 1;
+		}
+	}
+
+	if (InstancePtr->Config.HasS2MM) {
+		ChanMask = (1U << InstancePtr->Config.RxNumChannels) - 1;
+
+		while ((Chan_SerMask = XMcdma_ReadReg(BaseAddr,
+				XMCDMA_RX_OFFSET + XMCDMA_RXINT_SER_OFFSET) &
+				ChanMask) != 0) {
+			for (ChanId = 1; Chan_SerMask != 0;
+			     ChanId++, Chan_SerMask >>= 1) {
+				if (Chan_SerMask & 1)
+					XMcdma_EngineServiceChan(EnginePtr,
+						XMCDMA_DEV_TO_MEM, ChanId, 1);
+			}
+		}
+	}
+
+	if (TxServiced)
+		XMcdma_EngineTxSchedule(EnginePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services all channels of the engine without interrupts. It
+* retrieves, reports and frees the completed BDs of every channel, reports
+* errors, and runs a TX scheduling round.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_EnginePoll(XMcdma_Engine *EnginePtr)
+{
+	XMcdma *InstancePtr;
+	u32 NumChan;
+	u32 ChanId;
+
+	Xil_AssertVoid(EnginePtr != NULL);
+
+	InstancePtr = EnginePtr->InstancePtr;
+
+	if (InstancePtr->Config.HasMM2S) {
+		NumChan = InstancePtr->Config.TxNumChannels;
+		for (ChanId = 1; ChanId <= NumChan; ChanId++)
+			XMcdma_EngineServiceChan(EnginePtr, XMCDMA_MEM_TO_DEV,
+						 ChanId, 0);
+	}
+
+	if (InstancePtr->Config.HasS2MM) {
+		NumChan = InstancePtr->Config.RxNumChannels;
+		for (ChanId = 1; ChanId <= NumChan; ChanId++)
+			XMcdma_EngineServiceChan(EnginePtr, XMCDMA_DEV_TO_MEM,
+						 ChanId, 0);
+	}
+
+	XMcdma_EngineTxSchedule(EnginePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retrieves the counters of a channel of the engine.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV (TX) or XMCDMA_DEV_TO_MEM (RX).
+* @param	ChanId is the channel, starting at 1.
+* @param	StatsPtr points to a memory location where the counters are
+*		written. LatencyMin is 0xFFFFFFFF until a latency is measured.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_EngineGetStats(XMcdma_Engine *EnginePtr, u32 Direction,
+			   u32 ChanId, XMcdma_ChanStats *StatsPtr)
+{
+	XMcdma_EngineChan *EChan;
+
+	Xil_AssertVoid(EnginePtr != NULL);
+	Xil_AssertVoid(StatsPtr != NULL);
+
+	if (XMcdma_EngineGetChan(EnginePtr, Direction, ChanId, &EChan) == NULL)
+		return;
+
+	*StatsPtr = EChan->Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the counters of a channel of the engine.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV (TX) or XMCDMA_DEV_TO_MEM (RX).
+* @param	ChanId is the channel, starting at 1.
+*
+* @return	None.
+*
+******************************************************************************/
+void XMcdma_EngineResetStats(XMcdma_Engine *EnginePtr, u32 Direction,
+			     u32 ChanId)
+{
+	XMcdma_EngineChan *EChan;
+
+	Xil_AssertVoid(EnginePtr != NULL);
+
+	if (XMcdma_EngineGetChan(EnginePtr, Direction, ChanId, &EChan) == NULL)
+		return;
+
+	memset(&EChan->Stats, 0, sizeof(XMcdma_ChanStats));
+	EChan->Stats.LatencyMin = 0xFFFFFFFFU;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up a channel of the device and its engine state.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV (TX) or XMCDMA_DEV_TO_MEM (RX).
+* @param	ChanId is the channel, starting at 1.
+* @param	EChanPtr returns the engine state of the channel.
+*
+* @return	The channel, or NULL if the device has no such channel.
+*
+******************************************************************************/
+static XMcdma_ChanCtrl *XMcdma_EngineGetChan(XMcdma_Engine *EnginePtr,
+					     u32 Direction, u32 ChanId,
+					     XMcdma_EngineChan **EChanPtr)
+{
+	XMcdma *InstancePtr = EnginePtr->InstancePtr;
+
+	if (ChanId == 0)
+		return NULL;
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		if (!InstancePtr->Config.HasMM2S ||
+		    ChanId > (u32)InstancePtr->Config.TxNumChannels)
+			return NULL;
+
+		*EChanPtr = &EnginePtr->Tx[ChanId - 1];
+		return XMcdma_GetMcdmaTxChan(InstancePtr, ChanId);
+	}
+
+	if (!InstancePtr->Config.HasS2MM ||
+	    ChanId > (u32)InstancePtr->Config.RxNumChannels)
+		return NULL;
+
+	*EChanPtr = &EnginePtr->Rx[ChanId - 1];
+	return XMcdma_GetMcdmaRxChan(InstancePtr, ChanId);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services one channel: it acknowledges the pending interrupts,
+* reports errors and packet drops, and retrieves the completed BDs.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV (TX) or XMCDMA_DEV_TO_MEM (RX).
+* @param	ChanId is the channel, starting at 1.
+* @param	IsIntr is 1 when called from the interrupt handler; the
+*		completion interrupt is then counted for the adaptive
+*		coalescing.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XMcdma_EngineServiceChan(XMcdma_Engine *EnginePtr,
+				     u32 Direction, u32 ChanId, u32 IsIntr)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_EngineChan *EChan;
+	u32 IrqStatus;
+
+	Chan = XMcdma_EngineGetChan(EnginePtr, Direction, ChanId, &EChan);
+	if (Chan == NULL)
+		return;
+
+	IrqStatus = XMcdma_ChanGetIrq(Chan);
+	if (IrqStatus)
+		XMcdma_ChanAckIrq(Chan, IrqStatus);
+
+	if (IsIntr && (IrqStatus & (XMCDMA_IRQ_DELAY_MASK |
+				    XMCDMA_IRQ_IOC_MASK)))
+		Chan->Adapt.Interrupts++;
+
+	if (IrqStatus & XMCDMA_IRQ_PKTDROP_MASK)
+		EChan->Stats.PktDrops++;
+
+	if (IrqStatus & XMCDMA_IRQ_ERROR_MASK) {
+		Chan->ChanState = XMCDMA_CHAN_PAUSE;
+		EChan->Stats.Errors++;
+		if (EnginePtr->ErrorHandler != NULL)
+			EnginePtr->ErrorHandler(EnginePtr->ErrorRef, Direction,
+						ChanId, IrqStatus);
+		return;
+	}
+
+	XMcdma_EngineReap(EnginePtr, Chan, EChan, Direction);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function retrieves the completed BDs of a channel, counts them, passes
+* them to the done handler and frees them, or hands RX buffers back to the
+* hardware when XMCDMA_ENGINE_RX_RECYCLE is set.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	EChan is the engine state of the channel.
+* @param	Direction is XMCDMA_MEM_TO_DEV (TX) or XMCDMA_DEV_TO_MEM (RX).
+*
+* @return	None.
+*
+******************************************************************************/
+static void XMcdma_EngineReap(XMcdma_Engine *EnginePtr, XMcdma_ChanCtrl *Chan,
+			      XMcdma_EngineChan *EChan, u32 Direction)
+{
+	XMcdma_Bd *BdSetPtr;
+	XMcdma_Bd *BdPtr;
+	int BdCount;
+	int i;
+
+	BdCount = XMcdma_BdChainFromHW(Chan, XMCDMA_ENGINE_ALL_BDS, &BdSetPtr);
+	if (BdCount <= 0)
+		return;
+
+	XMcdma_EngineBatchDone(EnginePtr, EChan, (u32)BdCount);
+
+	BdPtr = BdSetPtr;
+	for (i = 0; i < BdCount; i++) {
+		if (Chan->IsRxChan) {
+			EChan->Stats.Bytes += XMcDma_BdGetActualLength(BdPtr,
+						Chan->MaxTransferLen);
+			if (XMcDma_BdGetSts(BdPtr) & XMCDMA_BD_STS_RXEOF_MASK)
+				EChan->Stats.Packets++;
+		} else {
+			EChan->Stats.Bytes += XMcDma_BdGetCtrl(BdPtr) &
+					      Chan->MaxTransferLen;
+			if (XMcDma_BdGetCtrl(BdPtr) & XMCDMA_BD_CTRL_EOF_MASK)
+				EChan->Stats.Packets++;
+		}
+		BdPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdPtr);
+	}
+
+	if (EnginePtr->DoneHandler != NULL)
+		EnginePtr->DoneHandler(EnginePtr->DoneRef, Direction,
+				       Chan->Chan_id, BdSetPtr, BdCount);
+
+	if (Chan->IsRxChan &&
+	    (EnginePtr->Options & XMCDMA_ENGINE_RX_RECYCLE)) {
+		if (XMcdma_EngineRecycle(EnginePtr, Chan, BdSetPtr, BdCount) !=
+		    XST_SUCCESS)
+			EChan->Stats.Errors++;
+		return;
+	}
+
+	XMcdma_BdChainFree(Chan, BdCount, BdSetPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function frees completed RX BDs and submits their buffers again, in
+* batches of up to XMCDMA_ENGINE_QUEUE_DEPTH buffers. The buffers of a batch
+* are read before the batch is freed, and a submitted batch can only reuse
+* free BDs or BDs of batches already read.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	Chan is the MCDMA RX Channel to be worked on.
+* @param	BdPtr is the first completed BD.
+* @param	BdCount is the number of completed BDs.
+*
+* @return
+*		- XST_SUCCESS if all buffers were submitted again.
+*		- XST_FAILURE otherwise.
+*
+******************************************************************************/
+static u32 XMcdma_EngineRecycle(XMcdma_Engine *EnginePtr,
+				XMcdma_ChanCtrl *Chan, XMcdma_Bd *BdPtr,
+				int BdCount)
+{
+	XMcdma_Buf Bufs[XMCDMA_ENGINE_QUEUE_DEPTH];
+	XMcdma_Bd *FirstBdPtr;
+	u32 Status = XST_SUCCESS;
+	int Count;
+
+	while (BdCount > 0) {
+		FirstBdPtr = BdPtr;
+		for (Count = 0; Count < BdCount &&
+		     Count < XMCDMA_ENGINE_QUEUE_DEPTH; Count++) {
+			Bufs[Count].BufAddr = (UINTPTR)XMcdma_BdRead64(BdPtr,
+						XMCDMA_BD_BUFA_OFFSET);
+			Bufs[Count].Len = XMcDma_BdGetCtrl(BdPtr) &
+					  Chan->MaxTransferLen;
+			BdPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdPtr);
+		}
+
+		XMcdma_BdChainFree(Chan, Count, FirstBdPtr);
+
+		if (XMcdma_EngineSubmit(EnginePtr, XMCDMA_DEV_TO_MEM,
+					Chan->Chan_id, Bufs, Count) !=
+		    XST_SUCCESS)
+			Status = XST_FAILURE;
+
+		BdCount -= Count;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function accounts completed BDs against the batches in flight on a
+* channel and updates the latency counters for every batch completed.
+*
+* @param	EnginePtr is a pointer to the engine to be worked on.
+* @param	EChan is the engine state of the channel.
+* @param	BdCount is the number of BDs completed.
+*
+* @return	None.
+*
+******************************************************************************/
+static void XMcdma_EngineBatchDone(XMcdma_Engine *EnginePtr,
+				   XMcdma_EngineChan *EChan, u32 BdCount)
+{
+	XMcdma_EngineBatch *BatchPtr;
+	XMcdma_ChanStats *StatsPtr = &EChan->Stats;
+	u32 Now = 0;
+	u32 Latency;
+	u32 Done;
+
+	if (EnginePtr->TimeFn != NULL)
+		Now = EnginePtr->TimeFn(EnginePtr->TimeRef);
+
+	while (BdCount > 0 && EChan->BatchCnt > 0) {
+		BatchPtr = &EChan->Batch[EChan->BatchHead];
+
+		Done = (BdCount < BatchPtr->BdCount) ? BdCount :
+						       BatchPtr->BdCount;
+		BatchPtr->BdCount -= Done;
+		BdCount -= Done;
+
+		if (BatchPtr->BdCount != 0)
+			break;
+
+		if (EnginePtr->TimeFn != NULL) {
+			Latency = Now - BatchPtr->Time;
+			StatsPtr->LatencyLast = Latency;
+			StatsPtr->LatencySum += Latency;
+			StatsPtr->LatencyCnt++;
+			if (Latency < StatsPtr->LatencyMin)
+				StatsPtr->LatencyMin = Latency;
+			if (Latency > StatsPtr->LatencyMax)
+				StatsPtr->LatencyMax = Latency;
+		}
+
+		EChan->BatchHead = (EChan->BatchHead + 1) %
+				   XMCDMA_ENGINE_MAX_BATCHES;
+		EChan->BatchCnt--;
+	}
+}
+/*****************************************************************************/
+/**
+*
+* This function gives back the BDs prepared by XMcDma_ChanSubmit() for a batch
+* whose tail descriptor was not written, so the next submission reuses them.
+*
+* @param	Chan is the MCDMA channel to be worked on.
+* @param	RestartPtr is the first free BD before the batch was prepared.
+* @param	TailPtr is the tail BD before the batch was prepared.
+* @param	BdCount is the number of BDs prepared for the batch.
+*
+* @return	None.
+*
+* @note		The counters are adjusted rather than restored so that BDs
+*		freed by the interrupt handler in the meantime are kept.
+*
+******************************************************************************/
+static void XMcdma_EngineUndoSubmit(XMcdma_ChanCtrl *Chan,
+				    XMcdma_Bd *RestartPtr, XMcdma_Bd *TailPtr,
+				    u32 BdCount)
+{
+	Chan->BdRestart = RestartPtr;
+	Chan->BdTail = TailPtr;
+	Chan->BdPendingCnt -= BdCount;
+	Chan->BdCnt += BdCount;
+}
+/** @} */
@@ -44,6 +44,8 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- ------------------------------------------------------
 * 1.0    adk    18/07/17 Initial version.
+* 1.1    ag     18/10/26 Count completion interrupts for the adaptive
+*                       interrupt coalescing.
 *
 ******************************************************************************/
 
@@ -109,6 +111,7 @@ void XMcdma_ChanIntrHandler(void *Instance)
 
 	if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
                 Chan->ChanState = XMCDMA_CHAN_IDLE;
+		Chan->Adapt.Interrupts++;
                 Chan->DoneHandler(Chan->DoneRef);
 	}
 
@@ -240,6 +243,7 @@ void XMcdma_IntrHandler(void *Instance)
 
 				 if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 					 Chan->ChanState = XMCDMA_CHAN_IDLE;
+					 Chan->Adapt.Interrupts++;
 					 InstancePtr->DoneHandler(InstancePtr->DoneRef, Chan_id);
 				 }
 
@@ -322,6 +326,7 @@ void XMcdma_TxIntrHandler(void *Instance)
 
 				 if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK))) {
 					 Chan->ChanState = XMCDMA_CHAN_IDLE;
+					 Chan->Adapt.Interrupts++;
 					 InstancePtr->TxDoneHandler(InstancePtr->TxDoneRef, Chan_id);
 				 }
 
@@ -0,0 +1,268 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/****************************************************************************/
+/**
+*
+* @file xnandpsu_gbm_test.c
+*
+* This file contains a host test of the good block map of the XNandPsu
+* driver, xnandpsu_bbm.c. It does not access a device. A RAM based BBT with
+* random bad blocks is set up for flashes smaller than, equal to and larger
+* than XNANDPSU_MAX_BLOCKS, and every result of XNandPsu_GetLogicalBlock()
+* and XNandPsu_GetPhysicalBlock() is compared with a walk of the BBT:
+*	- Blocks and good blocks inside the map translate both ways.
+*	- Blocks beyond XNANDPSU_MAX_BLOCKS map to the number of good blocks,
+*	  which XNandPsu_GetPhysicalBlock() refuses.
+*	- No lookup returns a block beyond the map.
+*
+* The test runs on the host, for example with
+*
+*	gcc -O2 -I../src -I<bsp>/common -I<bsp>/<arch> ../src/xnandpsu_bbm.c
+*		<bsp>/common/xil_assert.c <bsp>/common/xil_mem.c
+*		xnandpsu_gbm_test.c -o nandpsu_gbm_test
+*
+* where <bsp>/common and <bsp>/<arch> hold the headers of the standalone
+* BSP, including an xparameters.h. The flash accesses of xnandpsu_bbm.c are
+* stubbed in this file.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  	Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 1.3   ag     10/19/26 First Release.
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "xnandpsu.h"
+#include "xnandpsu_bbm.h"
+
+/************************** Constant Definitions ****************************/
+
+#define TEST_BAD_PERCENT	3	/* Share of bad blocks in the BBT */
+#define TEST_SEED		1	/* Seed of the bad block pattern */
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+#define TEST_CHECK(Cond)						\
+	do {								\
+		if (!(Cond)) {						\
+			printf("  %s:%d: check failed: %s\r\n",	\
+			       __FILE__, __LINE__, #Cond);		\
+			return XST_FAILURE;				\
+		}							\
+	} while (0)
+
+/************************** Function Prototypes *****************************/
+
+static int TestMap(const char *Name, u32 NumBlocks, int EdgesBad);
+static void TestSetBad(u32 Block);
+
+/************************** Variable Definitions ****************************/
+
+static XNandPsu Nand;			/* Instance under test */
+static u8 Bad[XNANDPSU_MAX_BLOCKS];	/* Bad blocks of the BBT */
+
+/****************************************************************************/
+/**
+*
+* Runs the good block map tests.
+*
+* @return	XST_SUCCESS if all tests passed, XST_FAILURE otherwise.
+*
+*****************************************************************************/
+int main(void)
+{
+	int Status = XST_SUCCESS;
+
+	srand(TEST_SEED);
+
+	Status |= TestMap("small flash", 1000U, FALSE);
+	Status |= TestMap("one block", 1U, FALSE);
+	Status |= TestMap("all blocks mapped", XNANDPSU_MAX_BLOCKS, FALSE);
+	Status |= TestMap("all blocks mapped, edges bad", XNANDPSU_MAX_BLOCKS,
+			  TRUE);
+	Status |= TestMap("one block beyond the map",
+			  XNANDPSU_MAX_BLOCKS + 1U, FALSE);
+	Status |= TestMap("twice the map", 2U * XNANDPSU_MAX_BLOCKS, TRUE);
+
+	if (Status != XST_SUCCESS) {
+		printf("Good block map test Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	printf("Successfully ran good block map test\r\n");
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Builds the good block map of a flash of NumBlocks blocks with random bad
+* blocks and checks every lookup against a walk of the BBT.
+*
+* @param	Name is printed with the result.
+* @param	NumBlocks is the number of blocks of the flash.
+* @param	EdgesBad marks the first and the last mapped block bad.
+*
+* @return	XST_SUCCESS if the test passed, XST_FAILURE otherwise.
+*
+*****************************************************************************/
+static int TestMap(const char *Name, u32 NumBlocks, int EdgesBad)
+{
+	u32 MapBlocks;
+	u32 Block;
+	u32 Good = 0U;
+	u32 PhysBlock;
+
+	printf("%s, %u blocks\r\n", Name, (unsigned)NumBlocks);
+
+	memset(&Nand, 0, sizeof(Nand));
+	memset(Bad, 0, sizeof(Bad));
+	Nand.IsReady = XIL_COMPONENT_IS_READY;
+	Nand.Geometry.NumBlocks = NumBlocks;
+
+	MapBlocks = NumBlocks;
+	if (MapBlocks > XNANDPSU_MAX_BLOCKS) {
+		MapBlocks = XNANDPSU_MAX_BLOCKS;
+	}
+	for (Block = 0U; Block < MapBlocks; Block++) {
+		if ((rand() % 100) < TEST_BAD_PERCENT) {
+			TestSetBad(Block);
+		}
+	}
+	if (EdgesBad && (MapBlocks > 1U)) {
+		TestSetBad(0U);
+		TestSetBad(MapBlocks - 1U);
+	}
+
+	XNandPsu_BuildGoodBlockMap(&Nand);
+
+	for (Block = 0U; Block < MapBlocks; Block++) {
+		TEST_CHECK(XNandPsu_GetLogicalBlock(&Nand, Block) == Good);
+		if (Bad[Block] == 0U) {
+			TEST_CHECK(XNandPsu_GetPhysicalBlock(&Nand, Good,
+						&PhysBlock) == XST_SUCCESS);
+			TEST_CHECK(PhysBlock == Block);
+			Good++;
+		}
+	}
+	TEST_CHECK(Nand.NumGoodBlocks == Good);
+
+	/* Blocks beyond the map are past the last logical block */
+	for (Block = MapBlocks; Block < NumBlocks; Block++) {
+		TEST_CHECK(XNandPsu_GetLogicalBlock(&Nand, Block) == Good);
+	}
+	TEST_CHECK(XNandPsu_GetPhysicalBlock(&Nand, Good, &PhysBlock) ==
+		   XST_FAILURE);
+	TEST_CHECK(XNandPsu_GetPhysicalBlock(&Nand, NumBlocks, &PhysBlock) ==
+		   XST_FAILURE);
+
+	printf("  %u good blocks, passed\r\n", (unsigned)Good);
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Marks a block bad in the RAM based BBT of the instance under test.
+*
+* @param	Block is the block to mark bad.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void TestSetBad(u32 Block)
+{
+	Nand.Bbt[Block >> XNANDPSU_BBT_BLOCK_SHIFT] |=
+		(u8)(XNANDPSU_BLOCK_BAD << XNandPsu_BbtBlockShift(Block));
+	Bad[Block] = 1U;
+}
+
+/*
+ * Flash accesses of xnandpsu_bbm.c. The map is built from the RAM based BBT
+ * only, so none of them is expected to be called.
+ */
+s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length,
+		  u8 *DestBuf)
+{
+	(void)InstancePtr;
+	(void)Offset;
+	(void)Length;
+	(void)DestBuf;
+	return XST_FAILURE;
+}
+
+s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length,
+		   u8 *SrcBuf)
+{
+	(void)InstancePtr;
+	(void)Offset;
+	(void)Length;
+	(void)SrcBuf;
+	return XST_FAILURE;
+}
+
+s32 XNandPsu_EraseBlock(XNandPsu *InstancePtr, u32 Target, u32 Block)
+{
+	(void)InstancePtr;
+	(void)Target;
+	(void)Block;
+	return XST_FAILURE;
+}
+
+s32 XNandPsu_ReadSpareBytes(XNandPsu *InstancePtr, u32 Page, u8 *Buf)
+{
+	(void)InstancePtr;
+	(void)Page;
+	(void)Buf;
+	return XST_FAILURE;
+}
+
+s32 XNandPsu_WriteSpareBytes(XNandPsu *InstancePtr, u32 Page, u8 *Buf)
+{
+	(void)InstancePtr;
+	(void)Page;
+	(void)Buf;
+	return XST_FAILURE;
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	(void)ctrl1;
+}
@@ -103,6 +103,8 @@
 * 1.2	nsk    01/19/17    Fix for the failure of reading nand first redundant
 * 	                   parameter page. CR#966603
 * 1,3	nsk    08/14/17    Added CCI support
+* 1.3	ag     10/18/26    Added XNandPsu_BulkRead() using read cache
+*			   sequential and multi-plane page reads.
 *
 * </pre>
 *
@@ -186,6 +188,25 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 							u32 Col, u8 *Buf);
 
+static s32 XNandPsu_ReadPageCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u32 Col, u8 *Buf, u8 Cmd1, u8 Cmd2,
+				u32 AddrCycles, u32 ProgMask);
+
+static s32 XNandPsu_IssueCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u8 Cmd1, u8 Cmd2, u32 AddrCycles,
+				u32 ProgMask);
+
+static s32 XNandPsu_ReadCachePages(XNandPsu *InstancePtr, u32 Target,
+				u32 Page, u32 NumPages, u8 *Buf);
+
+static s32 XNandPsu_ReadMultiPlanePage(XNandPsu *InstancePtr, u32 Target,
+				u32 Page, u32 PlanePages, u8 *Buf,
+				u32 PlaneBufOffset);
+
+static s32 XNandPsu_ReadBlockPages(XNandPsu *InstancePtr, u32 Block,
+				u32 Page, u32 NumPages, u32 NumPlanes,
+				u8 *Buf);
+
 static s32 XNandPsu_CheckOnDie(XNandPsu *InstancePtr, OnfiParamPage *Param);
 
 static void XNandPsu_SetEccAddrSize(XNandPsu *InstancePtr);
@@ -271,6 +292,11 @@ s32 XNandPsu_CfgInitialize(XNandPsu *InstancePtr, XNandPsu_Config *ConfigPtr,
 	 InstancePtr->Ecc_Stat_PerPage_flips = 0U;
 	 InstancePtr->Ecc_Stats_total_flips = 0U;
 
+	/* Use pipelined reads in XNandPsu_BulkRead() when supported */
+	InstancePtr->ReadCacheEn = (u8)InstancePtr->Features.ReadCache;
+	InstancePtr->MultiPlaneEn = ((InstancePtr->Features.MultiPlane != 0U) &&
+			(InstancePtr->Geometry.PlaneAddrBits == 1U)) ? 1U : 0U;
+
 	/*
 	 * Scan for the bad block table(bbt) stored in the flash & load it in
 	 * memory(RAM).  If bbt is not found, create bbt by scanning factory
@@ -482,6 +508,7 @@ static void XNandPsu_InitGeometry(XNandPsu *InstancePtr, OnfiParamPage *Param)
 						(u64)Param->PagesPerBlock *
 						(u64)Param->BytesPerPage);
 	InstancePtr->Geometry.EccCodeWordSize = 9U; /* 2 power of 9 = 512 */
+	InstancePtr->Geometry.PlaneAddrBits = Param->PlaneAddrBits & 0xFU;
 	if (InstancePtr->Geometry.NumTargetBlocks > XNANDPSU_MAX_BLOCKS)
 		xil_printf("!!! Device contains more blocks than the max defined blocks in driver\r\n");
 
@@ -531,6 +558,10 @@ static void XNandPsu_InitFeatures(XNandPsu *InstancePtr, OnfiParamPage *Param)
 								1U : 0U;
 	InstancePtr->Features.ExtPrmPage = ((Param->Features & (1U << 7)) != 0U) ?
 								1U : 0U;
+	InstancePtr->Features.MultiPlane = ((Param->Features & (1U << 3)) != 0U) ?
+								1U : 0U;
+	InstancePtr->Features.ReadCache =
+			((Param->OptionalCmds & (1U << 1)) != 0U) ? 1U : 0U;
 }
 
 /*****************************************************************************/
@@ -1534,6 +1565,135 @@ Out:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function reads from the flash like XNandPsu_Read(), skipping bad
+* blocks, but is optimized for long sequential reads. Bad blocks are looked
+* up through the good block map instead of the BBT, and full pages are read
+* with read cache sequential or multi-plane page reads when enabled.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Offset is the starting offset of flash to read.
+* @param	Length is the number of bytes to read.
+* @param	DestBuf is the destination data buffer to fill in.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+s32 XNandPsu_BulkRead(XNandPsu *InstancePtr, u64 Offset, u64 Length,
+							u8 *DestBuf)
+{
+	s32 Status = XST_FAILURE;
+	u32 BlockSize;
+	u32 BytesPerPage;
+	u32 Block;
+	u32 NextBlock;
+	u32 LogicalBlock;
+	u32 BlockOff;
+	u32 Page;
+	u32 Col;
+	u32 NumPages;
+	u32 NumPlanes;
+	u32 NumBytes;
+	u64 NumBlocks;
+	u8 *DestBufPtr = DestBuf;
+	u64 LengthVar = Length;
+
+	/* Assert the input arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(LengthVar != 0U);
+	Xil_AssertNonvoid((Offset + LengthVar) <=
+				InstancePtr->Geometry.DeviceSize);
+
+	BlockSize = InstancePtr->Geometry.BlockSize;
+	BytesPerPage = InstancePtr->Geometry.BytesPerPage;
+	BlockOff = (u32)(Offset % BlockSize);
+	LogicalBlock = XNandPsu_GetLogicalBlock(InstancePtr,
+					(u32)(Offset / BlockSize));
+
+	/*
+	 * Check if read operation exceeds flash size when including
+	 * bad blocks.
+	 */
+	NumBlocks = ((u64)BlockOff + LengthVar + BlockSize - 1U) / BlockSize;
+	if (((u64)LogicalBlock + NumBlocks) >
+			(u64)InstancePtr->NumGoodBlocks) {
+		goto Out;
+	}
+
+	while (LengthVar > 0U) {
+		Status = XNandPsu_GetPhysicalBlock(InstancePtr, LogicalBlock,
+							&Block);
+		if (Status != XST_SUCCESS) {
+			goto Out;
+		}
+		Page = BlockOff / BytesPerPage;
+		Col = BlockOff % BytesPerPage;
+
+		if ((Col > 0U) || (LengthVar < BytesPerPage)) {
+			/* Partial page, read through the driver buffer */
+			NumBytes = BytesPerPage - Col;
+			if ((u64)NumBytes > LengthVar) {
+				NumBytes = (u32)LengthVar;
+			}
+			Status = XNandPsu_ReadBlockPages(InstancePtr, Block,
+					Page, 1U, 1U,
+					&InstancePtr->PartialDataBuf[0]);
+			if (Status != XST_SUCCESS) {
+				goto Out;
+			}
+			(void)Xil_MemCpy(DestBufPtr,
+					&InstancePtr->PartialDataBuf[Col],
+					NumBytes);
+		} else {
+			NumPages = (BlockSize - BlockOff) / BytesPerPage;
+			if ((u64)NumPages > (LengthVar / BytesPerPage)) {
+				NumPages = (u32)(LengthVar / BytesPerPage);
+			}
+			/*
+			 * Read two whole blocks at once when the next good
+			 * block is the neighbour of this one in the other
+			 * plane.
+			 */
+			NumPlanes = 1U;
+			if ((InstancePtr->MultiPlaneEn != 0U) &&
+				((Block & 1U) == 0U) && (Page == 0U) &&
+				(NumPages == InstancePtr->Geometry.PagesPerBlock) &&
+				(LengthVar >= ((u64)BlockSize *
+						XNANDPSU_MAX_PLANES)) &&
+				(XNandPsu_GetPhysicalBlock(InstancePtr,
+					LogicalBlock + 1U, &NextBlock) ==
+							XST_SUCCESS) &&
+				(NextBlock == (Block + 1U))) {
+				NumPlanes = XNANDPSU_MAX_PLANES;
+			}
+			Status = XNandPsu_ReadBlockPages(InstancePtr, Block,
+					Page, NumPages, NumPlanes, DestBufPtr);
+			if (Status != XST_SUCCESS) {
+				goto Out;
+			}
+			NumBytes = NumPages * NumPlanes * BytesPerPage;
+		}
+		DestBufPtr += NumBytes;
+		LengthVar -= NumBytes;
+		BlockOff += NumBytes;
+		while (BlockOff >= BlockSize) {
+			BlockOff -= BlockSize;
+			LogicalBlock++;
+		}
+	}
+
+	Status = XST_SUCCESS;
+Out:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1873,15 +2033,49 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 {
 	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
 				InstancePtr->Geometry.ColAddrCycles;
-	u32 PktSize;
-	u32 PktCount;
-	s32 Status = XST_FAILURE;
-	u32 RegVal;
 
 	/* Assert the input arguments. */
 	Xil_AssertNonvoid(Page < InstancePtr->Geometry.NumPages);
 	Xil_AssertNonvoid(Target < XNANDPSU_MAX_TARGETS);
 
+	return XNandPsu_ReadPageCmd(InstancePtr, Target, Page, Col, Buf,
+				ONFI_CMD_RD1, ONFI_CMD_RD2, AddrCycles,
+				XNANDPSU_PROG_RD_MASK);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function issues a page read type command to the flash and transfers
+* one page of data into the buffer. It is shared by the normal page read,
+* the read cache and the multi-plane read sequences.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the page address value to read.
+* @param	Col is the column address value to read.
+* @param	Buf is the data buffer to fill in.
+* @param	Cmd1 is the first command cycle.
+* @param	Cmd2 is the second command cycle.
+* @param	AddrCycles is the number of address cycles to issue.
+* @param	ProgMask is the Program Register operation to start.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadPageCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u32 Col, u8 *Buf, u8 Cmd1, u8 Cmd2,
+				u32 AddrCycles, u32 ProgMask)
+{
+	u32 PktSize;
+	u32 PktCount;
+	s32 Status = XST_FAILURE;
+	u32 RegVal;
+
 	if (InstancePtr->EccCfg.CodeWordSize > 9U) {
 		PktSize = 1024U;
 	} else {
@@ -1889,8 +2083,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage/PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
-					1U, 1U, (u8)AddrCycles);
+	XNandPsu_Prepare_Cmd(InstancePtr, Cmd1, Cmd2, 1U, 1U, (u8)AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
 		RegVal = XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK |
@@ -1927,7 +2120,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 
 	/* Set Read command in Program Register */
 	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
-				XNANDPSU_PROG_OFFSET,XNANDPSU_PROG_RD_MASK);
+				XNANDPSU_PROG_OFFSET, ProgMask);
 
 	Status = XNandPsu_Data_ReadWrite(InstancePtr, Buf, PktCount, PktSize, 0, 1);
 
@@ -1980,6 +2173,232 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function issues a command which has no data phase, such as the first
+* half of a read cache or multi-plane read sequence, and waits for the
+* controller to complete it.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the page address value.
+* @param	Cmd1 is the first command cycle.
+* @param	Cmd2 is the second command cycle.
+* @param	AddrCycles is the number of address cycles to issue.
+* @param	ProgMask is the Program Register operation to start.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_IssueCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u8 Cmd1, u8 Cmd2, u32 AddrCycles,
+				u32 ProgMask)
+{
+	/*
+	 * Enable Transfer Complete Interrupt in Interrupt Status Enable
+	 * Register
+	 */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_INTR_STS_EN_OFFSET,
+			XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK);
+	/* Program Command */
+	XNandPsu_Prepare_Cmd(InstancePtr, Cmd1, Cmd2, 0U, 0U, (u8)AddrCycles);
+	/* Program Column, Page, Block address */
+	XNandPsu_SetPageColAddr(InstancePtr, Page, 0U);
+	/* Program Memory Address Register2 for chip select */
+	XNandPsu_SelectChip(InstancePtr, Target);
+	/* Start the operation in Program Register */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_PROG_OFFSET, ProgMask);
+	/* Poll for Transfer Complete event */
+	return XNandPsu_WaitFor_Transfer_Complete(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads consecutive pages using the ONFI read cache sequential
+* commands. After the first page is loaded with 00h-30h, every 31h command
+* moves the loaded page to the data register and starts the array read of
+* the next page, so the tR of page N+1 overlaps the transfer of page N. The
+* last page is fetched with 3Fh.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page address to read.
+* @param	NumPages is the number of pages to read.
+* @param	Buf is the data buffer to fill in.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		The pages must not cross a block boundary.
+*
+******************************************************************************/
+static s32 XNandPsu_ReadCachePages(XNandPsu *InstancePtr, u32 Target,
+				u32 Page, u32 NumPages, u8 *Buf)
+{
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+				InstancePtr->Geometry.ColAddrCycles;
+	u32 Index;
+	u8 Cmd;
+	u32 ProgMask;
+	u8 *BufPtr = Buf;
+	s32 Status = XST_FAILURE;
+
+	Xil_AssertNonvoid(NumPages > 1U);
+
+	/* Load the first page in to the cache register */
+	Status = XNandPsu_IssueCmd(InstancePtr, Target, Page, ONFI_CMD_RD1,
+				ONFI_CMD_RD2, AddrCycles,
+				XNANDPSU_PROG_RD_CACHE_START_MASK);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+
+	for (Index = 0U; Index < NumPages; Index++) {
+		if (Index == (NumPages - 1U)) {
+			Cmd = ONFI_CMD_RD_CACHE_END;
+			ProgMask = XNANDPSU_PROG_RD_CACHE_END_MASK;
+		} else {
+			Cmd = ONFI_CMD_RD_CACHE_SEQ;
+			ProgMask = XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+		}
+		Status = XNandPsu_ReadPageCmd(InstancePtr, Target,
+					Page + Index, 0U, BufPtr, Cmd, 0U,
+					0U, ProgMask);
+		if (Status != XST_SUCCESS) {
+			goto Out;
+		}
+		BufPtr += InstancePtr->Geometry.BytesPerPage;
+	}
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads one page from each of the two planes with a single
+* array read. The plane 0 page is queued with 00h-32h, the plane 1 page is
+* read with 00h-30h which also returns its data, and the plane 0 data is then
+* selected with Change Read Column Enhanced (06h-E0h).
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the page address in plane 0.
+* @param	PlanePages is the distance in pages to the plane 1 page.
+* @param	Buf is the buffer for the plane 0 page.
+* @param	PlaneBufOffset is the offset of the plane 1 page in Buf.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadMultiPlanePage(XNandPsu *InstancePtr, u32 Target,
+				u32 Page, u32 PlanePages, u8 *Buf,
+				u32 PlaneBufOffset)
+{
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+				InstancePtr->Geometry.ColAddrCycles;
+	s32 Status = XST_FAILURE;
+
+	Status = XNandPsu_IssueCmd(InstancePtr, Target, Page,
+				ONFI_CMD_MUL_RD1, ONFI_CMD_MUL_RD2, AddrCycles,
+				XNANDPSU_PROG_RD_INTRLVD_MASK);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+
+	Status = XNandPsu_ReadPageCmd(InstancePtr, Target, Page + PlanePages,
+				0U, Buf + PlaneBufOffset, ONFI_CMD_RD1,
+				ONFI_CMD_RD2, AddrCycles,
+				XNANDPSU_PROG_RD_MASK);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+
+	Status = XNandPsu_ReadPageCmd(InstancePtr, Target, Page, 0U, Buf,
+				ONFI_CMD_CHNG_RD_COL_ENHCD1,
+				ONFI_CMD_CHNG_RD_COL_ENHCD2, AddrCycles,
+				XNANDPSU_PROG_CHNG_RD_COL_ENH_MASK);
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a run of full pages from a physical block, selecting
+* the fastest read sequence the device and driver settings allow.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Block is the physical block number.
+* @param	Page is the first page within the block.
+* @param	NumPages is the number of pages to read.
+* @param	NumPlanes is 2 to also read the same pages from Block + 1
+*		with multi-plane reads, 1 otherwise.
+* @param	Buf is the data buffer to fill in. With two planes the pages
+*		of Block + 1 are stored NumPages pages after those of Block.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadBlockPages(XNandPsu *InstancePtr, u32 Block,
+				u32 Page, u32 NumPages, u32 NumPlanes,
+				u8 *Buf)
+{
+	u32 Target;
+	u32 TargetPage;
+	u32 Index;
+	u32 BytesPerPage = InstancePtr->Geometry.BytesPerPage;
+	s32 Status = XST_FAILURE;
+
+	Target = Block / InstancePtr->Geometry.NumTargetBlocks;
+	TargetPage = ((Block % InstancePtr->Geometry.NumTargetBlocks) *
+			InstancePtr->Geometry.PagesPerBlock) + Page;
+
+	if (NumPlanes == XNANDPSU_MAX_PLANES) {
+		for (Index = 0U; Index < NumPages; Index++) {
+			Status = XNandPsu_ReadMultiPlanePage(InstancePtr,
+					Target, TargetPage + Index,
+					InstancePtr->Geometry.PagesPerBlock,
+					Buf + (Index * BytesPerPage),
+					NumPages * BytesPerPage);
+			if (Status != XST_SUCCESS) {
+				goto Out;
+			}
+		}
+	} else if ((InstancePtr->ReadCacheEn != 0U) && (NumPages > 1U)) {
+		Status = XNandPsu_ReadCachePages(InstancePtr, Target,
+					TargetPage, NumPages, Buf);
+	} else {
+		for (Index = 0U; Index < NumPages; Index++) {
+			Status = XNandPsu_ReadPage(InstancePtr, Target,
+					TargetPage + Index, 0U,
+					Buf + (Index * BytesPerPage));
+			if (Status != XST_SUCCESS) {
+				goto Out;
+			}
+		}
+	}
+Out:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
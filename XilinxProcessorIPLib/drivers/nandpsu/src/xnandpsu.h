@@ -89,6 +89,19 @@
 * the control is returned back to user only after the read operation is
 * completed successfully or an error is reported.
 *
+* <b>Bulk Read Operation</b>
+*
+* XNandPsu_BulkRead() has the same semantics as XNandPsu_Read() but is meant
+* for large sequential reads such as boot images and file system mounts. Bad
+* blocks are skipped through a good block map which is built along with the
+* bad block table, and runs of full pages are read with the ONFI read cache
+* sequential command so that the array read of the next page overlaps the
+* DMA of the current one. On devices with two planes, pairs of good blocks
+* that belong to different planes are read with multi-plane page reads.
+* Either mechanism is used only when the device reports support for it in
+* the parameter page; the ReadCacheEn and MultiPlaneEn members of the
+* instance may be cleared by the application to disable them.
+*
 * <b>Erase Operation</b>
 *
 * The erase operations are provided to erase a Block in the Flash memory. The
@@ -167,6 +180,9 @@
 *       ms     04/10/17    Modified Comment lines in nandpsu_example.c to
 *                          follow doxygen rules.
 * 1.2	nsk    08/08/17    Added support to import example in SDK
+* 1.3	ag     10/18/26    Added XNandPsu_BulkRead() which uses ONFI read
+*			   cache sequential and multi-plane reads together
+*			   with a precomputed good block map.
 *
 * </pre>
 *
@@ -207,6 +223,10 @@ extern "C" {
 #define XNANDPSU_BCH			0x2U	/**< BCH Flash */
 
 #define XNANDPSU_MAX_BLOCKS		16384U	/**< Max number of Blocks */
+#define XNANDPSU_GBM_GROUP_SHIFT	5U	/**< Blocks per good block map
+						  group (2 power of 5) */
+#define XNANDPSU_MAX_PLANES		2U	/**< Max planes used for
+						  multi-plane read */
 #define XNANDPSU_MAX_SPARE_SIZE		0x800U	/**< Max spare bytes of a NAND
 						  flash page of 16K */
 
@@ -324,6 +344,7 @@ typedef struct {
 	u8 NumBitsPerCell;	/**< Number of bits per cell (Hamming/BCH) */
 	u8 NumBitsECC;		/**< Number of bits ECC correctability */
 	u32 EccCodeWordSize;	/**< ECC codeword size */
+	u8 PlaneAddrBits;	/**< Number of plane address bits */
 	/* Driver specific information */
 	u32 BlockSize;		/**< Block size */
 	u32 NumTargetPages;	/**< Total number of pages in a Target */
@@ -343,6 +364,8 @@ typedef struct {
 	u32 EzNand;
 	u32 OnDie;
 	u32 ExtPrmPage;
+	u32 ReadCache;		/**< Read cache commands supported */
+	u32 MultiPlane;		/**< Multi-plane operations supported */
 } XNandPsu_Features;
 
 /**
@@ -395,6 +418,12 @@ typedef struct {
 	XNandPsu_BadBlockPattern BbPattern;	/**< Bad block pattern to
 						  search */
 	u8 Bbt[XNANDPSU_MAX_BLOCKS >> 2];	/**< Bad block table array */
+	/* Good block map, rebuilt whenever the BBT changes */
+	u16 GoodBlockRank[XNANDPSU_MAX_BLOCKS >> XNANDPSU_GBM_GROUP_SHIFT];
+				/**< Good blocks preceding each group */
+	u32 NumGoodBlocks;	/**< Total number of good blocks */
+	u8 ReadCacheEn;		/**< Use read cache sequential in bulk read */
+	u8 MultiPlaneEn;	/**< Use multi-plane read in bulk read */
 } XNandPsu;
 
 /******************* Macro Definitions (Inline Functions) *******************/
@@ -537,6 +566,9 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length,
 s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length,
 							u8 *DestBuf);
 
+s32 XNandPsu_BulkRead(XNandPsu *InstancePtr, u64 Offset, u64 Length,
+							u8 *DestBuf);
+
 s32 XNandPsu_EraseBlock(XNandPsu *InstancePtr, u32 Target, u32 Block);
 
 s32 XNandPsu_WriteSpareBytes(XNandPsu *InstancePtr, u32 Page, u8 *Buf);
@@ -53,6 +53,10 @@
 *			   Oob and No-Oob region.
 * 1.1	nsk    11/07/16    Change memcpy to Xil_MemCpy to handle word aligned
 *	                   data access.
+* 1.3	ag     10/18/26    Added good block map which is rebuilt whenever the
+*			   RAM based BBT changes.
+*	ag     10/19/26    Bounded the good block map and its lookups to
+*			   XNANDPSU_MAX_BLOCKS.
 * </pre>
 *
 ******************************************************************************/
@@ -88,6 +92,8 @@ static s32 XNandPsu_MarkBbt(XNandPsu* InstancePtr, XNandPsu_BbtDesc *Desc,
 
 static s32 XNandPsu_UpdateBbt(XNandPsu *InstancePtr, u32 Target);
 
+static u32 XNandPsu_GbmNumBlocks(const XNandPsu *InstancePtr);
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -323,6 +329,7 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 		}
 	}
 
+	XNandPsu_BuildGoodBlockMap(InstancePtr);
 	Status = XST_SUCCESS;
 Out:
 	return Status;
@@ -898,6 +905,7 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	Data |= (XNANDPSU_BLOCK_BAD << BlockShift);
 	NewVal = Data;
 	InstancePtr->Bbt[BlockOffset] = Data;
+	XNandPsu_BuildGoodBlockMap(InstancePtr);
 
 	/* Update the Bad Block Table(BBT) in flash */
 	if (OldVal != NewVal) {
@@ -911,4 +919,168 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 Out:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+* This function builds the good block map from the RAM based Bad Block
+* Table(BBT). The map holds, for every group of 2^XNANDPSU_GBM_GROUP_SHIFT
+* blocks, the number of good blocks preceding the group. This allows
+* translating between logical (good block) and physical block numbers
+* without walking the whole BBT.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+*
+* @return
+*		- NONE.
+*
+* @note		Called whenever the RAM based BBT is loaded or modified. Only
+*		the first XNANDPSU_MAX_BLOCKS blocks, which the RAM based BBT
+*		covers, are mapped.
+*
+******************************************************************************/
+void XNandPsu_BuildGoodBlockMap(XNandPsu *InstancePtr)
+{
+	u32 Block;
+	u32 GoodBlocks = 0U;
+	u32 NumBlocks;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	NumBlocks = XNandPsu_GbmNumBlocks(InstancePtr);
+
+	for (Block = 0U; Block < NumBlocks; Block++) {
+		if ((Block & ((1U << XNANDPSU_GBM_GROUP_SHIFT) - 1U)) == 0U) {
+			InstancePtr->GoodBlockRank[Block >>
+				XNANDPSU_GBM_GROUP_SHIFT] = (u16)GoodBlocks;
+		}
+		if (XNandPsu_IsBlockBad(InstancePtr, Block) != XST_SUCCESS) {
+			GoodBlocks++;
+		}
+	}
+	InstancePtr->NumGoodBlocks = GoodBlocks;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of good blocks which precede a physical
+* block, i.e. the logical block number of the block if it is good, or of the
+* next good block if it is bad.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Block is the physical block number.
+*
+* @return	Number of good blocks before Block. For a block beyond the
+*		good block map this is the number of good blocks in the map,
+*		which no logical block reaches.
+*
+******************************************************************************/
+u32 XNandPsu_GetLogicalBlock(XNandPsu *InstancePtr, u32 Block)
+{
+	u32 Index;
+	u32 LogicalBlock;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Block < InstancePtr->Geometry.NumBlocks);
+
+	if (Block >= XNandPsu_GbmNumBlocks(InstancePtr)) {
+		LogicalBlock = InstancePtr->NumGoodBlocks;
+		goto Out;
+	}
+
+	LogicalBlock = InstancePtr->GoodBlockRank[Block >>
+						XNANDPSU_GBM_GROUP_SHIFT];
+	Index = Block & ~((1U << XNANDPSU_GBM_GROUP_SHIFT) - 1U);
+	while (Index < Block) {
+		if (XNandPsu_IsBlockBad(InstancePtr, Index) != XST_SUCCESS) {
+			LogicalBlock++;
+		}
+		Index++;
+	}
+Out:
+	return LogicalBlock;
+}
+
+/*****************************************************************************/
+/**
+* This function translates a logical block number (index among the good
+* blocks of the flash) into the physical block number. The group holding the
+* block is found by a binary search of the good block map and only the BBT
+* entries of that group are scanned.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	LogicalBlock is the logical block number.
+* @param	BlockPtr is filled with the physical block number.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if there are not enough good blocks.
+*
+******************************************************************************/
+s32 XNandPsu_GetPhysicalBlock(XNandPsu *InstancePtr, u32 LogicalBlock,
+							u32 *BlockPtr)
+{
+	u32 Low = 0U;
+	u32 High;
+	u32 Mid;
+	u32 Block;
+	u32 Count;
+	u32 NumBlocks;
+	s32 Status = XST_FAILURE;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(BlockPtr != NULL);
+
+	if (LogicalBlock >= InstancePtr->NumGoodBlocks) {
+		goto Out;
+	}
+
+	/* Find the last group whose rank is not above LogicalBlock */
+	NumBlocks = XNandPsu_GbmNumBlocks(InstancePtr);
+	High = (NumBlocks - 1U) >> XNANDPSU_GBM_GROUP_SHIFT;
+	while (Low < High) {
+		Mid = (Low + High + 1U) >> 1U;
+		if ((u32)InstancePtr->GoodBlockRank[Mid] <= LogicalBlock) {
+			Low = Mid;
+		} else {
+			High = Mid - 1U;
+		}
+	}
+
+	Count = InstancePtr->GoodBlockRank[Low];
+	Block = Low << XNANDPSU_GBM_GROUP_SHIFT;
+	while (Block < NumBlocks) {
+		if (XNandPsu_IsBlockBad(InstancePtr, Block) != XST_SUCCESS) {
+			if (Count == LogicalBlock) {
+				*BlockPtr = Block;
+				Status = XST_SUCCESS;
+				break;
+			}
+			Count++;
+		}
+		Block++;
+	}
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* This function returns the number of blocks covered by the good block map,
+* the smaller of the flash size and XNANDPSU_MAX_BLOCKS.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+*
+* @return	Number of blocks in the good block map.
+*
+******************************************************************************/
+static u32 XNandPsu_GbmNumBlocks(const XNandPsu *InstancePtr)
+{
+	u32 NumBlocks = InstancePtr->Geometry.NumBlocks;
+
+	if (NumBlocks > XNANDPSU_MAX_BLOCKS) {
+		NumBlocks = XNANDPSU_MAX_BLOCKS;
+	}
+
+	return NumBlocks;
+}
 /** @} */
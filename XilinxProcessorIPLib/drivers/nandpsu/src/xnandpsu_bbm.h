@@ -90,6 +90,8 @@
 *			   in page section by enabling XNANDPSU_BBT_NO_OOB.
 *			   Modified Bbt Signature and Version Offset value for
 *			   Oob and No-Oob region.
+* 1.3	ag     10/18/26    Added good block map for logical to physical
+*			   block translation.
 * </pre>
 *
 ******************************************************************************/
@@ -198,6 +200,13 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr);
 
 s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block);
 
+void XNandPsu_BuildGoodBlockMap(XNandPsu *InstancePtr);
+
+u32 XNandPsu_GetLogicalBlock(XNandPsu *InstancePtr, u32 Block);
+
+s32 XNandPsu_GetPhysicalBlock(XNandPsu *InstancePtr, u32 LogicalBlock,
+							u32 *BlockPtr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -82,6 +82,16 @@
 * check the status of the transfer and report back to the application
 * when done.
 *
+* Streaming read:
+* XQspiPsu_StreamRead() reads a large contiguous region of flash into memory
+* as a sequence of read commands of XQspiPsu_StreamCfg.ChunkSize bytes each.
+* The GENFIFO entries (command and address bytes as immediate data, dummy
+* and data phases) for the next chunk are queued while the current chunk is
+* received, and the RX DMA is re-armed as soon as a chunk completes, so the
+* bus stays busy for the whole read. Stacked and dual parallel connections
+* are handled by the driver based on the flash address. An optional handler
+* is called after every completed chunk.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -122,6 +132,8 @@
 *		     while booting images from QSPI
 * 1.5	tjs	08/08/17 Added index.html file for importing examples from system.mss
 * 1.5	nsk 08/14/17 Added CCI support
+* 1.6	ag  10/18/26 Added XQspiPsu_StreamRead() which issues back to back
+*		     read commands with the RX DMA re-armed per chunk.
 *
 * </pre>
 *
@@ -161,6 +173,18 @@ extern "C" {
 typedef void (*XQspiPsu_StatusHandler) (void *CallBackRef, u32 StatusEvent,
 					u32 ByteCount);
 
+/**
+ * The handler data type for XQspiPsu_StreamRead(). It is called in the
+ * context of XQspiPsu_StreamRead() after each chunk has been written to
+ * memory.
+ *
+ * @param	CallBackRef is the reference given in XQspiPsu_StreamCfg.
+ * @param	ChunkPtr is the start of the completed chunk in memory.
+ * @param	ByteCount is the size of the completed chunk.
+ */
+typedef void (*XQspiPsu_ChunkHandler) (void *CallBackRef, u8 *ChunkPtr,
+					u32 ByteCount);
+
 /**
  * This typedef contains configuration information for a flash message.
  */
@@ -176,6 +200,21 @@ typedef struct {
 	u8 PollBusMask;
 } XQspiPsu_Msg;
 
+/**
+ * This typedef describes the flash read command used by XQspiPsu_StreamRead().
+ */
+typedef struct {
+	u8 ReadCmd;		/**< Read command opcode */
+	u8 AddrBytes;		/**< Number of address bytes, 3 or 4 */
+	u8 DummyClocks;		/**< Dummy clocks after the address */
+	u8 BusWidth;		/**< Bus width of the dummy and data phases */
+	u32 ChunkSize;		/**< Bytes read per command, multiple of 4 */
+	u32 FlashSize;		/**< Size of one flash device in bytes, used to
+				  select the device in stacked mode */
+	XQspiPsu_ChunkHandler ChunkHandler; /**< Optional chunk handler */
+	void *ChunkRef;		/**< Reference passed to ChunkHandler */
+} XQspiPsu_StreamCfg;
+
 /**
  * This typedef contains configuration information for the device.
  */
@@ -245,6 +284,8 @@ typedef struct {
 
 #define XQSPIPSU_DMA_BYTES_MAX		0x10000000U
 
+#define XQSPIPSU_STREAM_MAX_ADDR_BYTES	4U
+
 #define XQSPIPSU_CLK_PRESCALE_2		0x00U
 #define XQSPIPSU_CLK_PRESCALE_4		0x01U
 #define XQSPIPSU_CLK_PRESCALE_8		0x02U
@@ -296,6 +337,10 @@ s32 XQspiPsu_InterruptHandler(XQspiPsu *InstancePtr);
 void XQspiPsu_SetStatusHandler(XQspiPsu *InstancePtr, void *CallBackRef,
 				XQspiPsu_StatusHandler FuncPointer);
 
+/* Streaming read function in xqspipsu_stream.c */
+s32 XQspiPsu_StreamRead(XQspiPsu *InstancePtr, const XQspiPsu_StreamCfg *Cfg,
+			u32 FlashAddr, u8 *RxBfrPtr, u32 ByteCount);
+
 /* Configuration functions */
 s32 XQspiPsu_SetClkPrescaler(XQspiPsu *InstancePtr, u8 Prescaler);
 void XQspiPsu_SelectFlash(XQspiPsu *InstancePtr, u8 FlashCS, u8 FlashBus);
@@ -0,0 +1,495 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xqspipsu_stream.c
+* @addtogroup qspipsu_v3_4
+* @{
+*
+* This file implements the streaming read of the QSPIPSU driver. A large read
+* is split in chunks, each of which is a complete flash read command. The
+* GENFIFO entries of the next chunk are queued while the current chunk is
+* being received so that the controller issues the commands back to back,
+* and the RX DMA is re-armed for the next chunk as soon as the current one
+* is done. See xqspipsu.h for more information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.6   ag  10/18/26 First release
+*       ag  10/19/26 Abort the stream on a DMA error instead of passing
+*                    the failed chunk to the chunk handler
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu.h"
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * DMA status bits which fail a streaming read. The threshold hit bit is not
+ * an error and is left out of XQSPIPSU_QSPIDMA_DST_INTR_ERR_MASK here.
+ */
+#define XQSPIPSU_STREAM_DMA_ERR_MASK	(XQSPIPSU_QSPIDMA_DST_INTR_ERR_MASK & \
+				~XQSPIPSU_QSPIDMA_DST_I_STS_THRESHOLD_HIT_MASK)
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Describes one chunk of a streaming read.
+ */
+typedef struct {
+	u32 FlashAddr;		/**< Address sent to the flash */
+	u8 *BufPtr;		/**< Destination of the chunk */
+	u32 ByteCount;		/**< Size of the chunk */
+	u32 GenFifoCS;		/**< Chip select of the chunk */
+	u32 GenFifoBus;		/**< Bus select of the chunk */
+} XQspiPsu_StreamChunk;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XQspiPsu_StreamSpiMode(u8 SpiMode);
+static void XQspiPsu_StreamNextChunk(XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamCfg *Cfg, u32 FlashAddr,
+			u8 *BufPtr, u32 ByteCount, XQspiPsu_StreamChunk *Chunk);
+static void XQspiPsu_StreamGenFifoWrite(XQspiPsu *InstancePtr, u32 Entry);
+static void XQspiPsu_StreamQueueChunk(XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamCfg *Cfg,
+			const XQspiPsu_StreamChunk *Chunk);
+static void XQspiPsu_StreamSetupDma(XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamChunk *Chunk);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function reads a region of flash into memory with back to back read
+* commands of Cfg->ChunkSize bytes. The next chunk is always queued in the
+* GENFIFO before waiting for the current one, and the RX DMA is programmed
+* for the next chunk as soon as the current chunk completes.
+*
+* In stacked mode, the lower or upper flash is selected for each chunk based
+* on the address and a chunk never crosses the boundary between the two
+* devices. In dual parallel mode both devices are accessed with the data
+* striped and the address sent to each device is FlashAddr / 2.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cfg is a pointer to the read command description.
+* @param	FlashAddr is the flash address to read from, as seen by the
+*		application for stacked or parallel connections.
+* @param	RxBfrPtr is the destination buffer, which must be 4-byte
+*		aligned.
+* @param	ByteCount is the number of bytes to read, a multiple of 4.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if the driver is not in DMA read mode.
+*		- XST_DEVICE_BUSY if a transfer is already in progress.
+*		- XST_FAILURE if the DMA reports an error. The transfer is
+*		aborted and the chunk which failed is not passed to
+*		Cfg->ChunkHandler.
+*
+* @note		The read is polled. For flashes which need a bank or extended
+*		address register, the caller must make sure the region does
+*		not cross a bank.
+*
+******************************************************************************/
+s32 XQspiPsu_StreamRead(XQspiPsu *InstancePtr, const XQspiPsu_StreamCfg *Cfg,
+			u32 FlashAddr, u8 *RxBfrPtr, u32 ByteCount)
+{
+	XQspiPsu_StreamChunk Chunk;
+	XQspiPsu_StreamChunk NextChunk;
+	u32 BaseAddress;
+	u32 NextAddr;
+	u32 Remaining;
+	u32 DmaIntrSts;
+	u32 QspiPsuStatusReg;
+	u32 HaveNext;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(Cfg != NULL);
+	Xil_AssertNonvoid((Cfg->AddrBytes == 3U) ||
+			(Cfg->AddrBytes == XQSPIPSU_STREAM_MAX_ADDR_BYTES));
+	Xil_AssertNonvoid((Cfg->ChunkSize != 0U) &&
+			((Cfg->ChunkSize & 0x3U) == 0U) &&
+			(Cfg->ChunkSize <= XQSPIPSU_DMA_BYTES_MAX));
+	Xil_AssertNonvoid(((INTPTR)RxBfrPtr & 0x3U) == 0U);
+	Xil_AssertNonvoid((ByteCount != 0U) && ((ByteCount & 0x3U) == 0U));
+
+	/* Check whether there is another transfer in progress. Not thread-safe */
+	if (InstancePtr->IsBusy == TRUE) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	if (InstancePtr->ReadMode != XQSPIPSU_READMODE_DMA) {
+		return (s32)XST_FAILURE;
+	}
+
+	InstancePtr->IsBusy = TRUE;
+	BaseAddress = InstancePtr->Config.BaseAddress;
+
+	/* Enable */
+	XQspiPsu_Enable(InstancePtr);
+
+	/* Clear any DMA status left over from a previous transfer */
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET,
+		XQspiPsu_ReadReg(BaseAddress,
+				XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET));
+
+	XQspiPsu_StreamNextChunk(InstancePtr, Cfg, FlashAddr, RxBfrPtr,
+				ByteCount, &Chunk);
+	XQspiPsu_StreamSetupDma(InstancePtr, &Chunk);
+	XQspiPsu_StreamQueueChunk(InstancePtr, Cfg, &Chunk);
+
+	NextAddr = FlashAddr + Chunk.ByteCount;
+	Remaining = ByteCount - Chunk.ByteCount;
+
+	while (Chunk.ByteCount != 0U) {
+		/*
+		 * Queue the next command behind the current one so that it
+		 * starts as soon as the current data phase ends.
+		 */
+		HaveNext = (u32)FALSE;
+		if (Remaining != 0U) {
+			XQspiPsu_StreamNextChunk(InstancePtr, Cfg, NextAddr,
+					Chunk.BufPtr + Chunk.ByteCount,
+					Remaining, &NextChunk);
+			XQspiPsu_StreamQueueChunk(InstancePtr, Cfg, &NextChunk);
+			NextAddr += NextChunk.ByteCount;
+			Remaining -= NextChunk.ByteCount;
+			HaveNext = (u32)TRUE;
+		}
+
+		/* Wait for the current chunk to reach memory */
+		do {
+			DmaIntrSts = XQspiPsu_ReadReg(BaseAddress,
+					XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET);
+		} while ((DmaIntrSts & (XQSPIPSU_QSPIDMA_DST_I_STS_DONE_MASK |
+				XQSPIPSU_STREAM_DMA_ERR_MASK)) == FALSE);
+		XQspiPsu_WriteReg(BaseAddress,
+				XQSPIPSU_QSPIDMA_DST_I_STS_OFFSET, DmaIntrSts);
+
+		if ((DmaIntrSts & XQSPIPSU_STREAM_DMA_ERR_MASK) != FALSE) {
+			/*
+			 * Drop the queued commands and the data in flight,
+			 * this also clears the busy flag and disables the
+			 * controller.
+			 */
+			XQspiPsu_Abort(InstancePtr);
+			return (s32)XST_FAILURE;
+		}
+
+		/* Re-arm the DMA before handing the chunk to the user */
+		if (HaveNext == (u32)TRUE) {
+			XQspiPsu_StreamSetupDma(InstancePtr, &NextChunk);
+		}
+
+		if (Cfg->ChunkHandler != NULL) {
+			Cfg->ChunkHandler(Cfg->ChunkRef, Chunk.BufPtr,
+					Chunk.ByteCount);
+		}
+
+		if (HaveNext == (u32)TRUE) {
+			Chunk = NextChunk;
+		} else {
+			Chunk.ByteCount = 0U;
+		}
+	}
+
+	QspiPsuStatusReg = XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET);
+	while ((QspiPsuStatusReg & XQSPIPSU_ISR_GENFIFOEMPTY_MASK) == FALSE) {
+		QspiPsuStatusReg = XQspiPsu_ReadReg(BaseAddress,
+						XQSPIPSU_ISR_OFFSET);
+	}
+
+	/* Clear the busy flag. */
+	InstancePtr->IsBusy = FALSE;
+
+	/* Disable the device. */
+	XQspiPsu_Disable(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Selects SPI mode - x1 or x2 or x4.
+*
+* @param	SpiMode - spi or dual or quad.
+* @return	Mask to set desired SPI mode in GENFIFO entry.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XQspiPsu_StreamSpiMode(u8 SpiMode)
+{
+	u32 Mask;
+
+	switch (SpiMode) {
+		case XQSPIPSU_SELECT_MODE_DUALSPI:
+			Mask = XQSPIPSU_GENFIFO_MODE_DUALSPI;
+			break;
+		case XQSPIPSU_SELECT_MODE_QUADSPI:
+			Mask = XQSPIPSU_GENFIFO_MODE_QUADSPI;
+			break;
+		default:
+			Mask = XQSPIPSU_GENFIFO_MODE_SPI;
+			break;
+	}
+
+	return Mask;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function computes the next chunk of a streaming read: its size, the
+* address to send to the flash and the chip and bus select to use.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cfg is a pointer to the read command description.
+* @param	FlashAddr is the application flash address of the chunk.
+* @param	BufPtr is the destination of the chunk.
+* @param	ByteCount is the number of bytes left to read.
+* @param	Chunk is filled with the chunk description.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamNextChunk(XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamCfg *Cfg, u32 FlashAddr,
+			u8 *BufPtr, u32 ByteCount, XQspiPsu_StreamChunk *Chunk)
+{
+	u32 Size = ByteCount;
+
+	if (Size > Cfg->ChunkSize) {
+		Size = Cfg->ChunkSize;
+	}
+
+	switch (InstancePtr->Config.ConnectionMode) {
+		case XQSPIPSU_CONNECTION_MODE_STACKED:
+			if (FlashAddr >= Cfg->FlashSize) {
+				Chunk->GenFifoCS = XQSPIPSU_GENFIFO_CS_UPPER;
+				Chunk->GenFifoBus = XQSPIPSU_GENFIFO_BUS_LOWER;
+				Chunk->FlashAddr = FlashAddr - Cfg->FlashSize;
+			} else {
+				Chunk->GenFifoCS = XQSPIPSU_GENFIFO_CS_LOWER;
+				Chunk->GenFifoBus = XQSPIPSU_GENFIFO_BUS_LOWER;
+				Chunk->FlashAddr = FlashAddr;
+				/* Do not cross in to the upper flash */
+				if (Size > (Cfg->FlashSize - FlashAddr)) {
+					Size = Cfg->FlashSize - FlashAddr;
+				}
+			}
+			break;
+
+		case XQSPIPSU_CONNECTION_MODE_PARALLEL:
+			Chunk->GenFifoCS = (u32)XQSPIPSU_GENFIFO_CS_LOWER |
+					(u32)XQSPIPSU_GENFIFO_CS_UPPER;
+			Chunk->GenFifoBus = XQSPIPSU_GENFIFO_BUS_BOTH;
+			Chunk->FlashAddr = FlashAddr / 2U;
+			break;
+
+		default:
+			Chunk->GenFifoCS = XQSPIPSU_GENFIFO_CS_LOWER;
+			Chunk->GenFifoBus = XQSPIPSU_GENFIFO_BUS_LOWER;
+			Chunk->FlashAddr = FlashAddr;
+			break;
+	}
+
+	Chunk->BufPtr = BufPtr;
+	Chunk->ByteCount = Size;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes one GENFIFO entry, waiting for room in the GENFIFO if
+* it is full. The GENFIFO is started after every entry so that queued
+* commands do not wait for the whole chunk to be written.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Entry is the GENFIFO entry.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamGenFifoWrite(XQspiPsu *InstancePtr, u32 Entry)
+{
+	u32 BaseAddress = InstancePtr->Config.BaseAddress;
+
+	while ((XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_ISR_OFFSET) &
+			XQSPIPSU_ISR_GENFIFONOT_FULL_MASK) == FALSE) {
+		/* Wait for the controller to consume an entry */
+	}
+
+	XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_GEN_FIFO_OFFSET, Entry);
+
+	if (InstancePtr->IsManualstart == TRUE) {
+		XQspiPsu_WriteReg(BaseAddress, XQSPIPSU_CFG_OFFSET,
+			XQspiPsu_ReadReg(BaseAddress, XQSPIPSU_CFG_OFFSET) |
+				XQSPIPSU_CFG_START_GEN_FIFO_MASK);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues the GENFIFO entries of one chunk: CS assert, command
+* and address bytes sent as immediate data, dummy clocks, the data phase and
+* CS de-assert. The TX FIFO is not used.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Cfg is a pointer to the read command description.
+* @param	Chunk is a pointer to the chunk to queue.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamQueueChunk(XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamCfg *Cfg,
+			const XQspiPsu_StreamChunk *Chunk)
+{
+	u32 Bus = Chunk->GenFifoBus;
+	u32 Entry;
+	u32 Index;
+	u32 TempCount;
+	u32 Exponent;
+
+	/* CS assert */
+	XQspiPsu_StreamGenFifoWrite(InstancePtr, (u32)XQSPIPSU_GENFIFO_MODE_SPI |
+			Chunk->GenFifoCS | Bus | XQSPIPSU_GENFIFO_CS_SETUP);
+
+	/* Command and address, one immediate byte per entry */
+	Entry = (u32)XQSPIPSU_GENFIFO_MODE_SPI | Chunk->GenFifoCS | Bus |
+			XQSPIPSU_GENFIFO_TX;
+	XQspiPsu_StreamGenFifoWrite(InstancePtr, Entry | Cfg->ReadCmd);
+	for (Index = Cfg->AddrBytes; Index > 0U; Index--) {
+		XQspiPsu_StreamGenFifoWrite(InstancePtr, Entry |
+			((Chunk->FlashAddr >> ((Index - 1U) * 8U)) & 0xFFU));
+	}
+
+	/* Dummy clocks at the data bus width */
+	Entry = XQspiPsu_StreamSpiMode(Cfg->BusWidth) | Chunk->GenFifoCS | Bus;
+	if (Cfg->DummyClocks != 0U) {
+		XQspiPsu_StreamGenFifoWrite(InstancePtr, Entry |
+				XQSPIPSU_GENFIFO_DATA_XFER | Cfg->DummyClocks);
+	}
+
+	/* Data phase */
+	Entry |= XQSPIPSU_GENFIFO_DATA_XFER | XQSPIPSU_GENFIFO_RX;
+	if (InstancePtr->Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		Entry |= XQSPIPSU_GENFIFO_STRIPE;
+	}
+	if (Chunk->ByteCount < XQSPIPSU_GENFIFO_IMM_DATA_MASK) {
+		XQspiPsu_StreamGenFifoWrite(InstancePtr,
+				Entry | Chunk->ByteCount);
+	} else {
+		/* Exponent entries for every power of two above 255 */
+		TempCount = Chunk->ByteCount >> 8U;
+		Exponent = 8U;
+		while (TempCount != 0U) {
+			if ((TempCount & 0x1U) != 0U) {
+				XQspiPsu_StreamGenFifoWrite(InstancePtr, Entry |
+					XQSPIPSU_GENFIFO_EXP | Exponent);
+			}
+			TempCount >>= 1U;
+			Exponent++;
+		}
+		if ((Chunk->ByteCount & 0xFFU) != 0U) {
+			XQspiPsu_StreamGenFifoWrite(InstancePtr, Entry |
+					(Chunk->ByteCount & 0xFFU));
+		}
+	}
+
+	/* CS de-assert */
+	XQspiPsu_StreamGenFifoWrite(InstancePtr, (u32)XQSPIPSU_GENFIFO_MODE_SPI |
+			Bus | XQSPIPSU_GENFIFO_CS_HOLD);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs the RX DMA for one chunk.
+*
+* @param	InstancePtr is a pointer to the XQspiPsu instance.
+* @param	Chunk is a pointer to the chunk to receive.
+*
+* @return	None
+*
+* @note		None.
+*
+******************************************************************************/
+static void XQspiPsu_StreamSetupDma(XQspiPsu *InstancePtr,
+			const XQspiPsu_StreamChunk *Chunk)
+{
+	u64 AddrTemp;
+
+	if (InstancePtr->Config.IsCacheCoherent == 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Chunk->BufPtr,
+				Chunk->ByteCount);
+	}
+
+	AddrTemp = (u64)((INTPTR)(Chunk->BufPtr) &
+				XQSPIPSU_QSPIDMA_DST_ADDR_MASK);
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+			XQSPIPSU_QSPIDMA_DST_ADDR_OFFSET, (u32)AddrTemp);
+
+#ifdef __aarch64__
+	AddrTemp = (u64)((INTPTR)(Chunk->BufPtr) >> 32);
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+			XQSPIPSU_QSPIDMA_DST_ADDR_MSB_OFFSET,
+			(u32)AddrTemp & XQSPIPSU_QSPIDMA_DST_ADDR_MSB_MASK);
+#endif
+
+	/* Writing the size starts the DMA */
+	XQspiPsu_WriteReg(InstancePtr->Config.BaseAddress,
+			XQSPIPSU_QSPIDMA_DST_SIZE_OFFSET, Chunk->ByteCount);
+}
+/** @} */
@@ -0,0 +1,498 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+ *
+ * @file xtrafgen_bandwidth_example.c
+ *
+ * This file contains a memory bandwidth benchmark built on the AXI Traffic
+ * Generator and the AXI Performance Monitor. The traffic generator is
+ * programmed with command lists that sweep the burst length, the size of
+ * each beat, the number of outstanding transactions and the address pattern,
+ * first for writes and then for reads. The performance monitor counts the
+ * bytes transferred on the slot the traffic generator drives and the clocks
+ * taken by each run. One CSV line is printed per run, with the header
+ *
+ *	dir,burst_beats,beat_bytes,outstanding,pattern,bytes,clocks,mb_per_s
+ *
+ * so the output can be captured on the host and compared against earlier
+ * runs to characterise a design or catch a regression.
+ *
+ * Each run uses BENCH_NUM_CMDS commands, each issued BENCH_REPEAT + 1 times
+ * through the repeat opcode. The number of outstanding transactions is
+ * limited by making command n depend on the completion of command
+ * n - outstanding; the traffic generator may allow fewer, depending on how
+ * the core is configured. The address patterns are:
+ *	- fixed:	all commands access the same burst.
+ *	- incr:		the commands walk the region sequentially.
+ *	- stride:	each command accesses one burst BENCH_STRIDE bytes
+ *			after the previous one, so consecutive commands fall
+ *			in different DRAM rows.
+ *
+ * @note
+ *
+ * The monitor slot set by BENCH_APM_SLOT must be connected to the master
+ * interface of the traffic generator, and the core must be configured in
+ * Full mode. The region at BENCH_MEM_BASE_ADDR, BENCH_REGION_SIZE bytes
+ * long, is overwritten. The monitor clock is given by APM_CLOCK_FREQ_HZ.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 4.3   ag   10/19/26 First release
+ * </pre>
+ *
+ * ***************************************************************************
+ */
+
+/***************************** Include Files *********************************/
+#include "xtrafgen.h"
+#include "xaxipmon.h"
+#include "xparameters.h"
+#include "xil_printf.h"
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * Address pattern of a run.
+ */
+typedef struct {
+	const char *Name;	/**< Name printed in the report */
+	u32 AddrMode;		/**< Address mode of the repeat opcode */
+	u32 Stride;		/**< Distance between commands, 0 for the
+				  *  size of one command */
+} BenchPattern;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define TRAFGEN_DEV_ID	XPAR_XTRAFGEN_0_DEVICE_ID
+#define AXIPMON_DEV_ID	XPAR_AXIPMON_0_DEVICE_ID
+
+#ifdef XPAR_V6DDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_V6DDR_0_S_AXI_BASEADDR
+#elif XPAR_S6DDR_0_S0_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_S6DDR_0_S0_AXI_BASEADDR
+#elif XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#define DDR_BASE_ADDR	XPAR_AXI_7SDDR_0_S_AXI_BASEADDR
+#elif XPAR_MIG_7SERIES_1_BASEADDR
+#define DDR_BASE_ADDR XPAR_MIG_7SERIES_1_BASEADDR
+#elif XPAR_MIG7SERIES_0_BASEADDR
+#define DDR_BASE_ADDR XPAR_MIG7SERIES_0_BASEADDR
+#endif
+
+#ifndef BENCH_MEM_BASE_ADDR
+#ifndef DDR_BASE_ADDR
+#warning CHECK FOR THE VALID DDR ADDRESS IN XPARAMETERS.H, \
+                        DEFAULT SET TO 0x01000000
+#define BENCH_MEM_BASE_ADDR	0x01000000
+#else
+#define BENCH_MEM_BASE_ADDR	(DDR_BASE_ADDR + 0x1000000)
+#endif
+#endif
+
+#ifndef APM_CLOCK_FREQ_HZ
+#define APM_CLOCK_FREQ_HZ	100000000U	/* Monitor clock */
+#endif
+
+#ifndef BENCH_APM_SLOT
+#define BENCH_APM_SLOT		0U	/* Monitor slot of the generator */
+#endif
+
+#define BENCH_NUM_CMDS		64U	/* Commands per run */
+#define BENCH_REPEAT		15U	/* Repeats of each command */
+#define BENCH_STRIDE		0x10000U /* Command distance, stride pattern */
+#define BENCH_REGION_SIZE	(BENCH_NUM_CMDS * BENCH_STRIDE)
+#define BENCH_MAX_BURST_BYTES	4096U	/* An AXI burst stays in 4 KB */
+#define BENCH_TIMEOUT		10000000U /* Polls before a run fails */
+
+#define BENCH_ARRAY_SIZE(a)	(sizeof(a) / sizeof((a)[0]))
+
+/************************** Function Prototypes ******************************/
+int XTrafGenBandwidthExample(u16 TrafGenDeviceId, u16 AxiPmonDeviceId);
+static int BenchRun(u8 RdWrFlag, u32 Beats, u32 Size, u32 Outstanding,
+			const BenchPattern *PatternPtr);
+static int BenchBuildCmds(u8 RdWrFlag, u32 Beats, u32 Size,
+			u32 Outstanding, const BenchPattern *PatternPtr);
+
+/************************** Variable Definitions *****************************/
+/*
+ * Device instance definitions
+ */
+XTrafGen XTrafGenInstance;
+XAxiPmon AxiPmonInstance;
+
+/*
+ * Metric counters of the written and read bytes
+ */
+static u32 WrCounter;
+static u32 RdCounter;
+
+/*
+ * Sweep parameters
+ */
+static const u32 BurstBeats[] = {1U, 4U, 16U, 64U, 256U};
+static const u32 Outstanding[] = {1U, 2U, 4U, 8U, 16U};
+static const BenchPattern Patterns[] = {
+	{"fixed", XTG_PARAM_OP_ADDRMODE_CONST, 0U},
+	{"incr", XTG_PARAM_OP_ADDRMODE_INCR, 0U},
+	{"stride", XTG_PARAM_OP_ADDRMODE_CONST, BENCH_STRIDE},
+};
+
+/*
+ * Best bandwidth seen in each direction, printed at the end
+ */
+static u32 PeakMbPerSec[2];
+
+/*****************************************************************************/
+/**
+*
+* Main function
+*
+* This function is the main entry of the bandwidth benchmark.
+*
+* @param        None
+*
+* @return
+*		- XST_SUCCESS if all runs completed
+*		- XST_FAILURE if a run failed.
+*
+* @note         None.
+*
+******************************************************************************/
+int main()
+{
+	int Status;
+
+	xil_printf("Entering main\n\r");
+
+	Status = XTrafGenBandwidthExample(TRAFGEN_DEV_ID, AXIPMON_DEV_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Traffic Generator Bandwidth Example Test Failed\n\r");
+		xil_printf("--- Exiting main() ---\n\r");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran Traffic Generator Bandwidth Example\n\r");
+	xil_printf("--- Exiting main() ---\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the benchmark.
+* It does the following:
+*	- Initialize the AXI Traffic Generator and the AXI Performance
+*	  Monitor
+*	- Assign the byte counts of the generator slot to metric counters
+*	- Run every combination of direction, burst length, beat size,
+*	  outstanding transactions and address pattern, printing one CSV
+*	  line per run
+*	- Print the best bandwidth of each direction
+*
+* @param	TrafGenDeviceId is the Device ID of the Axi Traffic Generator,
+*		typically XPAR_<TRAFGEN_instance>_DEVICE_ID value from
+*		xparameters.h.
+* @param	AxiPmonDeviceId is the Device ID of the AXI Performance
+*		Monitor, typically XPAR_<AXIPMON_instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return
+*		- XST_SUCCESS to indicate success
+*		- XST_FAILURE to indicate failure
+*
+******************************************************************************/
+int XTrafGenBandwidthExample(u16 TrafGenDeviceId, u16 AxiPmonDeviceId)
+{
+	XTrafGen_Config *Config;
+	XAxiPmon_Config *PmonConfig;
+	u32 MaxSize;
+	u32 Size;
+	u32 Beats;
+	u32 Outs;
+	u32 Pattern;
+	u8 RdWrFlag;
+	int Status;
+
+	Config = XTrafGen_LookupConfig(TrafGenDeviceId);
+	if (!Config) {
+		xil_printf("No config found for %d\r\n", TrafGenDeviceId);
+		return XST_FAILURE;
+	}
+
+	Status = XTrafGen_CfgInitialize(&XTrafGenInstance, Config,
+					Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Initialization failed\n\r");
+		return Status;
+	}
+
+	if (XTrafGenInstance.OperatingMode != XTG_MODE_FULL) {
+		xil_printf("Traffic Generator is not in Full mode\n\r");
+		return XST_FAILURE;
+	}
+
+	PmonConfig = XAxiPmon_LookupConfig(AxiPmonDeviceId);
+	if (PmonConfig == NULL) {
+		xil_printf("No config found for %d\r\n", AxiPmonDeviceId);
+		return XST_FAILURE;
+	}
+	XAxiPmon_CfgInitialize(&AxiPmonInstance, PmonConfig,
+				PmonConfig->BaseAddress);
+
+	/*
+	 * Count the written and read bytes of the traffic generator slot.
+	 * In Profile mode every slot has six fixed counters, the byte counts
+	 * being the third and the fourth.
+	 */
+	if (AxiPmonInstance.Mode == XAPM_MODE_ADVANCED) {
+		WrCounter = XAPM_METRIC_COUNTER_0;
+		RdCounter = XAPM_METRIC_COUNTER_1;
+		XAxiPmon_SetMetrics(&AxiPmonInstance, BENCH_APM_SLOT,
+				XAPM_METRIC_SET_2, XAPM_METRIC_COUNTER_0);
+		XAxiPmon_SetMetrics(&AxiPmonInstance, BENCH_APM_SLOT,
+				XAPM_METRIC_SET_3, XAPM_METRIC_COUNTER_1);
+	} else if (AxiPmonInstance.Mode == XAPM_MODE_PROFILE) {
+		WrCounter = (BENCH_APM_SLOT * 6U) + 2U;
+		RdCounter = (BENCH_APM_SLOT * 6U) + 3U;
+	} else {
+		xil_printf("Performance Monitor has no metric counters\n\r");
+		return XST_FAILURE;
+	}
+
+	/*
+	 * The widest beat is the width of the master interface
+	 */
+	MaxSize = 2U + XTrafGenInstance.MasterWidth;
+
+	xil_printf("dir,burst_beats,beat_bytes,outstanding,pattern,bytes,"
+			"clocks,mb_per_s\r\n");
+
+	for (RdWrFlag = XTG_WRITE; ; RdWrFlag = XTG_READ) {
+		for (Size = 2U; Size <= MaxSize; Size++) {
+		for (Beats = 0U; Beats < BENCH_ARRAY_SIZE(BurstBeats); Beats++) {
+			if ((BurstBeats[Beats] << Size) >
+					BENCH_MAX_BURST_BYTES) {
+				continue;
+			}
+		for (Outs = 0U; Outs < BENCH_ARRAY_SIZE(Outstanding); Outs++) {
+		for (Pattern = 0U; Pattern < BENCH_ARRAY_SIZE(Patterns);
+							Pattern++) {
+			Status = BenchRun(RdWrFlag, BurstBeats[Beats], Size,
+					Outstanding[Outs], &Patterns[Pattern]);
+			if (Status != XST_SUCCESS) {
+				return XST_FAILURE;
+			}
+		}
+		}
+		}
+		}
+
+		if (RdWrFlag == XTG_READ) {
+			break;
+		}
+	}
+
+	xil_printf("Peak write bandwidth %d MB/s, peak read bandwidth "
+			"%d MB/s\r\n", PeakMbPerSec[XTG_WRITE],
+			PeakMbPerSec[XTG_READ]);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs the traffic generator for one run, runs it while
+* the performance monitor counts, and prints the result.
+*
+* @param	RdWrFlag is XTG_WRITE or XTG_READ.
+* @param	Beats is the number of beats of each burst.
+* @param	Size is the AXI size of each beat, the beat is 2^Size bytes.
+* @param	Outstanding is the number of commands that may be in flight.
+* @param	PatternPtr is the address pattern.
+*
+* @return
+*		- XST_SUCCESS if the run completed
+*		- XST_FAILURE if programming failed, the generator reported an
+*		error, the run timed out or the monitor saw no traffic.
+*
+******************************************************************************/
+static int BenchRun(u8 RdWrFlag, u32 Beats, u32 Size, u32 Outstanding,
+			const BenchPattern *PatternPtr)
+{
+	u32 Timeout = BENCH_TIMEOUT;
+	u32 ClkHigh;
+	u32 ClkLow;
+	u32 Bytes;
+	u32 Error;
+	u32 MbPerSec;
+	int Status;
+
+	Status = BenchBuildCmds(RdWrFlag, Beats, Size, Outstanding,
+				PatternPtr);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Programming commands failed\n\r");
+		return XST_FAILURE;
+	}
+
+	XAxiPmon_ResetMetricCounter(&AxiPmonInstance);
+	XAxiPmon_ResetGlobalClkCounter(&AxiPmonInstance);
+	XAxiPmon_EnableGlobalClkCounter(&AxiPmonInstance);
+	XAxiPmon_EnableMetricsCounter(&AxiPmonInstance);
+
+	XTrafGen_StartMasterLogic(&XTrafGenInstance);
+
+	while (!XTrafGen_IsMasterLogicDone(&XTrafGenInstance)) {
+		Error = XTrafGen_ReadErrors(&XTrafGenInstance);
+		if (Error) {
+			XTrafGen_ClearErrors(&XTrafGenInstance, Error);
+			xil_printf("Traffic Generator error 0x%x\n\r", Error);
+			Timeout = 0U;
+		}
+		if (Timeout == 0U) {
+			break;
+		}
+		Timeout--;
+	}
+
+	XAxiPmon_DisableMetricsCounter(&AxiPmonInstance);
+	XAxiPmon_DisableGlobalClkCounter(&AxiPmonInstance);
+
+	if (Timeout == 0U) {
+		xil_printf("Run did not complete\n\r");
+		return XST_FAILURE;
+	}
+
+	XAxiPmon_GetGlobalClkCounter(&AxiPmonInstance, &ClkHigh, &ClkLow);
+	Bytes = XAxiPmon_GetMetricCounter(&AxiPmonInstance,
+			(RdWrFlag == XTG_WRITE) ? WrCounter : RdCounter);
+	if ((Bytes == 0U) || (ClkHigh != 0U) || (ClkLow == 0U)) {
+		xil_printf("Monitor slot %d sees no traffic\n\r",
+				BENCH_APM_SLOT);
+		return XST_FAILURE;
+	}
+
+	MbPerSec = (u32)(((u64)Bytes * APM_CLOCK_FREQ_HZ) /
+				((u64)ClkLow * 1000000U));
+	if (MbPerSec > PeakMbPerSec[RdWrFlag]) {
+		PeakMbPerSec[RdWrFlag] = MbPerSec;
+	}
+
+	xil_printf("%s,%d,%d,%d,%s,%d,%d,%d\r\n",
+			(RdWrFlag == XTG_WRITE) ? "wr" : "rd", Beats,
+			1U << Size, Outstanding, PatternPtr->Name, Bytes,
+			ClkLow, MbPerSec);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function replaces the command list of the traffic generator with the
+* commands of one run. The commands of the other direction are left empty.
+*
+* @param	RdWrFlag is XTG_WRITE or XTG_READ.
+* @param	Beats is the number of beats of each burst.
+* @param	Size is the AXI size of each beat.
+* @param	Outstanding is the number of commands that may be in flight.
+* @param	PatternPtr is the address pattern.
+*
+* @return
+*		- XST_SUCCESS if the commands are programmed
+*		- XST_FAILURE otherwise
+*
+******************************************************************************/
+static int BenchBuildCmds(u8 RdWrFlag, u32 Beats, u32 Size,
+			u32 Outstanding, const BenchPattern *PatternPtr)
+{
+	XTrafGen_Cmd Cmd;
+	u32 BurstBytes = Beats << Size;
+	u32 CmdSpan;
+	u32 Index;
+	int Status;
+
+	Status = XTrafGen_EraseAllCommands(&XTrafGenInstance);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	if (PatternPtr->Stride != 0U) {
+		CmdSpan = PatternPtr->Stride;
+	} else if (PatternPtr->AddrMode == XTG_PARAM_OP_ADDRMODE_INCR) {
+		CmdSpan = BurstBytes * (BENCH_REPEAT + 1U);
+	} else {
+		CmdSpan = 0U;
+	}
+
+	memset(&Cmd, 0, sizeof(Cmd));
+	Cmd.RdWrFlag = RdWrFlag;
+	Cmd.CRamCmd.Size = Size;
+	Cmd.CRamCmd.Burst = 0x1;		/* INCR */
+	Cmd.CRamCmd.Length = Beats - 1U;
+	Cmd.CRamCmd.ExpectedResp = 0x7;
+	Cmd.PRamCmd.Opcode = XTG_PARAM_OP_RPT;
+	Cmd.PRamCmd.OpCntl0 = BENCH_REPEAT;
+	Cmd.PRamCmd.AddrMode = PatternPtr->AddrMode;
+
+	for (Index = 0U; Index < BENCH_NUM_CMDS; Index++) {
+		Cmd.CRamCmd.Address = BENCH_MEM_BASE_ADDR + (Index * CmdSpan);
+		Cmd.CRamCmd.ValidCmd = 1;
+
+		/*
+		 * Depend numbers count from 1, 0 is no dependency
+		 */
+		Cmd.CRamCmd.MyDepend = (Index >= Outstanding) ?
+					(Index - Outstanding + 1U) : 0U;
+
+		Status = XTrafGen_AddCommand(&XTrafGenInstance, &Cmd);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	/* Add invalid command at the end of the queue */
+	Cmd.CRamCmd.Address = BENCH_MEM_BASE_ADDR;
+	Cmd.CRamCmd.ValidCmd = 0;
+	Cmd.CRamCmd.MyDepend = 0;
+	Cmd.PRamCmd.Opcode = XTG_PARAM_OP_NOP;
+	Status = XTrafGen_AddCommand(&XTrafGenInstance, &Cmd);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return XTrafGen_WriteCmdsToHw(&XTrafGenInstance);
+}
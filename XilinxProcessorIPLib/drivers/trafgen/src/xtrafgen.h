@@ -206,6 +206,8 @@
 *                    examples.
 * 4.2   ms  04/18/17 Modified tcl file to add suffix U for all macros
 *                    definitions of trafgen in xparameters.h
+* 4.3   ag  10/19/26 Added xtrafgen_bandwidth_example.c, a memory bandwidth
+*                    benchmark measured with the AXI Performance Monitor.
 * </pre>
 ******************************************************************************/
 
@@ -0,0 +1,216 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xzdma_dmamem_bench_example.c
+*
+* This file contains an example which compares the engines of the DMA
+* offloaded memory copy service of the standalone BSP (xil_dmamem.h). Copies
+* of several sizes are made by the processor and by each DMA engine present
+* in the design, every copy is verified and the time taken is reported in
+* timer ticks and MB/s. The size threshold of the service is set to zero so
+* that the engines are measured also below the default threshold; the
+* results show where the default threshold should be for the design.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.4   ag     10/19/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xparameters.h"
+#include "xil_dmamem.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/************************** Function Prototypes ******************************/
+
+int XZDma_DmaMemBenchExample(void);
+static int BenchOne(u32 Len, XTime *Ticks);
+
+/************************** Constant Definitions ******************************/
+
+#define MAX_COPY_LEN		(1024U * 1024U)	/**< Largest copy */
+#define MIN_COPY_LEN		256U	/**< Smallest copy */
+#define NUM_ITERATIONS		16U	/**< Copies per measurement */
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Variable Definitions *****************************/
+
+u8 SrcBuf[MAX_COPY_LEN] __attribute__ ((aligned (64)));
+u8 DstBuf[MAX_COPY_LEN] __attribute__ ((aligned (64)));
+
+static const char *const EngineName[XIL_DMAMEM_ENGINE_COUNT] = {
+	"CPU", "ZDMA", "CDMA", "PS DMA"
+};
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	/* Run the memcpy benchmark */
+	Status = XZDma_DmaMemBenchExample();
+	if (Status != XST_SUCCESS) {
+		xil_printf("DMA memcpy benchmark Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran DMA memcpy benchmark\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function measures every engine present in the design for copy sizes
+* from MIN_COPY_LEN to MAX_COPY_LEN and prints one line per engine and size.
+*
+* @return
+*		- XST_SUCCESS if all copies were correct.
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+int XZDma_DmaMemBenchExample(void)
+{
+	u32 DefaultEngine = Xil_DmaMemGetEngine();
+	u32 Engine;
+	u32 Len;
+	u32 Index;
+	u64 Rate;
+	XTime Ticks;
+	int Status = XST_SUCCESS;
+
+	for (Index = 0U; Index < MAX_COPY_LEN; Index++) {
+		SrcBuf[Index] = (u8)(Index ^ (Index >> 8));
+	}
+
+	Xil_DmaMemSetThreshold(0U);
+
+	xil_printf("engine, bytes, ticks per copy, MB/s\r\n");
+	for (Engine = 0U; Engine < XIL_DMAMEM_ENGINE_COUNT; Engine++) {
+		if (Xil_DmaMemSetEngine(Engine) != XST_SUCCESS) {
+			continue;
+		}
+
+		for (Len = MIN_COPY_LEN; Len <= MAX_COPY_LEN; Len <<= 2) {
+			if (BenchOne(Len, &Ticks) != XST_SUCCESS) {
+				xil_printf("%s: copy of %d bytes failed\r\n",
+					   EngineName[Engine], Len);
+				Status = XST_FAILURE;
+				continue;
+			}
+
+			Rate = 0U;
+			if (Ticks != 0U) {
+				Rate = ((u64)Len * NUM_ITERATIONS *
+					COUNTS_PER_SECOND) /
+					((u64)Ticks * 1000000U);
+			}
+			xil_printf("%s, %d, %d, %d\r\n", EngineName[Engine],
+				   Len, (u32)(Ticks / NUM_ITERATIONS),
+				   (u32)Rate);
+		}
+	}
+
+	Xil_DmaMemSetThreshold(XIL_DMAMEM_THRESHOLD);
+	(void)Xil_DmaMemSetEngine(DefaultEngine);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies Len bytes NUM_ITERATIONS times with the selected
+* engine and verifies the last copy.
+*
+* @param	Len is the number of bytes per copy.
+* @param	Ticks returns the timer ticks of all iterations.
+*
+* @return
+*		- XST_SUCCESS if the copies were correct.
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int BenchOne(u32 Len, XTime *Ticks)
+{
+	XTime Start;
+	XTime End;
+	u32 Iter;
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		DstBuf[Index] = 0U;
+	}
+
+	XTime_GetTime(&Start);
+	for (Iter = 0U; Iter < NUM_ITERATIONS; Iter++) {
+		if (Xil_DmaMemCpy(DstBuf, SrcBuf, Len) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+	*Ticks = End - Start;
+
+	for (Index = 0U; Index < Len; Index++) {
+		if (DstBuf[Index] != SrcBuf[Index]) {
+			return XST_FAILURE;
+		}
+	}
+
+	return XST_SUCCESS;
+}
@@ -0,0 +1,323 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xzdma_memcpy_async_example.c
+*
+* This file contains the example using XZDma driver as an asynchronous copy
+* engine. A prebuilt chain is first started twice without rebuilding its
+* descriptors, then a descriptor queue is set up on the channel and several
+* copies are queued with XZDma_MemCpyAsync() while it is running. The example
+* services the queue by polling, so no interrupt controller is needed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.4   ag     10/19/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+#include "xparameters.h"
+#include "xil_printf.h"
+
+/************************** Function Prototypes ******************************/
+
+int XZDma_MemCpyAsyncExample(u16 DeviceId);
+static void CopyDone(void *CallBackRef, s32 Status);
+static int WaitIdle(XZDma *InstancePtr);
+
+/************************** Constant Definitions ******************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#define ZDMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID /* ZDMA device Id */
+#define NUM_COPIES		8	/**< Copies queued at once */
+#define COPY_WORDS		256	/**< Words per copy */
+#define TESTDATA		0xABCD1230 /**< Test data */
+#define POLL_TIMEOUT		1000000U /**< Polling loop limit */
+
+/**************************** Type Definitions *******************************/
+
+
+/************************** Variable Definitions *****************************/
+
+XZDma ZDma;		/**<Instance of the ZDMA Device */
+XZDma_Queue Queue;	/**< Descriptor queue on the channel */
+
+u32 SrcBuf[NUM_COPIES][COPY_WORDS] __attribute__ ((aligned (64)));
+u32 DstBuf[NUM_COPIES][COPY_WORDS] __attribute__ ((aligned (64)));
+
+u8 QueueMem[NUM_COPIES * 64] __attribute__ ((aligned (64)));
+u8 ChainMem[2 * 64] __attribute__ ((aligned (64)));
+
+volatile u32 Completed = 0;
+volatile u32 Failed = 0;
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	/* Run the asynchronous memcpy example */
+	Status = XZDma_MemCpyAsyncExample((u16)ZDMA_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("ZDMA Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran ZDMA Async memcpy Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function builds a two element chain and starts it twice, then queues
+* a number of copies on a descriptor queue, services the queue until all of
+* them have completed and verifies the data.
+*
+* @param	DeviceId is the XPAR_<ZDMA Instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int XZDma_MemCpyAsyncExample(u16 DeviceId)
+{
+	int Status;
+	XZDma_Config *Config;
+	XZDma_Transfer Data[2];
+	XZDma_Chain Chain;
+	u32 Copy;
+	u32 Index;
+	u32 Timeout;
+	u32 Run;
+
+	/*
+	 * Initialize the ZDMA driver so that it's ready to use.
+	 * Look up the configuration in the config table,
+	 * then initialize it.
+	 */
+	Config = XZDma_LookupConfig(DeviceId);
+	if (NULL == Config) {
+		return XST_FAILURE;
+	}
+
+	Status = XZDma_CfgInitialize(&ZDma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/* Filling the buffers for data transfer */
+	for (Copy = 0; Copy < NUM_COPIES; Copy++) {
+		for (Index = 0; Index < COPY_WORDS; Index++) {
+			SrcBuf[Copy][Index] = TESTDATA + (Copy << 16) + Index;
+			DstBuf[Copy][Index] = 0;
+		}
+	}
+
+	/*
+	 * Prebuilt chain: the descriptors are written once and the chain is
+	 * started twice.
+	 */
+	Status = XZDma_SetMode(&ZDma, TRUE, XZDMA_NORMAL_MODE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Index = 0; Index < 2; Index++) {
+		Data[Index].SrcAddr = (UINTPTR)SrcBuf[Index];
+		Data[Index].DstAddr = (UINTPTR)DstBuf[NUM_COPIES - 1 - Index];
+		Data[Index].Size = sizeof(SrcBuf[Index]);
+		Data[Index].SrcCoherent = Config->IsCacheCoherent;
+		Data[Index].DstCoherent = Config->IsCacheCoherent;
+		Data[Index].Pause = 0;
+	}
+
+	Status = XZDma_ChainCreate(&ZDma, &Chain, (UINTPTR)ChainMem,
+					sizeof(ChainMem), Data, 2);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	for (Run = 0; Run < 2; Run++) {
+		if (!Config->IsCacheCoherent) {
+			for (Index = 0; Index < 2; Index++) {
+				Xil_DCacheFlushRange((INTPTR)Data[Index].SrcAddr,
+					Data[Index].Size);
+				Xil_DCacheInvalidateRange(
+					(INTPTR)Data[Index].DstAddr,
+					Data[Index].Size);
+			}
+		}
+
+		Status = XZDma_ChainStart(&ZDma, &Chain);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Status = WaitIdle(&ZDma);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	for (Index = 0; Index < 2; Index++) {
+		if (!Config->IsCacheCoherent) {
+			Xil_DCacheInvalidateRange((INTPTR)Data[Index].DstAddr,
+						Data[Index].Size);
+		}
+		for (Copy = 0; Copy < COPY_WORDS; Copy++) {
+			if (SrcBuf[Index][Copy] !=
+				DstBuf[NUM_COPIES - 1 - Index][Copy]) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	/* The queue takes over the channel and the descriptor memory */
+	Status = XZDma_QueueInit(&Queue, &ZDma, (UINTPTR)QueueMem,
+					sizeof(QueueMem));
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * The first copy starts the channel, the others are linked behind it
+	 * while it runs and are handed over when it pauses.
+	 */
+	for (Copy = 0; Copy < NUM_COPIES; Copy++) {
+		Status = XZDma_MemCpyAsync(&Queue, DstBuf[Copy], SrcBuf[Copy],
+				sizeof(SrcBuf[Copy]), CopyDone, &Queue);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	Timeout = POLL_TIMEOUT;
+	while ((XZDma_QueueIsIdle(&Queue) == FALSE) && (Timeout != 0U)) {
+		(void)XZDma_QueuePoll(&Queue);
+		Timeout--;
+	}
+	if ((Completed != NUM_COPIES) || (Failed != 0U)) {
+		return XST_FAILURE;
+	}
+
+	/* Validating the data transfer */
+	for (Copy = 0; Copy < NUM_COPIES; Copy++) {
+		for (Index = 0; Index < COPY_WORDS; Index++) {
+			if (SrcBuf[Copy][Index] != DstBuf[Copy][Index]) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This static function waits for the ZDMA done status of a chain by polling
+* and marks the channel idle again.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+*
+* @return
+*		- XST_SUCCESS if the chain completed.
+*		- XST_FAILURE on timeout.
+*
+* @note		None.
+*
+******************************************************************************/
+static int WaitIdle(XZDma *InstancePtr)
+{
+	u32 Timeout = POLL_TIMEOUT;
+
+	while (((XZDma_IntrGetStatus(InstancePtr) &
+			XZDMA_IXR_DMA_DONE_MASK) == 0U) && (Timeout != 0U)) {
+		Timeout--;
+	}
+	if (Timeout == 0U) {
+		return XST_FAILURE;
+	}
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_DMA_DONE_MASK);
+	InstancePtr->ChannelState = XZDMA_IDLE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This static function is called for every completed copy.
+*
+* @param	CallBackRef is the callback reference given on submission.
+* @param	Status is XST_SUCCESS if the copy completed.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void CopyDone(void *CallBackRef, s32 Status)
+{
+	if (Status == XST_SUCCESS) {
+		Completed++;
+	}
+	else {
+		Failed++;
+	}
+}
@@ -53,6 +53,8 @@
 *                        XZDma_SetChDataConfig API to set over fetch and
 *                        src issue parameters correctly.
 * 1.3   mus    08/14/17  Add CCI support for A53 in EL1 NS
+* 1.4   ag     10/19/26  Added XZDma_ChainCreate, XZDma_ChainUpdate and
+*                        XZDma_ChainStart for prebuilt descriptor chains.
 * </pre>
 *
 ******************************************************************************/
@@ -839,6 +841,166 @@ s32 XZDma_Start(XZDma *InstancePtr, XZDma_Transfer *Data, u32 Num)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function builds a linked list descriptor chain for the given transfers
+* in the memory provided by the application. The chain is written only once
+* and can then be started any number of times with XZDma_ChainStart(), which
+* avoids rebuilding the descriptors for recurring copies.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	ChainPtr is a pointer to the XZDma_Chain to be initialized.
+* @param	Dscr_MemPtr is a pointer to the memory for the descriptors.
+*		It should be aligned to 64 bytes.
+* @param	NoOfBytes specifies the number of bytes allocated for
+*		descriptors. Each transfer needs 64 bytes.
+* @param	Data is a pointer of array to the XZDma_Transfer structure
+*		describing the transfers of the chain. The Pause field is
+*		honoured as in XZDma_Start().
+* @param	Num specifies number of array elements of Data pointer.
+*
+* @return
+*		- XST_SUCCESS - if the chain has been built.
+*		- XST_FAILURE - if the memory cannot hold Num transfers.
+*
+* @note		The memory must not be used by XZDma_CreateBDList() or by a
+*		descriptor queue while the chain is in use.
+*
+******************************************************************************/
+s32 XZDma_ChainCreate(XZDma *InstancePtr, XZDma_Chain *ChainPtr,
+	UINTPTR Dscr_MemPtr, u32 NoOfBytes, XZDma_Transfer *Data, u32 Num)
+{
+	u32 Index;
+	u8 Last;
+	XZDma_LlDscr *SrcDscr = (XZDma_LlDscr *)(void *)Dscr_MemPtr;
+	XZDma_LlDscr *DstDscr;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ChainPtr != NULL);
+	Xil_AssertNonvoid(Dscr_MemPtr != 0x00U);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Num != 0x00U);
+
+	if (((NoOfBytes >> 1) / (u32)sizeof(XZDma_LlDscr)) < Num) {
+		Status = XST_FAILURE;
+		goto End;
+	}
+
+	DstDscr = SrcDscr + Num;
+	Last = FALSE;
+	for (Index = 0x00U; Index < Num; Index++) {
+		if (Index == (Num - 1U)) {
+			Last = TRUE;
+		}
+		XZDma_LinkedListMode(InstancePtr, &Data[Index],
+			&SrcDscr[Index], &DstDscr[Index], Last);
+	}
+
+	ChainPtr->SrcDscrPtr = SrcDscr;
+	ChainPtr->DstDscrPtr = DstDscr;
+	ChainPtr->Count = Num;
+	Status = XST_SUCCESS;
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function rewrites one transfer of a prebuilt descriptor chain, for
+* example to switch between double buffers. Only the two descriptors of the
+* element are written and flushed; the links of the chain are kept.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	ChainPtr is a pointer to the XZDma_Chain.
+* @param	Index is the position of the transfer in the chain.
+* @param	Data is a pointer to the new XZDma_Transfer values.
+*
+* @return
+*		- XST_SUCCESS - if the element has been updated.
+*		- XST_FAILURE - if the channel is busy.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_ChainUpdate(XZDma *InstancePtr, XZDma_Chain *ChainPtr, u32 Index,
+	XZDma_Transfer *Data)
+{
+	u8 Last;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ChainPtr != NULL);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Index < ChainPtr->Count);
+
+	if (InstancePtr->ChannelState == XZDMA_BUSY) {
+		Status = XST_FAILURE;
+	}
+	else {
+		if (Index == (ChainPtr->Count - 1U)) {
+			Last = TRUE;
+		}
+		else {
+			Last = FALSE;
+		}
+		XZDma_LinkedListMode(InstancePtr, Data,
+			&ChainPtr->SrcDscrPtr[Index],
+			&ChainPtr->DstDscrPtr[Index], Last);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts a descriptor chain built by XZDma_ChainCreate(). Only
+* the descriptor start addresses are programmed, the descriptors themselves
+* are not touched. Completion is reported through the done handler as for
+* XZDma_Start().
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	ChainPtr is a pointer to the XZDma_Chain to be started.
+*
+* @return
+*		- XST_SUCCESS - if ZDMA initiated the transfer.
+*		- XST_FAILURE - if the channel is not idle or not in scatter
+*		gather mode.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_ChainStart(XZDma *InstancePtr, XZDma_Chain *ChainPtr)
+{
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ChainPtr != NULL);
+	Xil_AssertNonvoid(ChainPtr->Count != 0x00U);
+
+	if ((InstancePtr->ChannelState != XZDMA_IDLE) ||
+			(InstancePtr->IsSgDma != TRUE)) {
+		Status = XST_FAILURE;
+	}
+	else {
+		XZDma_SetDscrStart(InstancePtr,
+			(UINTPTR)ChainPtr->SrcDscrPtr,
+			(UINTPTR)ChainPtr->DstDscrPtr);
+		XZDma_Enable(InstancePtr);
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -963,22 +1125,9 @@ static void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 		} while(Count < Num);
 	}
 
-	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
-		XZDMA_CH_SRC_START_LSB_OFFSET,
-		((UINTPTR)(InstancePtr->Descriptor.SrcDscrPtr) &
-					XZDMA_WORD0_LSB_MASK));
-	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
-		XZDMA_CH_SRC_START_MSB_OFFSET,
-		(((u64)(UINTPTR)(InstancePtr->Descriptor.SrcDscrPtr) >>
-			XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
-	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
-		XZDMA_CH_DST_START_LSB_OFFSET,
-		((UINTPTR)(InstancePtr->Descriptor.DstDscrPtr) &
-					XZDMA_WORD0_LSB_MASK));
-	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
-		XZDMA_CH_DST_START_MSB_OFFSET,
-		(((u64)(UINTPTR)(InstancePtr->Descriptor.DstDscrPtr) >>
-			XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+	XZDma_SetDscrStart(InstancePtr,
+		(UINTPTR)(InstancePtr->Descriptor.SrcDscrPtr),
+		(UINTPTR)(InstancePtr->Descriptor.DstDscrPtr));
 }
 
 /*****************************************************************************/
@@ -76,6 +76,26 @@
 * functions by using XZDma_SetCallBack API. In this version Descriptor done
 * option is disabled.
 *
+* <b> Descriptor queue and prebuilt chains </b>
+*
+* XZDma_Start() rebuilds the descriptors for every call and only one set of
+* transfers can be outstanding on a channel. For recurring copies the driver
+* provides prebuilt linked list chains: XZDma_ChainCreate() writes the
+* descriptors once into application memory and XZDma_ChainStart() only
+* programs the start addresses, so the same chain can be started any number
+* of times. XZDma_ChainUpdate() patches one element of a prebuilt chain.
+*
+* To use a channel as a general purpose offload copy engine, the descriptor
+* memory can be handed over to a XZDma_Queue with XZDma_QueueInit(). The
+* queue keeps a circular linked list of descriptors and accepts new transfers
+* through XZDma_QueueSubmit() or XZDma_MemCpyAsync() while the channel is
+* running. Every handed over batch ends with a pause command; transfers queued
+* in the meantime are linked behind it and the channel is continued from the
+* first of them when it pauses. Completions are counted with the destination
+* interrupt accounting register and reported per transfer through the
+* callback given at submission, either from XZDma_QueueIntrHandler() or from
+* XZDma_QueuePoll() when interrupts are not used.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -124,6 +144,9 @@
 *                        in doxygen.
 * 1.3   mus     08/14/17 Update cache coherency information of the interface in
 *                        its config structure.
+* 1.4   ag      10/19/26 Added prebuilt descriptor chains, a persistent
+*                        descriptor queue which accepts transfers while the
+*                        channel is running and XZDma_MemCpyAsync.
 * </pre>
 *
 ******************************************************************************/
@@ -144,6 +167,25 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+/** @name Descriptor queue
+ * @{
+ */
+#ifndef XZDMA_QUEUE_MAX_DSCR
+#define XZDMA_QUEUE_MAX_DSCR	64U	/**< Maximum number of transfers
+					  *  outstanding on a queue, should not
+					  *  exceed the width of the interrupt
+					  *  accounting register (255) */
+#endif
+
+#define XZDMA_QUEUE_INTR_MASK	(XZDMA_IXR_DMA_PAUSE_MASK | \
+				XZDMA_IXR_DMA_DONE_MASK | \
+				XZDMA_IXR_DST_DSCR_DONE_MASK | \
+				XZDMA_IXR_AXI_WR_DATA_MASK | \
+				XZDMA_IXR_AXI_RD_DATA_MASK | \
+				XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+				XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+					/**< Interrupts used by the queue */
+/*@}*/
 
 /**************************** Type Definitions *******************************/
 
@@ -360,6 +402,69 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+*
+* This typedef contains a prebuilt linked list descriptor chain. The
+* descriptors live in application memory and are written once by
+* XZDma_ChainCreate(), so the chain can be started repeatedly.
+*/
+typedef struct {
+	XZDma_LlDscr *SrcDscrPtr;	/**< First source descriptor */
+	XZDma_LlDscr *DstDscrPtr;	/**< First destination descriptor */
+	u32 Count;			/**< Number of transfers in the chain */
+} XZDma_Chain;
+
+/******************************************************************************/
+/**
+* Callback type for completion of a transfer submitted to a descriptor queue.
+*
+* @param 	CallBackRef is the callback reference given when the transfer
+*		was submitted.
+* @param	Status is XST_SUCCESS if the transfer completed or XST_FAILURE
+*		if the channel stopped on an AXI error before it completed.
+*******************************************************************************/
+typedef void (*XZDma_QueueHandler) (void *CallBackRef, s32 Status);
+
+/******************************************************************************/
+/**
+*
+* This typedef contains the per transfer bookkeeping of a descriptor queue.
+*/
+typedef struct {
+	XZDma_QueueHandler Handler;	/**< Completion callback */
+	void *CallBackRef;		/**< Passed to the completion callback */
+	UINTPTR DstAddr;		/**< Destination of the transfer */
+	u32 Size;			/**< Size of the transfer */
+	u8 CacheMaint;			/**< Destination is invalidated on
+					  *  completion */
+} XZDma_QueueEntry;
+
+/******************************************************************************/
+/**
+*
+* This typedef contains the state of a persistent descriptor queue. The
+* descriptors form a ring; slots between Head and HwTail are owned by the
+* channel, slots between HwTail and Tail are queued and will be handed over
+* when the channel pauses.
+*/
+typedef struct {
+	XZDma *InstancePtr;		/**< Channel serving the queue */
+	XZDma_LlDscr *SrcDscrPtr;	/**< Source descriptor ring */
+	XZDma_LlDscr *DstDscrPtr;	/**< Destination descriptor ring */
+	u32 Count;			/**< Number of slots in the ring */
+	u32 Head;			/**< Oldest slot not yet completed */
+	u32 HwTail;			/**< First slot not handed to the
+					  *  channel */
+	u32 Tail;			/**< First free slot */
+	u32 InFlight;			/**< Slots owned by the channel */
+	u32 Staged;			/**< Slots waiting for the channel */
+	XZDmaState HwState;		/**< State of the channel as seen by
+					  *  the queue */
+	XZDma_QueueEntry Entry[XZDMA_QUEUE_MAX_DSCR];
+					/**< Per slot bookkeeping */
+} XZDma_Queue;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -672,6 +777,60 @@ typedef struct {
 	XZDma_WriteReg((InstancePtr)->Config.BaseAddress,\
 		(XZDMA_CH_CTRL2_OFFSET), (XZDMA_CH_CTRL2_DIS_MASK))
 
+/*****************************************************************************/
+/**
+*
+* This function programs the start addresses of the first source and
+* destination descriptors used in scatter gather mode.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	SrcDscr is the address of the first source descriptor.
+* @param	DstDscr is the address of the first destination descriptor.
+*
+* @return	None.
+*
+* @note		None.
+*		C-style signature:
+*		void XZDma_SetDscrStart(XZDma *InstancePtr, UINTPTR SrcDscr,
+*					UINTPTR DstDscr)
+*
+******************************************************************************/
+#define XZDma_SetDscrStart(InstancePtr, SrcDscr, DstDscr) \
+do { \
+	XZDma_WriteReg((InstancePtr)->Config.BaseAddress, \
+		XZDMA_CH_SRC_START_LSB_OFFSET, \
+		((UINTPTR)(SrcDscr) & XZDMA_WORD0_LSB_MASK)); \
+	XZDma_WriteReg((InstancePtr)->Config.BaseAddress, \
+		XZDMA_CH_SRC_START_MSB_OFFSET, \
+		(((u64)(UINTPTR)(SrcDscr) >> XZDMA_WORD1_MSB_SHIFT) & \
+		XZDMA_WORD1_MSB_MASK)); \
+	XZDma_WriteReg((InstancePtr)->Config.BaseAddress, \
+		XZDMA_CH_DST_START_LSB_OFFSET, \
+		((UINTPTR)(DstDscr) & XZDMA_WORD0_LSB_MASK)); \
+	XZDma_WriteReg((InstancePtr)->Config.BaseAddress, \
+		XZDMA_CH_DST_START_MSB_OFFSET, \
+		(((u64)(UINTPTR)(DstDscr) >> XZDMA_WORD1_MSB_SHIFT) & \
+		XZDMA_WORD1_MSB_MASK)); \
+} while (0)
+
+/*****************************************************************************/
+/**
+*
+* This function reports whether all transfers submitted to a descriptor
+* queue have completed.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+*
+* @return	TRUE if no transfer is outstanding, FALSE otherwise.
+*
+* @note		None.
+*		C-style signature:
+*		u8 XZDma_QueueIsIdle(XZDma_Queue *QueuePtr)
+*
+******************************************************************************/
+#define XZDma_QueueIsIdle(QueuePtr) \
+	((((QueuePtr)->InFlight + (QueuePtr)->Staged) == 0U) ? TRUE : FALSE)
+
 /************************ Prototypes of functions **************************/
 
 XZDma_Config *XZDma_LookupConfig(u16 DeviceId);
@@ -697,6 +856,21 @@ void XZDma_IntrHandler(void *Instance);
 s32 XZDma_SetCallBack(XZDma *InstancePtr, XZDma_Handler HandlerType,
 	void *CallBackFunc, void *CallBackRef);
 
+s32 XZDma_ChainCreate(XZDma *InstancePtr, XZDma_Chain *ChainPtr,
+	UINTPTR Dscr_MemPtr, u32 NoOfBytes, XZDma_Transfer *Data, u32 Num);
+s32 XZDma_ChainUpdate(XZDma *InstancePtr, XZDma_Chain *ChainPtr, u32 Index,
+	XZDma_Transfer *Data);
+s32 XZDma_ChainStart(XZDma *InstancePtr, XZDma_Chain *ChainPtr);
+
+s32 XZDma_QueueInit(XZDma_Queue *QueuePtr, XZDma *InstancePtr,
+	UINTPTR Dscr_MemPtr, u32 NoOfBytes);
+s32 XZDma_QueueSubmit(XZDma_Queue *QueuePtr, XZDma_Transfer *Data,
+	XZDma_QueueHandler Handler, void *CallBackRef);
+s32 XZDma_MemCpyAsync(XZDma_Queue *QueuePtr, void *Dst, const void *Src,
+	u32 Len, XZDma_QueueHandler Handler, void *CallBackRef);
+u32 XZDma_QueuePoll(XZDma_Queue *QueuePtr);
+void XZDma_QueueIntrHandler(void *Queue);
+
 /*@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,551 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xzdma_queue.c
+* @addtogroup zdma_v1_0
+* @{
+*
+* This file contains the persistent descriptor queue of the ZDMA driver, which
+* lets a channel act as an asynchronous copy engine. Transfers can be queued
+* while the channel is running and complete through per transfer callbacks.
+* Please see xzdma.h for more details of the driver.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.4   ag     10/19/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+#define XZDMA_QUEUE_NEXT(QueuePtr, Slot) \
+	((((Slot) + 1U) == (QueuePtr)->Count) ? 0U : ((Slot) + 1U))
+
+#define XZDMA_QUEUE_AXI_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+					XZDMA_IXR_AXI_RD_DATA_MASK | \
+					XZDMA_IXR_AXI_RD_DST_DSCR_MASK | \
+					XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)
+
+/************************** Function Prototypes ******************************/
+
+static s32 XZDma_QueueAdd(XZDma_Queue *QueuePtr, XZDma_Transfer *Data,
+	XZDma_QueueHandler Handler, void *CallBackRef, u8 CacheMaint);
+static void XZDma_QueueKick(XZDma_Queue *QueuePtr);
+static u32 XZDma_QueueComplete(XZDma_Queue *QueuePtr, u32 Num, s32 Status);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a persistent descriptor queue on a ZDMA channel.
+* The descriptor memory is turned into a circular linked list and the channel
+* is switched to scatter gather mode.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue to be initialized.
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	Dscr_MemPtr is a pointer to the allocated memory for
+*		descriptors. It should be aligned to 64 bytes.
+* @param	NoOfBytes specifies the number of bytes allocated for
+*		descriptors. Each queue slot needs 64 bytes and at most
+*		XZDMA_QUEUE_MAX_DSCR slots are used.
+*
+* @return
+*		- XST_SUCCESS - if the queue has been initialized.
+*		- XST_FAILURE - if the channel is not idle or the memory
+*		cannot hold a single slot.
+*
+* @note		The queue owns the channel from here on; XZDma_Start() and
+*		XZDma_ChainStart() must not be used on it. Errors are reported
+*		through the error handler installed with XZDma_SetCallBack().
+*
+******************************************************************************/
+s32 XZDma_QueueInit(XZDma_Queue *QueuePtr, XZDma *InstancePtr,
+	UINTPTR Dscr_MemPtr, u32 NoOfBytes)
+{
+	u32 Index;
+	u32 Next;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady ==
+				(u32)(XIL_COMPONENT_IS_READY));
+	Xil_AssertNonvoid(Dscr_MemPtr != 0x00U);
+	Xil_AssertNonvoid(NoOfBytes != 0x00U);
+
+	Status = XZDma_SetMode(InstancePtr, TRUE, XZDMA_NORMAL_MODE);
+	if (Status != XST_SUCCESS) {
+		goto End;
+	}
+
+	QueuePtr->Count = XZDma_CreateBDList(InstancePtr, XZDMA_LINKEDLIST,
+					Dscr_MemPtr, NoOfBytes);
+	if (QueuePtr->Count == 0x00U) {
+		Status = XST_FAILURE;
+		goto End;
+	}
+	if (QueuePtr->Count > XZDMA_QUEUE_MAX_DSCR) {
+		QueuePtr->Count = XZDMA_QUEUE_MAX_DSCR;
+	}
+
+	QueuePtr->InstancePtr = InstancePtr;
+	QueuePtr->SrcDscrPtr =
+		(XZDma_LlDscr *)(void *)InstancePtr->Descriptor.SrcDscrPtr;
+	QueuePtr->DstDscrPtr =
+		(XZDma_LlDscr *)(void *)InstancePtr->Descriptor.DstDscrPtr;
+	QueuePtr->Head = 0x00U;
+	QueuePtr->HwTail = 0x00U;
+	QueuePtr->Tail = 0x00U;
+	QueuePtr->InFlight = 0x00U;
+	QueuePtr->Staged = 0x00U;
+	QueuePtr->HwState = XZDMA_IDLE;
+
+	/*
+	 * The links are written once here and never change, so the channel
+	 * can walk across the end of the ring without any help.
+	 */
+	for (Index = 0x00U; Index < QueuePtr->Count; Index++) {
+		Next = XZDMA_QUEUE_NEXT(QueuePtr, Index);
+
+		QueuePtr->SrcDscrPtr[Index].Address = 0x00U;
+		QueuePtr->SrcDscrPtr[Index].Size = 0x00U;
+		QueuePtr->SrcDscrPtr[Index].Cntl = XZDMA_WORD3_CMD_STOP_MASK |
+						XZDMA_WORD3_TYPE_MASK;
+		QueuePtr->SrcDscrPtr[Index].NextDscr =
+			(u64)(UINTPTR)&QueuePtr->SrcDscrPtr[Next];
+		QueuePtr->SrcDscrPtr[Index].Reserved = 0x00U;
+
+		QueuePtr->DstDscrPtr[Index].Address = 0x00U;
+		QueuePtr->DstDscrPtr[Index].Size = 0x00U;
+		QueuePtr->DstDscrPtr[Index].Cntl = XZDMA_WORD3_TYPE_MASK;
+		QueuePtr->DstDscrPtr[Index].NextDscr =
+			(u64)(UINTPTR)&QueuePtr->DstDscrPtr[Next];
+		QueuePtr->DstDscrPtr[Index].Reserved = 0x00U;
+
+		QueuePtr->Entry[Index].Handler = NULL;
+		QueuePtr->Entry[Index].CallBackRef = NULL;
+	}
+	Xil_DCacheFlushRange((UINTPTR)QueuePtr->SrcDscrPtr,
+		QueuePtr->Count * sizeof(XZDma_LlDscr));
+	Xil_DCacheFlushRange((UINTPTR)QueuePtr->DstDscrPtr,
+		QueuePtr->Count * sizeof(XZDma_LlDscr));
+
+	XZDma_EnableIntr(InstancePtr, XZDMA_QUEUE_INTR_MASK);
+
+	/* Drop any completion count left over from earlier transfers */
+	(void)XZDma_GetDstIntrCnt(InstancePtr);
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function queues a transfer on a descriptor queue. If the channel is
+* running, the transfer is linked behind the outstanding ones and handed over
+* when the channel pauses at the end of the current batch; otherwise the
+* channel is started or continued right away.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+* @param	Data is a pointer to the XZDma_Transfer describing the copy.
+*		The Pause field is ignored, the queue controls the descriptor
+*		commands itself.
+* @param	Handler is called when the transfer has completed. It may be
+*		NULL.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS - if the transfer has been queued.
+*		- XST_DEVICE_BUSY - if all slots of the queue are in use.
+*		- XST_INVALID_PARAM - if the size of the transfer is invalid.
+*
+* @note		Cache maintenance of the buffers is left to the caller, as for
+*		XZDma_Start(). When the queue is also serviced from interrupt
+*		context, the caller must disable the ZDMA interrupt around this
+*		call.
+*
+******************************************************************************/
+s32 XZDma_QueueSubmit(XZDma_Queue *QueuePtr, XZDma_Transfer *Data,
+	XZDma_QueueHandler Handler, void *CallBackRef)
+{
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Data != NULL);
+
+	return XZDma_QueueAdd(QueuePtr, Data, Handler, CallBackRef, FALSE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function copies Len bytes from Src to Dst asynchronously on a
+* descriptor queue, in the manner of memcpy(). The caches of both buffers
+* are maintained by the driver when the interface is not cache coherent:
+* the buffers are flushed here and the destination is invalidated again
+* before Handler is called.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+* @param	Dst is the destination buffer.
+* @param	Src is the source buffer.
+* @param	Len is the number of bytes to copy.
+* @param	Handler is called when the copy has completed. It may be NULL.
+* @param	CallBackRef is passed to Handler.
+*
+* @return
+*		- XST_SUCCESS - if the copy has been queued.
+*		- XST_DEVICE_BUSY - if all slots of the queue are in use.
+*		- XST_INVALID_PARAM - if Len is zero or too large.
+*
+* @note		The buffers must not be accessed by the processor until the
+*		completion callback has been invoked.
+*
+******************************************************************************/
+s32 XZDma_MemCpyAsync(XZDma_Queue *QueuePtr, void *Dst, const void *Src,
+	u32 Len, XZDma_QueueHandler Handler, void *CallBackRef)
+{
+	XZDma_Transfer Data;
+	u8 Coherent;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+	Xil_AssertNonvoid(Dst != NULL);
+	Xil_AssertNonvoid(Src != NULL);
+
+	Coherent = QueuePtr->InstancePtr->Config.IsCacheCoherent;
+
+	Data.SrcAddr = (UINTPTR)Src;
+	Data.DstAddr = (UINTPTR)Dst;
+	Data.Size = Len;
+	Data.SrcCoherent = (Coherent != 0U) ? TRUE : FALSE;
+	Data.DstCoherent = (Coherent != 0U) ? TRUE : FALSE;
+	Data.Pause = FALSE;
+
+	return XZDma_QueueAdd(QueuePtr, &Data, Handler, CallBackRef,
+				(Coherent != 0U) ? FALSE : TRUE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function services a descriptor queue without interrupts. Completed
+* transfers are reported through their callbacks and transfers queued while
+* the channel was running are handed over once it has paused.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+*
+* @return	The number of transfers completed by this call.
+*
+* @note		The same processing is done by XZDma_QueueIntrHandler(), only
+*		one of the two should be used for a queue.
+*
+******************************************************************************/
+u32 XZDma_QueuePoll(XZDma_Queue *QueuePtr)
+{
+	XZDma *InstancePtr;
+	u32 PendingIntr;
+	u32 ErrorStatus;
+	u32 Done;
+	u32 Completed;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(QueuePtr != NULL);
+
+	InstancePtr = QueuePtr->InstancePtr;
+
+	PendingIntr = (u32)XZDma_IntrGetStatus(InstancePtr) &
+						XZDMA_QUEUE_INTR_MASK;
+	XZDma_IntrClear(InstancePtr, PendingIntr);
+
+	/* Destination descriptors completed since the last call */
+	Done = XZDma_GetDstIntrCnt(InstancePtr) & XZDMA_CH_IRQ_ACCT_MASK;
+
+	if ((PendingIntr & (XZDMA_IXR_DMA_PAUSE_MASK |
+				XZDMA_IXR_DMA_DONE_MASK)) != 0x00U) {
+		/*
+		 * The channel stops at the tail of a batch only after all of
+		 * its descriptors have been processed.
+		 */
+		Done = QueuePtr->InFlight;
+		if ((PendingIntr & XZDMA_IXR_DMA_PAUSE_MASK) != 0x00U) {
+			QueuePtr->HwState = XZDMA_PAUSE;
+		}
+		else {
+			QueuePtr->HwState = XZDMA_IDLE;
+		}
+		InstancePtr->ChannelState = QueuePtr->HwState;
+	}
+
+	ErrorStatus = PendingIntr & XZDMA_QUEUE_AXI_ERR_MASK;
+	if (ErrorStatus != 0x00U) {
+		QueuePtr->HwState = XZDMA_IDLE;
+		InstancePtr->ChannelState = XZDMA_IDLE;
+	}
+
+	if (Done > QueuePtr->InFlight) {
+		Done = QueuePtr->InFlight;
+	}
+	Completed = XZDma_QueueComplete(QueuePtr, Done, XST_SUCCESS);
+
+	if (ErrorStatus != 0x00U) {
+		/* The channel has stopped, the rest of the batch is lost */
+		Completed += XZDma_QueueComplete(QueuePtr,
+					QueuePtr->InFlight, XST_FAILURE);
+		InstancePtr->ErrorHandler(InstancePtr->ErrorRef, ErrorStatus);
+	}
+
+	if ((QueuePtr->HwState != XZDMA_BUSY) && (QueuePtr->Staged != 0x00U)) {
+		XZDma_QueueKick(QueuePtr);
+	}
+
+	return Completed;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler for a ZDMA channel used through a
+* descriptor queue. It should be connected to the interrupt system instead
+* of XZDma_IntrHandler(), with the queue as callback reference.
+*
+* @param	Queue is a pointer to the XZDma_Queue instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XZDma_QueueIntrHandler(void *Queue)
+{
+	XZDma_Queue *QueuePtr = (XZDma_Queue *)((void *)Queue);
+
+	/* Verify arguments. */
+	Xil_AssertVoid(QueuePtr != NULL);
+
+	(void)XZDma_QueuePoll(QueuePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function writes a transfer into the next free slot of the
+* queue and makes it the new tail of the staged transfers. Descriptors owned
+* by the channel are never modified: the staged tail carries the pause
+* command and is only turned into a plain link while it is still staged.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+* @param	Data is a pointer to the XZDma_Transfer describing the copy.
+* @param	Handler is the completion callback.
+* @param	CallBackRef is passed to Handler.
+* @param	CacheMaint specifies whether the buffer caches are maintained
+*		by the driver.
+*
+* @return	XST_SUCCESS, XST_DEVICE_BUSY or XST_INVALID_PARAM.
+*
+* @note		None.
+*
+******************************************************************************/
+static s32 XZDma_QueueAdd(XZDma_Queue *QueuePtr, XZDma_Transfer *Data,
+	XZDma_QueueHandler Handler, void *CallBackRef, u8 CacheMaint)
+{
+	XZDma_LlDscr *SrcDscr;
+	XZDma_LlDscr *DstDscr;
+	XZDma_QueueEntry *Entry;
+	u32 Slot = QueuePtr->Tail;
+	u32 Prev;
+	u32 Value;
+	s32 Status;
+
+	if ((Data->Size == 0x00U) || (Data->Size > XZDMA_WORD2_SIZE_MASK)) {
+		Status = XST_INVALID_PARAM;
+		goto End;
+	}
+	if ((QueuePtr->InFlight + QueuePtr->Staged) >= QueuePtr->Count) {
+		Status = XST_DEVICE_BUSY;
+		goto End;
+	}
+
+	if (CacheMaint == TRUE) {
+		Xil_DCacheFlushRange((INTPTR)Data->SrcAddr, Data->Size);
+		Xil_DCacheFlushRange((INTPTR)Data->DstAddr, Data->Size);
+	}
+
+	SrcDscr = &QueuePtr->SrcDscrPtr[Slot];
+	DstDscr = &QueuePtr->DstDscrPtr[Slot];
+
+	Value = XZDMA_WORD3_CMD_PAUSE_MASK | XZDMA_WORD3_TYPE_MASK;
+	if (Data->SrcCoherent == TRUE) {
+		Value |= XZDMA_WORD3_COHRNT_MASK;
+	}
+	SrcDscr->Address = (u64)Data->SrcAddr;
+	SrcDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+	SrcDscr->Cntl = Value;
+	Xil_DCacheFlushRange((UINTPTR)SrcDscr, sizeof(XZDma_LlDscr));
+
+	/* Every destination descriptor is counted in the accounting register */
+	Value = XZDMA_WORD3_INTR_MASK | XZDMA_WORD3_TYPE_MASK;
+	if (Data->DstCoherent == TRUE) {
+		Value |= XZDMA_WORD3_COHRNT_MASK;
+	}
+	DstDscr->Address = (u64)Data->DstAddr;
+	DstDscr->Size = Data->Size & XZDMA_WORD2_SIZE_MASK;
+	DstDscr->Cntl = Value;
+	Xil_DCacheFlushRange((UINTPTR)DstDscr, sizeof(XZDma_LlDscr));
+
+	Entry = &QueuePtr->Entry[Slot];
+	Entry->Handler = Handler;
+	Entry->CallBackRef = CallBackRef;
+	Entry->DstAddr = Data->DstAddr;
+	Entry->Size = Data->Size;
+	Entry->CacheMaint = CacheMaint;
+
+	/* Link the previous staged tail to the new one */
+	if (QueuePtr->Staged != 0x00U) {
+		Prev = (Slot == 0x00U) ? (QueuePtr->Count - 1U) : (Slot - 1U);
+		SrcDscr = &QueuePtr->SrcDscrPtr[Prev];
+		SrcDscr->Cntl &= ~XZDMA_WORD3_CMD_MASK;
+		Xil_DCacheFlushRange((UINTPTR)SrcDscr, sizeof(XZDma_LlDscr));
+	}
+
+	QueuePtr->Tail = XZDMA_QUEUE_NEXT(QueuePtr, Slot);
+	QueuePtr->Staged++;
+
+	if (QueuePtr->HwState != XZDMA_BUSY) {
+		XZDma_QueueKick(QueuePtr);
+	}
+	Status = XST_SUCCESS;
+
+End:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function hands the staged transfers over to the channel. A
+* paused channel is continued from the start address registers, which point
+* at the first staged slot, so a stale prefetched link is never followed. An
+* idle channel is enabled as in XZDma_Start().
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_QueueKick(XZDma_Queue *QueuePtr)
+{
+	XZDma *InstancePtr = QueuePtr->InstancePtr;
+	XZDmaState State = QueuePtr->HwState;
+	u32 Value;
+
+	XZDma_SetDscrStart(InstancePtr,
+		(UINTPTR)&QueuePtr->SrcDscrPtr[QueuePtr->HwTail],
+		(UINTPTR)&QueuePtr->DstDscrPtr[QueuePtr->HwTail]);
+
+	QueuePtr->InFlight += QueuePtr->Staged;
+	QueuePtr->Staged = 0x00U;
+	QueuePtr->HwTail = QueuePtr->Tail;
+	QueuePtr->HwState = XZDMA_BUSY;
+
+	if (State == XZDMA_PAUSE) {
+		InstancePtr->ChannelState = XZDMA_BUSY;
+		Value = XZDma_ReadReg(InstancePtr->Config.BaseAddress,
+					XZDMA_CH_CTRL0_OFFSET);
+		Value |= XZDMA_CTRL0_CONT_ADDR_MASK | XZDMA_CTRL0_CONT_MASK;
+		XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+					XZDMA_CH_CTRL0_OFFSET, Value);
+	}
+	else {
+		/* The channel may have been reset after an error */
+		InstancePtr->ChannelState = XZDMA_IDLE;
+		(void)XZDma_SetMode(InstancePtr, TRUE, XZDMA_NORMAL_MODE);
+		XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+			XZDMA_CH_IEN_OFFSET,
+			(InstancePtr->IntrMask & XZDMA_IXR_ALL_INTR_MASK));
+		InstancePtr->ChannelState = XZDMA_BUSY;
+		XZDma_EnableCh(InstancePtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function retires the oldest transfers owned by the channel and
+* calls their completion callbacks. The queue is updated before each
+* callback so new transfers may be submitted from within it.
+*
+* @param	QueuePtr is a pointer to the XZDma_Queue instance.
+* @param	Num is the number of transfers to retire.
+* @param	Status is passed to the completion callbacks.
+*
+* @return	The number of transfers retired.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XZDma_QueueComplete(XZDma_Queue *QueuePtr, u32 Num, s32 Status)
+{
+	XZDma_QueueEntry *Entry;
+	u32 Count;
+
+	for (Count = 0x00U; Count < Num; Count++) {
+		Entry = &QueuePtr->Entry[QueuePtr->Head];
+		QueuePtr->Head = XZDMA_QUEUE_NEXT(QueuePtr, QueuePtr->Head);
+		QueuePtr->InFlight--;
+
+		if (Entry->CacheMaint == TRUE) {
+			Xil_DCacheInvalidateRange((INTPTR)Entry->DstAddr,
+							Entry->Size);
+		}
+		if (Entry->Handler != NULL) {
+			Entry->Handler(Entry->CallBackRef, Status);
+		}
+	}
+
+	return Count;
+}
+/** @} */
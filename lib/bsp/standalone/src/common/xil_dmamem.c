@@ -0,0 +1,855 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_dmamem.c
+*
+* This file contains the DMA offloaded memory copy service. Each supported
+* engine is reached through a small table of operations which is only built
+* when the driver of the engine is part of the BSP. See xil_dmamem.h for a
+* description of the service.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 6.4   ag       10/19/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include <string.h>
+#include "xil_dmamem.h"
+#include "xil_mem.h"
+#include "xil_cache.h"
+#include "xil_assert.h"
+
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+#include "xzdma.h"
+#endif
+#if defined (XPAR_XAXICDMA_NUM_INSTANCES)
+#include "xaxicdma.h"
+#endif
+#if defined (XPAR_XDMAPS_NUM_INSTANCES)
+#include "xdmaps.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+/*
+ * Parts of a split copy start on cache line boundaries.
+ */
+#define XIL_DMAMEM_SPLIT_ALIGN		64U
+
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+#if (XPAR_XZDMA_NUM_INSTANCES < XIL_DMAMEM_MAX_CHANNELS)
+#define XIL_DMAMEM_ZDMA_CHANNELS	XPAR_XZDMA_NUM_INSTANCES
+#else
+#define XIL_DMAMEM_ZDMA_CHANNELS	XIL_DMAMEM_MAX_CHANNELS
+#endif
+#define XIL_DMAMEM_ZDMA_ERR_MASK	(XZDMA_IXR_AXI_WR_DATA_MASK | \
+					XZDMA_IXR_AXI_RD_DATA_MASK)
+#endif
+
+#if defined (XPAR_XAXICDMA_NUM_INSTANCES)
+#if (XPAR_XAXICDMA_NUM_INSTANCES < XIL_DMAMEM_MAX_CHANNELS)
+#define XIL_DMAMEM_CDMA_CHANNELS	XPAR_XAXICDMA_NUM_INSTANCES
+#else
+#define XIL_DMAMEM_CDMA_CHANNELS	XIL_DMAMEM_MAX_CHANNELS
+#endif
+#define XIL_DMAMEM_CDMA_RESET_TIMEOUT	500U
+#endif
+
+#if defined (XPAR_XDMAPS_NUM_INSTANCES)
+#if (XDMAPS_CHANNELS_PER_DEV < XIL_DMAMEM_MAX_CHANNELS)
+#define XIL_DMAMEM_DMAPS_CHANNELS	XDMAPS_CHANNELS_PER_DEV
+#else
+#define XIL_DMAMEM_DMAPS_CHANNELS	XIL_DMAMEM_MAX_CHANNELS
+#endif
+#ifndef XIL_DMAMEM_DMAPS_DEVICE_ID
+#if defined (XPAR_XDMAPS_1_DEVICE_ID)
+#define XIL_DMAMEM_DMAPS_DEVICE_ID	XPAR_XDMAPS_1_DEVICE_ID
+#else
+#define XIL_DMAMEM_DMAPS_DEVICE_ID	XPAR_XDMAPS_0_DEVICE_ID
+#endif
+#endif
+/*
+ * Keeps the generated DMA program within one program buffer
+ */
+#define XIL_DMAMEM_DMAPS_MAX_LEN	0x100000U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/*
+ * Progress of the part of a copy given to one channel.
+ */
+typedef struct {
+	UINTPTR SrcAddr;	/* Next source address */
+	UINTPTR DstAddr;	/* Next destination address */
+	u32 Remaining;		/* Bytes not yet handed to the channel */
+	u8 Busy;		/* Channel belongs to a copy */
+	u8 CpuCopied;		/* Engine refused, processor did the rest */
+} Xil_DmaMemChan;
+
+typedef struct Xil_DmaMemEngineS Xil_DmaMemEngine;
+
+/*
+ * Operations of one engine. Start hands at most MaxLen bytes to a channel,
+ * Poll returns XST_DEVICE_BUSY while the channel is working and XST_SUCCESS
+ * or XST_FAILURE once it has stopped.
+ */
+typedef struct {
+	u32 (*Init)(Xil_DmaMemEngine *EnginePtr);
+	s32 (*Start)(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr, u32 Len);
+	s32 (*Poll)(u32 Chan);
+} Xil_DmaMemOps;
+
+struct Xil_DmaMemEngineS {
+	const Xil_DmaMemOps *Ops;	/* NULL for the processor */
+	u32 IsReady;			/* Init has been run */
+	u32 NumChans;			/* Usable channels */
+	u32 MaxLen;			/* Largest length of one start */
+	u32 Align;			/* Required address alignment */
+	u8 Coherent;			/* No cache maintenance needed */
+	Xil_DmaMemChan Chan[XIL_DMAMEM_MAX_CHANNELS];
+};
+
+/************************** Function Prototypes *****************************/
+
+static Xil_DmaMemEngine *Xil_DmaMemGetReady(u32 Engine);
+static void Xil_DmaMemKick(Xil_DmaMemEngine *EnginePtr, u32 Chan,
+			   u8 CacheMaint);
+
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+static u32 Xil_DmaMemZDmaInit(Xil_DmaMemEngine *EnginePtr);
+static s32 Xil_DmaMemZDmaStart(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr,
+			       u32 Len);
+static s32 Xil_DmaMemZDmaPoll(u32 Chan);
+#endif
+#if defined (XPAR_XAXICDMA_NUM_INSTANCES)
+static u32 Xil_DmaMemCdmaInit(Xil_DmaMemEngine *EnginePtr);
+static s32 Xil_DmaMemCdmaStart(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr,
+			       u32 Len);
+static s32 Xil_DmaMemCdmaPoll(u32 Chan);
+#endif
+#if defined (XPAR_XDMAPS_NUM_INSTANCES)
+static u32 Xil_DmaMemDmaPsInit(Xil_DmaMemEngine *EnginePtr);
+static s32 Xil_DmaMemDmaPsStart(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr,
+				u32 Len);
+static s32 Xil_DmaMemDmaPsPoll(u32 Chan);
+#endif
+
+/************************** Variable Definitions ****************************/
+
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+static XZDma Xil_DmaMemZDma[XIL_DMAMEM_ZDMA_CHANNELS];
+static const Xil_DmaMemOps Xil_DmaMemZDmaOps = {
+	Xil_DmaMemZDmaInit, Xil_DmaMemZDmaStart, Xil_DmaMemZDmaPoll
+};
+#define XIL_DMAMEM_ZDMA_OPS	(&Xil_DmaMemZDmaOps)
+#else
+#define XIL_DMAMEM_ZDMA_OPS	NULL
+#endif
+
+#if defined (XPAR_XAXICDMA_NUM_INSTANCES)
+static XAxiCdma Xil_DmaMemCdma[XIL_DMAMEM_CDMA_CHANNELS];
+static const Xil_DmaMemOps Xil_DmaMemCdmaOps = {
+	Xil_DmaMemCdmaInit, Xil_DmaMemCdmaStart, Xil_DmaMemCdmaPoll
+};
+#define XIL_DMAMEM_CDMA_OPS	(&Xil_DmaMemCdmaOps)
+#else
+#define XIL_DMAMEM_CDMA_OPS	NULL
+#endif
+
+#if defined (XPAR_XDMAPS_NUM_INSTANCES)
+static XDmaPs Xil_DmaMemDmaPs;
+static XDmaPs_Cmd Xil_DmaMemDmaPsCmd[XIL_DMAMEM_DMAPS_CHANNELS];
+static void (*const Xil_DmaMemDmaPsDone[XDMAPS_CHANNELS_PER_DEV])
+							(XDmaPs *InstPtr) = {
+	XDmaPs_DoneISR_0, XDmaPs_DoneISR_1, XDmaPs_DoneISR_2,
+	XDmaPs_DoneISR_3, XDmaPs_DoneISR_4, XDmaPs_DoneISR_5,
+	XDmaPs_DoneISR_6, XDmaPs_DoneISR_7
+};
+static const Xil_DmaMemOps Xil_DmaMemDmaPsOps = {
+	Xil_DmaMemDmaPsInit, Xil_DmaMemDmaPsStart, Xil_DmaMemDmaPsPoll
+};
+#define XIL_DMAMEM_DMAPS_OPS	(&Xil_DmaMemDmaPsOps)
+#else
+#define XIL_DMAMEM_DMAPS_OPS	NULL
+#endif
+
+static const Xil_DmaMemOps *const Xil_DmaMemOpsTable[XIL_DMAMEM_ENGINE_COUNT] = {
+	NULL,
+	XIL_DMAMEM_ZDMA_OPS,
+	XIL_DMAMEM_CDMA_OPS,
+	XIL_DMAMEM_DMAPS_OPS
+};
+
+static Xil_DmaMemEngine Xil_DmaMemEngines[XIL_DMAMEM_ENGINE_COUNT];
+static u32 Xil_DmaMemEngineSel = XIL_DMAMEM_ENGINE;
+static u32 Xil_DmaMemThreshold = XIL_DMAMEM_THRESHOLD;
+
+/************************** Function Definitions ****************************/
+
+/*****************************************************************************/
+/**
+*
+* @brief	Select the engine used by the following copies. The engine
+*		chosen at build time is used until this function is called.
+*
+* @param	Engine: one of the XIL_DMAMEM_ENGINE_* values.
+*
+* @return
+*		- XST_SUCCESS if the engine is selected.
+*		- XST_INVALID_PARAM if Engine is not a known engine.
+*		- XST_FAILURE if the engine is not present in the BSP.
+*		- XST_DEVICE_BUSY if a copy on the current engine is still
+*		outstanding.
+*
+*****************************************************************************/
+s32 Xil_DmaMemSetEngine(u32 Engine)
+{
+	Xil_DmaMemEngine *EnginePtr;
+	u32 Index;
+
+	if (Engine >= XIL_DMAMEM_ENGINE_COUNT) {
+		return XST_INVALID_PARAM;
+	}
+	if ((Engine != XIL_DMAMEM_ENGINE_CPU) &&
+	    (Xil_DmaMemGetReady(Engine) == NULL)) {
+		return XST_FAILURE;
+	}
+
+	EnginePtr = &Xil_DmaMemEngines[Xil_DmaMemEngineSel];
+	for (Index = 0U; Index < EnginePtr->NumChans; Index++) {
+		if (EnginePtr->Chan[Index].Busy != 0U) {
+			return XST_DEVICE_BUSY;
+		}
+	}
+
+	Xil_DmaMemEngineSel = Engine;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Return the engine used for copies.
+*
+* @return	One of the XIL_DMAMEM_ENGINE_* values.
+*
+*****************************************************************************/
+u32 Xil_DmaMemGetEngine(void)
+{
+	return Xil_DmaMemEngineSel;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Set the size below which copies are done by the processor.
+*		Starting a DMA transfer and maintaining the caches costs more
+*		than copying a few cache lines, so small copies stay on the
+*		processor.
+*
+* @param	Threshold: size in bytes.
+*
+*****************************************************************************/
+void Xil_DmaMemSetThreshold(u32 Threshold)
+{
+	Xil_DmaMemThreshold = Threshold;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Start copying Len bytes from Src to Dst. Large copies are split
+*		across the free channels of the selected engine. When the copy
+*		is done by the processor it is complete on return.
+*
+* @param	Req: state of the copy, passed to Xil_DmaMemCpyWait().
+* @param	Dst: destination buffer.
+* @param	Src: source buffer.
+* @param	Len: number of bytes to copy.
+*
+* @return	XST_SUCCESS.
+*
+* @note		Neither buffer may be accessed by the processor until
+*		Xil_DmaMemCpyWait() has returned.
+*
+*****************************************************************************/
+s32 Xil_DmaMemCpyAsync(Xil_DmaMemReq *Req, void *Dst, const void *Src,
+			u32 Len)
+{
+	Xil_DmaMemEngine *EnginePtr = NULL;
+	UINTPTR SrcAddr = (UINTPTR)Src;
+	UINTPTR DstAddr = (UINTPTR)Dst;
+	u32 FreeMask = 0U;
+	u32 FreeCnt = 0U;
+	u32 Parts;
+	u32 PartLen;
+	u32 Offset;
+	u32 Index;
+
+	Xil_AssertNonvoid(Req != NULL);
+
+	Req->Engine = XIL_DMAMEM_ENGINE_CPU;
+	Req->ChanMask = 0U;
+	Req->DstAddr = DstAddr;
+	Req->Len = Len;
+	Req->CacheMaint = 0U;
+	Req->Status = XST_SUCCESS;
+
+	if (Len == 0U) {
+		return XST_SUCCESS;
+	}
+
+	if ((Len >= Xil_DmaMemThreshold) &&
+	    (Xil_DmaMemEngineSel != XIL_DMAMEM_ENGINE_CPU)) {
+		EnginePtr = Xil_DmaMemGetReady(Xil_DmaMemEngineSel);
+	}
+	if ((EnginePtr == NULL) ||
+	    (((SrcAddr | DstAddr) & (EnginePtr->Align - 1U)) != 0U)) {
+		Xil_MemCpy(Dst, Src, Len);
+		return XST_SUCCESS;
+	}
+
+	for (Index = 0U; Index < EnginePtr->NumChans; Index++) {
+		if (EnginePtr->Chan[Index].Busy == 0U) {
+			FreeMask |= (u32)1U << Index;
+			FreeCnt++;
+		}
+	}
+	if (FreeCnt == 0U) {
+		Xil_MemCpy(Dst, Src, Len);
+		return XST_SUCCESS;
+	}
+
+	Parts = Len / XIL_DMAMEM_SPLIT_MIN;
+	if (Parts == 0U) {
+		Parts = 1U;
+	}
+	if (Parts > FreeCnt) {
+		Parts = FreeCnt;
+	}
+	PartLen = ((Len / Parts) + XIL_DMAMEM_SPLIT_ALIGN - 1U) &
+			~(XIL_DMAMEM_SPLIT_ALIGN - 1U);
+
+	Req->Engine = Xil_DmaMemEngineSel;
+	if (EnginePtr->Coherent == 0U) {
+		Xil_DCacheFlushRange((INTPTR)SrcAddr, Len);
+		Xil_DCacheFlushRange((INTPTR)DstAddr, Len);
+		Req->CacheMaint = 1U;
+	}
+
+	Offset = 0U;
+	for (Index = 0U; (Index < EnginePtr->NumChans) && (Offset < Len);
+	     Index++) {
+		if ((FreeMask & ((u32)1U << Index)) == 0U) {
+			continue;
+		}
+		EnginePtr->Chan[Index].SrcAddr = SrcAddr + Offset;
+		EnginePtr->Chan[Index].DstAddr = DstAddr + Offset;
+		EnginePtr->Chan[Index].Remaining =
+			((Len - Offset) < PartLen) ? (Len - Offset) : PartLen;
+		EnginePtr->Chan[Index].Busy = 1U;
+		EnginePtr->Chan[Index].CpuCopied = 0U;
+		Offset += EnginePtr->Chan[Index].Remaining;
+
+		Req->ChanMask |= (u32)1U << Index;
+		Xil_DmaMemKick(EnginePtr, Index, Req->CacheMaint);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Check whether a copy started with Xil_DmaMemCpyAsync() has
+*		completed. Channels which finished a segment of a copy longer
+*		than the engine can take at once are restarted here.
+*
+* @param	Req: state of the copy.
+*
+* @return
+*		- XST_DEVICE_BUSY if the copy is still in progress.
+*		- XST_SUCCESS if the copy has completed.
+*		- XST_FAILURE if an engine reported an error.
+*
+*****************************************************************************/
+s32 Xil_DmaMemCpyPoll(Xil_DmaMemReq *Req)
+{
+	Xil_DmaMemEngine *EnginePtr;
+	u32 Index;
+	s32 Status;
+
+	Xil_AssertNonvoid(Req != NULL);
+
+	if (Req->ChanMask == 0U) {
+		return Req->Status;
+	}
+
+	EnginePtr = &Xil_DmaMemEngines[Req->Engine];
+	for (Index = 0U; Index < EnginePtr->NumChans; Index++) {
+		if ((Req->ChanMask & ((u32)1U << Index)) == 0U) {
+			continue;
+		}
+
+		/*
+		 * A part finished by the processor is not known to the
+		 * engine, which may still hold the state of the refused
+		 * start.
+		 */
+		if (EnginePtr->Chan[Index].CpuCopied != 0U) {
+			Status = XST_SUCCESS;
+		} else {
+			Status = EnginePtr->Ops->Poll(Index);
+		}
+		if (Status == XST_DEVICE_BUSY) {
+			continue;
+		}
+		if ((Status == XST_SUCCESS) &&
+		    (EnginePtr->Chan[Index].Remaining != 0U)) {
+			Xil_DmaMemKick(EnginePtr, Index, Req->CacheMaint);
+			continue;
+		}
+		if (Status != XST_SUCCESS) {
+			Req->Status = XST_FAILURE;
+		}
+		EnginePtr->Chan[Index].Remaining = 0U;
+		EnginePtr->Chan[Index].Busy = 0U;
+		EnginePtr->Chan[Index].CpuCopied = 0U;
+		Req->ChanMask &= ~((u32)1U << Index);
+	}
+
+	if (Req->ChanMask != 0U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	if (Req->CacheMaint != 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Req->DstAddr, Req->Len);
+		Req->CacheMaint = 0U;
+	}
+
+	return Req->Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Wait for a copy started with Xil_DmaMemCpyAsync() to complete.
+*
+* @param	Req: state of the copy.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if an engine reported an error.
+*
+*****************************************************************************/
+s32 Xil_DmaMemCpyWait(Xil_DmaMemReq *Req)
+{
+	s32 Status;
+
+	do {
+		Status = Xil_DmaMemCpyPoll(Req);
+	} while (Status == XST_DEVICE_BUSY);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief	Copy Len bytes from Src to Dst and wait for the copy to
+*		complete, using the selected engine for large copies.
+*
+* @param	Dst: destination buffer.
+* @param	Src: source buffer.
+* @param	Len: number of bytes to copy.
+*
+* @return	XST_SUCCESS, or XST_FAILURE if an engine reported an error.
+*
+*****************************************************************************/
+s32 Xil_DmaMemCpy(void *Dst, const void *Src, u32 Len)
+{
+	Xil_DmaMemReq Req;
+
+	(void)Xil_DmaMemCpyAsync(&Req, Dst, Src, Len);
+
+	return Xil_DmaMemCpyWait(&Req);
+}
+
+/*****************************************************************************/
+/*
+*
+* Initialize an engine on first use.
+*
+* @param	Engine is one of the XIL_DMAMEM_ENGINE_* values.
+*
+* @return	The engine, or NULL if it is not present or has no usable
+*		channel.
+*
+*****************************************************************************/
+static Xil_DmaMemEngine *Xil_DmaMemGetReady(u32 Engine)
+{
+	Xil_DmaMemEngine *EnginePtr = &Xil_DmaMemEngines[Engine];
+
+	if (EnginePtr->IsReady == 0U) {
+		EnginePtr->IsReady = 1U;
+		EnginePtr->Ops = Xil_DmaMemOpsTable[Engine];
+		EnginePtr->Align = 1U;
+		if (EnginePtr->Ops != NULL) {
+			EnginePtr->NumChans = EnginePtr->Ops->Init(EnginePtr);
+		}
+	}
+
+	return (EnginePtr->NumChans != 0U) ? EnginePtr : NULL;
+}
+
+/*****************************************************************************/
+/*
+*
+* Hand the next segment of its part of a copy to a channel. If the engine
+* refuses it, the rest of the part is copied by the processor and written
+* back so the invalidation on completion does not discard it. The channel
+* is then marked so that polling does not ask the engine for the result.
+*
+* @param	EnginePtr is the engine.
+* @param	Chan is the channel.
+* @param	CacheMaint tells whether the caches are maintained for the copy.
+*
+*****************************************************************************/
+static void Xil_DmaMemKick(Xil_DmaMemEngine *EnginePtr, u32 Chan,
+			   u8 CacheMaint)
+{
+	Xil_DmaMemChan *ChanPtr = &EnginePtr->Chan[Chan];
+	u32 Len = ChanPtr->Remaining;
+
+	if (Len > EnginePtr->MaxLen) {
+		Len = EnginePtr->MaxLen;
+	}
+
+	if (EnginePtr->Ops->Start(Chan, ChanPtr->SrcAddr, ChanPtr->DstAddr,
+				  Len) != XST_SUCCESS) {
+		Len = ChanPtr->Remaining;
+		ChanPtr->CpuCopied = 1U;
+		Xil_MemCpy((void *)ChanPtr->DstAddr,
+			   (const void *)ChanPtr->SrcAddr, Len);
+		if (CacheMaint != 0U) {
+			Xil_DCacheFlushRange((INTPTR)ChanPtr->DstAddr, Len);
+		}
+	}
+
+	ChanPtr->SrcAddr += Len;
+	ChanPtr->DstAddr += Len;
+	ChanPtr->Remaining -= Len;
+}
+
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+/*****************************************************************************/
+/*
+*
+* Initialize the ZDMA channels in simple mode. Their interrupts stay
+* disabled, completion is taken from the interrupt status register.
+*
+*****************************************************************************/
+static u32 Xil_DmaMemZDmaInit(Xil_DmaMemEngine *EnginePtr)
+{
+	extern XZDma_Config XZDma_ConfigTable[XPAR_XZDMA_NUM_INSTANCES];
+	XZDma_DataConfig Configure;
+	XZDma *InstancePtr;
+	u32 Index;
+
+	for (Index = 0U; Index < XIL_DMAMEM_ZDMA_CHANNELS; Index++) {
+		InstancePtr = &Xil_DmaMemZDma[Index];
+		if (XZDma_CfgInitialize(InstancePtr, &XZDma_ConfigTable[Index],
+			XZDma_ConfigTable[Index].BaseAddress) != XST_SUCCESS) {
+			break;
+		}
+		if (XZDma_SetMode(InstancePtr, FALSE, XZDMA_NORMAL_MODE) !=
+								XST_SUCCESS) {
+			break;
+		}
+		if (XZDma_ConfigTable[Index].IsCacheCoherent) {
+			XZDma_GetChDataConfig(InstancePtr, &Configure);
+			Configure.SrcCache = 0xFU;
+			Configure.DstCache = 0xFU;
+			(void)XZDma_SetChDataConfig(InstancePtr, &Configure);
+		}
+	}
+
+	EnginePtr->MaxLen = XZDMA_WORD2_SIZE_MASK;
+	EnginePtr->Coherent = XZDma_ConfigTable[0].IsCacheCoherent;
+
+	return Index;
+}
+
+/*****************************************************************************/
+/*
+*
+* Start a simple mode transfer on a ZDMA channel.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemZDmaStart(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr,
+			       u32 Len)
+{
+	XZDma *InstancePtr = &Xil_DmaMemZDma[Chan];
+	XZDma_Transfer Data;
+
+	Data.SrcAddr = SrcAddr;
+	Data.DstAddr = DstAddr;
+	Data.Size = Len;
+	Data.SrcCoherent = InstancePtr->Config.IsCacheCoherent;
+	Data.DstCoherent = InstancePtr->Config.IsCacheCoherent;
+	Data.Pause = 0U;
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+
+	return XZDma_Start(InstancePtr, &Data, 1U);
+}
+
+/*****************************************************************************/
+/*
+*
+* Check a ZDMA channel for completion.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemZDmaPoll(u32 Chan)
+{
+	XZDma *InstancePtr = &Xil_DmaMemZDma[Chan];
+	u32 Status;
+
+	Status = XZDma_IntrGetStatus(InstancePtr);
+	if ((Status & XIL_DMAMEM_ZDMA_ERR_MASK) != 0U) {
+		XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+		InstancePtr->ChannelState = XZDMA_IDLE;
+		return XST_FAILURE;
+	}
+	if ((Status & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_DMA_DONE_MASK);
+	InstancePtr->ChannelState = XZDMA_IDLE;
+
+	return XST_SUCCESS;
+}
+#endif
+
+#if defined (XPAR_XAXICDMA_NUM_INSTANCES)
+/*****************************************************************************/
+/*
+*
+* Initialize the AXI CDMA engines with their interrupts disabled. Engines
+* without data realignment only take word aligned buffers.
+*
+*****************************************************************************/
+static u32 Xil_DmaMemCdmaInit(Xil_DmaMemEngine *EnginePtr)
+{
+	extern XAxiCdma_Config XAxiCdma_ConfigTable[];
+	XAxiCdma *InstancePtr;
+	u32 Index;
+
+	EnginePtr->MaxLen = XAXICDMA_MAX_TRANSFER_LEN;
+
+	for (Index = 0U; Index < XIL_DMAMEM_CDMA_CHANNELS; Index++) {
+		InstancePtr = &Xil_DmaMemCdma[Index];
+		if (XAxiCdma_CfgInitialize(InstancePtr,
+			&XAxiCdma_ConfigTable[Index],
+			XAxiCdma_ConfigTable[Index].BaseAddress) !=
+								XST_SUCCESS) {
+			break;
+		}
+		XAxiCdma_IntrDisable(InstancePtr, XAXICDMA_XR_IRQ_ALL_MASK);
+
+		if ((u32)InstancePtr->MaxTransLen < EnginePtr->MaxLen) {
+			EnginePtr->MaxLen = (u32)InstancePtr->MaxTransLen;
+		}
+		if ((InstancePtr->HasDRE == 0) &&
+		    ((u32)InstancePtr->WordLength > EnginePtr->Align)) {
+			EnginePtr->Align = (u32)InstancePtr->WordLength;
+		}
+	}
+
+	/* Keep segments word sized for engines without realignment */
+	EnginePtr->MaxLen &= ~(EnginePtr->Align - 1U);
+	EnginePtr->Coherent = 0U;
+
+	return Index;
+}
+
+/*****************************************************************************/
+/*
+*
+* Start a simple transfer on an AXI CDMA engine.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemCdmaStart(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr,
+			       u32 Len)
+{
+	u32 Status;
+
+	Status = XAxiCdma_SimpleTransfer(&Xil_DmaMemCdma[Chan], SrcAddr,
+					 DstAddr, (int)Len, NULL, NULL);
+
+	return (Status == (u32)XST_SUCCESS) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/*
+*
+* Check an AXI CDMA engine for completion, resetting it after an error.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemCdmaPoll(u32 Chan)
+{
+	XAxiCdma *InstancePtr = &Xil_DmaMemCdma[Chan];
+	u32 TimeOut = XIL_DMAMEM_CDMA_RESET_TIMEOUT;
+
+	if (XAxiCdma_IsBusy(InstancePtr)) {
+		return XST_DEVICE_BUSY;
+	}
+	if (XAxiCdma_GetError(InstancePtr) == 0U) {
+		return XST_SUCCESS;
+	}
+
+	XAxiCdma_Reset(InstancePtr);
+	while ((TimeOut != 0U) && (XAxiCdma_ResetIsDone(InstancePtr) == 0)) {
+		TimeOut--;
+	}
+	XAxiCdma_IntrDisable(InstancePtr, XAXICDMA_XR_IRQ_ALL_MASK);
+
+	return XST_FAILURE;
+}
+#endif
+
+#if defined (XPAR_XDMAPS_NUM_INSTANCES)
+/*****************************************************************************/
+/*
+*
+* Initialize the PS DMA controller; every channel of it is a copy channel.
+*
+*****************************************************************************/
+static u32 Xil_DmaMemDmaPsInit(Xil_DmaMemEngine *EnginePtr)
+{
+	XDmaPs_Config *Config;
+
+	Config = XDmaPs_LookupConfig(XIL_DMAMEM_DMAPS_DEVICE_ID);
+	if (Config == NULL) {
+		return 0U;
+	}
+	if (XDmaPs_CfgInitialize(&Xil_DmaMemDmaPs, Config,
+				 Config->BaseAddress) != XST_SUCCESS) {
+		return 0U;
+	}
+
+	EnginePtr->MaxLen = XIL_DMAMEM_DMAPS_MAX_LEN;
+	EnginePtr->Coherent = 0U;
+
+	return XIL_DMAMEM_DMAPS_CHANNELS;
+}
+
+/*****************************************************************************/
+/*
+*
+* Start a copy command on a PS DMA channel. The driver generates the DMA
+* program and releases it again in the done handling. If the start fails,
+* the channel is killed and the command is dropped from it, as the done
+* handling that would do so never runs.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemDmaPsStart(u32 Chan, UINTPTR SrcAddr, UINTPTR DstAddr,
+				u32 Len)
+{
+	XDmaPs_Cmd *Cmd = &Xil_DmaMemDmaPsCmd[Chan];
+
+	memset(Cmd, 0, sizeof(XDmaPs_Cmd));
+	Cmd->ChanCtrl.SrcBurstSize = 4;
+	Cmd->ChanCtrl.SrcBurstLen = 4;
+	Cmd->ChanCtrl.SrcInc = 1;
+	Cmd->ChanCtrl.DstBurstSize = 4;
+	Cmd->ChanCtrl.DstBurstLen = 4;
+	Cmd->ChanCtrl.DstInc = 1;
+	Cmd->BD.SrcAddr = (u32)SrcAddr;
+	Cmd->BD.DstAddr = (u32)DstAddr;
+	Cmd->BD.Length = Len;
+
+	if (XDmaPs_Start(&Xil_DmaMemDmaPs, Chan, Cmd, 0) != XST_SUCCESS) {
+		if (XDmaPs_IsActive(&Xil_DmaMemDmaPs, Chan)) {
+			(void)XDmaPs_ResetChannel(&Xil_DmaMemDmaPs, Chan);
+			Xil_DmaMemDmaPs.Chans[Chan].DmaCmdToHw = NULL;
+		}
+		(void)XDmaPs_FreeDmaProg(&Xil_DmaMemDmaPs, Chan, Cmd);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/*
+*
+* Check a PS DMA channel for completion. The done and fault handling of the
+* driver is run from here instead of from the interrupt system.
+*
+*****************************************************************************/
+static s32 Xil_DmaMemDmaPsPoll(u32 Chan)
+{
+	u32 BaseAddr = Xil_DmaMemDmaPs.Config.BaseAddress;
+
+	if (XDmaPs_IsActive(&Xil_DmaMemDmaPs, Chan)) {
+		if ((XDmaPs_ReadReg(BaseAddr, XDMAPS_FSC_OFFSET) &
+						((u32)1U << Chan)) != 0U) {
+			XDmaPs_FaultISR(&Xil_DmaMemDmaPs);
+		}
+		else if ((XDmaPs_ReadReg(BaseAddr, XDMAPS_INTSTATUS_OFFSET) &
+						((u32)1U << Chan)) != 0U) {
+			Xil_DmaMemDmaPsDone[Chan](&Xil_DmaMemDmaPs);
+		}
+		else {
+			return XST_DEVICE_BUSY;
+		}
+	}
+
+	return (Xil_DmaMemDmaPsCmd[Chan].DmaStatus == 0) ?
+		XST_SUCCESS : XST_FAILURE;
+}
+#endif
+/**
+* @} End of "addtogroup common_mem_operation_api".
+*/
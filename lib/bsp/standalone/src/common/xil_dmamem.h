@@ -0,0 +1,165 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xil_dmamem.h
+*
+* @addtogroup common_mem_operation_api
+*
+* <h2>DMA offloaded memory copy</h2>
+*
+* The xil_dmamem.h file contains a memory copy service which offloads bulk
+* copies to a DMA engine of the system. The engine is selected at build time
+* from the drivers present in the BSP, in the order ZDMA, AXI CDMA and
+* PS DMA (PL330), and can be overridden by defining XIL_DMAMEM_ENGINE. When
+* none of them is present every copy is done by the processor.
+*
+* Xil_DmaMemCpyAsync() starts a copy and Xil_DmaMemCpyWait() waits for it.
+* The service flushes the source and destination ranges before the copy and
+* invalidates the destination once it is complete, unless the engine is cache
+* coherent. Copies of XIL_DMAMEM_SPLIT_MIN bytes or more are split across up
+* to XIL_DMAMEM_MAX_CHANNELS channels which run in parallel. Copies smaller
+* than the threshold set with Xil_DmaMemSetThreshold(), copies whose buffers
+* the engine cannot address and copies for which no channel is free are done
+* by the processor with Xil_MemCpy() before Xil_DmaMemCpyAsync() returns.
+*
+* The channels are driven in polled mode; their interrupts must not be
+* connected by the application while the service uses them.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------- -------- -----------------------------------------------
+* 6.4   ag       10/19/26 First release.
+*
+* </pre>
+*
+*****************************************************************************/
+
+#ifndef XIL_DMAMEM_H		/* prevent circular inclusions */
+#define XIL_DMAMEM_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xparameters.h"
+
+/************************** Constant Definitions ****************************/
+
+/** @name Copy engines
+ * @{
+ */
+#define XIL_DMAMEM_ENGINE_CPU		0U	/**< Processor copy */
+#define XIL_DMAMEM_ENGINE_ZDMA		1U	/**< ZynqMP GDMA/ADMA */
+#define XIL_DMAMEM_ENGINE_CDMA		2U	/**< AXI CDMA */
+#define XIL_DMAMEM_ENGINE_DMAPS		3U	/**< Zynq PS DMA (PL330) */
+#define XIL_DMAMEM_ENGINE_COUNT		4U	/**< Number of engines */
+/*@}*/
+
+/*
+ * Default engine, the first one present in the BSP.
+ */
+#ifndef XIL_DMAMEM_ENGINE
+#if defined (XPAR_XZDMA_NUM_INSTANCES)
+#define XIL_DMAMEM_ENGINE	XIL_DMAMEM_ENGINE_ZDMA
+#elif defined (XPAR_XAXICDMA_NUM_INSTANCES)
+#define XIL_DMAMEM_ENGINE	XIL_DMAMEM_ENGINE_CDMA
+#elif defined (XPAR_XDMAPS_NUM_INSTANCES)
+#define XIL_DMAMEM_ENGINE	XIL_DMAMEM_ENGINE_DMAPS
+#else
+#define XIL_DMAMEM_ENGINE	XIL_DMAMEM_ENGINE_CPU
+#endif
+#endif
+
+/*
+ * Maximum number of channels a copy is split across.
+ */
+#ifndef XIL_DMAMEM_MAX_CHANNELS
+#define XIL_DMAMEM_MAX_CHANNELS		4U
+#endif
+
+/*
+ * Copies smaller than this many bytes are done by the processor, it can be
+ * changed at run time with Xil_DmaMemSetThreshold().
+ */
+#ifndef XIL_DMAMEM_THRESHOLD
+#define XIL_DMAMEM_THRESHOLD		4096U
+#endif
+
+/*
+ * Smallest part of a copy given to one channel when it is split.
+ */
+#ifndef XIL_DMAMEM_SPLIT_MIN
+#define XIL_DMAMEM_SPLIT_MIN		65536U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * State of one copy started with Xil_DmaMemCpyAsync().
+ */
+typedef struct {
+	u32 Engine;		/**< Engine serving the copy */
+	u32 ChanMask;		/**< Channels still working on the copy */
+	UINTPTR DstAddr;	/**< Destination of the copy */
+	u32 Len;		/**< Length of the copy */
+	u8 CacheMaint;		/**< Destination is invalidated on completion */
+	s32 Status;		/**< Result of the copy */
+} Xil_DmaMemReq;
+
+/************************** Function Prototypes *****************************/
+
+s32 Xil_DmaMemSetEngine(u32 Engine);
+u32 Xil_DmaMemGetEngine(void);
+void Xil_DmaMemSetThreshold(u32 Threshold);
+s32 Xil_DmaMemCpyAsync(Xil_DmaMemReq *Req, void *Dst, const void *Src,
+			u32 Len);
+s32 Xil_DmaMemCpyPoll(Xil_DmaMemReq *Req);
+s32 Xil_DmaMemCpyWait(Xil_DmaMemReq *Req);
+s32 Xil_DmaMemCpy(void *Dst, const void *Src, u32 Len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/**
+* @} End of "addtogroup common_mem_operation_api".
+*/
@@ -238,6 +238,11 @@
 * 16.00a gan 08/02/16   Fix for CR# 955897 -(2016.3)FSBL -
 * 						In pcap.c, check pl power through MCTRL register
 * 						for 3.0 and later versions of silicon.
+* 17.00a ag  10/18/26   In image_mover.c/pcap.c, partitions with a checksum
+* 						are moved in chunks through the PCAP DMA and the
+* 						MD5 is computed on each chunk while the next one is
+* 						moved. With FSBL_PERF, the move time of each
+* 						partition is printed.
 * </pre>
 *
 * </pre>
@@ -73,6 +73,10 @@
 * 						fallback image offset handling using MD5
 * 						Fix for PR#782309 Fallback support for AES
 * 						encryption with E-Fuse - Enhancement
+* 17.00a ag 10/18/26	Partitions with a checksum are moved in chunks and
+* 						the MD5 of each chunk is computed while the PCAP DMA
+* 						moves the next one. Added partition load timing
+* 						for FSBL_PERF
 *
 * </pre>
 *
@@ -89,6 +93,7 @@
 #include "pcap.h"
 #include "fsbl_hooks.h"
 #include "md5.h"
+#include "xil_cache.h"
 
 #ifdef XPAR_XWDTPS_0_BASEADDR
 #include "xwdtps.h"
@@ -96,7 +101,6 @@
 
 #ifdef RSA_SUPPORT
 #include "rsa.h"
-#include "xil_cache.h"
 #endif
 /************************** Constant Definitions *****************************/
 
@@ -104,6 +108,12 @@
 #define MAXIMUM_IMAGE_WORD_LEN 0x40000000
 #define MD5_CHECKSUM_SIZE   16
 
+/*
+ * Partitions with a checksum are moved and hashed in chunks of this many
+ * words (256KB), the next chunk being moved while the current one is hashed
+ */
+#define PARTITION_CHUNK_WORD_LEN	0x10000
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -112,6 +122,8 @@
 u32 ValidateParition(u32 StartAddr, u32 Length, u32 ChecksumOffset);
 u32 GetPartitionChecksum(u32 ChecksumOffset, u8 *Checksum);
 u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum);
+u32 PartitionMoveValidate(u32 SourceAddr, u32 LoadAddr, u32 WordLen,
+		u32 ChecksumOffset, u8 PcapFlag);
 
 /************************** Variable Definitions *****************************/
 /*
@@ -122,6 +134,7 @@ u8 PLPartitionFlag;
 u8 PSPartitionFlag;
 u8 SignedPartitionFlag;
 u8 PartitionChecksumFlag;
+u8 PartitionValidatedFlag;
 u8 BitstreamFlag;
 u8 ApplicationFlag;
 
@@ -178,6 +191,10 @@ u32 LoadBootImage(void)
 	u32 EfuseStatusRegValue;
 #ifdef RSA_SUPPORT
 	u32 HeaderSize;
+#endif
+#ifdef FSBL_PERF
+	XTime tCur = 0;
+	XTime tEnd = 0;
 #endif
 	/*
 	 * Resetting the Flags
@@ -445,9 +462,14 @@ u32 LoadBootImage(void)
 			}
 		}
 
+#ifdef FSBL_PERF
+		FsblGetGlobalTime(&tCur);
+#endif
+
 		/*
 		 * Move partitions from boot device
 		 */
+		PartitionValidatedFlag = 0;
 		Status = PartitionMove(ImageStartAddress, HeaderPtr);
 		if (Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL,"PARTITION_MOVE_FAIL\r\n");
@@ -455,6 +477,11 @@ u32 LoadBootImage(void)
 			FsblFallback();
 		}
 
+#ifdef FSBL_PERF
+		fsbl_printf(DEBUG_GENERAL,"Partition %lu move time: ", PartitionNum);
+		FsblMeasurePerfTime(tCur, tEnd);
+#endif
+
 		if ((SignedPartitionFlag) || (PartitionChecksumFlag)) {
 			if(PLPartitionFlag) {
 				/*
@@ -466,7 +493,10 @@ u32 LoadBootImage(void)
 				PartitionStartAddr = PartitionLoadAddr;
 			}
 
-			if (PartitionChecksumFlag) {
+			/*
+			 * Partition already validated while it was moved
+			 */
+			if (PartitionChecksumFlag && (!PartitionValidatedFlag)) {
 				/*
 				 * Validate the partition data with checksum
 				 */
@@ -1049,12 +1079,15 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
     u32 LoadAddr;
     u32 ImageWordLen;
     u32 DataWordLen;
+    u32 ChecksumOffset;
 
 	SourceAddr = ImageBaseAddress;
 	SourceAddr += Header->PartitionStart<<WORD_LENGTH_SHIFT;
 	LoadAddr = Header->LoadAddr;
 	ImageWordLen = Header->ImageWordLen;
 	DataWordLen = Header->DataWordLen;
+	ChecksumOffset = ImageBaseAddress +
+			(Header->CheckSumOffset << WORD_LENGTH_SHIFT);
 
 	/*
 	 * Add flash base address for linear boot devices
@@ -1101,9 +1134,17 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			LoadAddr = DDR_TEMP_START_ADDR;
 		}
 
-		Status = MoveImage(SourceAddr,
+		if (PartitionChecksumFlag) {
+			/*
+			 * Validate each chunk while it is in the cache
+			 */
+			Status = PartitionMoveValidate(SourceAddr, LoadAddr,
+						ImageWordLen, ChecksumOffset, 0);
+		} else {
+			Status = MoveImage(SourceAddr,
 						LoadAddr,
 						(ImageWordLen << WORD_LENGTH_SHIFT));
+		}
 		if(Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL, "Move Image Failed\r\n");
 			return XST_FAILURE;
@@ -1128,14 +1169,23 @@ u32 PartitionMove(u32 ImageBaseAddress, PartHeader *Header)
 			LoadAddr = DDR_TEMP_START_ADDR;
 		}
 
-		/*
-		 * Data transfer using PCAP
-		 */
-		Status = PcapDataTransfer((u32*)SourceAddr,
+		if (PartitionChecksumFlag && (!SecureTransferFlag) &&
+				(ImageWordLen == DataWordLen)) {
+			/*
+			 * Pipelined PCAP transfer with on the fly checksum
+			 */
+			Status = PartitionMoveValidate(SourceAddr, LoadAddr,
+						ImageWordLen, ChecksumOffset, 1);
+		} else {
+			/*
+			 * Data transfer using PCAP
+			 */
+			Status = PcapDataTransfer((u32*)SourceAddr,
 						(u32*)LoadAddr,
 						ImageWordLen,
 						DataWordLen,
 						SecureTransferFlag);
+		}
 		if(Status != XST_SUCCESS) {
 			fsbl_printf(DEBUG_GENERAL, "PCAP Data Transfer Failed\r\n");
 			return XST_FAILURE;
@@ -1333,3 +1383,133 @@ u32 CalcPartitionChecksum(u32 SourceAddr, u32 DataLength, u8 *Checksum)
     return XST_SUCCESS;
 }
 
+
+
+/******************************************************************************/
+/**
+*
+* This function moves a partition in chunks of PARTITION_CHUNK_WORD_LEN words
+* and validates it with the checksum present in the image. With PCAP, the
+* next chunk is moved by the DMA while the MD5 of the current one is
+* computed, so the checksum costs no more than the longest of the two.
+* Without PCAP, each chunk is hashed right after MoveImage while it is still
+* in the cache.
+*
+* @param	SourceAddr is the partition address on the boot device
+* @param	LoadAddr is the address the partition is moved to
+* @param	WordLen is the length of the partition in words
+* @param	ChecksumOffset is the address of the checksum on the boot device
+* @param	PcapFlag is 1 to use the PCAP DMA, 0 to use MoveImage
+*
+* @return
+*		- XST_SUCCESS if the partition is moved and its data is ok
+*		- XST_FAILURE if the move failed or the data is corrupted
+*
+* @note		On success PartitionValidatedFlag is set
+*
+*******************************************************************************/
+u32 PartitionMoveValidate(u32 SourceAddr, u32 LoadAddr, u32 WordLen,
+		u32 ChecksumOffset, u8 PcapFlag)
+{
+	MD5Context Context;
+	u8  Checksum[MD5_CHECKSUM_SIZE];
+	u8  CalcChecksum[MD5_CHECKSUM_SIZE];
+	u32 Status;
+	u32 Index;
+	u32 Offset;
+	u32 ChunkWordLen;
+	u32 NextOffset;
+	u32 NextWordLen;
+
+	/*
+	 * Get checksum from flash before the boot device is busy
+	 */
+	Status = GetPartitionChecksum(ChecksumOffset, &Checksum[0]);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	MD5Init(&Context);
+
+	Offset = 0;
+	ChunkWordLen = WordLen;
+	if (ChunkWordLen > PARTITION_CHUNK_WORD_LEN) {
+		ChunkWordLen = PARTITION_CHUNK_WORD_LEN;
+	}
+
+	if (PcapFlag) {
+		Status = PcapDataTransferStart((u32*)SourceAddr, (u32*)LoadAddr,
+					ChunkWordLen, ChunkWordLen, 0);
+		if (Status != XST_SUCCESS) {
+			fsbl_printf(DEBUG_GENERAL, "PCAP Data Transfer Failed\r\n");
+			return XST_FAILURE;
+		}
+	}
+
+	while (ChunkWordLen != 0) {
+		NextOffset = Offset + (ChunkWordLen << WORD_LENGTH_SHIFT);
+		NextWordLen = WordLen - (NextOffset >> WORD_LENGTH_SHIFT);
+		if (NextWordLen > PARTITION_CHUNK_WORD_LEN) {
+			NextWordLen = PARTITION_CHUNK_WORD_LEN;
+		}
+
+		if (PcapFlag) {
+			/*
+			 * Wait for the current chunk and start the next one
+			 */
+			Status = PcapDataTransferWait();
+			if ((Status == XST_SUCCESS) && (NextWordLen != 0)) {
+				Status = PcapDataTransferStart(
+						(u32*)(SourceAddr + NextOffset),
+						(u32*)(LoadAddr + NextOffset),
+						NextWordLen, NextWordLen, 0);
+			}
+		} else {
+#ifdef	XPAR_XWDTPS_0_BASEADDR
+			/*
+			 * Prevent WDT reset
+			 */
+			XWdtPs_RestartWdt(&Watchdog);
+#endif
+			Status = MoveImage(SourceAddr + Offset, LoadAddr + Offset,
+						ChunkWordLen << WORD_LENGTH_SHIFT);
+		}
+		if (Status != XST_SUCCESS) {
+			fsbl_printf(DEBUG_GENERAL, "Partition Chunk Move Failed\r\n");
+			return XST_FAILURE;
+		}
+
+		/*
+		 * The chunk was written to DDR behind the cache
+		 */
+		if (PcapFlag) {
+			Xil_DCacheInvalidateRange(LoadAddr + Offset,
+					ChunkWordLen << WORD_LENGTH_SHIFT);
+		}
+
+		MD5Update(&Context, (u8 *)(LoadAddr + Offset),
+				ChunkWordLen << WORD_LENGTH_SHIFT, 0);
+
+		Offset = NextOffset;
+		ChunkWordLen = NextWordLen;
+	}
+
+	MD5Final(&Context, &CalcChecksum[0], 0);
+
+	/*
+	 * Compare actual checksum with the calculated checksum
+	 */
+	for (Index = 0; Index < MD5_CHECKSUM_SIZE; Index++) {
+		if (Checksum[Index] != CalcChecksum[Index]) {
+			fsbl_printf(DEBUG_GENERAL, "Error: "
+					"Partition DataChecksum 0x%0x!= 0x%0x\r\n",
+					Checksum[Index], CalcChecksum[Index]);
+			return XST_FAILURE;
+		}
+	}
+
+	fsbl_printf(DEBUG_INFO, "Partition Validation Done\r\n");
+	PartitionValidatedFlag = 1;
+
+	return XST_SUCCESS;
+}
@@ -85,6 +85,9 @@
 * 											In pcap.c, check pl power
 * 											through MCTRL register for
 * 											3.0 and later versions of silicon.
+* 17.00a ag  10/18/26   Split PcapDataTransfer in PcapDataTransferStart and
+* 						PcapDataTransferWait so that the caller can work on
+* 						data already moved while the DMA is running
 * </pre>
 *
 * @note
@@ -154,7 +157,66 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 				u32 SourceLength, u32 DestinationLength, u32 SecureTransfer)
 {
 	u32 Status;
-	u32 IntrStsReg;
+
+#ifdef FSBL_PERF
+	XTime tXferCur = 0;
+	FsblGetGlobalTime(&tXferCur);
+#endif
+
+	Status = PcapDataTransferStart(SourceDataPtr, DestinationDataPtr,
+					SourceLength, DestinationLength, SecureTransfer);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Dump the PCAP registers
+	 */
+	PcapDumpRegisters();
+
+	Status = PcapDataTransferWait();
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * For Performance measurement
+	 */
+#ifdef FSBL_PERF
+	XTime tXferEnd = 0;
+	fsbl_printf(DEBUG_GENERAL,"Time taken is ");
+	FsblMeasurePerfTime(tXferCur,tXferEnd);
+#endif
+
+	return XST_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+*
+* This function starts a PCAP DMA transfer and returns without waiting for
+* it to complete. PcapDataTransferWait has to be called before the next
+* transfer is started.
+*
+* @param 	SourceDataPtr is a pointer to where the data is read from
+* @param 	DestinationDataPtr is a pointer to where the data is written to
+* @param 	SourceLength is the length of the data to be moved in words
+* @param 	DestinationLength is the length of the data to be moved in words
+* @param 	SecureTransfer indicated the encryption key location, 0 for
+* 			non-encrypted
+*
+* @return
+*		- XST_SUCCESS if the transfer is started
+*		- XST_FAILURE if the transfer could not be started
+*
+* @note		 None
+*
+****************************************************************************/
+u32 PcapDataTransferStart(u32 *SourceDataPtr, u32 *DestinationDataPtr,
+				u32 SourceLength, u32 DestinationLength, u32 SecureTransfer)
+{
+	u32 Status;
 	u32 PcapTransferType = XDCFG_CONCURRENT_NONSEC_READ_WRITE;
 
 	/*
@@ -164,11 +226,6 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		PcapTransferType = XDCFG_CONCURRENT_SECURE_READ_WRITE;
 	}
 
-#ifdef FSBL_PERF
-	XTime tXferCur = 0;
-	FsblGetGlobalTime(&tXferCur);
-#endif
-
 	/*
 	 * Clear the PCAP status registers
 	 */
@@ -203,10 +260,29 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		return XST_FAILURE;
 	}
 
-	/*
-	 * Dump the PCAP registers
-	 */
-	PcapDumpRegisters();
+	return XST_SUCCESS;
+}
+
+
+/******************************************************************************/
+/**
+*
+* This function waits for the PCAP DMA transfer started by
+* PcapDataTransferStart to complete and checks it for errors.
+*
+* @param 	None
+*
+* @return
+*		- XST_SUCCESS if the transfer is successful
+*		- XST_FAILURE if the transfer fails
+*
+* @note		 None
+*
+****************************************************************************/
+u32 PcapDataTransferWait(void)
+{
+	u32 Status;
+	u32 IntrStsReg;
 
 	/*
 	 * Poll for the DMA done
@@ -218,7 +294,7 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 	}
 
 	fsbl_printf(DEBUG_INFO,"DMA Done ! \n\r");
-		
+
 	/*
 	 * Check for errors
 	 */
@@ -228,15 +304,6 @@ u32 PcapDataTransfer(u32 *SourceDataPtr, u32 *DestinationDataPtr,
 		return XST_FAILURE;
 	}
 
-	/*
-	 * For Performance measurement
-	 */
-#ifdef FSBL_PERF
-	XTime tXferEnd = 0;
-	fsbl_printf(DEBUG_GENERAL,"Time taken is ");
-	FsblMeasurePerfTime(tXferCur,tXferEnd);
-#endif
-
 	return XST_SUCCESS;
 }
 
@@ -46,6 +46,9 @@
 *       vns  02/17/17 Added PPK hash and SPK ID verification when eFUSE
 *                     RSA authentication is enabled
 * 3.0   vns  09/08/17 Added PPK revoke check.
+*       ag   10/19/26 Added per-boot cache of verified PPK/SPK keys so that
+*                     only the partition signature is verified when the
+*                     same key is reused by subsequent partitions.
 *
 * </pre>
 *
@@ -63,6 +66,9 @@
 u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen);
 u32 XFsbl_PpkSpkIdVer(u64 AcOffset, u32 HashLen);
 void XFsbl_ReadPpkHashSpkID(u32 *PpkHash, u8 PpkSelect, u32 *SpkId);
+static void XFsbl_AuthKeyHash(u64 AcOffset, u32 HashLen, u8 *KeyHash);
+static XFsblPs_AuthKeyCache *XFsbl_AuthKeyCacheLookup(const u8 *KeyHash,
+				u32 HashLen);
 /*****************************************************************************/
 
 static XSecure_Rsa SecureRsa;
@@ -74,6 +80,18 @@ extern u8 ReadBuffer[READ_BUFFER_SIZE];
 u8 EfusePpkHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4)))={0U};
 u8 EfuseSpkID[XFSBL_SPKID_AC_ALIGN]={0U};
 
+/*
+ * Keys which are already verified in this boot. Contents are valid for
+ * the life time of the FSBL only, eFUSE PPK hash and SPK ID can not change
+ * while FSBL is running.
+ */
+static XFsblPs_AuthKeyCache AuthKeyCache[XFSBL_AUTH_KEY_CACHE_SIZE];
+static u32 AuthKeyCacheNext = 0U;
+#ifdef XFSBL_PERF
+static u32 AuthKeyCacheHits = 0U;
+static XTime AuthKeyCacheSaved = 0U;
+#endif
+
 /*****************************************************************************/
 /**
  * Configure the RSA and SHA for the SPK
@@ -334,6 +352,179 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * Calculates the hash which identifies the keys of an authentication
+ * certificate. It covers the AC header (PPK select and SPK ID), PPK, SPK
+ * and SPK signature, i.e. all the data verified by XFsbl_PpkSpkIdVer()
+ * and XFsbl_SpkVer().
+ *
+ * @param	AcOffset is the authentication certificate address
+ * @param	HashLen holds the type of authentication enabled
+ * @param	KeyHash is the buffer of size XFSBL_HASH_TYPE_SHA3 to store
+ *		the hash
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XFsbl_AuthKeyHash(u64 AcOffset, u32 HashLen, u8 *KeyHash)
+{
+	u8 * AcPtr = (u8*) (PTRSIZE) AcOffset;
+	void * ShaCtx = (void * )NULL;
+
+#ifdef XFSBL_SHA2
+	sha2_context ShaCtxObj;
+	ShaCtx = &ShaCtxObj;
+#endif
+
+	(void)memset(KeyHash, 0U, XFSBL_HASH_TYPE_SHA3);
+
+	(void)XFsbl_ShaStart(ShaCtx, HashLen);
+	XFsbl_ShaUpdate(ShaCtx, AcPtr, XFSBL_AUTH_HEADER_SIZE, HashLen);
+	XFsbl_ShaUpdate(ShaCtx, AcPtr + XFSBL_RSA_AC_ALIGN,
+		(XFSBL_PPK_SIZE + XFSBL_SPK_SIZE + XFSBL_SPK_SIG_SIZE),
+		HashLen);
+	XFsbl_ShaFinish(ShaCtx, KeyHash, HashLen);
+}
+
+/*****************************************************************************/
+/**
+ * Looks up the verified key cache.
+ *
+ * @param	KeyHash is the hash calculated by XFsbl_AuthKeyHash()
+ * @param	HashLen holds the type of authentication enabled
+ *
+ * @return	Pointer to the matching cache entry or NULL
+ *
+ ******************************************************************************/
+static XFsblPs_AuthKeyCache *XFsbl_AuthKeyCacheLookup(const u8 *KeyHash,
+				u32 HashLen)
+{
+	XFsblPs_AuthKeyCache *Entry = NULL;
+	u32 Index;
+
+	for (Index = 0U; Index < XFSBL_AUTH_KEY_CACHE_SIZE; Index++) {
+		if ((AuthKeyCache[Index].IsValid == TRUE) &&
+			(AuthKeyCache[Index].HashLen == HashLen) &&
+			(XFsbl_CompareHashs((u8 *)KeyHash,
+				AuthKeyCache[Index].KeyHash) == XFSBL_SUCCESS)) {
+			Entry = &AuthKeyCache[Index];
+			break;
+		}
+	}
+
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+ * Verifies the PPK (against eFUSE when RSA authentication is enabled) and
+ * SPK signature of an authentication certificate. Keys which are verified
+ * successfully are remembered for the rest of the boot, so partitions
+ * signed with an already verified key only need their own signature
+ * verification.
+ *
+ * @param	AcOffset is the authentication certificate address
+ * @param	HashLen holds the type of authentication enabled
+ * @param	EfuseRsaEn is non zero if eFUSE RSA authentication is enabled
+ *
+ * @return
+ *		- XFSBL_SUCCESS if keys are verified or found in the cache
+ *		- Error code of XFsbl_PpkSpkIdVer() / XFsbl_SpkVer() on
+ *		failure
+ *
+ ******************************************************************************/
+u32 XFsbl_AuthKeyVer(u64 AcOffset, u32 HashLen, u32 EfuseRsaEn)
+{
+	u8 KeyHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4)));
+	XFsblPs_AuthKeyCache *Entry;
+	u32 Status;
+#ifdef XFSBL_PERF
+	XTime tStart = 0;
+	XTime tEnd = 0;
+
+	XTime_GetTime(&tStart);
+#endif
+
+	/* Re-initialize CSU DMA. This is a workaround and need to be removed */
+	Status = XFsbl_CsuDmaInit();
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	XFsbl_AuthKeyHash(AcOffset, HashLen, KeyHash);
+
+	Entry = XFsbl_AuthKeyCacheLookup(KeyHash, HashLen);
+	if (Entry != NULL) {
+		XFsbl_Printf(DEBUG_INFO, "Auth: PPK/SPK already verified\r\n");
+#ifdef XFSBL_PERF
+		XTime_GetTime(&tEnd);
+		AuthKeyCacheHits++;
+		if (Entry->VerTime > (tEnd - tStart)) {
+			AuthKeyCacheSaved += Entry->VerTime - (tEnd - tStart);
+		}
+#endif
+		goto END;
+	}
+
+	/* PPK hash and SPK ID verification when eFUSE RSA bit is programmed */
+	if (EfuseRsaEn != 0x00U) {
+		Status = XFsbl_PpkSpkIdVer(AcOffset, HashLen);
+		if (Status != XFSBL_SUCCESS) {
+			goto END;
+		}
+	}
+
+	/* Do SPK Signature verification using PPK */
+	Status = XFsbl_SpkVer(AcOffset, HashLen);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	/* Remember the verified keys, replacing the oldest entry */
+	Entry = &AuthKeyCache[AuthKeyCacheNext];
+	(void)memcpy(Entry->KeyHash, KeyHash, XFSBL_HASH_TYPE_SHA3);
+	Entry->HashLen = HashLen;
+	Entry->IsValid = TRUE;
+#ifdef XFSBL_PERF
+	XTime_GetTime(&tEnd);
+	Entry->VerTime = tEnd - tStart;
+#endif
+	AuthKeyCacheNext = (AuthKeyCacheNext + 1U) % XFSBL_AUTH_KEY_CACHE_SIZE;
+
+END:
+	return Status;
+}
+
+#ifdef XFSBL_PERF
+/*****************************************************************************/
+/**
+ * Prints the time saved by skipping the PPK/SPK verification of keys
+ * which were already verified in this boot.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XFsbl_AuthKeyCacheReport(void)
+{
+	u64 tSavedNs;
+
+	if (AuthKeyCacheHits == 0U) {
+		return;
+	}
+
+	tSavedNs = ((double)AuthKeyCacheSaved /
+			(double)COUNTS_PER_SECOND) * 1e9;
+
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, "%d.%06d ms.: PPK/SPK Ver. Time saved"
+		" (%d partitions used verified keys)\r\n",
+		(u32)(tSavedNs / 1000000U), (u32)(tSavedNs % 1000000U),
+		AuthKeyCacheHits);
+}
+#endif
+
 /*****************************************************************************/
 /**
  *
@@ -400,22 +591,15 @@ u32 XFsbl_Authentication(const XFsblPs * FsblInstancePtr, u64 PartitionOffset,
 					1U, (u32 *)EfuseSpkID);
 		}
 	}
-	/* PPK hash and SPK ID verification when eFUSE RSA bit is programmed */
-	if (EfuseRsaEn != 0x00U) {
-		Status = XFsbl_PpkSpkIdVer(AcOffset, HashLen);
-		if (Status != XFSBL_SUCCESS) {
-			goto END;
-		}
+	/*
+	 * PPK hash, SPK ID (when eFUSE RSA bit is programmed) and
+	 * SPK signature verification, skipped for already verified keys
+	 */
+	Status = XFsbl_AuthKeyVer(AcOffset, HashLen, EfuseRsaEn);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
 	}
 
-        /* Do SPK Signature verification using PPK */
-        Status = XFsbl_SpkVer(AcOffset, HashLen);
-
-        if(XFSBL_SUCCESS != Status)
-        {
-                goto END;
-        }
-
         /* Do Partition Signature verification using SPK */
         Status = XFsbl_PartitionSignVer(FsblInstancePtr, PartitionOffset,
 					PartitionLen, AcOffset, PartitionNum);
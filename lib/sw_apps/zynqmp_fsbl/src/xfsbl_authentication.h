@@ -46,6 +46,7 @@
 * 1.0   ssc  01/20/16 Initial release
 * 2.0   bv   12/05/16 Made compliance to MISRAC 2012 guidelines.
 *       vns  02/17/17 Added API prototype to compare hashs
+*       ag   10/19/26 Added verified PPK/SPK key cache
 *
 * </pre>
 *
@@ -102,6 +103,24 @@ extern "C" {
 
 #define XFSBL_AUTH_BUFFER_SIZE	(XFSBL_AUTH_CERT_MIN_SIZE)
 
+/* Number of verified PPK/SPK keys remembered during a boot */
+#define XFSBL_AUTH_KEY_CACHE_SIZE	(4U)
+
+#ifdef XFSBL_SECURE
+/**
+ * Verified PPK/SPK key cache entry
+ */
+typedef struct {
+	u8 KeyHash[XFSBL_HASH_TYPE_SHA3]
+		__attribute__ ((aligned (4))); /**< Hash of AC keys */
+	u32 HashLen; /**< SHA3/SHA2 used for KeyHash */
+	u32 IsValid; /**< TRUE once the keys are verified */
+#ifdef XFSBL_PERF
+	XTime VerTime; /**< Time taken for the full key verification */
+#endif
+} XFsblPs_AuthKeyCache;
+#endif
+
 /**
 * CSU RSA Register Map
 */
@@ -116,6 +135,10 @@ void XFsbl_ShaStart(void * Ctx, u32 HashLen);
 void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
 void XFsbl_ShaFinish(void * Ctx, u8 * Hash, u32 HashLen);
 u32 XFsbl_CompareHashs(u8 *Hash1, u8 *Hash2);
+u32 XFsbl_AuthKeyVer(u64 AcOffset, u32 HashLen, u32 EfuseRsaEn);
+#ifdef XFSBL_PERF
+void XFsbl_AuthKeyCacheReport(void);
+#endif
 #endif
 
 
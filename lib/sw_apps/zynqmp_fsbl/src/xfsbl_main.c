@@ -46,6 +46,7 @@
 * 1.00  ba   02/22/16 Added performance measurement feature.
 * 2.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
 *                     Added warm restart support
+*       ag   10/19/26 Print time saved by the verified PPK/SPK key cache
 *
 * </pre>
 *
@@ -56,6 +57,7 @@
 /***************************** Include Files *********************************/
 #include "xfsbl_hw.h"
 #include "xfsbl_main.h"
+#include "xfsbl_authentication.h"
 #include "bspconfig.h"
 
 /************************** Constant Definitions *****************************/
@@ -232,6 +234,9 @@ int main(void )
 						XFsbl_MeasurePerfTime(FsblInstance.PerfTime.tFsblStart);
 						XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": Total Time \n\r");
 						XFsbl_Printf(DEBUG_PRINT_ALWAYS, "Note: Total execution time includes print times \n\r");
+#ifdef XFSBL_SECURE
+						XFsbl_AuthKeyCacheReport();
+#endif
 #endif
 						FsblStage = XFSBL_STAGE4;
 						EarlyHandoff = FsblStatus;
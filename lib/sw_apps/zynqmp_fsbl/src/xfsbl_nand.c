@@ -43,6 +43,8 @@
 * Ver   Who  Date        Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  kc   04/21/14 Initial release
+* 2.0   ag   10/18/26 Use the good block map and XNandPsu_BulkRead() to
+*                     load partitions
 *
 * </pre>
 *
@@ -132,36 +134,40 @@ u32 XFsbl_NandCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 	u32 Status = XFSBL_SUCCESS;
 	u32 MultiBootOffset=0U;
 	u32 FlashImageOffsetAddress=0U;
-	u32 CurrentBlock;
-	u32 RealSrcAddress;
-	u32 NoofBlocks;
+	u32 BlockSize;
+	u32 LogicalBlock;
+	u32 RealBlock;
+	u64 RealSrcAddress;
 
 	/**
 	 * Read the Multiboot Register
 	 */
 	MultiBootOffset = XFsbl_In32(CSU_CSU_MULTI_BOOT);
 	FlashImageOffsetAddress = MultiBootOffset * XFSBL_IMAGE_SEARCH_OFFSET;
-	CurrentBlock = (u32)(FlashImageOffsetAddress/NandInstPtr->Geometry.BlockSize);
-	NoofBlocks= ((SrcAddress - FlashImageOffsetAddress) / NandInstPtr->Geometry.BlockSize) + 1;
-	RealSrcAddress=SrcAddress;
-
-	while(NoofBlocks > 0)
-	{
-		if (XNandPsu_IsBlockBad(NandInstPtr, CurrentBlock) == XST_SUCCESS)
-		{
-			XFsbl_Printf(DEBUG_DETAILED, "Identified block (%d) as bad\r\n",
-											CurrentBlock);
-			RealSrcAddress= RealSrcAddress + NandInstPtr->Geometry.BlockSize ;
-			XFsbl_Printf(DEBUG_DETAILED,
-						"Src Address: %x, Calculated real Address:%x\r\n",
-						SrcAddress, RealSrcAddress);
-		}
-		CurrentBlock+=1;
-		NoofBlocks-=1;
-	}
+	BlockSize = NandInstPtr->Geometry.BlockSize;
 
-	Status = (u32)XNandPsu_Read(NandInstPtr, (u64)(RealSrcAddress),(u64)Length,
-                                               (u8 *) DestAddress);
+	/**
+	 * Offsets in the image are relative to good blocks only, so
+	 * translate the block holding SrcAddress through the good block
+	 * map of the driver
+	 */
+	LogicalBlock = XNandPsu_GetLogicalBlock(NandInstPtr,
+				FlashImageOffsetAddress / BlockSize) +
+			((SrcAddress - FlashImageOffsetAddress) / BlockSize);
+	if (XNandPsu_GetPhysicalBlock(NandInstPtr, LogicalBlock, &RealBlock)
+						!= XST_SUCCESS) {
+		Status = XFSBL_ERROR_NAND_READ;
+		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_NAND_READ\r\n");
+		goto END;
+	}
+	RealSrcAddress = ((u64)RealBlock * BlockSize) +
+				(SrcAddress % BlockSize);
+	XFsbl_Printf(DEBUG_DETAILED,
+			"Src Address: %x, Calculated real Address:%x\r\n",
+			SrcAddress, (u32)RealSrcAddress);
+
+	Status = (u32)XNandPsu_BulkRead(NandInstPtr, RealSrcAddress,
+				(u64)Length, (u8 *) DestAddress);
 	if (Status != XST_SUCCESS) {
 		Status = XFSBL_ERROR_NAND_READ;
 		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_NAND_READ\r\n");
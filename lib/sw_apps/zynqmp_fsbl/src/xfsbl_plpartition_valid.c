@@ -46,6 +46,9 @@
 * and compares with the stored hash. If matched each chunk will be sent to AES
 * if decryption exists or to PCAP throught CSUDMA.
 * The above process will be repeated for all the blocks of bitstream.
+* The chunk buffer is used as two halves, so that while CSU DMA is feeding one
+* half to SHA3 or PCAP, the other half is read from boot device or DDR. A chunk
+* is sent to PCAP only after the hash of the complete chunk is compared.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -53,6 +56,9 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- -----------------------------------------------------
 * 1.0   vns     01/28/17 First release
+*       ag      10/19/26 Blocks signed with already verified keys skip the
+*                        PPK/SPK verification
+*       ag      10/19/26 Overlapped chunk reads with SHA3 and PCAP transfers
 * </pre>
 *
 ******************************************************************************/
@@ -64,10 +70,11 @@
 
 /************************** Constant Definitions ****************************/
 
+/* Size of one half of the chunk buffer, word aligned */
+#define XFSBL_PL_HALF_CHUNK(ChunkSize)	(((ChunkSize) / 2U) & ~(u32)3U)
+
 /************************** Function Prototypes ******************************/
 #if defined (XFSBL_BS) && defined (XFSBL_SECURE)
-extern u32 XFsbl_PpkSpkIdVer(u64 AcOffset, u32 HashLen);
-extern u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen);
 extern u32 XFsbl_AdmaCopy(void * DestPtr, void * SrcPtr, u32 Size);
 extern u32 XFsbl_PcapWaitForDone(void);
 static u32 XFsbl_DecrptPl(XFsblPs_PlPartition *PartitionParams,
@@ -79,6 +86,10 @@ static u32 XFsbl_PlBlockAuthentication(XFsblPs * FsblInstancePtr,
 			UINTPTR SrcAddress, u32 Length, u8 *AuthCer);
 static void XFsbl_DmaPlCopy(XCsuDma *InstancePtr, UINTPTR Src,
 		u32 Size, u8 EnLast);
+static void XFsbl_DmaPlWaitForDone(XCsuDma *InstancePtr);
+static u32 XFsbl_PlHashChunk(XFsblPs_PlPartition *PartitionParams,
+		XSecure_Sha3 *SecureSha3, UINTPTR ChunkAdrs, u32 ChunkLen,
+		UINTPTR NextAdrs, u32 NextLen);
 static u32 XFsbl_CopyData(XFsblPs_PlPartition *PartitionPtr,
 		u8 *DstPtr, u8 *SrcPtr, u32 Size);
 static u32 XFsbl_DecrypSecureHdr(XSecure_Aes *InstancePtr, u64 SrcAddr,
@@ -272,17 +283,13 @@ static u32 XFsbl_PlBlockAuthentication(XFsblPs * FsblInstancePtr,
 			PartitionParams->PlAuth.NoOfHashs);
 		return XFSBL_ERROR_PROVIDED_BUF_HASH_STORE;
 	}
-	/* PPK hash and SPK ID verification when eFSUE RSA bit is programmed */
-	if (EfuseRsaEn != 0x00U) {
-		Status = XFsbl_PpkSpkIdVer((UINTPTR)AuthCer,
-			PartitionParams->PlAuth.AuthType);
-		if (Status != XFSBL_SUCCESS) {
-			goto END;
-		}
-	}
-
-	/* Do SPK Signature verification using PPK */
-	Status = XFsbl_SpkVer((UINTPTR)AuthCer, PartitionParams->PlAuth.AuthType);
+	/*
+	 * PPK hash, SPK ID (when eFSUE RSA bit is programmed) and SPK
+	 * signature verification, skipped if the block's keys are
+	 * already verified
+	 */
+	Status = XFsbl_AuthKeyVer((UINTPTR)AuthCer,
+			PartitionParams->PlAuth.AuthType, EfuseRsaEn);
 	if (XFSBL_SUCCESS != Status) {
 		goto END;
 	}
@@ -321,6 +328,8 @@ END:
 * This function re-authenticates the each chunk of the block and compares
 * with the stored hash and sends the data AES engine if encryption exists
 * and to PCAP directly in encryption is not existing.
+* While the second half of a chunk is sent to PCAP, the first half of the
+* next chunk is read in to the chunk buffer.
 *
 * @param	PartitionParams is a pointer to XFsblPs_PlPartition
 * @param	Address start address of the authentication block.
@@ -331,19 +340,24 @@ END:
 * 		Error code on failure
 * 		XFSBL_SUCESS on success
 *
-* @note		None.
+* @note		First half of the first chunk should be already read in to
+*		the chunk buffer by XFsbl_PlSignVer().
 *
 ******************************************************************************/
 static u32 XFsbl_ReAuthenticationBlock(XFsblPs_PlPartition *PartitionParams,
 				UINTPTR Address, u32 BlockLen, u32 NoOfChunks)
 {
 	u32 Status;
+	u32 CopyStatus;
 	u32 Index;
-	u32 Len = PartitionParams->ChunkSize;;
+	u32 Len = PartitionParams->ChunkSize;
+	u32 HalfLen = XFSBL_PL_HALF_CHUNK(PartitionParams->ChunkSize);
+	u32 FirstLen;
+	u32 NextLen;
 	UINTPTR Offset;
 	u8 ChunksHash[48];
 	XSecure_Sha3 SecureSha3;
-	u32 HashDataLen = BlockLen;
+	u8 *ChunkBuf = PartitionParams->ChunkBuffer;
 	u8 *HashStored = PartitionParams->PlAuth.HashsOfChunks;
 	(void)memset(ChunksHash,0U,sizeof(ChunksHash));
 
@@ -358,23 +372,32 @@ static u32 XFsbl_ReAuthenticationBlock(XFsblPs_PlPartition *PartitionParams,
 	for (Index = 0; Index < NoOfChunks; Index++) {
 			/* Last chunk */
 			if (Index == NoOfChunks -1) {
-				Len = HashDataLen;
+				Len = BlockLen -
+					(PartitionParams->ChunkSize * Index);
 			}
 			Offset = (UINTPTR)Address +
 				(u64)(PartitionParams->ChunkSize * Index);
+			FirstLen = (Len > HalfLen) ? HalfLen : Len;
+
+			/* Length of first half of next chunk to be read */
+			NextLen = 0U;
+			if (Index + 1 < NoOfChunks) {
+				NextLen = BlockLen -
+					(PartitionParams->ChunkSize * (Index + 1));
+				if (NextLen > HalfLen) {
+					NextLen = HalfLen;
+				}
+			}
 
-			/* Copy from DDR or flash to Buffer */
-			Status = XFsbl_CopyData(PartitionParams,
-						PartitionParams->ChunkBuffer,
-							(u8 *)Offset, Len);
+			/*
+			 * Calculating hash for each chunk, chunk buffer is
+			 * not overwritten until chunk is sent to AES/PCAP
+			 */
+			Status = XFsbl_PlHashChunk(PartitionParams, &SecureSha3,
+					Offset, Len, 0U, 0U);
 			if (Status != XFSBL_SUCCESS) {
-				return Status;
+				goto END;
 			}
-			/* Calculating hash for each chunk */
-			XSecure_SssSetup(XSecure_SssInputSha3
-					(XSECURE_CSU_SSS_SRC_SRC_DMA));
-			XSecure_Sha3Update(&SecureSha3,
-				PartitionParams->ChunkBuffer, Len);
 			XSecure_Sha3_ReadHash(&SecureSha3, (u8 *)ChunksHash);
 
 			/* Comparing with stored Hashs */
@@ -392,12 +415,8 @@ static u32 XFsbl_ReAuthenticationBlock(XFsblPs_PlPartition *PartitionParams,
 				Status = XFSBL_ERROR_CHUNK_HASH_COMPARISON;
 				goto END;
 			}
-			/* Remaining block size will be in HashDataLen */
-			HashDataLen = HashDataLen - PartitionParams->ChunkSize;
-			if (Index+1 <= NoOfChunks - 1) {
-				HashStored = HashStored +
+			HashStored = HashStored +
 					PartitionParams->PlAuth.AuthType;
-			}
 
 			/* If image is not encrypted */
 			if (PartitionParams->IsEncrypted == FALSE) {
@@ -408,18 +427,52 @@ static u32 XFsbl_ReAuthenticationBlock(XFsblPs_PlPartition *PartitionParams,
 
 				/* Copy bitstream to PCAP */
 				XFsbl_DmaPlCopy(PartitionParams->CsuDmaPtr,
-					(UINTPTR)PartitionParams->ChunkBuffer,
-						Len/4, 0);
+					(UINTPTR)ChunkBuf, FirstLen/4, 0);
+
+				CopyStatus = XFSBL_SUCCESS;
+				if (Len > FirstLen) {
+					XCsuDma_Transfer(
+						PartitionParams->CsuDmaPtr,
+						XCSUDMA_SRC_CHANNEL,
+						(UINTPTR)(ChunkBuf + HalfLen),
+						(Len - FirstLen)/4, 0);
+					/* Read next chunk's first half */
+					if (NextLen != 0U) {
+						CopyStatus = XFsbl_CopyData(
+							PartitionParams,
+							ChunkBuf,
+							(u8 *)(Offset +
+							PartitionParams->ChunkSize),
+							NextLen);
+						NextLen = 0U;
+					}
+					XFsbl_DmaPlWaitForDone(
+						PartitionParams->CsuDmaPtr);
+				}
 
 				Status = XFsbl_PcapWaitForDone();
 				if (Status != XFSBL_SUCCESS) {
 					goto END;
 				}
+				if (CopyStatus != XFSBL_SUCCESS) {
+					Status = CopyStatus;
+					goto END;
+				}
 			}
 			/* If image is encrypted */
 			else {
 				Status = XFsbl_DecrptPlChunks(PartitionParams,
-					(UINTPTR)PartitionParams->ChunkBuffer, Len);
+					(UINTPTR)ChunkBuf, Len);
+				if (Status != XFSBL_SUCCESS) {
+					goto END;
+				}
+			}
+
+			/* Read next chunk's first half if not read already */
+			if (NextLen != 0U) {
+				Status = XFsbl_CopyData(PartitionParams,
+					ChunkBuf, (u8 *)(Offset +
+					PartitionParams->ChunkSize), NextLen);
 				if (Status != XFSBL_SUCCESS) {
 					goto END;
 				}
@@ -431,6 +484,72 @@ END:
 
 }
 
+/******************************************************************************
+*
+* This function calculates the hash of a chunk in two halves. CSU DMA sends
+* one half of the chunk buffer to SHA3 while the other half is read from
+* boot device or DDR.
+*
+* @param	PartitionParams is a pointer to XFsblPs_PlPartition
+* @param	SecureSha3 is a pointer to started SHA3 instance
+* @param	ChunkAdrs is the chunk address on boot device or DDR
+* @param	ChunkLen is the chunk size
+* @param	NextAdrs is the address to be read in to first half of the
+*		chunk buffer once it is hashed, 0 if nothing to be read
+* @param	NextLen is the size to be read from NextAdrs
+*
+* @return
+* 		Error code on failure
+* 		XFSBL_SUCESS on success
+*
+* @note		First half of the chunk should be already read in to the
+*		chunk buffer. SHA3 digest is not read by this function.
+*
+******************************************************************************/
+static u32 XFsbl_PlHashChunk(XFsblPs_PlPartition *PartitionParams,
+		XSecure_Sha3 *SecureSha3, UINTPTR ChunkAdrs, u32 ChunkLen,
+		UINTPTR NextAdrs, u32 NextLen)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 CopyStatus = XFSBL_SUCCESS;
+	u32 HalfLen = XFSBL_PL_HALF_CHUNK(PartitionParams->ChunkSize);
+	u32 FirstLen = (ChunkLen > HalfLen) ? HalfLen : ChunkLen;
+	u32 SecondLen = ChunkLen - FirstLen;
+	u8 *ChunkBuf = PartitionParams->ChunkBuffer;
+
+	XSecure_SssSetup(XSecure_SssInputSha3(XSECURE_CSU_SSS_SRC_SRC_DMA));
+
+	/* Hash first half while second half is read */
+	XSecure_Sha3UpdateStart(SecureSha3, ChunkBuf, FirstLen);
+	if (SecondLen != 0U) {
+		CopyStatus = XFsbl_CopyData(PartitionParams,
+				ChunkBuf + HalfLen,
+				(u8 *)(ChunkAdrs + HalfLen), SecondLen);
+	}
+	XSecure_Sha3UpdateComplete(SecureSha3);
+	if (CopyStatus != XFSBL_SUCCESS) {
+		Status = CopyStatus;
+		goto END;
+	}
+
+	/* Hash second half while first half of next data is read */
+	if (SecondLen != 0U) {
+		XSecure_Sha3UpdateStart(SecureSha3,
+				ChunkBuf + HalfLen, SecondLen);
+	}
+	if (NextLen != 0U) {
+		CopyStatus = XFsbl_CopyData(PartitionParams, ChunkBuf,
+				(u8 *)NextAdrs, NextLen);
+	}
+	if (SecondLen != 0U) {
+		XSecure_Sha3UpdateComplete(SecureSha3);
+	}
+	Status = CopyStatus;
+
+END:
+	return Status;
+}
+
 /******************************************************************************
 *
 * This function performs authentication and RSA signature verification for
@@ -467,7 +586,10 @@ static u32 XFsbl_PlSignVer(XFsblPs_PlPartition *PartitionParams,
 	XSecure_Rsa SecureRsa={0U};
 	u32 Index;
 	u32 Len = PartitionParams->ChunkSize;
+	u32 HalfLen = XFSBL_PL_HALF_CHUNK(PartitionParams->ChunkSize);
 	u64 Offset;
+	UINTPTR NextAdrs;
+	u32 NextLen;
 
 	/* Start the SHA engine */
 	if (XSECURE_HASH_TYPE_SHA3 == PartitionParams->PlAuth.AuthType) {
@@ -486,6 +608,13 @@ static u32 XFsbl_PlSignVer(XFsblPs_PlPartition *PartitionParams,
 		XSecure_Sha3Start(&SecureSha3);
 	}
 
+	/* Read first half of the first chunk */
+	Status = XFsbl_CopyData(PartitionParams, PartitionParams->ChunkBuffer,
+		(u8 *)BlockAdrs, (BlockSize > HalfLen) ? HalfLen : BlockSize);
+	if (Status != XFSBL_SUCCESS) {
+		return Status;
+	}
+
 	/* SHA calculation */
 	for (Index = 0; Index < NoOfChunks; Index++) {
 		/*
@@ -499,16 +628,27 @@ static u32 XFsbl_PlSignVer(XFsblPs_PlPartition *PartitionParams,
 		Offset = (u64)BlockAdrs +
 			(u64)(PartitionParams->ChunkSize * Index);
 
-		Status = XFsbl_CopyData(PartitionParams,
-			PartitionParams->ChunkBuffer, (u8 *)(UINTPTR)Offset, Len);
+		/*
+		 * Next chunk's first half is read while hashing, after the
+		 * last chunk first chunk is read again for re-authentication
+		 */
+		if (Index+1 < NoOfChunks) {
+			NextAdrs = (UINTPTR)(Offset + PartitionParams->ChunkSize);
+			NextLen = HashDataLen - PartitionParams->ChunkSize;
+		}
+		else {
+			NextAdrs = BlockAdrs;
+			NextLen = BlockSize;
+		}
+		if (NextLen > HalfLen) {
+			NextLen = HalfLen;
+		}
+
+		Status = XFsbl_PlHashChunk(PartitionParams, &SecureSha3,
+				(UINTPTR)Offset, Len, NextAdrs, NextLen);
 		if (Status != XFSBL_SUCCESS) {
 			return Status;
 		}
-		XSecure_SssSetup(XSecure_SssInputSha3
-				(XSECURE_CSU_SSS_SRC_SRC_DMA));
-
-		XSecure_Sha3Update(&SecureSha3,
-			PartitionParams->ChunkBuffer, Len);
 		XSecure_Sha3_ReadHash(&SecureSha3,
 				(u8 *)ChunksHash);
 
@@ -603,12 +743,28 @@ static void XFsbl_DmaPlCopy(XCsuDma *InstancePtr, UINTPTR Src, u32 Size,
 	/* Data transfer */
 	XCsuDma_Transfer(InstancePtr, XCSUDMA_SRC_CHANNEL, (UINTPTR)Src,
 							Size, EnLast);
+	XFsbl_DmaPlWaitForDone(InstancePtr);
+
+}
+
+/******************************************************************************
+*
+* This function waits for the CSU DMA source channel transfer to be done.
+*
+* @param	InstancePtr is an instance of CSUDMA
+*
+* @return	None
+*
+* @note		None
+*
+******************************************************************************/
+static void XFsbl_DmaPlWaitForDone(XCsuDma *InstancePtr)
+{
 	/* Polling for transfer to be done */
 	XCsuDma_WaitForDone(InstancePtr, XCSUDMA_SRC_CHANNEL);
 	/* To acknowledge the transfer has completed */
 	XCsuDma_IntrClear(InstancePtr, XCSUDMA_SRC_CHANNEL,
 					XCSUDMA_IXR_DONE_MASK);
-
 }
 
 /*****************************************************************************
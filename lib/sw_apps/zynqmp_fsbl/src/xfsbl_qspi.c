@@ -47,6 +47,10 @@
 *                     32Bit boot mode support
 * 3.0   bv   12/02/16 Made compliance to MISRAC 2012 guidelines
 *       ds   01/03/17 Add support for Micron QSPI 2G part
+*       ag   10/18/26 Use the chunked streaming read of the QSPIPSU driver
+*                     for word aligned copies
+*       ag   10/19/26 Build the polled read messages only when the copy is
+*                     not streamed
 *
 * </pre>
 *
@@ -73,9 +77,16 @@
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
+/*
+ * Word aligned reads are streamed in back to back chunks by the driver,
+ * the others go through the polled transfer
+ */
+#define XFsbl_QspiCanStream(DestAddress, TransferBytes) \
+	((((DestAddress) | (PTRSIZE)(TransferBytes)) & 0x3U) == 0U)
 
 /************************** Function Prototypes ******************************/
 static u32 FlashReadID(XQspiPsu *QspiPsuPtr);
+static void XFsbl_QspiStreamSetup(u8 AddrBytes);
 
 /************************** Variable Definitions *****************************/
 static XQspiPsu QspiPsuInstance;
@@ -84,6 +95,7 @@ static u32 QspiFlashMake=0U;
 static u32 ReadCommand=0U;
 static XQspiPsu_Msg FlashMsg[5];
 static u8 IssiIdFlag=0U;
+static XQspiPsu_StreamCfg QspiStreamCfg;
 
 static u8 TxBfrPtr __attribute__ ((aligned(32)));
 static u8 ReadBuffer[10] __attribute__ ((aligned(32)));
@@ -200,6 +212,46 @@ END:
 }
 
 
+/*****************************************************************************/
+/**
+ * This function fills the streaming read configuration from the read
+ * command and flash size detected during init
+ *
+ * @param	AddrBytes is the number of address bytes of the read command
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XFsbl_QspiStreamSetup(u8 AddrBytes)
+{
+	QspiStreamCfg.ReadCmd = (u8)ReadCommand;
+	QspiStreamCfg.AddrBytes = AddrBytes;
+	QspiStreamCfg.DummyClocks = DUMMY_CLOCKS;
+
+	if ((ReadCommand == QUAD_READ_CMD_24BIT) ||
+			(ReadCommand == QUAD_READ_CMD_32BIT)) {
+		QspiStreamCfg.BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+	} else if ((ReadCommand == DUAL_READ_CMD_24BIT) ||
+			(ReadCommand == DUAL_READ_CMD_32BIT)) {
+		QspiStreamCfg.BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+	} else {
+		QspiStreamCfg.BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	}
+
+	QspiStreamCfg.ChunkSize = XFSBL_QSPI_STREAM_CHUNK_SIZE;
+
+	/* QspiFlashSize covers both devices for stacked and parallel */
+	if (QspiPsuInstance.Config.ConnectionMode ==
+			XQSPIPSU_CONNECTION_MODE_SINGLE) {
+		QspiStreamCfg.FlashSize = QspiFlashSize;
+	} else {
+		QspiStreamCfg.FlashSize = QspiFlashSize / 2U;
+	}
+
+	QspiStreamCfg.ChunkHandler = NULL;
+	QspiStreamCfg.ChunkRef = NULL;
+}
+
 /*****************************************************************************/
 /**
  * This function is used to initialize the qspi controller and driver
@@ -340,6 +392,8 @@ u32 XFsbl_Qspi24Init(u32 DeviceFlags)
 		QspiFlashSize = 2 * QspiFlashSize;
 	}
 
+	XFsbl_QspiStreamSetup(3U);
+
 END:
 	return UStatus;
 }
@@ -690,78 +744,89 @@ u32 XFsbl_Qspi24Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 					"QSPI Read Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
 						QspiAddr, DestAddress, TransferBytes);
 
-		/**
-		 * Setup the read command with the specified address and data for the
-		 * Flash
-		 */
+		if (XFsbl_QspiCanStream(DestAddress, TransferBytes)) {
+			/**
+			 * The driver builds the read commands of the chunks
+			 */
+			SStatus = XQspiPsu_StreamRead(&QspiPsuInstance,
+					&QspiStreamCfg, SrcAddress,
+					(u8 *)DestAddress, TransferBytes);
+		} else {
+			/**
+			 * Setup the read command with the specified address and data for the
+			 * Flash
+			 */
 
-		WriteBuffer[COMMAND_OFFSET]   = (u8)ReadCommand;
-		WriteBuffer[ADDRESS_1_OFFSET] = (u8)((QspiAddr & 0xFF0000U) >> 16);
-		WriteBuffer[ADDRESS_2_OFFSET] = (u8)((QspiAddr & 0xFF00U) >> 8);
-		WriteBuffer[ADDRESS_3_OFFSET] = (u8)(QspiAddr & 0xFFU);
-		DiscardByteCnt = 4;
+			WriteBuffer[COMMAND_OFFSET]   = (u8)ReadCommand;
+			WriteBuffer[ADDRESS_1_OFFSET] = (u8)((QspiAddr & 0xFF0000U) >> 16);
+			WriteBuffer[ADDRESS_2_OFFSET] = (u8)((QspiAddr & 0xFF00U) >> 8);
+			WriteBuffer[ADDRESS_3_OFFSET] = (u8)(QspiAddr & 0xFFU);
+			DiscardByteCnt = 4;
 
-		FlashMsg[0].TxBfrPtr = WriteBuffer;
-		FlashMsg[0].RxBfrPtr = NULL;
-		FlashMsg[0].ByteCount = DiscardByteCnt;
-		FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+			FlashMsg[0].TxBfrPtr = WriteBuffer;
+			FlashMsg[0].RxBfrPtr = NULL;
+			FlashMsg[0].ByteCount = DiscardByteCnt;
+			FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+			FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
 
-		/* It is recommended to have a separate entry for dummy */
-		if ((ReadCommand == FAST_READ_CMD_24BIT) || (ReadCommand == DUAL_READ_CMD_24BIT) ||
-		    (ReadCommand == QUAD_READ_CMD_24BIT)) {
-			/* Update Dummy cycles as per flash specs for QUAD IO */
+			/* It is recommended to have a separate entry for dummy */
+			if ((ReadCommand == FAST_READ_CMD_24BIT) || (ReadCommand == DUAL_READ_CMD_24BIT) ||
+			    (ReadCommand == QUAD_READ_CMD_24BIT)) {
+				/* Update Dummy cycles as per flash specs for QUAD IO */
+
+				/*
+				 * It is recommended that Bus width value during dummy
+				 * phase should be same as data phase
+				 */
+				if (ReadCommand == FAST_READ_CMD_24BIT) {
+					FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+				}
+
+				if (ReadCommand == DUAL_READ_CMD_24BIT) {
+					FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+				}
+
+				if (ReadCommand == QUAD_READ_CMD_24BIT) {
+					FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+				}
+
+				FlashMsg[1].TxBfrPtr = NULL;
+				FlashMsg[1].RxBfrPtr = NULL;
+				FlashMsg[1].ByteCount = DUMMY_CLOCKS;
+				FlashMsg[1].Flags = 0U;
+			}
 
-			/*
-			 * It is recommended that Bus width value during dummy
-			 * phase should be same as data phase
-			 */
 			if (ReadCommand == FAST_READ_CMD_24BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
 			}
 
 			if (ReadCommand == DUAL_READ_CMD_24BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
 			}
 
 			if (ReadCommand == QUAD_READ_CMD_24BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
 			}
 
-			FlashMsg[1].TxBfrPtr = NULL;
-			FlashMsg[1].RxBfrPtr = NULL;
-			FlashMsg[1].ByteCount = DUMMY_CLOCKS;
-			FlashMsg[1].Flags = 0U;
-		}
-
-		if (ReadCommand == FAST_READ_CMD_24BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		}
-
-		if (ReadCommand == DUAL_READ_CMD_24BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
-		}
-
-		if (ReadCommand == QUAD_READ_CMD_24BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-		}
+			FlashMsg[2].TxBfrPtr = NULL;
+			FlashMsg[2].RxBfrPtr = (u8 *)DestAddress;
+			FlashMsg[2].ByteCount = TransferBytes;
+			FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
 
-		FlashMsg[2].TxBfrPtr = NULL;
-		FlashMsg[2].RxBfrPtr = (u8 *)DestAddress;
-		FlashMsg[2].ByteCount = TransferBytes;
-		FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+			if(QspiPsuInstance.Config.ConnectionMode ==
+					XQSPIPSU_CONNECTION_MODE_PARALLEL){
+				FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+			}
 
-		if(QspiPsuInstance.Config.ConnectionMode ==
-				XQSPIPSU_CONNECTION_MODE_PARALLEL){
-			FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+			/**
+			 * Send the read command to the Flash to read the
+			 * specified number of bytes from the Flash, send the
+			 * read command and address and receive the specified
+			 * number of bytes of data in the data buffer
+			 */
+			SStatus = XQspiPsu_PolledTransfer(&QspiPsuInstance,
+					&FlashMsg[0], 3);
 		}
-
-		/**
-		 * Send the read command to the Flash to read the specified number
-		 * of bytes from the Flash, send the read command and address and
-		 * receive the specified number of bytes of data in the data buffer
-		 */
-		SStatus = XQspiPsu_PolledTransfer(&QspiPsuInstance, &FlashMsg[0], 3);
 		if (SStatus != XFSBL_SUCCESS) {
 			Status = XFSBL_ERROR_QSPI_READ;
 			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_QSPI_READ\r\n");
@@ -952,6 +1017,8 @@ u32 XFsbl_Qspi32Init(u32 DeviceFlags)
 		QspiFlashSize = 2 * QspiFlashSize;
 	}
 
+	XFsbl_QspiStreamSetup(4U);
+
 END:
 	return UStatus;
 }
@@ -1022,83 +1089,94 @@ u32 XFsbl_Qspi32Copy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
 					"QSPI Read Src 0x%0lx, Dest %0lx, Length %0lx\r\n",
 						QspiAddr, DestAddress, TransferBytes);
 
-		/**
-		 * Setup the read command with the specified address and data for the
-		 * Flash
-		 */
-
-		WriteBuffer[COMMAND_OFFSET]   = (u8)ReadCommand;
-		WriteBuffer[ADDRESS_1_OFFSET] = (u8)((QspiAddr & 0xFF000000U) >> 24);
-		WriteBuffer[ADDRESS_2_OFFSET] = (u8)((QspiAddr & 0xFF0000U) >> 16);
-		WriteBuffer[ADDRESS_3_OFFSET] = (u8)((QspiAddr & 0xFF00U) >> 8);
-		WriteBuffer[ADDRESS_4_OFFSET] = (u8)(QspiAddr & 0xFFU);
-		DiscardByteCnt = 5;
-
-		FlashMsg[0].TxBfrPtr = WriteBuffer;
-		FlashMsg[0].RxBfrPtr = NULL;
-		FlashMsg[0].ByteCount = DiscardByteCnt;
-		FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
+		if (XFsbl_QspiCanStream(DestAddress, TransferBytes)) {
+			/**
+			 * The driver builds the read commands of the chunks
+			 */
+			Status = XQspiPsu_StreamRead(&QspiPsuInstance,
+					&QspiStreamCfg, SrcAddress,
+					(u8 *)DestAddress, TransferBytes);
+		} else {
+			/**
+			 * Setup the read command with the specified address and data for the
+			 * Flash
+			 */
 
-		/*
-		 * It is recommended to have a separate entry for dummy
-		 */
-		if ((ReadCommand == FAST_READ_CMD_32BIT) ||
-				(ReadCommand == DUAL_READ_CMD_32BIT) ||
-				(ReadCommand == QUAD_READ_CMD_32BIT)) {
+			WriteBuffer[COMMAND_OFFSET]   = (u8)ReadCommand;
+			WriteBuffer[ADDRESS_1_OFFSET] = (u8)((QspiAddr & 0xFF000000U) >> 24);
+			WriteBuffer[ADDRESS_2_OFFSET] = (u8)((QspiAddr & 0xFF0000U) >> 16);
+			WriteBuffer[ADDRESS_3_OFFSET] = (u8)((QspiAddr & 0xFF00U) >> 8);
+			WriteBuffer[ADDRESS_4_OFFSET] = (u8)(QspiAddr & 0xFFU);
+			DiscardByteCnt = 5;
 
-			/* Update Dummy cycles as per flash specs for QUAD IO */
+			FlashMsg[0].TxBfrPtr = WriteBuffer;
+			FlashMsg[0].RxBfrPtr = NULL;
+			FlashMsg[0].ByteCount = DiscardByteCnt;
+			FlashMsg[0].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+			FlashMsg[0].Flags = XQSPIPSU_MSG_FLAG_TX;
 
 			/*
-			 * It is recommended that Bus width value during dummy
-			 * phase should be same as data phase
+			 * It is recommended to have a separate entry for dummy
 			 */
+			if ((ReadCommand == FAST_READ_CMD_32BIT) ||
+					(ReadCommand == DUAL_READ_CMD_32BIT) ||
+					(ReadCommand == QUAD_READ_CMD_32BIT)) {
+
+				/* Update Dummy cycles as per flash specs for QUAD IO */
+
+				/*
+				 * It is recommended that Bus width value during dummy
+				 * phase should be same as data phase
+				 */
+				if (ReadCommand == FAST_READ_CMD_32BIT) {
+					FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+				}
+
+				if (ReadCommand == DUAL_READ_CMD_32BIT) {
+					FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+				}
+
+				if (ReadCommand == QUAD_READ_CMD_32BIT) {
+					FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+				}
+
+				FlashMsg[1].TxBfrPtr = NULL;
+				FlashMsg[1].RxBfrPtr = NULL;
+				FlashMsg[1].ByteCount = DUMMY_CLOCKS;
+				FlashMsg[1].Flags = 0U;
+			}
+
 			if (ReadCommand == FAST_READ_CMD_32BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
 			}
 
 			if (ReadCommand == DUAL_READ_CMD_32BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
+				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
 			}
 
 			if (ReadCommand == QUAD_READ_CMD_32BIT) {
-				FlashMsg[1].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
+				FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
 			}
 
-			FlashMsg[1].TxBfrPtr = NULL;
-			FlashMsg[1].RxBfrPtr = NULL;
-			FlashMsg[1].ByteCount = DUMMY_CLOCKS;
-			FlashMsg[1].Flags = 0U;
-		}
-
-		if (ReadCommand == FAST_READ_CMD_32BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
-		}
-
-		if (ReadCommand == DUAL_READ_CMD_32BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_DUALSPI;
-		}
-
-		if (ReadCommand == QUAD_READ_CMD_32BIT) {
-			FlashMsg[2].BusWidth = XQSPIPSU_SELECT_MODE_QUADSPI;
-		}
+			FlashMsg[2].TxBfrPtr = NULL;
+			FlashMsg[2].RxBfrPtr = (u8 *)DestAddress;
+			FlashMsg[2].ByteCount = TransferBytes;
+			FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
 
-		FlashMsg[2].TxBfrPtr = NULL;
-		FlashMsg[2].RxBfrPtr = (u8 *)DestAddress;
-		FlashMsg[2].ByteCount = TransferBytes;
-		FlashMsg[2].Flags = XQSPIPSU_MSG_FLAG_RX;
+			if(QspiPsuInstance.Config.ConnectionMode ==
+					XQSPIPSU_CONNECTION_MODE_PARALLEL){
+				FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+			}
 
-		if(QspiPsuInstance.Config.ConnectionMode ==
-				XQSPIPSU_CONNECTION_MODE_PARALLEL){
-			FlashMsg[2].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+			/**
+			 * Send the read command to the Flash to read the
+			 * specified number of bytes from the Flash, send the
+			 * read command and address and receive the specified
+			 * number of bytes of data in the data buffer
+			 */
+			Status = XQspiPsu_PolledTransfer(&QspiPsuInstance,
+					&FlashMsg[0], 3);
 		}
-
-		/**
-		 * Send the read command to the Flash to read the specified number
-		 * of bytes from the Flash, send the read command and address and
-		 * receive the specified number of bytes of data in the data buffer
-		 */
-		Status = XQspiPsu_PolledTransfer(&QspiPsuInstance, &FlashMsg[0], 3);
 		if (Status != XFSBL_SUCCESS) {
 			UStatus = XFSBL_ERROR_QSPI_READ;
 			XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_QSPI_READ\r\n");
@@ -46,6 +46,7 @@
 * 2.00  sg   12/03/15 Added GQSPI driver support
 *                     32Bit boot mode support
 * 3.0   ds   01/03/17 Add support for Micron QSPI 2G part
+*       ag   10/18/26 Added XFSBL_QSPI_STREAM_CHUNK_SIZE
 * </pre>
 *
 * @note
@@ -115,6 +116,12 @@ extern "C" {
  */
 #define DMA_DATA_TRAN_SIZE		(0x20000000U)
 
+/*
+ * Size of each read command of a streamed copy. The next command is queued
+ * while this many bytes are received
+ */
+#define XFSBL_QSPI_STREAM_CHUNK_SIZE	(0x40000U)
+
 /*
  * The following defines are for dual flash interface.
  */
@@ -147,15 +147,15 @@ static const PmApiEntry pmApiTable[] = {
 	}, {
 			.apiId = PM_SECURE_RSA_AES,
 			.argTypes = { ARG_UINT32, ARG_UINT32, ARG_UINT32, ARG_UINT32,
-				      ARG_UNDEF }
+				      ARG_UINT32 }
 	}, {
 			.apiId = PM_SECURE_SHA,
 			.argTypes = { ARG_UINT32, ARG_UINT32, ARG_UINT32, ARG_UINT32,
-					      ARG_UNDEF }
+					      ARG_UINT32 }
 	}, {
 			.apiId = PM_SECURE_RSA,
 			.argTypes = { ARG_UINT32, ARG_UINT32, ARG_UINT32, ARG_UINT32,
-					      ARG_UNDEF }
+					      ARG_UINT32 }
 	},
 };
 
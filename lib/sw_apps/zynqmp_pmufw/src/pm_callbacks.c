@@ -104,6 +104,23 @@ void PmNotifyCb(const PmMaster* const master, const PmNodeId nodeId,
 	XPfw_IpiTrigger( master->ipiMask);
 }
 
+/**
+ * PmSecureDoneCb() - notifies a master about completion of a queued
+ *                    secure request
+ * @master      Master which queued the request
+ * @apiId       PM_SECURE_* API id of the completed request
+ * @addrLow     Lower 32 bits of the request address, identifies request
+ * @status      Status of the secure operation
+ * @latency     Time from acceptance to completion of the request (us)
+ */
+void PmSecureDoneCb(const PmMaster* const master, const u32 apiId,
+		    const u32 addrLow, const u32 status, const u32 latency)
+{
+	IPI_REQUEST5(master->ipiMask, PM_SECURE_DONE_CB, apiId, addrLow,
+		     status, latency);
+	XPfw_IpiTrigger( master->ipiMask);
+}
+
 /**
  * PmInitSuspendCb() - request a master to suspend itself
  * @master      Master to be asked to suspend
@@ -49,4 +49,7 @@ void PmNotifyCb(const PmMaster* const master, const PmNodeId nodeId,
 void PmInitSuspendCb(const PmMaster* const master, const u32 reason,
 		     const u32 latency, const u32 state, const u32 timeout);
 
+void PmSecureDoneCb(const PmMaster* const master, const u32 apiId,
+		    const u32 addrLow, const u32 status, const u32 latency);
+
 #endif
@@ -55,6 +55,7 @@
 #include "xpfw_resets.h"
 #include "rpu.h"
 #include "xsecure.h"
+#include "pm_secure.h"
 
 #define AMS_REF_CTRL_REG_OFFSET	0x108
 
@@ -650,11 +651,49 @@ static void PmFpgaLoad(const PmMaster *const master,
 {
 	u32 Status;
 
+	/* PL loading shares the CSU DMA and SHA3 engine with secure queue */
+	if (true == PmSecureIsBusy()) {
+		Status = XST_DEVICE_BUSY;
+		goto done;
+	}
+
        Status = XFpga_PL_BitSream_Load(AddrHigh, AddrLow, size, flags);
 
+done:
+
        IPI_RESPONSE1(master->ipiMask, Status);
 }
 
+/**
+ * PmSecureRequest() - Execute or queue a secure request
+ * @master  Initiator of the request
+ * @apiId   PM_SECURE_* API id
+ * @ack     REQUEST_ACK_NON_BLOCKING to queue the request, the master is
+ *          then notified about completion through PM_SECURE_DONE_CB.
+ *          Any other value executes the request before responding.
+ *
+ * @note    Synchronous requests are refused while queued requests are
+ *          pending because they would overwrite the secure engines state.
+ */
+static void PmSecureRequest(const PmMaster *const master, const u32 apiId,
+			    const u32 AddrHigh, const u32 AddrLow,
+			    const u32 size, const u32 flags, const u32 ack)
+{
+	u32 Status;
+
+	if (REQUEST_ACK_NON_BLOCKING == ack) {
+		Status = PmSecureEnqueue(master, apiId, AddrHigh, AddrLow,
+					 size, flags);
+	} else if (true == PmSecureIsBusy()) {
+		Status = XST_DEVICE_BUSY;
+	} else {
+		Status = PmSecureExecute(apiId, AddrHigh, AddrLow, size,
+					 flags);
+	}
+
+	IPI_RESPONSE1(master->ipiMask, Status);
+}
+
 /**
  * PmSecureRsaAes() - Load secure image.
  * This function loads the secure images back to memory, it supports
@@ -669,17 +708,16 @@ static void PmFpgaLoad(const PmMaster *const master,
  *
  * WrSize: Number of 32bit words that the DMA should write
  *
+ * ack: REQUEST_ACK_NON_BLOCKING to queue the request
+ *
  * @return  error status based on implemented functionality(SUCCESS by default)
  */
 static void PmSecureRsaAes(const PmMaster *const master,
 			const u32 AddrHigh, const u32 AddrLow,
-			const u32 size, const u32 flags)
+			const u32 size, const u32 flags, const u32 ack)
 {
-	u32 Status;
-
-	Status = XSecure_RsaAes(AddrHigh, AddrLow, size, flags);
-
-	IPI_RESPONSE1(master->ipiMask, Status);
+	PmSecureRequest(master, PM_SECURE_RSA_AES, AddrHigh, AddrLow, size,
+			flags, ack);
 }
 
 /**
@@ -695,18 +733,16 @@ static void PmSecureRsaAes(const PmMaster *const master,
  *
  * @Flags: provides inputs for operation to be performed
  *
+ * @ack: REQUEST_ACK_NON_BLOCKING to queue the request
+ *
  * @return  error status based on implemented functionality(SUCCESS by default)
  */
 static void PmSecureSha(const PmMaster *const master,
 			const u32 SrcAddrHigh, const u32 SrcAddrLow,
-			const u32 SrcSize, const u32 Flags)
+			const u32 SrcSize, const u32 Flags, const u32 ack)
 {
-	u32 Status;
-
-	Status = XSecure_Sha3Hash(SrcAddrHigh, SrcAddrLow,
-			SrcSize, Flags);
-
-	IPI_RESPONSE1(master->ipiMask, Status);
+	PmSecureRequest(master, PM_SECURE_SHA, SrcAddrHigh, SrcAddrLow, SrcSize,
+			Flags, ack);
 }
 
 /**
@@ -723,18 +759,16 @@ static void PmSecureSha(const PmMaster *const master,
  *
  * @Flags: provides inputs for operation to be performed
  *
+ * @ack: REQUEST_ACK_NON_BLOCKING to queue the request
+ *
  * @return  error status based on implemented functionality(SUCCESS by default)
  */
 static void PmSecureRsa(const PmMaster *const master,
 			const u32 SrcAddrHigh, const u32 SrcAddrLow,
-			const u32 SrcSize, const u32 Flags)
+			const u32 SrcSize, const u32 Flags, const u32 ack)
 {
-	u32 Status;
-
-	Status = XSecure_RsaCore(SrcAddrHigh, SrcAddrLow,
-			SrcSize, Flags);
-
-	IPI_RESPONSE1(master->ipiMask, Status);
+	PmSecureRequest(master, PM_SECURE_RSA, SrcAddrHigh, SrcAddrLow, SrcSize,
+			Flags, ack);
 }
 
 /**
@@ -1294,13 +1328,16 @@ static void PmProcessApiCall(PmMaster *const master, const u32 *pload)
 		PmGetChipid(master);
 		break;
 	case PM_SECURE_RSA_AES:
-		PmSecureRsaAes(master, pload[1], pload[2], pload[3], pload[4]);
+		PmSecureRsaAes(master, pload[1], pload[2], pload[3], pload[4],
+			       pload[5]);
 		break;
 	case PM_SECURE_SHA:
-		PmSecureSha(master, pload[1], pload[2], pload[3], pload[4]);
+		PmSecureSha(master, pload[1], pload[2], pload[3], pload[4],
+			    pload[5]);
 		break;
 	case PM_SECURE_RSA:
-		PmSecureRsa(master, pload[1], pload[2], pload[3], pload[4]);
+		PmSecureRsa(master, pload[1], pload[2], pload[3], pload[4],
+			    pload[5]);
 		break;
 	default:
 		PmDbg(DEBUG_DETAILED,"ERROR unsupported PM API #%lu\r\n", pload[0]);
@@ -119,6 +119,7 @@
 #define PM_INIT_SUSPEND_CB      30U
 #define PM_ACKNOWLEDGE_CB       31U
 #define PM_NOTIFY_CB            32U
+#define PM_SECURE_DONE_CB       33U
 
 /* Nodes */
 #define NODE_UNKNOWN    0U
@@ -0,0 +1,413 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ */
+#include "xpfw_config.h"
+#ifdef ENABLE_PM
+
+/*********************************************************************
+ * This file contains the queue of secure requests. Queued requests are
+ * executed from the scheduler one slice per scheduler tick. A slice is
+ * a whole RSA or RSA-AES operation (both are single hardware jobs in
+ * xilsecure), or up to PM_SECURE_SLICE_SIZE bytes of a SHA3 update.
+ * The latency of every secure operation is accounted per API.
+ *
+ * Requests are enqueued from the IPI interrupt while slices run from the
+ * scheduler task. The task updates the queue and schedules its next slice
+ * with interrupts disabled, so neither the queue nor the scheduler task
+ * list are modified by both contexts at the same time.
+ *********************************************************************/
+
+#include "pm_secure.h"
+#include "pm_defs.h"
+#include "pm_common.h"
+#include "pm_callbacks.h"
+#include "xpfw_core.h"
+#include "xpfw_mod_pm.h"
+#include "xsecure.h"
+#include "xsecure_hw.h"
+
+/* Secure API ids are consecutive, statistics are indexed from the first */
+#define PM_SECURE_API_FIRST	PM_SECURE_RSA_AES
+#define PM_SECURE_API_CNT	(PM_SECURE_RSA - PM_SECURE_RSA_AES + 1U)
+
+/**
+ * PmSecureRequest - Queued secure request
+ * @master      Master which issued the request
+ * @apiId       PM_SECURE_* API id
+ * @addrHigh    Higher 32 bits of the data address
+ * @addrLow     Lower 32 bits of the data address
+ * @size        Size argument of the request
+ * @flags       Flags argument of the request
+ * @done        Number of bytes processed by the slices executed so far
+ * @slices      Number of slices executed so far
+ * @acceptUs    Time the request was accepted
+ * @startUs     Time the first slice was executed
+ */
+typedef struct PmSecureRequest {
+	const PmMaster* master;
+	u32 apiId;
+	u32 addrHigh;
+	u32 addrLow;
+	u32 size;
+	u32 flags;
+	u32 done;
+	u32 slices;
+	u64 acceptUs;
+	u64 startUs;
+} PmSecureRequest;
+
+/**
+ * PmSecureStats - Latency accounting of one secure operation
+ * @count       Number of completed requests
+ * @slices      Number of slices the requests were executed in
+ * @waitTotal   Accumulated time spent in the queue (us)
+ * @waitMax     Longest time spent in the queue (us)
+ * @execTotal   Accumulated time from first slice to completion (us)
+ * @execMax     Longest time from first slice to completion (us)
+ */
+typedef struct PmSecureStats {
+	u32 count;
+	u32 slices;
+	u64 waitTotal;
+	u32 waitMax;
+	u64 execTotal;
+	u32 execMax;
+} PmSecureStats;
+
+/* Shared between the IPI interrupt and the scheduler task */
+static volatile PmSecureRequest pmSecureQueue[PM_SECURE_QUEUE_LEN];
+static volatile u32 pmSecureHead;
+static volatile u32 pmSecureCount;
+
+static PmSecureStats pmSecureStats[PM_SECURE_API_CNT];
+
+static const char* const pmSecureNames[PM_SECURE_API_CNT] = {
+	"RSA_AES",
+	"SHA",
+	"RSA",
+};
+
+/**
+ * PmSecureCall() - Execute a secure operation in xilsecure
+ * @apiId       PM_SECURE_* API id
+ * @addrHigh    Higher 32 bits of the data address
+ * @addrLow     Lower 32 bits of the data address
+ * @size        Size argument of the request
+ * @flags       Flags argument of the request
+ *
+ * @return      Status returned by xilsecure
+ */
+static u32 PmSecureCall(const u32 apiId, const u32 addrHigh,
+			const u32 addrLow, const u32 size, const u32 flags)
+{
+	u32 status;
+
+	switch (apiId) {
+	case PM_SECURE_RSA_AES:
+		status = XSecure_RsaAes(addrHigh, addrLow, size, flags);
+		break;
+	case PM_SECURE_SHA:
+		status = XSecure_Sha3Hash(addrHigh, addrLow, size, flags);
+		break;
+	case PM_SECURE_RSA:
+		status = XSecure_RsaCore(addrHigh, addrLow, size, flags);
+		break;
+	default:
+		status = XST_INVALID_PARAM;
+		break;
+	}
+
+	return status;
+}
+
+/**
+ * PmSecureAccount() - Account latency of a completed secure operation
+ * @apiId       PM_SECURE_* API id
+ * @acceptUs    Time the request was accepted
+ * @startUs     Time the execution started
+ * @slices      Number of slices the operation was executed in
+ *
+ * @return      Time from acceptance to completion (us)
+ */
+static u32 PmSecureAccount(const u32 apiId, const u64 acceptUs,
+			   const u64 startUs, const u32 slices)
+{
+	PmSecureStats* stats = &pmSecureStats[apiId - PM_SECURE_API_FIRST];
+	u64 nowUs = XPfw_CoreGetTimeUs();
+	u32 waitUs = 0U;
+	u32 execUs = 0U;
+
+	if (startUs >= acceptUs) {
+		waitUs = (u32)(startUs - acceptUs);
+	}
+	if (nowUs >= startUs) {
+		execUs = (u32)(nowUs - startUs);
+	}
+
+	stats->count++;
+	stats->slices += slices;
+	stats->waitTotal += waitUs;
+	stats->execTotal += execUs;
+	if (waitUs > stats->waitMax) {
+		stats->waitMax = waitUs;
+	}
+	if (execUs > stats->execMax) {
+		stats->execMax = execUs;
+	}
+
+	PmDbg(DEBUG_DETAILED, "%s: wait %lu us, exec %lu us, %lu slices\r\n",
+	      pmSecureNames[apiId - PM_SECURE_API_FIRST], waitUs, execUs,
+	      slices);
+
+	return waitUs + execUs;
+}
+
+#ifdef ENABLE_SCHEDULER
+static void PmSecureProcessSlices(void);
+
+/**
+ * PmSecureDumpStats() - Print latency accounting of all secure operations
+ *
+ * @note    Printed whenever the queue of secure requests gets empty.
+ */
+static void PmSecureDumpStats(void)
+{
+	const PmSecureStats* stats;
+	u32 i;
+
+	for (i = 0U; i < PM_SECURE_API_CNT; i++) {
+		stats = &pmSecureStats[i];
+		if (0U == stats->count) {
+			continue;
+		}
+		XPfw_Printf(DEBUG_DETAILED, "PMUFW: %s: %lu requests, %lu "
+			    "slices, wait avg %lu max %lu us, exec avg %lu "
+			    "max %lu us\r\n", pmSecureNames[i], stats->count,
+			    stats->slices,
+			    (u32)(stats->waitTotal / stats->count),
+			    stats->waitMax,
+			    (u32)(stats->execTotal / stats->count),
+			    stats->execMax);
+	}
+}
+
+/**
+ * PmSecureScheduleSlice() - Schedule the next slice of the queue
+ *
+ * @return      Status of adding the scheduler task
+ */
+static XStatus PmSecureScheduleSlice(void)
+{
+	return XPfw_CoreScheduleTask(PmModPtr, 0U, PmSecureProcessSlices);
+}
+
+/**
+ * PmSecureRunSlice() - Execute one slice of the request at the queue head
+ *
+ * @note    Completed request is removed from the queue and its master is
+ *          notified through PM_SECURE_DONE_CB.
+ */
+static void PmSecureRunSlice(void)
+{
+	volatile PmSecureRequest* req = &pmSecureQueue[pmSecureHead];
+	bool finished = true;
+	u32 latency;
+	u32 status;
+	u32 len;
+	u64 addr;
+
+	if (0U == req->slices) {
+		req->startUs = XPfw_CoreGetTimeUs();
+	}
+	req->slices++;
+
+	if ((PM_SECURE_SHA == req->apiId) &&
+	    (XSECURE_SHA3_UPDATE == (req->flags & XSECURE_SHA3_MASK))) {
+		len = req->size - req->done;
+		if (len > PM_SECURE_SLICE_SIZE) {
+			len = PM_SECURE_SLICE_SIZE;
+		}
+		addr = (((u64)req->addrHigh << 32ULL) | req->addrLow) +
+		       req->done;
+
+		/* Other requests may have routed the CSU DMA elsewhere */
+		XSecure_SssSetup(XSecure_SssInputSha3(
+				 XSECURE_CSU_SSS_SRC_SRC_DMA));
+		status = XSecure_Sha3Hash((u32)(addr >> 32ULL), (u32)addr, len,
+					  req->flags);
+		req->done += len;
+		if ((XST_SUCCESS == status) && (req->done < req->size)) {
+			finished = false;
+		}
+	} else {
+		status = PmSecureCall(req->apiId, req->addrHigh, req->addrLow,
+				      req->size, req->flags);
+	}
+
+	if (true == finished) {
+		latency = PmSecureAccount(req->apiId, req->acceptUs,
+					  req->startUs, req->slices);
+		PmSecureDoneCb(req->master, req->apiId, req->addrLow, status,
+			       latency);
+		microblaze_disable_interrupts();
+		pmSecureHead = (pmSecureHead + 1U) % PM_SECURE_QUEUE_LEN;
+		pmSecureCount--;
+		microblaze_enable_interrupts();
+	}
+}
+
+/**
+ * PmSecureProcessSlices() - Scheduler task executing the secure queue
+ *
+ * @note    One slice is executed per scheduler tick. If the next slice
+ *          cannot be scheduled, the queue is drained right away.
+ *          Checking the queue and scheduling the next slice is done with
+ *          interrupts disabled: PmSecureEnqueue() schedules the task only
+ *          for an empty queue, and it adds to the same scheduler task list.
+ */
+static void PmSecureProcessSlices(void)
+{
+	bool pending = true;
+	bool drained = false;
+
+	while (true == pending) {
+		PmSecureRunSlice();
+
+		microblaze_disable_interrupts();
+		if (0U == pmSecureCount) {
+			pending = false;
+			drained = true;
+		} else if (XST_SUCCESS == PmSecureScheduleSlice()) {
+			pending = false;
+		} else {
+			/* Not scheduled, run the next slice right away */
+		}
+		microblaze_enable_interrupts();
+	}
+
+	if (true == drained) {
+		PmSecureDumpStats();
+	}
+}
+#endif
+
+/**
+ * PmSecureExecute() - Execute a secure operation synchronously
+ * @apiId       PM_SECURE_* API id
+ * @addrHigh    Higher 32 bits of the data address
+ * @addrLow     Lower 32 bits of the data address
+ * @size        Size argument of the request
+ * @flags       Flags argument of the request
+ *
+ * @return      Status returned by xilsecure
+ */
+u32 PmSecureExecute(const u32 apiId, const u32 addrHigh, const u32 addrLow,
+		    const u32 size, const u32 flags)
+{
+	u64 startUs = XPfw_CoreGetTimeUs();
+	u32 status;
+
+	status = PmSecureCall(apiId, addrHigh, addrLow, size, flags);
+	(void)PmSecureAccount(apiId, startUs, startUs, 1U);
+
+	return status;
+}
+
+/**
+ * PmSecureEnqueue() - Accept a secure request into the queue
+ * @master      Master which issued the request
+ * @apiId       PM_SECURE_* API id
+ * @addrHigh    Higher 32 bits of the data address
+ * @addrLow     Lower 32 bits of the data address
+ * @size        Size argument of the request
+ * @flags       Flags argument of the request
+ *
+ * @return      XST_SUCCESS if the request is accepted
+ *              XST_DEVICE_BUSY if the queue is full
+ *              XST_NO_FEATURE if the scheduler is not enabled
+ *              XST_FAILURE if the queue could not be scheduled
+ *
+ * @note    Called from the IPI interrupt handler.
+ */
+u32 PmSecureEnqueue(const PmMaster *const master, const u32 apiId,
+		    const u32 addrHigh, const u32 addrLow, const u32 size,
+		    const u32 flags)
+{
+	u32 status;
+#ifdef ENABLE_SCHEDULER
+	volatile PmSecureRequest* req;
+
+	if (PM_SECURE_QUEUE_LEN == pmSecureCount) {
+		status = XST_DEVICE_BUSY;
+		goto done;
+	}
+
+	if (0U == pmSecureCount) {
+		if (XST_SUCCESS != PmSecureScheduleSlice()) {
+			status = XST_FAILURE;
+			goto done;
+		}
+	}
+
+	req = &pmSecureQueue[(pmSecureHead + pmSecureCount) %
+			     PM_SECURE_QUEUE_LEN];
+	req->master = master;
+	req->apiId = apiId;
+	req->addrHigh = addrHigh;
+	req->addrLow = addrLow;
+	req->size = size;
+	req->flags = flags;
+	req->done = 0U;
+	req->slices = 0U;
+	req->acceptUs = XPfw_CoreGetTimeUs();
+	req->startUs = req->acceptUs;
+	pmSecureCount++;
+	status = XST_SUCCESS;
+
+done:
+#else
+	status = XST_NO_FEATURE;
+#endif
+	return status;
+}
+
+/**
+ * PmSecureIsBusy() - Check whether queued secure requests are pending
+ *
+ * @return      True if the queue is not empty
+ *
+ * @note    Secure engines keep state between slices, so requests which
+ *          use them synchronously have to be refused meanwhile.
+ */
+bool PmSecureIsBusy(void)
+{
+	return (0U != pmSecureCount);
+}
+
+#endif
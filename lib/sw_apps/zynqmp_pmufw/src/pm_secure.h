@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * Use of the Software is limited solely to applications:
+ * (a) running on a Xilinx device, or
+ * (b) that interact with a Xilinx device through a bus or interconnect.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * Except as contained in this notice, the name of the Xilinx shall not be used
+ * in advertising or otherwise to promote the sale, use or other dealings in
+ * this Software without prior written authorization from Xilinx.
+ */
+
+/*********************************************************************
+ * Queue of secure (xilsecure) requests.
+ * Secure requests issued with REQUEST_ACK_NON_BLOCKING are accepted
+ * into the queue right away and executed in slices from the scheduler,
+ * so that other PM requests are served in between. Completion is
+ * signalled to the master through the PM_SECURE_DONE_CB callback.
+ *********************************************************************/
+
+#ifndef PM_SECURE_H_
+#define PM_SECURE_H_
+
+#include "pm_master.h"
+#include "xil_types.h"
+
+/*********************************************************************
+ * Macros
+ ********************************************************************/
+/* Maximum number of queued secure requests */
+#define PM_SECURE_QUEUE_LEN	8U
+
+/* Number of bytes hashed by one slice of a queued SHA3 update */
+#ifndef PM_SECURE_SLICE_SIZE
+#define PM_SECURE_SLICE_SIZE	0x100000U
+#endif
+
+/*********************************************************************
+ * Function declarations
+ ********************************************************************/
+u32 PmSecureExecute(const u32 apiId, const u32 addrHigh, const u32 addrLow,
+		    const u32 size, const u32 flags);
+u32 PmSecureEnqueue(const PmMaster *const master, const u32 apiId,
+		    const u32 addrHigh, const u32 addrLow, const u32 size,
+		    const u32 flags);
+bool PmSecureIsBusy(void);
+
+#endif
@@ -248,6 +248,19 @@ Done:
 	return Status;
 }
 
+u64 XPfw_CoreGetTimeUs(void)
+{
+	u64 TimeUs;
+
+	if (CorePtr != NULL) {
+		TimeUs = XPfw_SchedulerGetTimeUs(&CorePtr->Scheduler);
+	} else {
+		TimeUs = 0U;
+	}
+
+	return TimeUs;
+}
+
 void XPfw_CoreTickHandler(void)
 {
 	if(CorePtr != NULL){
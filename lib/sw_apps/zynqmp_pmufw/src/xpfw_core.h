@@ -56,6 +56,7 @@ const XPfw_Module_t *XPfw_CoreCreateMod(void);
 XStatus XPfw_CoreScheduleTask(const XPfw_Module_t *ModPtr, u32 Interval, VoidFunction_t CallbackRef);
 s32 XPfw_CoreRemoveTask(const XPfw_Module_t *ModPtr, u32 Interval, VoidFunction_t CallbackRef);
 XStatus XPfw_CoreStopScheduler(void);
+u64 XPfw_CoreGetTimeUs(void);
 XStatus XPfw_CoreLoop(void);
 void XPfw_CorePrintStats(void);
 XStatus XPfw_CoreRegisterEvent(const XPfw_Module_t *ModPtr, u32 EventId);
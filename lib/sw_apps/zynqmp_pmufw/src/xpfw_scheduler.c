@@ -185,6 +185,41 @@ XStatus XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 	return Status;
 }
 
+/**
+ * Time since the scheduler was started, in microseconds. The PIT counter
+ * gives the position inside the current tick. A tick which has elapsed but
+ * not been handled yet (interrupts masked) is detected by the pending PIT
+ * interrupt and accounted for.
+ */
+u64 XPfw_SchedulerGetTimeUs(const XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Tick;
+	u32 Count;
+	u32 Pending;
+	u64 Counts;
+
+	if ((SchedPtr == NULL) || (SchedPtr->Enabled != TRUE)) {
+		return 0U;
+	}
+
+	do {
+		Tick = SchedPtr->Tick;
+		Pending = XPfw_Read32(PMU_IOMODULE_IRQ_PENDING) &
+				PMU_IOMODULE_IRQ_PENDING_PIT1_MASK;
+		Count = XPfw_Read32(SchedPtr->PitBaseAddr + PIT_COUNTER_OFFSET);
+	} while ((Tick != SchedPtr->Tick) ||
+		(Pending != (XPfw_Read32(PMU_IOMODULE_IRQ_PENDING) &
+				PMU_IOMODULE_IRQ_PENDING_PIT1_MASK)));
+
+	if (Pending != 0U) {
+		Tick++;
+	}
+
+	Counts = ((u64)Tick * COUNT_PER_TICK) + (COUNT_PER_TICK - Count);
+
+	return (Counts * 1000000U) / PMU_PIT_CLK_FREQ;
+}
+
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn)
 {
 	u32 Idx;
@@ -0,0 +1,553 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+* @file xilflash_async_example.c
+*
+*
+* This file contains a design example using the asynchronous erase/write APIs
+* of the Flash Library. The test area (by default the whole device) is
+* updated twice:
+*	- with the blocking XFlash_Erase()/XFlash_Write() APIs, and
+*	- with XFlash_EraseAsync()/XFlash_WriteAsync(), advanced from a main
+*	  loop that performs background work between XFlash_AsyncPoll() calls.
+*	  The completion handler chains the next erase/write.
+*
+* The amount of background work done while the flash was busy, the status
+* samples taken and, on ARM processors, the time of both updates are
+* printed. The data is read back and verified after each update.
+*
+* @note		The Erase operation on a CFI compliant Flash device will result
+*		in an error if the block is locked. This example performs an
+*		Unlock operation before the Erase operation on the Intel CFI
+*		compliant Flash devices only.
+*		Asynchronous write is only supported on Intel CFI compliant
+*		Flash devices. On AMD devices the data is written with the
+*		blocking API after the asynchronous erase.
+*		The update erases the test area. Do not run it on a flash
+*		holding the boot image or the program being executed.
+*
+*<pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------------
+* 4.5   ag   10/18/26 First release
+*
+*</pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <xilflash.h>
+#include <stdio.h>
+#include <xil_types.h>
+#include "xil_printf.h"
+#if defined (__arm__) || defined (__aarch64__)
+#include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+
+/*
+ * The following constants define the baseaddress and width the flash memory.
+ * These constants map to the XPAR parameters created in the xparameters.h file.
+ * They are defined here such that a user can easily change all the needed
+ * parameters in one place.
+ */
+#define FLASH_BASE_ADDRESS	XPAR_EMC_0_S_AXI_MEM0_BASEADDR
+
+/*
+ * The following constant defines the total byte width of the flash memory. The
+ * user needs to update this width based on the flash width in the design/board.
+ */
+#define FLASH_MEM_WIDTH		2
+
+/*
+ * Test area. A size of 0 updates from START_ADDRESS to the end of the device.
+ */
+#define START_ADDRESS		0x0
+#define UPDATE_SIZE		0
+
+/*
+ * The update is written in chunks of CHUNK_SIZE bytes from the same RAM
+ * buffer, so that a whole device can be updated from a small buffer.
+ */
+#define CHUNK_SIZE		4096
+
+/*
+ * Number of passes of the background work function over the work buffer for
+ * each iteration of the main loop.
+ */
+#define WORK_BUFFER_SIZE	256
+
+/**************************** Type Definitions *******************************/
+
+/*
+ * State of the asynchronous update, shared with the completion handler.
+ */
+typedef struct {
+	u32 NextOffset;		/* Next chunk to erase/write */
+	u32 EndOffset;		/* End of the test area */
+	int Done;		/* Update completed */
+	int Status;		/* Status of the update */
+} UpdateState;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+int FlashAsyncExample(void);
+static int BlockingUpdate(u32 Offset, u32 Bytes);
+static int WriteChunks(u32 Offset, u32 Bytes);
+static int AsyncUpdate(u32 Offset, u32 Bytes, u32 *WorkPtr);
+static void AsyncHandler(void *CallBackRef, u32 Operation, int Status);
+static int VerifyUpdate(u32 Offset, u32 Bytes);
+static void BackgroundWork(void);
+static u32 ElapsedUs(void);
+
+/************************** Variable Definitions *****************************/
+XFlash FlashInstance; /* XFlash Instance. */
+
+/*
+ * Buffers used during read and write transactions.
+ */
+u8 ReadBuffer[CHUNK_SIZE]; /* Buffer used to store the data read. */
+u8 WriteBuffer[CHUNK_SIZE]; /* Write buffer. */
+
+static UpdateState Update;
+static u8 WorkBuffer[WORK_BUFFER_SIZE];
+static volatile u32 WorkResult;
+
+#if defined (__arm__) || defined (__aarch64__)
+static XTime StartTime;
+#endif
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+*
+* Main function to execute the Flash asynchronous update example.
+*
+* @param	None
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	Status = FlashAsyncExample();
+	if(Status != XST_SUCCESS) {
+		xil_printf("Flash Async Update Test Fail\n\r");
+		return XST_FAILURE;
+	}
+	xil_printf("Flash Async Update Test Pass\n\r");
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function updates the test area with the blocking and the asynchronous
+* APIs and reports the CPU time left to the application in both cases.
+*
+* @param	None
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+int FlashAsyncExample(void)
+{
+	int Status;
+	u32 Index;
+	u32 Bytes;
+	u32 Work = 0;
+	u32 BlockingUs;
+	u32 AsyncUs;
+
+	/*
+	 * Initialize the Flash Library.
+	 */
+	Status = XFlash_Initialize(&FlashInstance, FLASH_BASE_ADDRESS,
+				   FLASH_MEM_WIDTH, 0);
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Reset the Flash Device. This clears the Status registers and puts
+	 * the device in Read mode.
+	 */
+	Status = XFlash_Reset(&FlashInstance);
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Bytes = UPDATE_SIZE;
+	if (Bytes == 0) {
+		Bytes = FlashInstance.Geometry.DeviceSize - START_ADDRESS;
+	}
+
+	/*
+	 * Perform an unlock operation before the erase operation for the Intel
+	 * Flash. The erase operation will result in an error if the block is
+	 * locked.
+	 */
+	if ((FlashInstance.CommandSet == XFL_CMDSET_INTEL_STANDARD) ||
+	    (FlashInstance.CommandSet == XFL_CMDSET_INTEL_EXTENDED) ||
+	    (FlashInstance.CommandSet == XFL_CMDSET_INTEL_G18)) {
+		Status = XFlash_Unlock(&FlashInstance, START_ADDRESS, Bytes);
+		if(Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+	}
+
+	for(Index = 0; Index < CHUNK_SIZE; Index++) {
+		WriteBuffer[Index] = Index + 1;
+	}
+
+	/*
+	 * Update with the blocking APIs. The CPU is not available to the
+	 * application for the whole update.
+	 */
+	(void) ElapsedUs();
+	Status = BlockingUpdate(START_ADDRESS, Bytes);
+	BlockingUs = ElapsedUs();
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = VerifyUpdate(START_ADDRESS, Bytes);
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	/*
+	 * Update with the asynchronous APIs, doing background work while the
+	 * flash is busy.
+	 */
+	(void) ElapsedUs();
+	Status = AsyncUpdate(START_ADDRESS, Bytes, &Work);
+	AsyncUs = ElapsedUs();
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = VerifyUpdate(START_ADDRESS, Bytes);
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	xil_printf("Updated %d bytes\n\r", Bytes);
+	xil_printf("Blocking update: no background work\n\r");
+	xil_printf("Async update: %d background work units, "
+		   "%d status samples\n\r", Work,
+		   FlashInstance.Async.PollCount);
+	if ((BlockingUs != 0) || (AsyncUs != 0)) {
+		xil_printf("Update time: blocking %d us, async %d us\n\r",
+			   BlockingUs, AsyncUs);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function erases and writes the test area with the blocking APIs.
+*
+* @param	Offset is the offset of the test area.
+* @param	Bytes is the size of the test area.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int BlockingUpdate(u32 Offset, u32 Bytes)
+{
+	int Status;
+
+	Status = XFlash_Erase(&FlashInstance, Offset, Bytes);
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	return WriteChunks(Offset, Bytes);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes the write buffer repeatedly over the given area with
+* the blocking API.
+*
+* @param	Offset is the offset of the area.
+* @param	Bytes is the size of the area.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int WriteChunks(u32 Offset, u32 Bytes)
+{
+	int Status;
+	u32 Chunk;
+	u32 EndOffset = Offset + Bytes;
+
+	while (Offset < EndOffset) {
+		Chunk = EndOffset - Offset;
+		if (Chunk > CHUNK_SIZE) {
+			Chunk = CHUNK_SIZE;
+		}
+
+		Status = XFlash_Write(&FlashInstance, Offset, Chunk,
+				      WriteBuffer);
+		if(Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Offset += Chunk;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function erases and writes the test area with the asynchronous APIs.
+* The main loop polls the library and does a unit of background work per
+* iteration; the completion handler starts the next chunk.
+*
+* @param	Offset is the offset of the test area.
+* @param	Bytes is the size of the test area.
+* @param	WorkPtr returns the number of background work units done.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		XFlash_AsyncPoll() could be called from the RY/BY interrupt
+*		instead, by connecting XFlash_AsyncInterruptHandler().
+*
+******************************************************************************/
+static int AsyncUpdate(u32 Offset, u32 Bytes, u32 *WorkPtr)
+{
+	int Status;
+
+	Update.NextOffset = Offset;
+	Update.EndOffset = Offset + Bytes;
+	Update.Done = 0;
+	Update.Status = XST_SUCCESS;
+
+	XFlash_SetAsyncHandler(&FlashInstance, AsyncHandler, &Update);
+
+	Status = XFlash_EraseAsync(&FlashInstance, Offset, Bytes);
+	if(Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	while (!Update.Done) {
+		(void) XFlash_AsyncPoll(&FlashInstance);
+		if (!Update.Done) {
+			BackgroundWork();
+			(*WorkPtr)++;
+		}
+	}
+
+	XFlash_SetAsyncHandler(&FlashInstance, NULL, NULL);
+
+	return (Update.Status == XST_SUCCESS) ? XST_SUCCESS : XST_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the asynchronous completion handler. After the erase it
+* starts writing the first chunk, after each write it starts the next one.
+*
+* @param	CallBackRef is the update state.
+* @param	Operation is the completed operation.
+* @param	Status is the completion status.
+*
+* @return	None.
+*
+* @note		Devices without asynchronous write support are written with
+*		the blocking API once the erase has completed.
+*
+******************************************************************************/
+static void AsyncHandler(void *CallBackRef, u32 Operation, int Status)
+{
+	UpdateState *UpdatePtr = (UpdateState *)CallBackRef;
+	u32 Chunk;
+
+	if (Status != XST_SUCCESS) {
+		UpdatePtr->Status = Status;
+		UpdatePtr->Done = 1;
+		return;
+	}
+
+	if (Operation == XFL_ASYNC_WRITE) {
+		Chunk = UpdatePtr->EndOffset - UpdatePtr->NextOffset;
+		if (Chunk > CHUNK_SIZE) {
+			Chunk = CHUNK_SIZE;
+		}
+		UpdatePtr->NextOffset += Chunk;
+	}
+
+	if (UpdatePtr->NextOffset >= UpdatePtr->EndOffset) {
+		UpdatePtr->Done = 1;
+		return;
+	}
+
+	Chunk = UpdatePtr->EndOffset - UpdatePtr->NextOffset;
+	if (Chunk > CHUNK_SIZE) {
+		Chunk = CHUNK_SIZE;
+	}
+
+	Status = XFlash_WriteAsync(&FlashInstance, UpdatePtr->NextOffset,
+				   Chunk, WriteBuffer);
+	if (Status == XFLASH_NOT_SUPPORTED) {
+		UpdatePtr->Status = WriteChunks(UpdatePtr->NextOffset,
+				UpdatePtr->EndOffset - UpdatePtr->NextOffset);
+		UpdatePtr->Done = 1;
+	}
+	else if (Status != XST_SUCCESS) {
+		UpdatePtr->Status = Status;
+		UpdatePtr->Done = 1;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads back the test area and compares it with the data
+* written.
+*
+* @param	Offset is the offset of the test area.
+* @param	Bytes is the size of the test area.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		None.
+*
+******************************************************************************/
+static int VerifyUpdate(u32 Offset, u32 Bytes)
+{
+	int Status;
+	u32 Chunk;
+	u32 Index;
+	u32 EndOffset = Offset + Bytes;
+
+	while (Offset < EndOffset) {
+		Chunk = EndOffset - Offset;
+		if (Chunk > CHUNK_SIZE) {
+			Chunk = CHUNK_SIZE;
+		}
+
+		Status = XFlash_Read(&FlashInstance, Offset, Chunk,
+				     ReadBuffer);
+		if(Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+
+		for(Index = 0; Index < Chunk; Index++) {
+			if(ReadBuffer[Index] != WriteBuffer[Index]) {
+				return XST_FAILURE;
+			}
+		}
+		Offset += Chunk;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stands for the application work done while the flash is
+* busy. It checksums the work buffer once.
+*
+* @param	None
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void BackgroundWork(void)
+{
+	u32 Index;
+	u32 Sum = WorkResult;
+
+	for (Index = 0; Index < WORK_BUFFER_SIZE; Index++) {
+		Sum = (Sum << 1) + WorkBuffer[Index] + (Sum >> 31);
+		WorkBuffer[Index] = (u8)Sum;
+	}
+
+	WorkResult = Sum;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the time elapsed since its previous call, in
+* microseconds.
+*
+* @param	None
+*
+* @return	Elapsed time in microseconds, 0 if no global timer is
+*		available on the processor.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 ElapsedUs(void)
+{
+#if defined (__arm__) || defined (__aarch64__)
+	XTime Now;
+	XTime Elapsed;
+
+	XTime_GetTime(&Now);
+	Elapsed = Now - StartTime;
+	StartTime = Now;
+
+	return (u32)((Elapsed * 1000000U) / COUNTS_PER_SECOND);
+#else
+	return 0;
+#endif
+}
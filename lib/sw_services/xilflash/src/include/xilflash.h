@@ -114,6 +114,28 @@
 * only after the erase operation is completed successfully or an error is
 * reported.
 *
+* <b>Asynchronous Erase/Write Operation</b>
+*
+* XFlash_EraseAsync() and XFlash_WriteAsync() only issue the first block erase
+* or write buffer program to the device and return. The operation is then
+* advanced by calling XFlash_AsyncPoll() from a periodic tick, an idle loop or
+* the handler of the RY/BY interrupt (XFlash_AsyncInterruptHandler() can be
+* connected to the interrupt controller directly). Each call samples the
+* device status once and, if the device is ready, issues the next step, so the
+* CPU is only used for the command cycles and not while the device is busy.
+* The completion status is returned by XFlash_AsyncPoll() and is also reported
+* through the handler installed with XFlash_SetAsyncHandler().
+*
+* Only one asynchronous operation can be in progress per instance. While it is
+* in progress, XFlash_Write(), XFlash_Erase(), XFlash_Lock(), XFlash_Unlock()
+* and XFlash_Reset() return XFLASH_BUSY. XFlash_Read() returns XFLASH_BUSY
+* only if the range overlaps the bank the device is working on. For multiple
+* bank devices (Xilinx Platform Flash XL and Micron G18, where the library
+* treats each bank as an erase region) reads from the other banks are served
+* while the busy bank erases or programs. For all other devices the whole
+* device is treated as a single bank. Asynchronous write is only supported for
+* Intel family devices.
+*
 * <b>Sector Protection</b>
 *
 * The Flash Device is divided into Blocks. Each Block can be protected
@@ -218,6 +240,10 @@
 *                     _example.c to canonical name (CR 808007)
 * 4.3   ms   01/17/17 Fixed compilation warnings.
 * 4.4   ms   08/03/17 Added doxygen tags.
+* 4.5   ag   10/18/26 Added asynchronous erase/write APIs XFlash_EraseAsync(),
+*		      XFlash_WriteAsync() and XFlash_AsyncPoll() which are
+*		      advanced from a poll/tick or RY/BY interrupt. Reads from
+*		      banks other than the busy one are allowed meanwhile.
 *
 * </pre>
 *
@@ -358,6 +384,13 @@ extern "C" {
  #define XFL_DEVCTL_SET_CONFIG_REG	11	/**< Set config register value*/
 #endif /* XPAR_XFL_DEVICE_FAMILY_INTEL */
 
+/*
+ * Asynchronous operation in progress. Passed to the asynchronous handler.
+ */
+#define XFL_ASYNC_IDLE			0	/**< No operation in progress */
+#define XFL_ASYNC_ERASE			1	/**< Erase in progress */
+#define XFL_ASYNC_WRITE			2	/**< Write in progress */
+
 /**
  * A block region is defined as a set of consecutive erase blocks of the
  * same size. Most flash devices only have a handful of regions. If a
@@ -457,6 +490,36 @@ typedef union {
 #endif /* XPAR_XFL_DEVICE_FAMILY_INTEL */
 } DeviceCtrlParam;
 
+/**
+ * Handler called when an asynchronous erase or write operation completes.
+ * Operation is one of the XFL_ASYNC_* constants and Status is XST_SUCCESS
+ * or the error reported by the device. The handler may start the next
+ * asynchronous operation.
+ */
+typedef void (*XFlash_AsyncHandler) (void *CallBackRef, u32 Operation,
+					int Status);
+
+/**
+ * State of an asynchronous erase or write operation.
+ */
+typedef struct {
+	u32 Operation;		/**< One of the XFL_ASYNC_* constants */
+	u32 StartOffset;	/**< Offset of the request */
+	u32 EndOffset;		/**< Offset following the last byte of the
+				  *  request */
+	u32 NextOffset;		/**< Offset of the next step to start */
+	u8 *SrcPtr;		/**< Source of the next step (write only) */
+	u32 BusyOffset;		/**< Offset of the step in progress */
+	u32 BankStart;		/**< First offset of the busy bank */
+	u32 BankEnd;		/**< Offset following the busy bank */
+	int Status;		/**< Status of the last completed operation,
+				  *  XFLASH_BUSY while one is in progress */
+	u32 StepCount;		/**< Erase blocks/write buffers issued */
+	u32 PollCount;		/**< Status samples taken */
+	XFlash_AsyncHandler Handler;	/**< Completion handler */
+	void *CallBackRef;	/**< Callback reference for the handler */
+} XFlashAsync;
+
 /**
  * The XFlash library instance data. The user is required to allocate a
  * variable of this type for every flash device in the system. A pointer
@@ -466,6 +529,9 @@ typedef struct XFlashTag {
 	u32 Options;		/* Current device options */
 	int IsReady;		/* Device is initialized and ready */
 	int IsPlatformFlash;	/* Indicates whether this a platform flash */
+	int IsMultiBank;	/* Each erase region is a bank that can be
+				 * read while another one is busy
+				 */
 	u16 CommandSet;		/* Command algorithm used by part. Choices
 				 * are defined in XFL_CMDSET constants
 				 */
@@ -500,8 +566,18 @@ typedef struct XFlashTag {
 		int (*DeviceControl) (struct XFlashTag * InstancePtr,
 					u32 Command, DeviceCtrlParam
 					*Parameters);
+		int (*EraseStart) (struct XFlashTag * InstancePtr, u32 Offset,
+					u32 Bytes, u32 *StepBytesPtr);
+		int (*WriteStart) (struct XFlashTag * InstancePtr, u32 Offset,
+					u32 Bytes, void *SrcPtr,
+					u32 *StepBytesPtr);
+		int (*AsyncStatus) (struct XFlashTag * InstancePtr,
+					u32 Offset);
+		int (*AsyncEnd) (struct XFlashTag * InstancePtr, u32 Offset,
+					u32 Bytes);
 	} VTable;
 	XFlashCommandSet Command;	/* Flash Specific Commands */
+	XFlashAsync Async;		/* Asynchronous operation state */
 } XFlash;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -645,6 +721,17 @@ int XFlash_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlash_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlash_IsReady(XFlash * InstancePtr);
 
+/*
+ * Asynchronous erase/write functions.
+ */
+int XFlash_EraseAsync(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+int XFlash_WriteAsync(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			void *SrcPtr);
+int XFlash_AsyncPoll(XFlash * InstancePtr);
+void XFlash_AsyncInterruptHandler(void *InstancePtr);
+void XFlash_SetAsyncHandler(XFlash * InstancePtr,
+			XFlash_AsyncHandler FuncPtr, void *CallBackRef);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,8 @@
 *		      XFL_AMD_BOTTOM_WP_UNIFORM.
 * 4.1	nsk  06/06/12 Added New definitions as per AMD spec.
 *		      (CR 781697).
+* 4.5   ag   10/18/26 Added XFlashAmd_EraseStart(), XFlashAmd_AsyncStatus() and
+*		      XFlashAmd_AsyncEnd() for the asynchronous erase API.
 * </pre>
 *
 ******************************************************************************/
@@ -170,6 +172,11 @@ int XFlashAmd_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashAmd_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashAmd_EraseChip(struct XFlashTag * InstancePtr);
 
+int XFlashAmd_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			 u32 *StepBytesPtr);
+int XFlashAmd_AsyncStatus(XFlash * InstancePtr, u32 Offset);
+int XFlashAmd_AsyncEnd(XFlash * InstancePtr, u32 Offset, u32 Bytes);
+
 #endif /* XPAR_XFL_DEVICE_FAMILY_AMD */
 
 #ifdef __cplusplus
@@ -62,6 +62,9 @@
 *		      fixes the CR 662317.
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
+* 4.5   ag   10/18/26 Added XFlashIntel_EraseStart(), XFlashIntel_WriteStart(),
+*		      XFlashIntel_AsyncStatus() and XFlashIntel_AsyncEnd() for
+*		      the asynchronous erase/write APIs.
 *
 * </pre>
 *
@@ -270,6 +273,12 @@ int XFlashIntel_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashIntel_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashIntel_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 int XFlashIntel_GetStatus(XFlash * InstancePtr, u32 Offset);
+int XFlashIntel_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			   u32 *StepBytesPtr);
+int XFlashIntel_WriteStart(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			   void *SrcPtr, u32 *StepBytesPtr);
+int XFlashIntel_AsyncStatus(XFlash * InstancePtr, u32 Offset);
+int XFlashIntel_AsyncEnd(XFlash * InstancePtr, u32 Offset, u32 Bytes);
 
 #endif /* XPAR_XFL_DEVICE_FAMILY_INTEL */
 
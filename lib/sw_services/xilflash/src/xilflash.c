@@ -65,6 +65,12 @@
 *		      CR 662317 Description - Xilinx Platform Flash on ML605
 *		      fails to work.
 * 4.4   ms   08/03/17 Added tags and modified comment lines style for doxygen.
+* 4.5   ag   10/18/26 Added asynchronous erase/write APIs XFlash_EraseAsync(),
+*		      XFlash_WriteAsync(), XFlash_AsyncPoll(),
+*		      XFlash_AsyncInterruptHandler() and
+*		      XFlash_SetAsyncHandler(). Read, write, erase, lock, unlock
+*		      and reset return XFLASH_BUSY when they would interfere
+*		      with the asynchronous operation in progress.
 * </pre>
 *
 *
@@ -90,6 +96,8 @@
 /************************** Function Prototypes ******************************/
 
 static int SetVTable(XFlash * InstancePtr);
+static int AsyncStep(XFlash * InstancePtr);
+static void AsyncFinish(XFlash * InstancePtr, int Status);
 
 /************************** Variable Definitions *****************************/
 
@@ -150,6 +158,9 @@ int XFlash_Initialize(XFlash * InstancePtr, u32 BaseAddress, u8 BusWidth,
 	InstancePtr->IsReady = 0;
 	InstancePtr->Geometry.BaseAddress = BaseAddress;
 	InstancePtr->IsPlatformFlash = IsPlatformFlash;
+	InstancePtr->IsMultiBank = 0;
+	memset(&InstancePtr->Async, 0, sizeof(XFlashAsync));
+	InstancePtr->Async.Status = XST_SUCCESS;
 
 #ifdef XPAR_XFL_DEVICE_FAMILY_INTEL
 	if (IsPlatformFlash == 1) {
@@ -214,6 +225,8 @@ int XFlash_Initialize(XFlash * InstancePtr, u32 BaseAddress, u8 BusWidth,
 *		- XST_SUCCESS if successful.
 *		- XFLASH_ADDRESS_ERROR if the source address does not start
 *		  within the addressable areas of the device(s).
+*		- XFLASH_BUSY if the range overlaps the bank an asynchronous
+*		  erase or write is working on.
 *
 * @note		This function allows the transfer of data past the end of the
 *		device's address space. If this occurs, then results are
@@ -222,6 +235,8 @@ int XFlash_Initialize(XFlash * InstancePtr, u32 BaseAddress, u8 BusWidth,
 ******************************************************************************/
 int XFlash_Read(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *DestPtr)
 {
+	XFlashAsync *AsyncPtr;
+
 	if(InstancePtr == NULL) {
 		return XST_FAILURE;
 	}
@@ -230,6 +245,17 @@ int XFlash_Read(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *DestPtr)
 		return XST_FAILURE;
 	}
 
+	/*
+	 * The busy bank outputs its status register instead of the array, so
+	 * only reads from the other bank(s) can be served.
+	 */
+	AsyncPtr = &InstancePtr->Async;
+	if ((AsyncPtr->Operation != XFL_ASYNC_IDLE) && (Bytes != 0) &&
+	    (Offset < AsyncPtr->BankEnd) &&
+	    ((Offset + Bytes) > AsyncPtr->BankStart)) {
+		return XFLASH_BUSY;
+	}
+
 	return (InstancePtr->VTable.Read(InstancePtr, Offset, Bytes, DestPtr));
 }
 
@@ -264,6 +290,7 @@ int XFlash_Read(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *DestPtr)
 *		  retrieve specific error conditions. When this error is
 *		  returned, it is possible that the target address range was
 *		  only partially programmed.
+*		- XFLASH_BUSY if an asynchronous operation is in progress.
 *
 * @note		None.
 *
@@ -278,6 +305,10 @@ int XFlash_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *SrcPtr)
 		return XST_FAILURE;
 	}
 
+	if(InstancePtr->Async.Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
 	return (InstancePtr->VTable.Write(InstancePtr, Offset, Bytes, SrcPtr));
 }
 
@@ -299,6 +330,7 @@ int XFlash_Write(XFlash * InstancePtr, u32 Offset, u32 Bytes, void *SrcPtr)
 *		- XST_SUCCESS if successful.
 *		- XFLASH_ADDRESS_ERROR if the destination address range is
 *		  not completely within the addressable areas of the device(s).
+*		- XFLASH_BUSY if an asynchronous operation is in progress.
 *
 * @note		Due to flash memory design, the range actually erased may be
 *		larger than what was specified by the Offset & Bytes parameters.
@@ -316,6 +348,10 @@ int XFlash_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 		return XST_FAILURE;
 	}
 
+	if(InstancePtr->Async.Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
 	return (InstancePtr->VTable.Erase(InstancePtr, Offset, Bytes));
 }
 
@@ -339,6 +375,7 @@ int XFlash_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 * 		- XST_SUCCESS if successful.
 *		- XFLASH_ADDRESS_ERROR if the destination address range is
 *		  not completely within the addressable areas of the device(s).
+*		- XFLASH_BUSY if an asynchronous operation is in progress.
 *
 * @note		Due to flash memory design, the range actually locked may be
 *		larger than what was specified by the Offset & Bytes parameters.
@@ -356,6 +393,10 @@ int XFlash_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 		return XST_FAILURE;
 	}
 
+	if(InstancePtr->Async.Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
 	return (InstancePtr->VTable.Lock(InstancePtr, Offset, Bytes));
 }
 
@@ -380,6 +421,7 @@ int XFlash_Lock(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 *		- XST_SUCCESS if successful.
 *		- XFLASH_ADDRESS_ERROR if the destination address range is
 *		  not completely within the addressable areas of the device(s).
+*		- XFLASH_BUSY if an asynchronous operation is in progress.
 *
 * @note		None.
 *
@@ -394,6 +436,10 @@ int XFlash_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 		return XST_FAILURE;
 	}
 
+	if(InstancePtr->Async.Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
 	return (InstancePtr->VTable.Unlock(InstancePtr, Offset, Bytes));
 }
 
@@ -407,7 +453,8 @@ int XFlash_Unlock(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 * @return
 *		- XST_SUCCESS if successful.
 *		- XFLASH_BUSY if the flash devices were in the middle of an
-*		  operation and could not be reset.
+*		  operation and could not be reset, or if an asynchronous
+*		  operation is in progress.
 *		- XFLASH_ERROR if the device(s) have experienced an internal
 *		  error during the operation. XFlash_DeviceControl() must be
 *		  used to access the cause of the device specific error.
@@ -426,6 +473,10 @@ int XFlash_Reset(XFlash * InstancePtr)
 		return XST_FAILURE;
 	}
 
+	if(InstancePtr->Async.Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
 	return (InstancePtr->VTable.Reset(InstancePtr));
 }
 
@@ -486,6 +537,272 @@ int XFlash_IsReady(XFlash * InstancePtr)
 	return (InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function starts erasing the specified address range in the flash
+* device and returns without waiting for the device. Only the first block
+* erase is issued here, the remaining blocks are issued by
+* XFlash_AsyncPoll() as the device becomes ready.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+* @param	Offset		Offset into the device(s) address space from
+*				which to begin erasure.
+* @param	Bytes		Number of bytes to erase.
+*
+* @return
+*		- XST_SUCCESS if the erase was started, or if Bytes is zero.
+*		- XFLASH_BUSY if an asynchronous operation is in progress.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_NOT_SUPPORTED if the device family does not support
+*		  asynchronous erase.
+*
+* @note		As with XFlash_Erase(), the range actually erased may be
+*		larger than what was specified by the Offset & Bytes parameters.
+*
+******************************************************************************/
+int XFlash_EraseAsync(XFlash * InstancePtr, u32 Offset, u32 Bytes)
+{
+	XFlashAsync *AsyncPtr;
+	int Status;
+
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(InstancePtr->IsReady != XIL_COMPONENT_IS_READY) {
+		return XST_FAILURE;
+	}
+
+	AsyncPtr = &InstancePtr->Async;
+	if(AsyncPtr->Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
+	if (InstancePtr->VTable.EraseStart == NULL) {
+		return XFLASH_NOT_SUPPORTED;
+	}
+
+	if (Bytes == 0) {
+		return XST_SUCCESS;
+	}
+
+	AsyncPtr->StartOffset = Offset;
+	AsyncPtr->NextOffset = Offset;
+	AsyncPtr->EndOffset = Offset + Bytes;
+	AsyncPtr->SrcPtr = NULL;
+	AsyncPtr->StepCount = 0;
+	AsyncPtr->PollCount = 0;
+	AsyncPtr->Operation = XFL_ASYNC_ERASE;
+
+	Status = AsyncStep(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		AsyncPtr->Operation = XFL_ASYNC_IDLE;
+		AsyncPtr->Status = Status;
+		return Status;
+	}
+
+	AsyncPtr->Status = XFLASH_BUSY;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function starts programming the flash device(s) with data specified in
+* the user buffer and returns without waiting for the device. Only the first
+* write buffer is programmed here, the remaining ones are programmed by
+* XFlash_AsyncPoll() as the device becomes ready.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+* @param	Offset		Offset into the device(s) address space from
+*				which to begin programming. Must be aligned
+*				to the width of the flash's data bus.
+* @param	Bytes		Number of bytes to program.
+* @param	SrcPtr		Source address containing data to be
+*				programmed. It has no alignment requirement.
+*
+* @return
+*		- XST_SUCCESS if the write was started, or if Bytes is zero.
+*		- XFLASH_BUSY if an asynchronous operation is in progress.
+*		- XFLASH_ADDRESS_ERROR if the destination address range is
+*		  not completely within the addressable areas of the device(s).
+*		- XFLASH_ALIGNMENT_ERROR if Offset is not aligned to the width
+*		  of the flash's data bus.
+*		- XFLASH_NOT_SUPPORTED if the device family does not support
+*		  asynchronous write.
+*
+* @note		The user buffer must not be modified until the operation has
+*		completed.
+*
+******************************************************************************/
+int XFlash_WriteAsync(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			void *SrcPtr)
+{
+	XFlashAsync *AsyncPtr;
+	int Status;
+
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(SrcPtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	if(InstancePtr->IsReady != XIL_COMPONENT_IS_READY) {
+		return XST_FAILURE;
+	}
+
+	AsyncPtr = &InstancePtr->Async;
+	if(AsyncPtr->Operation != XFL_ASYNC_IDLE) {
+		return XFLASH_BUSY;
+	}
+
+	if (InstancePtr->VTable.WriteStart == NULL) {
+		return XFLASH_NOT_SUPPORTED;
+	}
+
+	if (Bytes == 0) {
+		return XST_SUCCESS;
+	}
+
+	AsyncPtr->StartOffset = Offset;
+	AsyncPtr->NextOffset = Offset;
+	AsyncPtr->EndOffset = Offset + Bytes;
+	AsyncPtr->SrcPtr = (u8 *)SrcPtr;
+	AsyncPtr->StepCount = 0;
+	AsyncPtr->PollCount = 0;
+	AsyncPtr->Operation = XFL_ASYNC_WRITE;
+
+	Status = AsyncStep(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		AsyncPtr->Operation = XFL_ASYNC_IDLE;
+		AsyncPtr->Status = Status;
+		return Status;
+	}
+
+	AsyncPtr->Status = XFLASH_BUSY;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function advances the asynchronous erase or write operation in
+* progress. The device status is sampled once. If the device is still busy
+* the function returns immediately, otherwise the next block erase or write
+* buffer program is issued, or the operation is completed and the handler set
+* by XFlash_SetAsyncHandler() is called.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+*
+* @return
+*		- XFLASH_BUSY if the operation is still in progress.
+*		- XST_SUCCESS if the operation has completed successfully, or
+*		  if no operation was started.
+*		- The error status of the device (for example XFLASH_ERROR) if
+*		  the operation has failed. XFlash_DeviceControl() can be used
+*		  to retrieve the device specific error condition.
+*
+* @note		Once the operation has completed, the completion status
+*		is returned until the next operation is started.
+*		This function is not re-entrant. If it is called from the RY/BY
+*		interrupt, it must not be called from task context at the same
+*		time.
+*
+******************************************************************************/
+int XFlash_AsyncPoll(XFlash * InstancePtr)
+{
+	XFlashAsync *AsyncPtr;
+	int Status;
+
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	AsyncPtr = &InstancePtr->Async;
+	if (AsyncPtr->Operation == XFL_ASYNC_IDLE) {
+		return AsyncPtr->Status;
+	}
+
+	/*
+	 * Sample the status of the bank working on the current step.
+	 */
+	AsyncPtr->PollCount++;
+	Status = InstancePtr->VTable.AsyncStatus(InstancePtr,
+						 AsyncPtr->BusyOffset);
+	if (Status == XFLASH_BUSY) {
+		return XFLASH_BUSY;
+	}
+
+	if (Status == XFLASH_READY) {
+		if (AsyncPtr->NextOffset == AsyncPtr->EndOffset) {
+			Status = XST_SUCCESS;
+		}
+		else {
+			Status = AsyncStep(InstancePtr);
+			if (Status == XST_SUCCESS) {
+				return XFLASH_BUSY;
+			}
+		}
+	}
+
+	AsyncFinish(InstancePtr, Status);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function is the interrupt handler for the RY/BY signal of the flash
+* device. It can be connected to the interrupt controller (or GPIO) the RY/BY
+* signal is routed to, with the XFlash instance as the callback reference.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+*
+* @return	None.
+*
+* @note		For Intel devices, XFL_DEVCTL_SET_RYBY can be used to pulse
+*		RY/BY on every erase and program completion.
+*
+******************************************************************************/
+void XFlash_AsyncInterruptHandler(void *InstancePtr)
+{
+	(void) XFlash_AsyncPoll((XFlash *)InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This function sets the handler called when an asynchronous erase or write
+* operation completes.
+*
+* @param	InstancePtr	Pointer to the XFlash instance.
+* @param	FuncPtr		Pointer to the handler, NULL to remove it.
+* @param	CallBackRef	Reference passed back to the handler.
+*
+* @return	None.
+*
+* @note		The handler is called from XFlash_AsyncPoll(), so it runs in
+*		interrupt context when the RY/BY interrupt is used.
+*
+******************************************************************************/
+void XFlash_SetAsyncHandler(XFlash * InstancePtr,
+			XFlash_AsyncHandler FuncPtr, void *CallBackRef)
+{
+	if(InstancePtr == NULL) {
+		return;
+	}
+
+	InstancePtr->Async.Handler = FuncPtr;
+	InstancePtr->Async.CallBackRef = CallBackRef;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -661,6 +978,11 @@ static int SetVTable(XFlash * InstancePtr)
 			InstancePtr->VTable.Reset = XFlashIntel_Reset;
 			InstancePtr->VTable.DeviceControl =
 						XFlashIntel_DeviceControl;
+			InstancePtr->VTable.EraseStart = XFlashIntel_EraseStart;
+			InstancePtr->VTable.WriteStart = XFlashIntel_WriteStart;
+			InstancePtr->VTable.AsyncStatus =
+						XFlashIntel_AsyncStatus;
+			InstancePtr->VTable.AsyncEnd = XFlashIntel_AsyncEnd;
 			break;
 #endif /* XPAR_XFL_DEVICE_FAMILY_INTEL */
 
@@ -677,6 +999,10 @@ static int SetVTable(XFlash * InstancePtr)
 			InstancePtr->VTable.Reset = XFlashAmd_Reset;
 			InstancePtr->VTable.DeviceControl =
 						XFlashAmd_DeviceControl;
+			InstancePtr->VTable.EraseStart = XFlashAmd_EraseStart;
+			InstancePtr->VTable.WriteStart = NULL;
+			InstancePtr->VTable.AsyncStatus = XFlashAmd_AsyncStatus;
+			InstancePtr->VTable.AsyncEnd = XFlashAmd_AsyncEnd;
 			break;
 #endif /* XPAR_XFL_DEVICE_FAMILY_AMD */
 
@@ -686,3 +1012,103 @@ static int SetVTable(XFlash * InstancePtr)
 
 	return (XST_SUCCESS);
 }
+
+/*****************************************************************************/
+/**
+*
+* Issues the next step (one block erase or one write buffer program) of the
+* asynchronous operation in progress and records the bank the device is busy
+* with.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+*
+* @return
+*		- XST_SUCCESS if the step was issued.
+*		- The error status returned by the family specific function
+*		  otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int AsyncStep(XFlash * InstancePtr)
+{
+	XFlashAsync *AsyncPtr = &InstancePtr->Async;
+	XFlashGeometry *GeomPtr = &InstancePtr->Geometry;
+	u32 StepBytes = 0;
+	u32 Dummy;
+	u16 Region;
+	u16 Block;
+	int Status;
+
+	if (AsyncPtr->Operation == XFL_ASYNC_ERASE) {
+		Status = InstancePtr->VTable.EraseStart(InstancePtr,
+				AsyncPtr->NextOffset,
+				AsyncPtr->EndOffset - AsyncPtr->NextOffset,
+				&StepBytes);
+	}
+	else {
+		Status = InstancePtr->VTable.WriteStart(InstancePtr,
+				AsyncPtr->NextOffset,
+				AsyncPtr->EndOffset - AsyncPtr->NextOffset,
+				AsyncPtr->SrcPtr, &StepBytes);
+	}
+
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/*
+	 * For multiple bank devices only the bank (erase region) holding the
+	 * step is busy, otherwise the whole device is.
+	 */
+	AsyncPtr->BusyOffset = AsyncPtr->NextOffset;
+	AsyncPtr->BankStart = 0;
+	AsyncPtr->BankEnd = 0xFFFFFFFF;
+	if ((InstancePtr->IsMultiBank == 1) &&
+	    (XFlashGeometry_ToBlock(GeomPtr, AsyncPtr->BusyOffset, &Region,
+				    &Block, &Dummy) == XST_SUCCESS)) {
+		AsyncPtr->BankStart = GeomPtr->EraseRegion[Region].AbsoluteOffset;
+		AsyncPtr->BankEnd = AsyncPtr->BankStart +
+			(GeomPtr->EraseRegion[Region].Size *
+			 GeomPtr->EraseRegion[Region].Number);
+	}
+
+	AsyncPtr->NextOffset += StepBytes;
+	if (AsyncPtr->SrcPtr != NULL) {
+		AsyncPtr->SrcPtr += StepBytes;
+	}
+	AsyncPtr->StepCount++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Completes the asynchronous operation in progress. The bank(s) are placed
+* back into read-array mode and the completion handler is called.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Status is the completion status of the operation.
+*
+* @return	None.
+*
+* @note		The instance is marked idle before the handler is called so
+*		that the handler can start the next operation.
+*
+******************************************************************************/
+static void AsyncFinish(XFlash * InstancePtr, int Status)
+{
+	XFlashAsync *AsyncPtr = &InstancePtr->Async;
+	u32 Operation = AsyncPtr->Operation;
+
+	(void) InstancePtr->VTable.AsyncEnd(InstancePtr, AsyncPtr->StartOffset,
+				AsyncPtr->EndOffset - AsyncPtr->StartOffset);
+
+	AsyncPtr->Operation = XFL_ASYNC_IDLE;
+	AsyncPtr->Status = Status;
+
+	if (AsyncPtr->Handler != NULL) {
+		AsyncPtr->Handler(AsyncPtr->CallBackRef, Operation, Status);
+	}
+}
@@ -80,6 +80,10 @@
 *		      of erase regions is not more than 1.
 * 4.1	nsk  06/06/12 Updated Spansion WriteBuffer programming.
 *		      (CR 781697).
+* 4.5   ag   10/18/26 Added XFlashAmd_EraseStart(), XFlashAmd_AsyncStatus()
+*		      and XFlashAmd_AsyncEnd() which issue a single block erase
+*		      and run a single pass of the toggle algorithm, for the
+*		      asynchronous erase API.
 * </pre>
 *
 ******************************************************************************/
@@ -727,6 +731,189 @@ int XFlashAmd_Erase(XFlash * InstancePtr, u32 Offset, u32 Bytes)
 	return (XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+*
+* Starts erasing the block holding Offset in the AMD flash device without
+* waiting for completion. Used by the asynchronous erase API.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset into the device(s) address space of the
+*		block to erase.
+* @param	Bytes is the number of bytes left to erase from Offset. It is
+*		used to verify the end of the range.
+* @param	StepBytesPtr returns the number of bytes from Offset to the end
+*		of the block.
+*
+* @return
+*		- XST_SUCCESS if the erase was started.
+*		- XFLASH_ADDRESS_ERROR if the range is not completely within
+*		  the addressable areas of the device(s).
+*		- XST_FAILURE if failed.
+*
+* @note		Offsets are converted to the device addressing the same way
+*		as XFlashAmd_Erase() does.
+*
+******************************************************************************/
+int XFlashAmd_EraseStart(XFlash * InstancePtr, u32 Offset, u32 Bytes,
+			 u32 *StepBytesPtr)
+{
+	u16 Region;
+	u16 Block;
+	u32 BlockOffset;
+	u32 Dummy;
+	u32 StartOffset;
+	u32 EndOffset;
+	u32 StepUnits;
+	XFlashGeometry *GeomPtr;
+
+	/* Verify inputs are valid. */
+	if ((InstancePtr == NULL) || (StepBytesPtr == NULL) || (Bytes == 0)) {
+		return (XST_FAILURE);
+	}
+
+	GeomPtr = &InstancePtr->Geometry;
+
+	if (InstancePtr->Geometry.MemoryLayout == XFL_LAYOUT_X16_X16_X1) {
+		StartOffset = Offset >> 1;
+		EndOffset = (Offset + Bytes - 1) >> 1;
+	}
+	else {
+		StartOffset = Offset;
+		EndOffset = Offset + Bytes - 1;
+	}
+
+	if (XFlashGeometry_ToBlock(GeomPtr, EndOffset, &Region, &Block,
+				   &Dummy) != XST_SUCCESS) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	if (XFlashGeometry_ToBlock(GeomPtr, StartOffset, &Region, &Block,
+				   &BlockOffset) != XST_SUCCESS) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	StepUnits = GeomPtr->EraseRegion[Region].Size - BlockOffset;
+	if (InstancePtr->Geometry.MemoryLayout == XFL_LAYOUT_X16_X16_X1) {
+		*StepBytesPtr = (StepUnits << 1) - (Offset & 1);
+	}
+	else {
+		*StepBytesPtr = StepUnits;
+	}
+	if (*StepBytesPtr > Bytes) {
+		*StepBytesPtr = Bytes;
+	}
+
+	(void) EnqueueEraseBlocks(InstancePtr, &Region, &Block, 1);
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks once whether the erase operation on the block holding Offset has
+* completed, without waiting for the device. Used by the asynchronous erase
+* API.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is an offset within the block being erased.
+*
+* @return
+*		- XFLASH_READY if the operation has completed.
+*		- XFLASH_BUSY if DQ6 is still toggling.
+*		- XFLASH_ERROR if DQ5 indicates that the operation failed.
+*
+* @note		This is a single pass of the toggle algorithm of PollSR.
+*
+******************************************************************************/
+int XFlashAmd_AsyncStatus(XFlash * InstancePtr, u32 Offset)
+{
+	u32 StatusReg1;
+	u32 StatusReg2;
+	u32 StatusOffset;
+	XFlashVendorData_Amd *DevDataPtr;
+
+	/* Verify inputs are valid. */
+	if (InstancePtr == NULL) {
+		return (XST_FAILURE);
+	}
+
+	DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	if (InstancePtr->Geometry.MemoryLayout == XFL_LAYOUT_X16_X16_X1) {
+		StatusOffset = Offset >> 1;
+	}
+	else {
+		StatusOffset = Offset;
+	}
+
+	/*
+	 * If DQ6 did not toggle between two reads the operation is complete.
+	 */
+	StatusReg1 = DevDataPtr->GetStatus(InstancePtr->Geometry.BaseAddress,
+					   StatusOffset);
+	StatusReg2 = DevDataPtr->GetStatus(InstancePtr->Geometry.BaseAddress,
+					   StatusOffset);
+	if ((StatusReg1 & XFL_AMD_SR_ERASE_COMPL_MASK) ==
+		(StatusReg2 & XFL_AMD_SR_ERASE_COMPL_MASK)) {
+		return (XFLASH_READY);
+	}
+
+	/*
+	 * If DQ5 is zero then operation is not yet complete.
+	 */
+	if ((StatusReg2 & XFL_AMD_SR_ERASE_ERROR_MASK) !=
+		XFL_AMD_SR_ERASE_ERROR_MASK) {
+		return (XFLASH_BUSY);
+	}
+
+	/*
+	 * DQ5 is set, DQ6 must have stopped toggling for the operation to be
+	 * successful.
+	 */
+	StatusReg1 = DevDataPtr->GetStatus(InstancePtr->Geometry.BaseAddress,
+					   StatusOffset);
+	StatusReg2 = DevDataPtr->GetStatus(InstancePtr->Geometry.BaseAddress,
+					   StatusOffset);
+	if ((StatusReg1 & XFL_AMD_SR_ERASE_COMPL_MASK) ==
+		(StatusReg2 & XFL_AMD_SR_ERASE_COMPL_MASK)) {
+		return (XFLASH_READY);
+	}
+
+	return (XFLASH_ERROR);
+}
+
+/*****************************************************************************/
+/**
+*
+* Places the bank(s) used by a completed asynchronous erase back into read
+* mode.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset of the asynchronous operation.
+* @param	Bytes is the number of bytes of the asynchronous operation.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XFLASH_ADDRESS_ERROR if Offset is not within the device.
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlashAmd_AsyncEnd(XFlash * InstancePtr, u32 Offset, u32 Bytes)
+{
+	if (InstancePtr == NULL) {
+		return (XST_FAILURE);
+	}
+
+	if (InstancePtr->Geometry.MemoryLayout == XFL_LAYOUT_X16_X16_X1) {
+		Offset = Offset >> 1;
+	}
+
+	return (XFlashAmd_ResetBank(InstancePtr, Offset, Bytes));
+}
+
 /*****************************************************************************/
 /**
 *
@@ -97,6 +97,14 @@
 *		      Description: Non-word aligned data write to flash fails
 *		      with AXI interface.
 * 4.1	nsk  08/06/15 Fixed CR 835008.
+* 4.5   ag   10/18/26 Added XFlashIntel_EraseStart(), XFlashIntel_WriteStart(),
+*		      XFlashIntel_AsyncStatus() and XFlashIntel_AsyncEnd() which
+*		      issue a single block erase/write buffer and sample the
+*		      status once, for the asynchronous erase/write APIs.
+*		      Platform Flash XL and Micron G18 banks are reported as
+*		      independent through IsMultiBank.
+*		      GetStatus64 now reports busy until both halves of the
+*		      bus are ready, as PollSR64 does.
 * </pre>
 *
 ******************************************************************************/
@@ -211,6 +219,7 @@ static void GetPartID(XFlash *InstancePtr);
 static int XFlashIntel_ResetBank(XFlash *InstancePtr, u32 Offset, u32 Bytes);
 static u16 EnqueueEraseBlocks(XFlash *InstancePtr, u16 *RegionPtr,
 				u16 *BlockPtr, u16 MaxBlocks);
+static void WriteBufferWord(u32 Address, u8 *Word, u32 BusWidthBytes);
 
 extern int XFlashGeometry_ToBlock(XFlashGeometry *InstancePtr,
 				u32 AbsoluteOffset,
@@ -336,6 +345,16 @@ int XFlashIntel_Initialize(XFlash *InstancePtr)
 			(InstancePtr->Properties.ProgCap.WriteBufferSize /
 							BusWidthBytes) - 1;
 
+	/*
+	 * The banks of the Platform Flash XL and Micron G18 devices are
+	 * described as separate erase regions, and can be read while another
+	 * bank is erasing or programming.
+	 */
+	if ((InstancePtr->IsPlatformFlash == 1) ||
+	    (InstancePtr->CommandSet == XFL_CMDSET_INTEL_G18)) {
+		InstancePtr->IsMultiBank = 1;
+	}
+
 	/*
 	 * Get part ID.
 	 */
@@ -575,6 +594,256 @@ int XFlashIntel_Erase(XFlash *InstancePtr, u32 Offset, u32 Bytes)
 	return (XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+*
+* Starts erasing the block holding Offset in the Intel flash device without
+* waiting for completion. Used by the asynchronous erase API.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset into the device(s) address space of the
+*		block to erase.
+* @param	Bytes is the number of bytes left to erase from Offset. It is
+*		used to verify the end of the range.
+* @param	StepBytesPtr returns the number of bytes from Offset to the end
+*		of the block.
+*
+* @return
+*		- XST_SUCCESS if the erase was started.
+*		- XFLASH_ADDRESS_ERROR if the range is not completely within
+*		  the addressable areas of the device(s).
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlashIntel_EraseStart(XFlash *InstancePtr, u32 Offset, u32 Bytes,
+			   u32 *StepBytesPtr)
+{
+	u16 Region, Block;
+	u32 BlockOffset;
+	XFlashGeometry *GeomPtr;
+
+	/*
+	 * Verify inputs are valid.
+	 */
+	if((InstancePtr == NULL) || (StepBytesPtr == NULL) || (Bytes == 0)) {
+		return XST_FAILURE;
+	}
+
+	GeomPtr = &InstancePtr->Geometry;
+
+	if (!XFL_GEOMETRY_IS_ABSOLUTE_VALID(GeomPtr, Offset + Bytes - 1)) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	if (XFlashGeometry_ToBlock(GeomPtr, Offset, &Region, &Block,
+				   &BlockOffset) != XST_SUCCESS) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	*StepBytesPtr = GeomPtr->EraseRegion[Region].Size - BlockOffset;
+	if (*StepBytesPtr > Bytes) {
+		*StepBytesPtr = Bytes;
+	}
+
+	(void) EnqueueEraseBlocks(InstancePtr, &Region, &Block, 1);
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* Programs one write buffer of the Intel flash device without waiting for
+* the program operation to complete. Used by the asynchronous write API.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset into the device(s) address space from which
+*		to begin programming. Must be aligned to the width of the
+*		flash's data bus.
+* @param	Bytes is the number of bytes left to program from Offset.
+* @param	SrcPtr is the source address containing data to be programmed.
+*		It has no alignment requirement.
+* @param	StepBytesPtr returns the number of bytes loaded in the write
+*		buffer. This is up to the end of the write buffer holding
+*		Offset.
+*
+* @return
+*		- XST_SUCCESS if the program operation was started.
+*		- XFLASH_ADDRESS_ERROR if the range is not completely within
+*		  the addressable areas of the device(s).
+*		- XFLASH_ALIGNMENT_ERROR if Offset is not aligned to the width
+*		  of the flash's data bus.
+*		- XFLASH_NOT_SUPPORTED if the part has no write buffer.
+*		- XFLASH_ERROR if the device reported an error while waiting
+*		  for the write buffer.
+*
+* @note		The write buffer is padded with 0xFF as done by the blocking
+*		write functions.
+*
+******************************************************************************/
+int XFlashIntel_WriteStart(XFlash *InstancePtr, u32 Offset, u32 Bytes,
+			   void *SrcPtr, u32 *StepBytesPtr)
+{
+	XFlashVendorData_Intel *DevDataPtr;
+	u8 *SrcBytePtr = (u8 *)SrcPtr;
+	u32 Layout;
+	u32 BusWidthBytes;
+	u32 BufferSize;
+	u32 BufferOffset;
+	u32 DataEnd;
+	u32 WordOffset;
+	u32 Index;
+	u8 Word[8];
+	int Status;
+
+	/*
+	 * Verify inputs are valid.
+	 */
+	if((InstancePtr == NULL) || (SrcPtr == NULL) ||
+	   (StepBytesPtr == NULL) || (Bytes == 0)) {
+		return XST_FAILURE;
+	}
+
+	if (!XFL_GEOMETRY_IS_ABSOLUTE_VALID(&InstancePtr->Geometry, Offset) ||
+		!XFL_GEOMETRY_IS_ABSOLUTE_VALID(&InstancePtr->Geometry,
+						Offset + Bytes - 1)) {
+		return (XFLASH_ADDRESS_ERROR);
+	}
+
+	BufferSize = InstancePtr->Properties.ProgCap.WriteBufferSize;
+	if (BufferSize == 0) {
+		return (XFLASH_NOT_SUPPORTED);
+	}
+
+	Layout = InstancePtr->Geometry.MemoryLayout;
+	BusWidthBytes = (Layout & XFL_LAYOUT_NUM_PARTS_MASK) *
+			((Layout & XFL_LAYOUT_PART_MODE_MASK) >> 8);
+	if (Offset & (BusWidthBytes - 1)) {
+		return (XFLASH_ALIGNMENT_ERROR);
+	}
+
+	DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	/*
+	 * Load the write buffer holding Offset, up to its end.
+	 */
+	BufferOffset = Offset &
+		~InstancePtr->Properties.ProgCap.WriteBufferAlignmentMask;
+	DataEnd = BufferOffset + BufferSize;
+	if (DataEnd > (Offset + Bytes)) {
+		DataEnd = Offset + Bytes;
+	}
+
+	/*
+	 * Send command to write buffer. Wait for buffer to become available
+	 * (Strata devices do not require this). Write number of words to be
+	 * written (always the maximum).
+	 */
+	DevDataPtr->SendCmd(InstancePtr->Geometry.BaseAddress, BufferOffset,
+			    InstancePtr->Command.WriteBufferCommand);
+	if (!((Layout == XFL_LAYOUT_X16_X16_X1) &&
+	      (InstancePtr->Properties.PartID.DeviceID == 0x01))) {
+		Status = DevDataPtr->PollSR(InstancePtr, BufferOffset);
+		if (Status != XFLASH_READY) {
+			return (Status);
+		}
+	}
+	DevDataPtr->SendCmd(InstancePtr->Geometry.BaseAddress, BufferOffset,
+			    DevDataPtr->WriteBufferWordCount);
+
+	/*
+	 * Fill the whole buffer, bytes outside Offset to DataEnd are written
+	 * as 0xFF which leaves the flash contents unchanged.
+	 */
+	for (WordOffset = BufferOffset;
+	     WordOffset < (BufferOffset + BufferSize);
+	     WordOffset += BusWidthBytes) {
+		for (Index = 0; Index < BusWidthBytes; Index++) {
+			if (((WordOffset + Index) >= Offset) &&
+			    ((WordOffset + Index) < DataEnd)) {
+				Word[Index] = SrcBytePtr[WordOffset + Index -
+							 Offset];
+			}
+			else {
+				Word[Index] = 0xFF;
+			}
+		}
+
+		WriteBufferWord(InstancePtr->Geometry.BaseAddress + WordOffset,
+				Word, BusWidthBytes);
+	}
+
+	/*
+	 * Buffer write completed. Send confirmation command; completion is
+	 * checked by XFlashIntel_AsyncStatus().
+	 */
+	DevDataPtr->SendCmd(InstancePtr->Geometry.BaseAddress, BufferOffset,
+			    XFL_INTEL_CMD_CONFIRM);
+
+	*StepBytesPtr = DataEnd - Offset;
+
+	return (XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+*
+* Samples the status register of the bank holding Offset once, without
+* waiting for the WSM. Used by the asynchronous erase/write API.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is an offset within the bank of the operation in
+*		progress.
+*
+* @return
+*		- XFLASH_READY if the WSM is ready.
+*		- XFLASH_BUSY if the WSM is busy.
+*		- XFLASH_ERROR if the WSM is ready, but an error condition
+*		  exists. XFlash_DeviceControl() can be used to retrieve it.
+*
+* @note		The bank stays in read status mode after an erase or program
+*		command, so the status register is read directly.
+*
+******************************************************************************/
+int XFlashIntel_AsyncStatus(XFlash *InstancePtr, u32 Offset)
+{
+	XFlashVendorData_Intel *DevDataPtr;
+
+	/*
+	 * Verify inputs are valid.
+	 */
+	if(InstancePtr == NULL) {
+		return XST_FAILURE;
+	}
+
+	DevDataPtr = GET_PARTDATA(InstancePtr);
+
+	return (DevDataPtr->GetStatus(InstancePtr, Offset));
+}
+
+/*****************************************************************************/
+/**
+*
+* Places the bank(s) used by a completed asynchronous erase/write back into
+* read-array mode.
+*
+* @param	InstancePtr is the pointer to the XFlash instance.
+* @param	Offset is the offset of the asynchronous operation.
+* @param	Bytes is the number of bytes of the asynchronous operation.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XFLASH_BUSY or XFLASH_ERROR as returned by the bank reset.
+*
+* @note		None.
+*
+******************************************************************************/
+int XFlashIntel_AsyncEnd(XFlash *InstancePtr, u32 Offset, u32 Bytes)
+{
+	return (XFlashIntel_ResetBank(InstancePtr, Offset, Bytes));
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1290,7 +1559,7 @@ static int GetStatus64(XFlash *InstancePtr, u32 Offset)
 	 * Next, determine if the device(s) are still busy.
 	 */
 	if (((XUINT64_MSW(RegData) & DevDataPtr->SR_WsmReady.Mask32) !=
-	     DevDataPtr->SR_WsmReady.Mask32) && ((XUINT64_LSW(RegData)
+	     DevDataPtr->SR_WsmReady.Mask32) || ((XUINT64_LSW(RegData)
 						  & DevDataPtr->SR_WsmReady.
 						  Mask32) !=
 						 DevDataPtr->SR_WsmReady.
@@ -3261,4 +3530,50 @@ static u16 EnqueueEraseBlocks(XFlash *InstancePtr, u16 *Region,
 	return (1);
 }
 
+/*****************************************************************************/
+/**
+*
+* Writes one data word to the write buffer. The word is written with the
+* access width used by the blocking write buffer functions for the layout
+* (two 32-bit accesses for a 64-bit bus).
+*
+* @param	Address is the physical address of the word.
+* @param	Word is the word data, in memory order.
+* @param	BusWidthBytes is the width of the flash data bus in bytes.
+*
+* @return	None.
+*
+* @note		The data is copied through memcpy so that the word has the
+*		same byte order in flash as in the user buffer.
+*
+******************************************************************************/
+static void WriteBufferWord(u32 Address, u8 *Word, u32 BusWidthBytes)
+{
+	u16 Data16;
+	u32 Data32;
+	u32 Data32Hi;
+
+	switch (BusWidthBytes) {
+		case 1:
+			WRITE_FLASH_8(Address, Word[0]);
+			break;
+
+		case 2:
+			memcpy(&Data16, Word, 2);
+			WRITE_FLASH_16(Address, Data16);
+			break;
+
+		case 4:
+			memcpy(&Data32, Word, 4);
+			WRITE_FLASH_32(Address, Data32);
+			break;
+
+		default:
+			memcpy(&Data32, Word, 4);
+			memcpy(&Data32Hi, &Word[4], 4);
+			WRITE_FLASH_64x2(Address, Data32, Data32Hi);
+			break;
+	}
+}
+
 #endif /* XPAR_XFL_DEVICE_FAMILY_INTEL */
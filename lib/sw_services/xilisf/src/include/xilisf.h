@@ -421,6 +421,26 @@
 * Winbond devices have a Status Register 2 which can be read using the
 * XIsf_GetStatusReg2() API.
 *
+* <b>Cached Operations</b>
+*
+* For Intel, STM, Winbond and Spansion Serial Flash, the application can
+* attach an XIsf_Cache to the instance with XIsf_CacheInitialize() and then
+* use XIsf_CacheRead() and XIsf_CacheWrite() for small accesses, e.g. to a
+* configuration store.
+*
+* - Reads are served from a page aligned read-ahead window, so only a miss
+*   pays the command and address overhead.
+* - Writes are merged in a copy of one sector in RAM. The sector is written
+*   back when a write goes to another sector or on XIsf_CacheFlush(). If the
+*   new data only clears bits, the dirty pages are programmed without an
+*   erase. Otherwise the sector is erased and its non blank pages are
+*   programmed.
+*
+* The hit and miss counters of both buffers are kept in XIsf_Cache.Stats.
+* The cached operations are supported in polled mode only. Data written with
+* XIsf_Write() or XIsf_Erase() discards the read-ahead window; the sector
+* buffer must be flushed before using these APIs on the buffered sector.
+*
 * <b>Write Enable/Disable Operations</b>
 *
 * For Intel, STM, Winbond and Spansion Serial Flash the user application must
@@ -511,6 +531,12 @@
 * 	   tjs	08/09/17 Updated the calculation of RealByteCount for reading data
 * 					 from flash with TESTADDRESS being 0x00000000, CR#981795
 *      ms   08/03/17 Added doxygen tags.
+* 5.10 ag   10/18/26 Added read-ahead and write-back caching.
+*                    New APIs:
+*                      XIsf_CacheInitialize()
+*                      XIsf_CacheRead()
+*                      XIsf_CacheWrite()
+*                      XIsf_CacheFlush()
 *
 * </pre>
 *
@@ -646,6 +672,12 @@ extern "C" {
 #define FLASH_CFG_TBL_PARALLEL_128_WB	(WINBOND_INDEX_START + 2)
 
 
+/*
+ * Maximum number of pages in a sector for the write-back buffer of
+ * XIsf_Cache
+ */
+#define XISF_CACHE_MAX_PAGES_PER_SECTOR	1024
+
 /*
  * Interrupt or Polling mode of Operation Flags
  */
@@ -801,6 +833,40 @@ typedef XQspiPsu XIsf_Iface;
 typedef void (*XIsf_StatusHandler) (void *CallBackRef, u32 StatusEvent,
 					unsigned int ByteCount);
 
+/**
+ * The following definition specifies the counters of an XIsf_Cache.
+ */
+typedef struct {
+	u32 ReadHits;		/**< Pages read from the cache */
+	u32 ReadMisses;		/**< Read-ahead window fills */
+	u32 WriteHits;		/**< Writes merged in the buffered sector */
+	u32 WriteMisses;	/**< Sectors loaded in the write-back buffer */
+	u32 PagePrograms;	/**< Pages programmed on write back */
+	u32 SectorErases;	/**< Sectors erased on write back */
+} XIsf_CacheStats;
+
+/**
+ * The following definition specifies the read-ahead and write-back cache of
+ * a Serial Flash instance. The buffers are provided by the application.
+ */
+typedef struct {
+	u8 *ReadBufPtr;		/**< Read-ahead buffer, ReadSize +
+				  *  XISF_CMD_MAX_EXTRA_BYTES bytes */
+	u32 ReadSize;		/**< Size of the read-ahead window, a multiple
+				  *  of the page size */
+	u32 ReadAddr;		/**< Flash address of the window */
+	u8 ReadValid;		/**< Window holds valid data */
+	u8 *SectorBufPtr;	/**< Write-back buffer, sector size +
+				  *  XISF_CMD_MAX_EXTRA_BYTES bytes */
+	u32 SectorAddr;		/**< Flash address of the buffered sector */
+	u8 SectorValid;		/**< A sector is buffered */
+	u8 SectorDirty;		/**< Buffered sector differs from flash */
+	u8 EraseNeeded;		/**< A write sets bits cleared in flash */
+	u8 PageDirty[XISF_CACHE_MAX_PAGES_PER_SECTOR / 8]; /**< Dirty pages of
+							     *  the sector */
+	XIsf_CacheStats Stats;	/**< Hit/miss counters */
+} XIsf_Cache;
+
 /**
  * The following definition specifies the instance structure of the Serial
  * Flash.
@@ -873,6 +939,8 @@ typedef struct {
 	s32 (*XIsf_Iface_SetClkPrescaler)
 		(XIsf_Iface *InstancePtr, u8 PreScaler);
 	XIsf_StatusHandler StatusHandler;
+	XIsf_Cache *CachePtr;	/**< Read-ahead/write-back cache, NULL if
+				  *  not used */
 } XIsf;
 
 /**
@@ -1089,6 +1157,21 @@ void XIsf_SetStatusHandler(XIsf *InstancePtr, XIsf_Iface *XIfaceInstancePtr,
 void XIsf_IfaceHandler(void *CallBackRef, u32 StatusEvent,
 		unsigned int ByteCount);
 
+#if ((XPAR_XISF_FLASH_FAMILY == INTEL) || (XPAR_XISF_FLASH_FAMILY == STM) || \
+     (XPAR_XISF_FLASH_FAMILY == WINBOND) || \
+     (XPAR_XISF_FLASH_FAMILY == SPANSION))
+/*
+ * Functions for cached Read/Write in xilisf_cache.c
+ */
+int XIsf_CacheInitialize(XIsf *InstancePtr, XIsf_Cache *CachePtr,
+			u8 *ReadBufPtr, u32 ReadSize, u8 *SectorBufPtr);
+int XIsf_CacheRead(XIsf *InstancePtr, u32 Address, u8 *ReadPtr,
+			u32 NumBytes);
+int XIsf_CacheWrite(XIsf *InstancePtr, u32 Address, const u8 *WritePtr,
+			u32 NumBytes);
+int XIsf_CacheFlush(XIsf *InstancePtr);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
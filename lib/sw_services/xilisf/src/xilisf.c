@@ -99,6 +99,7 @@
 *                     and S25FL256S.
 *       sk   03/02/16 Added support for MT25QU01G.
 * 5.9   ms   08/03/17 Added tags and modified comment lines style for doxygen.
+* 5.10  ag   10/18/26 Initialize the cache pointer of the instance.
 *
 * </pre>
 *
@@ -613,6 +614,7 @@ int XIsf_Initialize(XIsf *InstancePtr, XIsf_Iface *SpiInstPtr, u8 SlaveSelect,
 	InstancePtr->IsReady = FALSE;
 	InstancePtr->SpiSlaveSelect = SlaveSelect;
 	InstancePtr->WriteBufPtr = WritePtr;
+	InstancePtr->CachePtr = NULL;
 
 #ifdef XPAR_XISF_INTERFACE_AXISPI
 	if (SpiInstPtr->IsStarted != XIL_COMPONENT_IS_STARTED) {
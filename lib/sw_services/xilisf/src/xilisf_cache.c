@@ -0,0 +1,631 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xilisf_cache.c
+*
+* This file contains the library functions to read and write the Serial Flash
+* through a read-ahead window and a sector write-back buffer. Refer xilisf.h
+* for a detailed description.
+*
+* <pre>
+*
+* MODIFICATION HISTORY:
+*
+* Ver   Who      Date     Changes
+* ----- -------  -------- -----------------------------------------------
+* 5.10  ag       10/18/26 First release
+*       ag       10/19/26 Reject reads and writes beyond the end of the
+*                         Serial Flash.
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "include/xilisf.h"
+
+#if ((XPAR_XISF_FLASH_FAMILY == INTEL) || (XPAR_XISF_FLASH_FAMILY == STM) || \
+     (XPAR_XISF_FLASH_FAMILY == WINBOND) || \
+     (XPAR_XISF_FLASH_FAMILY == SPANSION))
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 CacheSectorSize(XIsf *InstancePtr);
+static u32 CacheFlashSize(XIsf *InstancePtr);
+static u32 CacheDataOffset(XIsf *InstancePtr);
+static int CacheWaitReady(XIsf *InstancePtr);
+static int CacheFill(XIsf *InstancePtr, u8 *BufPtr, u32 Address,
+			u32 NumBytes);
+static int CacheProgramPage(XIsf *InstancePtr, u32 Address, u8 *PagePtr);
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions ******************************/
+
+/*****************************************************************************/
+/**
+* @brief
+* This API attaches a read-ahead window and a sector write-back buffer to the
+* Serial Flash instance.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	CachePtr is a pointer to the XIsf_Cache to use.
+* @param	ReadBufPtr is the read-ahead buffer. Its size must be at
+*		least ReadSize + XISF_CMD_MAX_EXTRA_BYTES.
+* @param	ReadSize is the size of the read-ahead window. It must be a
+*		non zero multiple of the page size.
+* @param	SectorBufPtr is the write-back buffer. Its size must be at
+*		least the sector size + XISF_CMD_MAX_EXTRA_BYTES. It can be
+*		NULL if XIsf_CacheWrite() is not used.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		The buffers must meet the alignment requirement of the SPI
+*		interface for its DMA, if any.
+*
+******************************************************************************/
+int XIsf_CacheInitialize(XIsf *InstancePtr, XIsf_Cache *CachePtr,
+			u8 *ReadBufPtr, u32 ReadSize, u8 *SectorBufPtr)
+{
+	u32 Index;
+
+	if ((InstancePtr == NULL) || (CachePtr == NULL) ||
+			(ReadBufPtr == NULL)) {
+		return (int)XST_FAILURE;
+	}
+
+	if (InstancePtr->IsReady != TRUE) {
+		return (int)XST_FAILURE;
+	}
+
+	if ((ReadSize == 0U) ||
+		((ReadSize % InstancePtr->BytesPerPage) != 0U) ||
+		(ReadSize > CacheFlashSize(InstancePtr))) {
+		return (int)XST_FAILURE;
+	}
+
+	if ((CacheSectorSize(InstancePtr) / InstancePtr->BytesPerPage) >
+			XISF_CACHE_MAX_PAGES_PER_SECTOR) {
+		return (int)XST_FAILURE;
+	}
+
+	CachePtr->ReadBufPtr = ReadBufPtr;
+	CachePtr->ReadSize = ReadSize;
+	CachePtr->ReadAddr = 0U;
+	CachePtr->ReadValid = FALSE;
+	CachePtr->SectorBufPtr = SectorBufPtr;
+	CachePtr->SectorAddr = 0U;
+	CachePtr->SectorValid = FALSE;
+	CachePtr->SectorDirty = FALSE;
+	CachePtr->EraseNeeded = FALSE;
+	for (Index = 0U; Index < sizeof(CachePtr->PageDirty); Index++) {
+		CachePtr->PageDirty[Index] = 0U;
+	}
+	CachePtr->Stats.ReadHits = 0U;
+	CachePtr->Stats.ReadMisses = 0U;
+	CachePtr->Stats.WriteHits = 0U;
+	CachePtr->Stats.WriteMisses = 0U;
+	CachePtr->Stats.PagePrograms = 0U;
+	CachePtr->Stats.SectorErases = 0U;
+
+	InstancePtr->CachePtr = CachePtr;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This API reads data from the Serial Flash through the cache. Data of the
+* buffered sector is returned from the write-back buffer, other data from
+* the read-ahead window, which is refilled from the page of the first byte
+* not found in it.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	Address is the starting address in the Serial Flash.
+* @param	ReadPtr is a pointer to the memory where the data is stored.
+*		Unlike XIsf_Read(), the data starts at ReadPtr[0].
+* @param	NumBytes is the number of bytes to read.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE, also if the range
+*		is not within the Serial Flash.
+*
+* @note		Hits and misses are counted per page accessed.
+*
+******************************************************************************/
+int XIsf_CacheRead(XIsf *InstancePtr, u32 Address, u8 *ReadPtr,
+			u32 NumBytes)
+{
+	XIsf_Cache *CachePtr;
+	u8 *SrcPtr;
+	u32 PageSize;
+	u32 SectorSize;
+	u32 FlashSize;
+	u32 ByteCount;
+	u32 Index;
+	int Status;
+
+	if ((InstancePtr == NULL) || (ReadPtr == NULL)) {
+		return (int)XST_FAILURE;
+	}
+
+	CachePtr = InstancePtr->CachePtr;
+	if ((CachePtr == NULL) ||
+		(XIsf_GetTransferMode(InstancePtr) != XISF_POLLING_MODE)) {
+		return (int)XST_FAILURE;
+	}
+
+	PageSize = InstancePtr->BytesPerPage;
+	SectorSize = CacheSectorSize(InstancePtr);
+	FlashSize = CacheFlashSize(InstancePtr);
+
+	/*
+	 * The whole range must be within the Serial Flash
+	 */
+	if ((Address >= FlashSize) || (NumBytes > (FlashSize - Address))) {
+		return (int)XST_FAILURE;
+	}
+
+	while (NumBytes > 0U) {
+		/*
+		 * Copy up to the end of the page
+		 */
+		ByteCount = PageSize - (Address % PageSize);
+		if (ByteCount > NumBytes) {
+			ByteCount = NumBytes;
+		}
+
+		if ((CachePtr->SectorValid == TRUE) &&
+			(Address >= CachePtr->SectorAddr) &&
+			(Address < (CachePtr->SectorAddr + SectorSize))) {
+			SrcPtr = CachePtr->SectorBufPtr +
+				CacheDataOffset(InstancePtr) +
+				(Address - CachePtr->SectorAddr);
+			CachePtr->Stats.ReadHits++;
+		} else {
+			if ((CachePtr->ReadValid != TRUE) ||
+				(Address < CachePtr->ReadAddr) ||
+				(Address >= (CachePtr->ReadAddr +
+						CachePtr->ReadSize))) {
+				/*
+				 * Refill the window from the current page
+				 */
+				CachePtr->ReadValid = FALSE;
+				CachePtr->ReadAddr = Address - (Address % PageSize);
+				if ((CachePtr->ReadAddr + CachePtr->ReadSize) >
+						FlashSize) {
+					CachePtr->ReadAddr = FlashSize -
+							CachePtr->ReadSize;
+				}
+				Status = CacheFill(InstancePtr,
+						CachePtr->ReadBufPtr,
+						CachePtr->ReadAddr,
+						CachePtr->ReadSize);
+				if (Status != (int)XST_SUCCESS) {
+					return (int)XST_FAILURE;
+				}
+				CachePtr->ReadValid = TRUE;
+				CachePtr->Stats.ReadMisses++;
+			} else {
+				CachePtr->Stats.ReadHits++;
+			}
+			SrcPtr = CachePtr->ReadBufPtr +
+				CacheDataOffset(InstancePtr) +
+				(Address - CachePtr->ReadAddr);
+		}
+
+		for (Index = 0U; Index < ByteCount; Index++) {
+			ReadPtr[Index] = SrcPtr[Index];
+		}
+
+		ReadPtr += ByteCount;
+		Address += ByteCount;
+		NumBytes -= ByteCount;
+	}
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This API writes data to the Serial Flash through the write-back buffer.
+* The data is merged in the RAM copy of its sector. Writing to another
+* sector first writes back the buffered one.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	Address is the starting address in the Serial Flash.
+* @param	WritePtr is a pointer to the data to write.
+* @param	NumBytes is the number of bytes to write.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE, also if the range
+*		is not within the Serial Flash.
+*
+* @note		The data is in the Serial Flash only after XIsf_CacheFlush()
+*		or a write to another sector.
+*
+******************************************************************************/
+int XIsf_CacheWrite(XIsf *InstancePtr, u32 Address, const u8 *WritePtr,
+			u32 NumBytes)
+{
+	XIsf_Cache *CachePtr;
+	u8 *DstPtr;
+	u32 SectorSize;
+	u32 FlashSize;
+	u32 SectorAddr;
+	u32 Offset;
+	u32 ByteCount;
+	u32 Index;
+	u32 Page;
+	int Status;
+
+	if ((InstancePtr == NULL) || (WritePtr == NULL)) {
+		return (int)XST_FAILURE;
+	}
+
+	CachePtr = InstancePtr->CachePtr;
+	if ((CachePtr == NULL) || (CachePtr->SectorBufPtr == NULL) ||
+		(XIsf_GetTransferMode(InstancePtr) != XISF_POLLING_MODE)) {
+		return (int)XST_FAILURE;
+	}
+
+	SectorSize = CacheSectorSize(InstancePtr);
+	FlashSize = CacheFlashSize(InstancePtr);
+
+	/*
+	 * The whole range must be within the Serial Flash
+	 */
+	if ((Address >= FlashSize) || (NumBytes > (FlashSize - Address))) {
+		return (int)XST_FAILURE;
+	}
+
+	while (NumBytes > 0U) {
+		SectorAddr = Address - (Address % SectorSize);
+
+		if ((CachePtr->SectorValid != TRUE) ||
+			(CachePtr->SectorAddr != SectorAddr)) {
+			Status = XIsf_CacheFlush(InstancePtr);
+			if (Status != (int)XST_SUCCESS) {
+				return (int)XST_FAILURE;
+			}
+
+			CachePtr->SectorValid = FALSE;
+			Status = CacheFill(InstancePtr, CachePtr->SectorBufPtr,
+					SectorAddr, SectorSize);
+			if (Status != (int)XST_SUCCESS) {
+				return (int)XST_FAILURE;
+			}
+			CachePtr->SectorAddr = SectorAddr;
+			CachePtr->SectorValid = TRUE;
+			CachePtr->Stats.WriteMisses++;
+		} else {
+			CachePtr->Stats.WriteHits++;
+		}
+
+		Offset = Address - SectorAddr;
+		ByteCount = SectorSize - Offset;
+		if (ByteCount > NumBytes) {
+			ByteCount = NumBytes;
+		}
+
+		/*
+		 * Merge the data. Only a bit going from 0 to 1 needs an erase.
+		 */
+		DstPtr = CachePtr->SectorBufPtr + CacheDataOffset(InstancePtr);
+		for (Index = Offset; Index < (Offset + ByteCount); Index++) {
+			if (DstPtr[Index] != *WritePtr) {
+				if ((*WritePtr & (u8)(~DstPtr[Index])) != 0U) {
+					CachePtr->EraseNeeded = TRUE;
+				}
+				Page = Index / InstancePtr->BytesPerPage;
+				CachePtr->PageDirty[Page >> 3] |=
+						(u8)(1U << (Page & 0x7U));
+				CachePtr->SectorDirty = TRUE;
+				DstPtr[Index] = *WritePtr;
+			}
+			WritePtr++;
+		}
+
+		Address += ByteCount;
+		NumBytes -= ByteCount;
+	}
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* This API writes the buffered sector back to the Serial Flash if it was
+* modified. When the new data only clears bits, the modified pages are
+* programmed. Otherwise the sector is erased and all its non blank pages
+* are programmed.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+* @note		The sector stays in the buffer after the flush.
+*
+******************************************************************************/
+int XIsf_CacheFlush(XIsf *InstancePtr)
+{
+	XIsf_Cache *CachePtr;
+	u8 *DataPtr;
+	u8 *PagePtr;
+	u32 PageSize;
+	u32 NumPages;
+	u32 Page;
+	u32 Index;
+	u8 Blank;
+	int Status;
+
+	if (InstancePtr == NULL) {
+		return (int)XST_FAILURE;
+	}
+
+	CachePtr = InstancePtr->CachePtr;
+	if (CachePtr == NULL) {
+		return (int)XST_FAILURE;
+	}
+
+	if ((CachePtr->SectorValid != TRUE) ||
+			(CachePtr->SectorDirty != TRUE)) {
+		return (int)XST_SUCCESS;
+	}
+
+	PageSize = InstancePtr->BytesPerPage;
+	NumPages = CacheSectorSize(InstancePtr) / PageSize;
+	DataPtr = CachePtr->SectorBufPtr + CacheDataOffset(InstancePtr);
+
+	if (CachePtr->EraseNeeded == TRUE) {
+		Status = XIsf_WriteEnable(InstancePtr, XISF_WRITE_ENABLE);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+
+		Status = XIsf_Erase(InstancePtr, XISF_SECTOR_ERASE,
+					CachePtr->SectorAddr);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+
+		Status = CacheWaitReady(InstancePtr);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+		CachePtr->Stats.SectorErases++;
+	}
+
+	for (Page = 0U; Page < NumPages; Page++) {
+		PagePtr = DataPtr + (Page * PageSize);
+
+		if (CachePtr->EraseNeeded == TRUE) {
+			/*
+			 * Blank pages are already in the erased state
+			 */
+			Blank = TRUE;
+			for (Index = 0U; Index < PageSize; Index++) {
+				if (PagePtr[Index] != 0xFFU) {
+					Blank = FALSE;
+					break;
+				}
+			}
+			if (Blank == TRUE) {
+				continue;
+			}
+		} else if ((CachePtr->PageDirty[Page >> 3] &
+				(u8)(1U << (Page & 0x7U))) == 0U) {
+			continue;
+		}
+
+		Status = CacheProgramPage(InstancePtr,
+				CachePtr->SectorAddr + (Page * PageSize),
+				PagePtr);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+		CachePtr->Stats.PagePrograms++;
+	}
+
+	for (Index = 0U; Index < sizeof(CachePtr->PageDirty); Index++) {
+		CachePtr->PageDirty[Index] = 0U;
+	}
+	CachePtr->SectorDirty = FALSE;
+	CachePtr->EraseNeeded = FALSE;
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the size of the sector used for erase.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+*
+* @return	The sector size in bytes.
+*
+******************************************************************************/
+static u32 CacheSectorSize(XIsf *InstancePtr)
+{
+#if defined (XPAR_XISF_INTERFACE_PSQSPI) || \
+	defined (XPAR_XISF_INTERFACE_QSPIPSU)
+	return InstancePtr->SectorSize;
+#else
+	return (u32)InstancePtr->BytesPerPage *
+			(u32)InstancePtr->PagesPerBlock;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the size of the Serial Flash.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+*
+* @return	The size of the Serial Flash in bytes.
+*
+******************************************************************************/
+static u32 CacheFlashSize(XIsf *InstancePtr)
+{
+#if defined (XPAR_XISF_INTERFACE_PSQSPI) || \
+	defined (XPAR_XISF_INTERFACE_QSPIPSU)
+	return InstancePtr->SectorSize * InstancePtr->NumSectors;
+#else
+	return CacheSectorSize(InstancePtr) * (u32)InstancePtr->NumOfSectors;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the position of the first data byte in a buffer
+* filled by XIsf_Read(). With the AXI SPI and PS SPI interfaces the bytes
+* received while the command and address are sent come first.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+*
+* @return	The offset of the data in the read buffer.
+*
+******************************************************************************/
+static u32 CacheDataOffset(XIsf *InstancePtr)
+{
+#if defined (XPAR_XISF_INTERFACE_PSQSPI) || \
+	defined (XPAR_XISF_INTERFACE_QSPIPSU)
+	return 0U;
+#else
+	if (InstancePtr->FourByteAddrMode == TRUE) {
+		return XISF_CMD_SEND_EXTRA_BYTES_4BYTE_MODE;
+	}
+	return XISF_CMD_SEND_EXTRA_BYTES;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits until the Serial Flash is ready for the next command.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+******************************************************************************/
+static int CacheWaitReady(XIsf *InstancePtr)
+{
+	u8 StatusBuf[XISF_STATUS_RDWR_BYTES + 1];
+	int Status;
+
+	do {
+		Status = XIsf_GetStatus(InstancePtr, StatusBuf);
+		if (Status != (int)XST_SUCCESS) {
+			return (int)XST_FAILURE;
+		}
+	} while ((StatusBuf[BYTE2] & XISF_SR_IS_READY_MASK) != 0U);
+
+	return (int)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a region of the Serial Flash in to a cache buffer.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	BufPtr is the cache buffer.
+* @param	Address is the starting address in the Serial Flash.
+* @param	NumBytes is the number of bytes to read.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+******************************************************************************/
+static int CacheFill(XIsf *InstancePtr, u8 *BufPtr, u32 Address,
+			u32 NumBytes)
+{
+	XIsf_ReadParam ReadParam;
+
+	ReadParam.Address = Address;
+	ReadParam.ReadPtr = BufPtr;
+	ReadParam.NumBytes = NumBytes;
+	ReadParam.NumDummyBytes = 0;
+
+	return XIsf_Read(InstancePtr, XISF_READ, &ReadParam);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function programs one page of the Serial Flash and waits for the
+* program to complete.
+*
+* @param	InstancePtr is a pointer to the XIsf instance.
+* @param	Address is the address of the page.
+* @param	PagePtr is the data of the page.
+*
+* @return	XST_SUCCESS if successful else XST_FAILURE.
+*
+******************************************************************************/
+static int CacheProgramPage(XIsf *InstancePtr, u32 Address, u8 *PagePtr)
+{
+	XIsf_WriteParam WriteParam;
+	int Status;
+
+	Status = XIsf_WriteEnable(InstancePtr, XISF_WRITE_ENABLE);
+	if (Status != (int)XST_SUCCESS) {
+		return (int)XST_FAILURE;
+	}
+
+	WriteParam.Address = Address;
+	WriteParam.WritePtr = PagePtr;
+	WriteParam.NumBytes = InstancePtr->BytesPerPage;
+
+	Status = XIsf_Write(InstancePtr, XISF_WRITE, &WriteParam);
+	if (Status != (int)XST_SUCCESS) {
+		return (int)XST_FAILURE;
+	}
+
+	return CacheWaitReady(InstancePtr);
+}
+
+#endif
@@ -64,6 +64,7 @@
 * 5.7  rk	27/07/16 Added the subsector erase command.
 * 5.9  nsk  07/11/17 Add Micron 4Byte addressing support in SectorErase, CR#980169
 *      ms   08/03/17 Added tags and updated comment lines style for doxygen.
+* 5.10 ag   10/18/26 Discard the read-ahead window of the cache on erase.
 *
 * </pre>
 *
@@ -152,6 +153,13 @@ int XIsf_Erase(XIsf *InstancePtr, XIsf_EraseOperation Operation, u32 Address)
 		return (int)(XST_FAILURE);
 	}
 
+	/*
+	 * The read-ahead window may hold the data being erased
+	 */
+	if (InstancePtr->CachePtr != NULL) {
+		InstancePtr->CachePtr->ReadValid = FALSE;
+	}
+
 	switch (Operation) {
 
 		case XISF_PAGE_ERASE:
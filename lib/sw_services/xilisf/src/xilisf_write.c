@@ -61,6 +61,7 @@
 *      sk   03/02/16 Used 3byte command with 4 byte addressing for Micron.
 * 5.9  nsk  07/11/17 Add Micron 4Byte addressing support in Xisf_Write, CR#980169
 *      ms   08/03/17 Added tags and modified comment lines style for doxygen.
+* 5.10 ag   10/18/26 Discard the read-ahead window of the cache on write.
 *
 * </pre>
 *
@@ -261,6 +262,13 @@ int XIsf_Write(XIsf *InstancePtr, XIsf_WriteOperation Operation,
 		return (int)XST_FAILURE;
 	}
 
+	/*
+	 * The read-ahead window may hold the data being overwritten
+	 */
+	if (InstancePtr->CachePtr != NULL) {
+		InstancePtr->CachePtr->ReadValid = FALSE;
+	}
+
 	switch (Operation) {
 		case XISF_WRITE:
 			WriteParamPtr = (XIsf_WriteParam*)(void *) OpParamPtr;
@@ -0,0 +1,260 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*
+******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file	xilsecure_stream_example.c
+* @addtogroup xsecure_stream_example	XilSecure Streaming API Example Usage
+* @{
+*
+* @note
+* This example encrypts a test image with the AES engine and then streams the
+* encrypted image back through the SHA-3 and AES-GCM engines, chunk by chunk,
+* using the double buffered XSecure_Stream helper. The reader callback copies
+* each chunk from DDR as a flash driver would. The calculated hash is
+* compared with the hash of the whole encrypted image, the decrypted image
+* with the original one, and the throughput of each stage is printed.
+*
+* MODIFICATION HISTORY:
+* <pre>
+* Ver   Who    Date     Changes
+* ----- ------ -------- -------------------------------------------------
+* 2.3   ag     10/19/26 First Release
+*
+* </pre>
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xparameters.h"
+#include "xtime_l.h"
+#include "xsecure_stream.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XSECURE_IMAGE_SIZE	(256U * 1024U)	/* Size of the test image */
+#define XSECURE_CHUNK_SIZE	(16U * 1024U)	/* Size of one chunk */
+#define XSECURE_HASH_SIZE	(48U)
+
+#define XSECURE_CSUDMA_DEVICEID	XPAR_XCSUDMA_0_DEVICE_ID
+
+/*
+ * The hard coded AES key and IV, the IV is padded to 16 bytes
+ */
+static const u8 csu_key[] = {
+  0xf8, 0x78, 0xb8, 0x38, 0xd8, 0x58, 0x98, 0x18,
+  0xe8, 0x68, 0xa8, 0x28, 0xc8, 0x48, 0x88, 0x08,
+  0xf0, 0x70, 0xb0, 0x30, 0xd0, 0x50, 0x90, 0x10,
+  0xe0, 0x60, 0xa0, 0x20, 0xc0, 0x40, 0x80, 0x00
+};
+
+static const u8 csu_iv[] = {
+ 0xD2, 0x45, 0x0E, 0x07, 0xEA, 0x5D, 0xE0, 0x42, 0x6C, 0x0F, 0xA1, 0x33,
+ 0x00, 0x00, 0x00, 0x00
+};
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static s32 SecureStreamExample(void);
+static u32 SecureStreamReader(void *CallBackRef, u32 Offset, u8 *Buffer,
+				u32 Length);
+static u64 SecureStreamGetTicks(void);
+
+/************************** Variable Definitions *****************************/
+
+u8 Image[XSECURE_IMAGE_SIZE] __attribute__ ((aligned (64)));
+u8 EncImage[XSECURE_IMAGE_SIZE + XSECURE_SECURE_GCM_TAG_SIZE]
+					__attribute__ ((aligned (64)));
+u8 DecImage[XSECURE_IMAGE_SIZE] __attribute__ ((aligned (64)));
+u8 ChunkBuffer0[XSECURE_CHUNK_SIZE] __attribute__ ((aligned (64)));
+u8 ChunkBuffer1[XSECURE_CHUNK_SIZE] __attribute__ ((aligned (64)));
+u8 RefHash[XSECURE_HASH_SIZE] __attribute__ ((aligned (64)));
+u8 Hash[XSECURE_HASH_SIZE] __attribute__ ((aligned (64)));
+
+XSecure_Sha3 Secure_Sha3;
+XSecure_Aes Secure_Aes;
+XSecure_Stream Secure_Stream;
+XCsuDma CsuDma;
+
+/************************** Function Definitions ******************************/
+int main(void)
+{
+	int Status;
+
+	Status = SecureStreamExample();
+	if (Status == XST_SUCCESS) {
+		xil_printf("\r\nSuccessfully ran Stream example\r\n");
+	}
+	else {
+		xil_printf("\r\nStream example failed\r\n");
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* This function encrypts a test image, streams it back through SHA-3 and
+* AES-GCM, verifies the results and prints the throughput of each stage.
+*
+* @param	None
+*
+* @return
+*		- XST_FAILURE if the Stream example failed.
+*		- XST_SUCCESS if the Stream example was successful
+*
+* @note		None.
+*
+****************************************************************************/
+/** //! [Stream example] */
+static s32 SecureStreamExample(void)
+{
+	XCsuDma_Config *Config;
+	s32 Status;
+	u32 Index;
+
+	/* Initialize CSU DMA driver */
+	Config = XCsuDma_LookupConfig(XSECURE_CSUDMA_DEVICEID);
+	if (NULL == Config) {
+		return XST_FAILURE;
+	}
+
+	Status = XCsuDma_CfgInitialize(&CsuDma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XSecure_Sha3Initialize(&Secure_Sha3, &CsuDma);
+	XSecure_AesInitialize(&Secure_Aes, &CsuDma,
+				XSECURE_CSU_AES_KEY_SRC_KUP,
+				(u32 *)csu_iv, (u32 *)csu_key);
+
+	/* Prepare the encrypted image and its reference hash */
+	for (Index = 0U; Index < XSECURE_IMAGE_SIZE; Index++) {
+		Image[Index] = (u8)(Index * 7U + (Index >> 8));
+	}
+	XSecure_AesEncryptData(&Secure_Aes, EncImage, Image,
+				XSECURE_IMAGE_SIZE);
+	XSecure_Sha3Digest(&Secure_Sha3, EncImage, XSECURE_IMAGE_SIZE,
+				RefHash);
+
+	/* Stream the encrypted image through SHA-3 and AES-GCM */
+	XSecure_StreamInitialize(&Secure_Stream, &Secure_Sha3, &Secure_Aes,
+			ChunkBuffer0, ChunkBuffer1, XSECURE_CHUNK_SIZE);
+	XSecure_StreamSetReader(&Secure_Stream, SecureStreamReader,
+				EncImage);
+	XSecure_StreamSetTimer(&Secure_Stream, SecureStreamGetTicks,
+				COUNTS_PER_SECOND);
+
+	Status = XSecure_StreamDecrypt(&Secure_Stream, DecImage,
+			XSECURE_IMAGE_SIZE, EncImage + XSECURE_IMAGE_SIZE, Hash);
+	if (Status != XST_SUCCESS) {
+		xil_printf("Stream decryption failed: %d\r\n", Status);
+		return XST_FAILURE;
+	}
+
+	for (Index = 0U; Index < XSECURE_HASH_SIZE; Index++) {
+		if (Hash[Index] != RefHash[Index]) {
+			xil_printf("SHA-3 hash mismatch\r\n");
+			return XST_FAILURE;
+		}
+	}
+
+	for (Index = 0U; Index < XSECURE_IMAGE_SIZE; Index++) {
+		if (DecImage[Index] != Image[Index]) {
+			xil_printf("Decrypted data mismatch at %d\r\n", Index);
+			return XST_FAILURE;
+		}
+	}
+
+	xil_printf("Image %d bytes, chunk %d bytes\r\n", XSECURE_IMAGE_SIZE,
+				XSECURE_CHUNK_SIZE);
+	xil_printf("Read  : %d MB/s\r\n", XSecure_StreamGetMBps(
+			&Secure_Stream, XSECURE_STREAM_STAGE_READ));
+	xil_printf("SHA-3 : %d MB/s\r\n", XSecure_StreamGetMBps(
+			&Secure_Stream, XSECURE_STREAM_STAGE_SHA3));
+	xil_printf("AES   : %d MB/s\r\n", XSecure_StreamGetMBps(
+			&Secure_Stream, XSECURE_STREAM_STAGE_AES));
+	xil_printf("Total : %d MB/s\r\n", XSecure_StreamGetMBps(
+			&Secure_Stream, XSECURE_STREAM_STAGE_TOTAL));
+
+	return XST_SUCCESS;
+}
+/** //! [Stream example] */
+/** @} */
+
+/****************************************************************************/
+/**
+ * Reader callback, copies a chunk of the encrypted image.
+ *
+ * @param	CallBackRef is the start of the encrypted image.
+ * @param	Offset is the offset of the chunk in the image.
+ * @param	Buffer is the buffer to be filled.
+ * @param	Length is the length of the chunk in bytes.
+ *
+ * @return	XST_SUCCESS
+ *
+ * @note	A flash driver read would take the place of the copy.
+ *
+ *****************************************************************************/
+static u32 SecureStreamReader(void *CallBackRef, u32 Offset, u8 *Buffer,
+				u32 Length)
+{
+	memcpy(Buffer, (u8 *)CallBackRef + Offset, Length);
+
+	return XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * Time source of the stream statistics.
+ *
+ * @param	None
+ *
+ * @return	Current value of the global timer.
+ *
+ * @note	None.
+ *
+ *****************************************************************************/
+static u64 SecureStreamGetTicks(void)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+
+	return (u64)Now;
+}
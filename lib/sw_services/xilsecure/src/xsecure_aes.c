@@ -54,6 +54,13 @@
 *                    inputs will be accepted in little endian format(KEY, IV
 *                    and Data).
 * 2.2   vns 07/06/16 Added doxygen tags
+* 2.3   ag  10/19/26 Split XSecure_AesDecryptUpdate into
+*                    XSecure_AesDecryptUpdateStart,
+*                    XSecure_AesDecryptUpdatePoll and
+*                    XSecure_AesDecryptUpdateComplete.
+*       ag  10/19/26 XSecure_AesDecryptUpdateStart returns a status and
+*                    refuses a NULL buffer or an oversized update even when
+*                    asserts are compiled out.
 *
 * </pre>
 *
@@ -446,6 +453,8 @@ void XSecure_AesDecryptInit(XSecure_Aes *InstancePtr, u8 * DecData,
  * @return	Final call of this API returns the status of GCM tag matching.
  *		- XSECURE_CSU_AES_GCM_TAG_MISMATCH: If GCM tag is mismatched
  *		- XST_SUCCESS: If GCM tag is matching.
+ *		- XST_INVALID_PARAM: If EncData is NULL or Size exceeds the
+ *		remaining data. Nothing is transferred.
  *
  * @note	When Size of the data equals to size of the remaining data
  *		that data will be treated as final data.
@@ -456,8 +465,42 @@ void XSecure_AesDecryptInit(XSecure_Aes *InstancePtr, u8 * DecData,
  ******************************************************************************/
 s32 XSecure_AesDecryptUpdate(XSecure_Aes *InstancePtr, u8 *EncData, u32 Size)
 {
-	u32 GcmStatus;
-	XCsuDma_Configure ConfigurValues = {0};
+	u32 Status;
+
+	Status = XSecure_AesDecryptUpdateStart(InstancePtr, EncData, Size);
+	if (Status != (u32)XST_SUCCESS) {
+		return (s32)Status;
+	}
+
+	return XSecure_AesDecryptUpdateComplete(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts the CSU DMA transfer of the provided encrypted data
+ * to the AES engine and returns without waiting for the transfer to complete.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ * @param	EncData		Pointer to the encrypted data which needs to be
+ *		decrypted.
+ * @param	Size		Expected size of data to be decrypted in bytes.
+ *
+ * @return
+ *		- XST_SUCCESS if the transfer was started
+ *		- XST_INVALID_PARAM if EncData is NULL or Size exceeds the
+ *		remaining data. Nothing is transferred.
+ *
+ * @note	EncData should not be modified until
+ *		XSecure_AesDecryptUpdatePoll() reports completion. Every call
+ *		of this API that returns XST_SUCCESS should be followed by
+ *		XSecure_AesDecryptUpdateComplete(), which returns the GCM tag
+ *		status for the final update.
+ *
+ ******************************************************************************/
+u32 XSecure_AesDecryptUpdateStart(XSecure_Aes *InstancePtr, u8 *EncData,
+		u32 Size)
+{
 	u8 IsFinalUpdate = FALSE;
 
 	/* Assert validates the input arguments */
@@ -465,14 +508,88 @@ s32 XSecure_AesDecryptUpdate(XSecure_Aes *InstancePtr, u8 *EncData, u32 Size)
 	Xil_AssertNonvoid(EncData != NULL);
 	Xil_AssertNonvoid(Size <= InstancePtr->SizeofData);
 
+	/* Asserts may be compiled out, never start an invalid transfer */
+	if ((EncData == NULL) || (Size > InstancePtr->SizeofData)) {
+		return (u32)XST_INVALID_PARAM;
+	}
+
 	/* Check if this is final update */
 	if (InstancePtr->SizeofData == Size) {
 		IsFinalUpdate = TRUE;
 	}
 
+	InstancePtr->UpdateSize = Size;
+
 	XCsuDma_Transfer(InstancePtr->CsuDmaPtr,
 				XCSUDMA_SRC_CHANNEL,
 				(UINTPTR)EncData, Size/4U, IsFinalUpdate);
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks whether the update started by
+ * XSecure_AesDecryptUpdateStart() has been consumed by the AES engine.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the CSU DMA transfer is done
+ *		- XST_DEVICE_BUSY if the CSU DMA transfer is still in progress
+ *
+ * @note	The done status is not acknowledged here, so this API can be
+ *		called from the CSU DMA done interrupt handler as well as in
+ *		a polling loop.
+ *
+ ******************************************************************************/
+s32 XSecure_AesDecryptUpdatePoll(XSecure_Aes *InstancePtr)
+{
+	u32 Status;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = XCsuDma_IntrGetStatus(InstancePtr->CsuDmaPtr,
+					XCSUDMA_SRC_CHANNEL);
+	if ((Status & XCSUDMA_IXR_DONE_MASK) != XCSUDMA_IXR_DONE_MASK) {
+		return XST_DEVICE_BUSY;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the update started by
+ * XSecure_AesDecryptUpdateStart() and acknowledges it. On the final update
+ * the GCM tag is pushed to the AES engine and verified.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance.
+ *
+ * @return	Final call of this API returns the status of GCM tag matching.
+ *		- XSECURE_CSU_AES_GCM_TAG_MISMATCH: If GCM tag is mismatched
+ *		- XST_SUCCESS: If GCM tag is matching.
+ *
+ * @note	The final update blocks until the AES engine is done with the
+ *		GCM tag.
+ *
+ ******************************************************************************/
+s32 XSecure_AesDecryptUpdateComplete(XSecure_Aes *InstancePtr)
+{
+	u32 GcmStatus;
+	XCsuDma_Configure ConfigurValues = {0};
+	u8 IsFinalUpdate = FALSE;
+
+	/* Assert validates the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (InstancePtr->SizeofData == InstancePtr->UpdateSize) {
+		IsFinalUpdate = TRUE;
+	}
+
 	/* Wait for the Src DMA completion. */
 	XCsuDma_WaitForDone(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL);
 	if (InstancePtr->Destination ==
@@ -533,7 +650,9 @@ s32 XSecure_AesDecryptUpdate(XSecure_Aes *InstancePtr, u8 *EncData, u32 Size)
 	}
 
 	/* Update the size of data */
-	InstancePtr->SizeofData = InstancePtr->SizeofData - Size;
+	InstancePtr->SizeofData = InstancePtr->SizeofData -
+					InstancePtr->UpdateSize;
+	InstancePtr->UpdateSize = 0U;
 
 	return XST_SUCCESS;
 
@@ -81,6 +81,10 @@
 *                     XSecure_AesEncryptData, and added XSecure_AesEncryptInit
 *                     and XSecure_AesEncryptUpdate APIs for generic usage.
 * 2.2   vns  07/06/16 Added doxygen tags
+* 2.3   ag   10/19/26 Added non-blocking XSecure_AesDecryptUpdateStart,
+*                     XSecure_AesDecryptUpdatePoll and
+*                     XSecure_AesDecryptUpdateComplete APIs.
+*       ag   10/19/26 XSecure_AesDecryptUpdateStart returns a status.
 *
 * </pre>
 * @endcond
@@ -193,6 +197,7 @@ typedef struct {
 		 */
 	u32 SizeofData; /**< Size of Data to be encrypted or decrypted */
 	u8  *Destination; /**< Destination for decrypted/encrypted data */
+	u32 UpdateSize; /**< Size of the decryption update in progress */
 } XSecure_Aes;
 
 /** @}
@@ -208,6 +213,10 @@ s32  XSecure_AesInitialize(XSecure_Aes *InstancePtr, XCsuDma *CsuDmaPtr,
 void XSecure_AesDecryptInit(XSecure_Aes *InstancePtr, u8 * DecData,
 		u32 Size, u8 * GcmTagAddr);
 s32 XSecure_AesDecryptUpdate(XSecure_Aes *InstancePtr, u8 *EncData, u32 Size);
+u32 XSecure_AesDecryptUpdateStart(XSecure_Aes *InstancePtr, u8 *EncData,
+		u32 Size);
+s32 XSecure_AesDecryptUpdatePoll(XSecure_Aes *InstancePtr);
+s32 XSecure_AesDecryptUpdateComplete(XSecure_Aes *InstancePtr);
 
 s32 XSecure_AesDecryptData(XSecure_Aes *InstancePtr, u8 * DecData, u8 *EncData,
 		u32 Size, u8 * GcmTagAddr);
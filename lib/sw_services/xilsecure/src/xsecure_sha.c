@@ -44,6 +44,8 @@
 * 1.00  ba   08/10/14 Initial release
 * 2.0   vns  01/28/17 Added API to read SHA3 hash.
 * 2.2   vns  07/06/16 Added doxygen tags
+* 2.3   ag   10/19/26 Split XSecure_Sha3Update into XSecure_Sha3UpdateStart,
+*                     XSecure_Sha3UpdatePoll and XSecure_Sha3UpdateComplete.
 *
 * </pre>
 *
@@ -164,6 +166,32 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr)
  ******************************************************************************/
 void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size)
+{
+	XSecure_Sha3UpdateStart(InstancePtr, Data, Size);
+
+	/* Checking the CSU DMA done bit should be enough. */
+	XSecure_Sha3UpdateComplete(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts the CSU DMA transfer of a new input data block to the
+ * SHA-3 engine and returns without waiting for the transfer to complete.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ * @param	Data 		Pointer to the input data for hashing.
+ * @param	Size 		Size of the input data in bytes.
+ *
+ * @return	None
+ *
+ * @note	Data should not be modified until XSecure_Sha3UpdatePoll()
+ *		reports completion. Every call of this API should be followed
+ *		by XSecure_Sha3UpdateComplete() before the next update.
+ *
+ ******************************************************************************/
+void XSecure_Sha3UpdateStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size)
 {
 	/* Asserts validate the input arguments */
 	Xil_AssertVoid(InstancePtr != NULL);
@@ -173,8 +201,60 @@ void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 
 	XCsuDma_Transfer(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
 					(UINTPTR)Data, (u32)Size/4, 0);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function checks whether the update started by
+ * XSecure_Sha3UpdateStart() has been consumed by the SHA-3 engine.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the CSU DMA transfer is done
+ *		- XST_DEVICE_BUSY if the CSU DMA transfer is still in progress
+ *
+ * @note	The done status is not acknowledged here, so this API can be
+ *		called from the CSU DMA done interrupt handler as well as in
+ *		a polling loop.
+ *
+ ******************************************************************************/
+s32 XSecure_Sha3UpdatePoll(XSecure_Sha3 *InstancePtr)
+{
+	u32 Status;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	Status = XCsuDma_IntrGetStatus(InstancePtr->CsuDmaPtr,
+					XCSUDMA_SRC_CHANNEL);
+	if ((Status & XCSUDMA_IXR_DONE_MASK) != XCSUDMA_IXR_DONE_MASK) {
+		return XST_DEVICE_BUSY;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function waits for the update started by XSecure_Sha3UpdateStart()
+ * and acknowledges the CSU DMA done status.
+ *
+ * @param	InstancePtr 	Pointer to the XSecure_Sha3 instance.
+ *
+ * @return	None
+ *
+ * @note	Returns immediately if XSecure_Sha3UpdatePoll() already
+ *		reported completion.
+ *
+ ******************************************************************************/
+void XSecure_Sha3UpdateComplete(XSecure_Sha3 *InstancePtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(InstancePtr != NULL);
 
-	/* Checking the CSU DMA done bit should be enough. */
 	XCsuDma_WaitForDone(InstancePtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL);
 
 	/* Acknowledge the transfer has completed */
@@ -53,6 +53,17 @@
 * A pointer to CsuDma instance has to be passed in initialization as CSU
 * DMA will be used for data transfers to SHA module.
 *
+* <b>Non-blocking update</b>
+*
+* XSecure_Sha3Update() waits for the CSU DMA before returning. Callers which
+* want to fetch the next block of data while the current one is being hashed
+* can split the update into XSecure_Sha3UpdateStart(), which only programs the
+* CSU DMA, XSecure_Sha3UpdatePoll(), which checks the CSU DMA done status and
+* can be called from the CSU DMA done interrupt handler, and
+* XSecure_Sha3UpdateComplete(), which acknowledges the transfer. The buffer
+* passed to XSecure_Sha3UpdateStart() must not be modified until the update
+* is completed.
+*
 *
 * @note
 *
@@ -64,6 +75,9 @@
 * 1.00  ba   11/05/14 Initial release
 * 2.0   vns  01/28/17 Added API to read SHA3 hash.
 * 2.2   vns  07/06/16 Added doxygen tags
+* 2.3   ag   10/19/26 Added non-blocking XSecure_Sha3UpdateStart,
+*                     XSecure_Sha3UpdatePoll and XSecure_Sha3UpdateComplete
+*                     APIs so that data fetch can overlap the CSU DMA.
 *
 * </pre>
 *
@@ -125,6 +139,10 @@ void XSecure_Sha3Start(XSecure_Sha3 *InstancePtr);
 /* Data Transfer */
 void XSecure_Sha3Update(XSecure_Sha3 *InstancePtr, const u8 *Data,
 						const u32 Size);
+void XSecure_Sha3UpdateStart(XSecure_Sha3 *InstancePtr, const u8 *Data,
+						const u32 Size);
+s32 XSecure_Sha3UpdatePoll(XSecure_Sha3 *InstancePtr);
+void XSecure_Sha3UpdateComplete(XSecure_Sha3 *InstancePtr);
 void XSecure_Sha3Finish(XSecure_Sha3 *InstancePtr, u8 *Hash);
 
 /* Complete SHA digest calculation */
@@ -0,0 +1,660 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsecure_stream.c
+*
+* This file contains the implementation of the double buffered streaming
+* helper which hashes and decrypts an image chunk by chunk. Refer to the
+* header file xsecure_stream.h for more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.3   ag   10/19/26 Initial release
+*       ag   10/19/26 End the stream when the AES update cannot be started.
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xsecure_stream.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u64 XSecure_StreamGetTicks(XSecure_Stream *StreamPtr);
+static void XSecure_StreamAddStats(XSecure_Stream *StreamPtr, u32 Stage,
+		u32 Bytes, u64 Start);
+static void XSecure_StreamSetSrcEndian(XSecure_Stream *StreamPtr,
+		u32 EndianType);
+static void XSecure_StreamSelectSha3(XSecure_Stream *StreamPtr);
+static void XSecure_StreamSelectAes(XSecure_Stream *StreamPtr);
+static void XSecure_StreamStartAes(XSecure_Stream *StreamPtr);
+static void XSecure_StreamKick(XSecure_Stream *StreamPtr, u8 *Buffer,
+		u32 Length);
+static void XSecure_StreamService(XSecure_Stream *StreamPtr);
+static u32 XSecure_StreamRead(XSecure_Stream *StreamPtr, u32 Offset,
+		u8 *Buffer, u32 Length);
+
+/************************** Variable Definitions *****************************/
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function initializes the streaming helper instance.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Sha3InstPtr	Pointer to an initialized XSecure_Sha3 instance,
+ *		or NULL if the image should not be hashed.
+ * @param	AesInstPtr	Pointer to an initialized XSecure_Aes instance,
+ *		or NULL if the image should not be decrypted.
+ * @param	Buffer0		First chunk buffer, word aligned.
+ * @param	Buffer1		Second chunk buffer, word aligned.
+ * @param	ChunkSize	Size of each chunk buffer in bytes, should be
+ *		a multiple of 4.
+ *
+ * @return	XST_SUCCESS if initialization was successful.
+ *
+ * @note	Both engines should use the same CSU DMA instance.
+ *
+ ******************************************************************************/
+s32 XSecure_StreamInitialize(XSecure_Stream *StreamPtr,
+		XSecure_Sha3 *Sha3InstPtr, XSecure_Aes *AesInstPtr,
+		u8 *Buffer0, u8 *Buffer1, u32 ChunkSize)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid((Sha3InstPtr != NULL) || (AesInstPtr != NULL));
+	Xil_AssertNonvoid(Buffer0 != NULL);
+	Xil_AssertNonvoid(Buffer1 != NULL);
+	Xil_AssertNonvoid(ChunkSize != 0U);
+	Xil_AssertNonvoid((ChunkSize % 4U) == 0U);
+
+	memset(StreamPtr, 0, sizeof(XSecure_Stream));
+
+	StreamPtr->Sha3InstPtr = Sha3InstPtr;
+	StreamPtr->AesInstPtr = AesInstPtr;
+	if (Sha3InstPtr != NULL) {
+		StreamPtr->CsuDmaPtr = Sha3InstPtr->CsuDmaPtr;
+	}
+	else {
+		StreamPtr->CsuDmaPtr = AesInstPtr->CsuDmaPtr;
+	}
+	StreamPtr->Buffer[0] = Buffer0;
+	StreamPtr->Buffer[1] = Buffer1;
+	StreamPtr->ChunkSize = ChunkSize;
+	StreamPtr->State = XSECURE_STREAM_IDLE;
+	StreamPtr->AesStatus = XST_SUCCESS;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function registers the reader callback which fetches the image.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Reader		Reader callback.
+ * @param	CallBackRef	Argument passed to the reader callback.
+ *
+ * @return	None
+ *
+ * @note	The reader is called while the CSU DMA works on the other
+ *		buffer, so it should not use the CSU DMA itself.
+ *
+ ******************************************************************************/
+void XSecure_StreamSetReader(XSecure_Stream *StreamPtr,
+		XSecure_StreamReader Reader, void *CallBackRef)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid(Reader != NULL);
+
+	StreamPtr->Reader = Reader;
+	StreamPtr->ReaderRef = CallBackRef;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function registers the time source used for the per stage
+ * statistics.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	GetTicks	Function returning a free running counter,
+ *		NULL to disable the statistics.
+ * @param	TicksPerSec	Frequency of the counter.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_StreamSetTimer(XSecure_Stream *StreamPtr,
+		u64 (*GetTicks)(void), u64 TicksPerSec)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(StreamPtr != NULL);
+	Xil_AssertVoid((GetTicks == NULL) || (TicksPerSec != 0U));
+
+	StreamPtr->GetTicks = GetTicks;
+	StreamPtr->TicksPerSec = TicksPerSec;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function selects whether the CSU DMA source done interrupt is used
+ * to advance the stream.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Enable		TRUE to use the interrupt, FALSE to poll.
+ *
+ * @return	None
+ *
+ * @note	In interrupt mode XSecure_StreamIntrHandler() should be
+ *		connected to the CSU DMA interrupt, with StreamPtr as the
+ *		callback reference. The interrupt is only enabled while
+ *		XSecure_StreamDecrypt() is running.
+ *
+ ******************************************************************************/
+void XSecure_StreamSetIntrMode(XSecure_Stream *StreamPtr, u8 Enable)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	StreamPtr->IsIntrMode = (Enable != FALSE) ? TRUE : FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function streams an image from the reader callback through the SHA-3
+ * and AES-GCM engines, using the two chunk buffers alternately so that the
+ * next chunk is read while the current one is hashed and decrypted.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Dst		Destination of the decrypted data, or
+ *		XSECURE_DESTINATION_PCAP_ADDR. Ignored without AES instance.
+ * @param	Size		Size of the encrypted image in bytes, excluding
+ *		the GCM tag. Should be a multiple of 4.
+ * @param	GcmTagAddr	Pointer to the GCM tag of the image. Ignored
+ *		without AES instance.
+ * @param	Hash		Pointer to a 48 byte buffer for the SHA-3 hash of
+ *		the encrypted image. Ignored without SHA-3 instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the image was hashed and the GCM tag matched
+ *		- XSECURE_CSU_AES_GCM_TAG_MISMATCH if the GCM tag mismatched
+ *		- XST_FAILURE if the reader callback failed
+ *
+ * @note	The AES instance is initialized for decryption by this API
+ *		using the key and IV set at XSecure_AesInitialize().
+ *
+ ******************************************************************************/
+s32 XSecure_StreamDecrypt(XSecure_Stream *StreamPtr, u8 *Dst, u32 Size,
+		u8 *GcmTagAddr, u8 *Hash)
+{
+	s32 Status = XST_SUCCESS;
+	u32 Offset = 0U;
+	u32 Length;
+	u32 NextLength;
+	u32 Index = 0U;
+	u64 Start;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(StreamPtr->Reader != NULL);
+	Xil_AssertNonvoid(Size != 0U);
+	Xil_AssertNonvoid((Size % 4U) == 0U);
+	Xil_AssertNonvoid((StreamPtr->Sha3InstPtr == NULL) || (Hash != NULL));
+	Xil_AssertNonvoid((StreamPtr->AesInstPtr == NULL) ||
+			((Dst != NULL) && (GcmTagAddr != NULL)));
+
+	Start = XSecure_StreamGetTicks(StreamPtr);
+	StreamPtr->State = XSECURE_STREAM_IDLE;
+	StreamPtr->AesStatus = XST_SUCCESS;
+
+	if (StreamPtr->Sha3InstPtr != NULL) {
+		XSecure_Sha3Start(StreamPtr->Sha3InstPtr);
+	}
+	if (StreamPtr->AesInstPtr != NULL) {
+		XSecure_AesDecryptInit(StreamPtr->AesInstPtr, Dst, Size,
+					GcmTagAddr);
+	}
+
+	if (StreamPtr->IsIntrMode == TRUE) {
+		XCsuDma_EnableIntr(StreamPtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					XCSUDMA_IXR_DONE_MASK);
+	}
+
+	/* Prime the first buffer */
+	Length = (Size < StreamPtr->ChunkSize) ? Size : StreamPtr->ChunkSize;
+	Status = (s32)XSecure_StreamRead(StreamPtr, 0U,
+				StreamPtr->Buffer[0], Length);
+
+	while ((Status == XST_SUCCESS) && (Offset < Size)) {
+		XSecure_StreamKick(StreamPtr, StreamPtr->Buffer[Index], Length);
+
+		/* Read the next chunk while the current one is processed */
+		NextLength = Size - (Offset + Length);
+		if (NextLength > StreamPtr->ChunkSize) {
+			NextLength = StreamPtr->ChunkSize;
+		}
+		if (NextLength != 0U) {
+			Status = (s32)XSecure_StreamRead(StreamPtr,
+					Offset + Length,
+					StreamPtr->Buffer[Index ^ 1U],
+					NextLength);
+		}
+
+		while (StreamPtr->State != XSECURE_STREAM_IDLE) {
+			if (StreamPtr->IsIntrMode != TRUE) {
+				XSecure_StreamService(StreamPtr);
+			}
+		}
+
+		if (StreamPtr->AesStatus != XST_SUCCESS) {
+			Status = StreamPtr->AesStatus;
+		}
+
+		Offset += Length;
+		Length = NextLength;
+		Index ^= 1U;
+	}
+
+	if (StreamPtr->IsIntrMode == TRUE) {
+		XCsuDma_DisableIntr(StreamPtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+					XCSUDMA_IXR_DONE_MASK);
+	}
+
+	/* Leave the source channel without byte swapping, as AES does */
+	if (StreamPtr->AesInstPtr != NULL) {
+		XSecure_StreamSetSrcEndian(StreamPtr, 0U);
+	}
+
+	if ((Status == XST_SUCCESS) && (StreamPtr->Sha3InstPtr != NULL)) {
+		u64 FinishStart = XSecure_StreamGetTicks(StreamPtr);
+
+		XSecure_StreamSelectSha3(StreamPtr);
+		XSecure_Sha3Finish(StreamPtr->Sha3InstPtr, Hash);
+		XSecure_StreamAddStats(StreamPtr, XSECURE_STREAM_STAGE_SHA3,
+					0U, FinishStart);
+	}
+
+	if (Status == XST_SUCCESS) {
+		XSecure_StreamAddStats(StreamPtr, XSECURE_STREAM_STAGE_TOTAL,
+					Size, Start);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function is the CSU DMA done interrupt handler of the stream. It
+ * moves the chunk in flight from the SHA-3 engine to the AES engine and
+ * marks it complete when the AES engine has consumed it.
+ *
+ * @param	CallBackRef	Pointer to the XSecure_Stream instance.
+ *
+ * @return	None
+ *
+ * @note	On the final chunk the GCM tag is verified from this handler.
+ *
+ ******************************************************************************/
+void XSecure_StreamIntrHandler(void *CallBackRef)
+{
+	XSecure_Stream *StreamPtr = (XSecure_Stream *)CallBackRef;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XSecure_StreamService(StreamPtr);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function clears the per stage statistics.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XSecure_StreamResetStats(XSecure_Stream *StreamPtr)
+{
+	/* Asserts validate the input arguments */
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	memset(StreamPtr->Stats, 0, sizeof(StreamPtr->Stats));
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function returns the throughput of a stage, accumulated over all
+ * XSecure_StreamDecrypt() calls since the last reset.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Stage		One of the XSECURE_STREAM_STAGE_* values.
+ *
+ * @return	Throughput in MB/s, or 0 if no time was recorded.
+ *
+ * @note	The SHA-3 and AES stages are measured from the start of the
+ *		CSU DMA transfer until its completion is seen, so in polled
+ *		mode they include the part of the reader time that overlaps
+ *		them.
+ *
+ ******************************************************************************/
+u32 XSecure_StreamGetMBps(XSecure_Stream *StreamPtr, u32 Stage)
+{
+	XSecure_StreamStats *StatsPtr;
+
+	/* Asserts validate the input arguments */
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(Stage < XSECURE_STREAM_STAGE_MAX);
+
+	StatsPtr = &StreamPtr->Stats[Stage];
+	if (StatsPtr->Ticks == 0U) {
+		return 0U;
+	}
+
+	return (u32)(((StatsPtr->Bytes * StreamPtr->TicksPerSec) /
+			StatsPtr->Ticks) / 1000000U);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function returns the current time of the registered time source.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ *
+ * @return	Counter value, 0 if no time source is registered.
+ *
+ ******************************************************************************/
+static u64 XSecure_StreamGetTicks(XSecure_Stream *StreamPtr)
+{
+	if (StreamPtr->GetTicks == NULL) {
+		return 0U;
+	}
+
+	return StreamPtr->GetTicks();
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function accounts bytes and the time elapsed since Start to a stage.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Stage		One of the XSECURE_STREAM_STAGE_* values.
+ * @param	Bytes		Bytes processed by the stage.
+ * @param	Start		Counter value at the start of the stage.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_StreamAddStats(XSecure_Stream *StreamPtr, u32 Stage,
+		u32 Bytes, u64 Start)
+{
+	if (StreamPtr->GetTicks == NULL) {
+		return;
+	}
+
+	StreamPtr->Stats[Stage].Bytes += Bytes;
+	StreamPtr->Stats[Stage].Ticks += StreamPtr->GetTicks() - Start;
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function enables or disables byte swapping on the CSU DMA source
+ * channel.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	EndianType	1 to swap bytes, as AES expects, 0 otherwise.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_StreamSetSrcEndian(XSecure_Stream *StreamPtr,
+		u32 EndianType)
+{
+	XCsuDma_Configure ConfigurValues = {0};
+
+	XCsuDma_GetConfig(StreamPtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+				&ConfigurValues);
+	ConfigurValues.EndianType = EndianType;
+	XCsuDma_SetConfig(StreamPtr->CsuDmaPtr, XCSUDMA_SRC_CHANNEL,
+				&ConfigurValues);
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function routes the CSU DMA source channel to the SHA-3 engine.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_StreamSelectSha3(XSecure_Stream *StreamPtr)
+{
+	XSecure_SssSetup(XSecure_SssInputSha3(XSECURE_CSU_SSS_SRC_SRC_DMA));
+
+	if (StreamPtr->AesInstPtr != NULL) {
+		XSecure_StreamSetSrcEndian(StreamPtr, 0U);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function routes the CSU DMA source channel to the AES engine and the
+ * AES output to PCAP or to the CSU DMA destination channel, as configured
+ * by XSecure_AesDecryptInit().
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_StreamSelectAes(XSecure_Stream *StreamPtr)
+{
+	u32 SssCfg = XSecure_SssInputAes(XSECURE_CSU_SSS_SRC_SRC_DMA);
+
+	if (StreamPtr->AesInstPtr->Destination ==
+			(u8 *)XSECURE_DESTINATION_PCAP_ADDR) {
+		SssCfg |= XSecure_SssInputPcap(XSECURE_CSU_SSS_SRC_AES);
+	}
+	else {
+		SssCfg |= XSecure_SssInputDstDma(XSECURE_CSU_SSS_SRC_AES);
+	}
+	XSecure_SssSetup(SssCfg);
+
+	if (StreamPtr->Sha3InstPtr != NULL) {
+		XSecure_StreamSetSrcEndian(StreamPtr, 1U);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts processing of a chunk, with the SHA-3 engine if
+ * present and with the AES engine otherwise.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Buffer		Chunk to be processed.
+ * @param	Length		Length of the chunk in bytes.
+ *
+ * @return	None
+ *
+ * @note	The state is updated before the transfer is started, so that
+ *		the interrupt handler always sees a consistent state.
+ *
+ ******************************************************************************/
+static void XSecure_StreamKick(XSecure_Stream *StreamPtr, u8 *Buffer,
+		u32 Length)
+{
+	StreamPtr->ActiveBuf = Buffer;
+	StreamPtr->ActiveLen = Length;
+	StreamPtr->StageStart = XSecure_StreamGetTicks(StreamPtr);
+
+	if (StreamPtr->Sha3InstPtr != NULL) {
+		StreamPtr->State = XSECURE_STREAM_SHA3_BUSY;
+		XSecure_StreamSelectSha3(StreamPtr);
+		XSecure_Sha3UpdateStart(StreamPtr->Sha3InstPtr, Buffer, Length);
+	}
+	else {
+		XSecure_StreamStartAes(StreamPtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function starts the AES stage of the chunk in flight. If the AES
+ * update is refused, the error is recorded in AesStatus and the stream goes
+ * idle, so XSecure_StreamDecrypt() returns it.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_StreamStartAes(XSecure_Stream *StreamPtr)
+{
+	u32 Status;
+
+	StreamPtr->State = XSECURE_STREAM_AES_BUSY;
+	XSecure_StreamSelectAes(StreamPtr);
+	Status = XSecure_AesDecryptUpdateStart(StreamPtr->AesInstPtr,
+			StreamPtr->ActiveBuf, StreamPtr->ActiveLen);
+	if (Status != (u32)XST_SUCCESS) {
+		StreamPtr->AesStatus = (s32)Status;
+		StreamPtr->State = XSECURE_STREAM_IDLE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function advances the chunk in flight if the CSU DMA transfer of the
+ * current stage is done. It is called from the interrupt handler or from
+ * the polling loop of XSecure_StreamDecrypt().
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XSecure_StreamService(XSecure_Stream *StreamPtr)
+{
+	if (StreamPtr->State == XSECURE_STREAM_SHA3_BUSY) {
+		if (XSecure_Sha3UpdatePoll(StreamPtr->Sha3InstPtr) !=
+				XST_SUCCESS) {
+			return;
+		}
+		XSecure_Sha3UpdateComplete(StreamPtr->Sha3InstPtr);
+		XSecure_StreamAddStats(StreamPtr, XSECURE_STREAM_STAGE_SHA3,
+				StreamPtr->ActiveLen, StreamPtr->StageStart);
+
+		if (StreamPtr->AesInstPtr == NULL) {
+			StreamPtr->State = XSECURE_STREAM_IDLE;
+			return;
+		}
+
+		/* Hand the same chunk over to the AES engine */
+		StreamPtr->StageStart = XSecure_StreamGetTicks(StreamPtr);
+		XSecure_StreamStartAes(StreamPtr);
+	}
+
+	if (StreamPtr->State == XSECURE_STREAM_AES_BUSY) {
+		if (XSecure_AesDecryptUpdatePoll(StreamPtr->AesInstPtr) !=
+				XST_SUCCESS) {
+			return;
+		}
+		StreamPtr->AesStatus =
+			XSecure_AesDecryptUpdateComplete(StreamPtr->AesInstPtr);
+		XSecure_StreamAddStats(StreamPtr, XSECURE_STREAM_STAGE_AES,
+				StreamPtr->ActiveLen, StreamPtr->StageStart);
+		StreamPtr->State = XSECURE_STREAM_IDLE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief
+ * This function calls the reader callback and accounts its time.
+ *
+ * @param	StreamPtr	Pointer to the XSecure_Stream instance.
+ * @param	Offset		Offset of the chunk in the image.
+ * @param	Buffer		Buffer to be filled.
+ * @param	Length		Length of the chunk in bytes.
+ *
+ * @return	XST_SUCCESS if the reader succeeded, XST_FAILURE otherwise.
+ *
+ ******************************************************************************/
+static u32 XSecure_StreamRead(XSecure_Stream *StreamPtr, u32 Offset,
+		u8 *Buffer, u32 Length)
+{
+	u64 Start = XSecure_StreamGetTicks(StreamPtr);
+	u32 Status;
+
+	Status = StreamPtr->Reader(StreamPtr->ReaderRef, Offset, Buffer,
+					Length);
+	XSecure_StreamAddStats(StreamPtr, XSECURE_STREAM_STAGE_READ, Length,
+					Start);
+
+	if (Status != (u32)XST_SUCCESS) {
+		return (u32)XST_FAILURE;
+	}
+
+	return (u32)XST_SUCCESS;
+}
@@ -0,0 +1,180 @@
+/******************************************************************************
+*
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* Use of the Software is limited solely to applications:
+* (a) running on a Xilinx device, or
+* (b) that interact with a Xilinx device through a bus or interconnect.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+* XILINX  BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+* OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Except as contained in this notice, the name of the Xilinx shall not be used
+* in advertising or otherwise to promote the sale, use or other dealings in
+* this Software without prior written authorization from Xilinx.
+*******************************************************************************/
+/*****************************************************************************/
+/**
+*
+* @file xsecure_stream.h
+* @addtogroup xsecure_stream_apis XilSecure Streaming APIs
+* @{
+* @cond xsecure_internal
+* This file contains the prototypes and type definitions of the double
+* buffered streaming helper, which passes a large image from a reader
+* callback through the SHA-3 and AES-GCM engines.
+*
+* The SHA-3 and AES engines share the single CSU DMA source channel, so
+* each chunk is first hashed and then decrypted, with the secure stream
+* switch reconfigured in between. While the CSU DMA works on one buffer,
+* the reader callback fills the other buffer with the next chunk.
+*
+* <b>Initialization & Configuration</b>
+*
+*   - XSecure_StreamInitialize(XSecure_Stream *StreamPtr,
+*		XSecure_Sha3 *Sha3InstPtr, XSecure_Aes *AesInstPtr,
+*		u8 *Buffer0, u8 *Buffer1, u32 ChunkSize)
+*   - XSecure_StreamSetReader(XSecure_Stream *StreamPtr,
+*		XSecure_StreamReader Reader, void *CallBackRef)
+*
+* Either engine instance can be NULL to only hash or only decrypt. The SHA-3
+* and AES instances should be initialized before. Per stage throughput is
+* accumulated when a time source is registered with XSecure_StreamSetTimer().
+*
+* <b>Interrupt mode</b>
+*
+* By default the CSU DMA done status is polled. After
+* XSecure_StreamSetIntrMode() the CSU DMA source done interrupt is enabled
+* while XSecure_StreamDecrypt() runs, and XSecure_StreamIntrHandler() must be
+* connected to the CSU DMA interrupt by the application. The handler moves
+* a chunk from the SHA-3 engine to the AES engine without waiting for the
+* processor.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.3   ag   10/19/26 Initial release
+*
+* </pre>
+*
+* @endcond
+*
+******************************************************************************/
+#ifndef XSECURE_STREAM_H
+#define XSECURE_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xsecure_sha.h"
+#include "xsecure_aes.h"
+
+/************************** Constant Definitions ****************************/
+/** @cond xsecure_internal
+@{
+*/
+
+/**
+ * Stream stages, used with XSecure_StreamGetMBps()
+ */
+#define XSECURE_STREAM_STAGE_READ	(0U) /**< Reader callback */
+#define XSECURE_STREAM_STAGE_SHA3	(1U) /**< SHA-3 engine */
+#define XSECURE_STREAM_STAGE_AES	(2U) /**< AES-GCM engine */
+#define XSECURE_STREAM_STAGE_TOTAL	(3U) /**< Whole image */
+#define XSECURE_STREAM_STAGE_MAX	(4U) /**< Number of stages */
+
+/**
+ * Stream states
+ */
+#define XSECURE_STREAM_IDLE		(0U) /**< No chunk in flight */
+#define XSECURE_STREAM_SHA3_BUSY	(1U) /**< Chunk is being hashed */
+#define XSECURE_STREAM_AES_BUSY		(2U) /**< Chunk is being decrypted */
+
+/***************************** Type Definitions******************************/
+
+/**
+ * Reader callback. Copies Length bytes at Offset of the image into Buffer
+ * and returns XST_SUCCESS, or any other value on failure.
+ */
+typedef u32 (*XSecure_StreamReader)(void *CallBackRef, u32 Offset,
+					u8 *Buffer, u32 Length);
+
+/**
+ * Bytes processed and time spent by one stage
+ */
+typedef struct {
+	u64 Bytes; /**< Bytes passed through the stage */
+	u64 Ticks; /**< Time spent in the stage, in timer ticks */
+} XSecure_StreamStats;
+
+/**
+ * The streaming helper instance data structure.
+ */
+typedef struct {
+	XSecure_Sha3 *Sha3InstPtr; /**< SHA-3 instance, NULL to skip hashing */
+	XSecure_Aes *AesInstPtr; /**< AES instance, NULL to skip decryption */
+	XCsuDma *CsuDmaPtr; /**< CSU DMA shared by both engines */
+	u8 *Buffer[2]; /**< Chunk buffers used alternately */
+	u32 ChunkSize; /**< Size of one chunk in bytes */
+	XSecure_StreamReader Reader; /**< Reader callback */
+	void *ReaderRef; /**< Argument passed to the reader callback */
+	u64 (*GetTicks)(void); /**< Time source, NULL to skip statistics */
+	u64 TicksPerSec; /**< Frequency of the time source */
+	u8 IsIntrMode; /**< CSU DMA done interrupt used or not */
+	volatile u32 State; /**< Current state of the chunk in flight */
+	volatile s32 AesStatus; /**< Status of the last AES update */
+	u8 *ActiveBuf; /**< Chunk in flight */
+	u32 ActiveLen; /**< Length of the chunk in flight */
+	u64 StageStart; /**< Start time of the DMA stage in flight */
+	XSecure_StreamStats Stats[XSECURE_STREAM_STAGE_MAX];
+			/**< Per stage statistics */
+} XSecure_Stream;
+/**
+@}
+@endcond */
+
+/***************************** Function Prototypes ***************************/
+/* Initialization */
+s32 XSecure_StreamInitialize(XSecure_Stream *StreamPtr,
+		XSecure_Sha3 *Sha3InstPtr, XSecure_Aes *AesInstPtr,
+		u8 *Buffer0, u8 *Buffer1, u32 ChunkSize);
+void XSecure_StreamSetReader(XSecure_Stream *StreamPtr,
+		XSecure_StreamReader Reader, void *CallBackRef);
+void XSecure_StreamSetTimer(XSecure_Stream *StreamPtr,
+		u64 (*GetTicks)(void), u64 TicksPerSec);
+void XSecure_StreamSetIntrMode(XSecure_Stream *StreamPtr, u8 Enable);
+
+/* Streaming */
+s32 XSecure_StreamDecrypt(XSecure_Stream *StreamPtr, u8 *Dst, u32 Size,
+		u8 *GcmTagAddr, u8 *Hash);
+void XSecure_StreamIntrHandler(void *CallBackRef);
+
+/* Statistics */
+void XSecure_StreamResetStats(XSecure_Stream *StreamPtr);
+u32 XSecure_StreamGetMBps(XSecure_Stream *StreamPtr, u32 Stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XSECURE_STREAM_H */
+/**@}*/
@@ -64,6 +64,9 @@
 *                        checks.
 * 6.2   vns     03/10/17 Added error codes for LBist, LPD/FPD SC enable bits
 *                        programming.
+*
+* 6.3   ag      10/19/26 Added XilSKey_JtagOp, XilSKey_JtagTiming and the
+*                        JTAG timing report APIs.
 *
  *****************************************************************************/
 
@@ -739,6 +742,29 @@ typedef enum {
 #define XilSKey_WriteReg(BaseAddress, RegOffset, Data) \
 		Xil_Out32(((BaseAddress) + (u32)(RegOffset)), (u32)(Data))
 
+/**
+ * Operations accounted by the JTAG timing report
+ */
+typedef enum {
+	XSK_JTAG_OP_NAVIGATE,		/**< TAP state changes */
+	XSK_JTAG_OP_IR_SHIFT,		/**< Instruction register scans */
+	XSK_JTAG_OP_DR_SHIFT,		/**< Data register scans */
+	XSK_JTAG_OP_EFUSE_WRITE,	/**< eFUSE bit programming */
+	XSK_JTAG_OP_EFUSE_READ,		/**< eFUSE row reads */
+	XSK_JTAG_OP_BBRAM_PROGRAM,	/**< BBRAM key programming */
+	XSK_JTAG_OP_BBRAM_VERIFY,	/**< BBRAM key verification */
+	XSK_JTAG_OP_MAX
+} XilSKey_JtagOp;
+
+/**
+ * Timing of a JTAG operation
+ */
+typedef struct {
+	u32 Count;		/**< Number of operations */
+	u64 TckCycles;		/**< TCK cycles clocked by the shift engine */
+	u64 Ticks;		/**< Timer ticks spent */
+} XilSKey_JtagTiming;
+
 /************************** Function Prototypes *****************************/
 u32 XilSKey_EfusePs_XAdcInit (void );
 void XilSKey_EfusePs_XAdcReadTemperatureAndVoltage(XSKEfusePs_XAdc *XAdcInstancePtr);
@@ -764,6 +790,9 @@ void XilSKey_StrCpyRange(u8 *Src, u8 *Dst, u32 From, u32 To);
 u32 XilSKey_CrcCalculation(u8 *Key);
 u32 XilSkey_CrcCalculation_AesKey(u8 *Key);
 u32 XilSKey_Ceil(float Freq);
+void XilSKey_JtagTimingReset(void);
+const XilSKey_JtagTiming *XilSKey_JtagGetTiming(XilSKey_JtagOp Op);
+void XilSKey_JtagTimingReport(void);
 /***************************************************************************/
 
 #ifdef __cplusplus
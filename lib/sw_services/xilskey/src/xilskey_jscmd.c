@@ -76,6 +76,12 @@
 *                        for returning FAILURE on timeout.
 *       vns     07/28/16 Modified Bbram_ProgramKey_Ultra API to program control
 *                        word based on user inputs.
+* 6.3   ag      10/19/26 Added a JTAG shift engine which drives TDI, TMS and
+*                        TCK with precomputed GPIO register writes and shifts
+*                        a whole scan in one pass, navigateTAP and
+*                        jtagShiftTDIBits use it. Added per operation timing
+*                        XilSKey_JtagTimingReset, XilSKey_JtagGetTiming and
+*                        XilSKey_JtagTimingReport.
 * </pre>
 *
 *
@@ -202,6 +208,45 @@ static XGpio structXGpio;
 int setPin (int pin, int value);
 int readPin (int pin);
 
+/**
+ * Precomputed GPIO register accesses of a JTAG output pin
+ */
+typedef struct {
+	UINTPTR Addr;		/**< Register driving the pin */
+	u32 Value[2];		/**< Values driving the pin low and high */
+} XilSKey_JtagPin;
+
+/**
+ * JTAG shift engine. When TDI, TMS and TCK are driven by the same
+ * register, every TCK cycle takes two register writes, the first one
+ * sets up TDI and TMS with TCK low and the second one raises TCK.
+ */
+typedef struct {
+	u8 Packed;		/**< TDI, TMS and TCK are in OutAddr */
+	UINTPTR OutAddr;	/**< Register driving TDI, TMS and TCK */
+	u32 Out[4];		/**< Values driving TCK low, indexed by
+				  *  (TMS << 1) | TDI */
+	u32 TckHigh;		/**< Bits set in Out[] to raise TCK */
+	XilSKey_JtagPin Tdi;	/**< TDI when the pins are not packed */
+	XilSKey_JtagPin Tms;	/**< TMS when the pins are not packed */
+	XilSKey_JtagPin Tck;	/**< TCK when the pins are not packed */
+	UINTPTR TdoAddr;	/**< Register sampling TDO */
+	u32 TdoMask;		/**< TDO bit of TdoAddr */
+	u8 TdiLevel;		/**< Current level of TDI */
+	u8 TmsLevel;		/**< Current level of TMS */
+	u64 TckCycles;		/**< TCK cycles clocked so far */
+} XilSKey_JtagEngine;
+
+static XilSKey_JtagEngine JtagEngine;
+static XilSKey_JtagTiming JtagTiming[XSK_JTAG_OP_MAX];
+
+static void JtagEngineInit(void);
+static void JtagEngineTms(u32 TmsBits, u32 Count);
+static void JtagEngineShift(const u8 *TdiBuf, u8 TdiFill, u8 *TdoBuf,
+				u32 BitCount, u8 ExitShift);
+static inline void JtagOpBegin(u64 *Mark);
+static inline void JtagOpEnd(XilSKey_JtagOp Op, const u64 *Mark);
+
 u32 Bbram_ReadKey[8];
 
 void GpioConfig(unsigned long addr, unsigned long mask, unsigned long val)
@@ -291,6 +336,7 @@ void JtagInitGpio (XilSKey_ModuleSelection Module)
 
 
 #endif
+	JtagEngineInit();
 } /* initGpio() */
 
 int getByteCountFromBitCount (int bitCount)
@@ -585,49 +631,20 @@ void navigateTAP (unsigned char startState, unsigned char endState)
     unsigned char tmsValue = (tableValue >> 8) & 0x00FF;
     unsigned char bitCount = tableValue & 0x00FF;
 
-    unsigned char mask = 0x01;
-
     js_printf ("navigate - start=%d, end=%d\n", startState, endState);
     js_printf ("tmsvalue = 0x%02X, bitCount = %d\n", tmsValue, bitCount);
 
     if (endState == JS_RESET)
     {
-	// initialize state to JS_RESET
-	setPin (MIO_TMS, 1);
-
-	setPin (MIO_TCK, 1);
-	setPin (MIO_TCK, 0);
-	setPin (MIO_TCK, 1);
-	setPin (MIO_TCK, 0);
-	setPin (MIO_TCK, 1);
-	setPin (MIO_TCK, 0);
-	setPin (MIO_TCK, 1);
-	setPin (MIO_TCK, 0);
-	setPin (MIO_TCK, 1);
-	setPin (MIO_TCK, 0);
+	// initialize state to JS_RESET, 5 TCK with TMS high
+	JtagEngineTms (0x1F, 5);
 
 	return;
     }
 
     if (startState != endState)
     {
-	while (bitCount)
-	{
-		if (tmsValue & mask)
-		{
-			setPin (MIO_TMS, 1);
-		}
-		else
-		{
-			setPin (MIO_TMS, 0);
-		}
-		// pulse tck pin
-		setPin (MIO_TCK, 1);
-		setPin (MIO_TCK, 0);
-
-		mask <<= 1;
-		bitCount--;
-	}
+	JtagEngineTms (tmsValue, bitCount);
     }
     else
     {
@@ -647,6 +664,13 @@ int setPin (int pin, int value)
 	GpoOutValue = (GpoOutValue & (~Mask)) | (GpoOut & Mask);
 	XGpio_DiscreteWrite(&structXGpio, GpioOutPutCh, GpoOutValue);
 #endif
+	/* Keep the shift engine in line with the pin levels */
+	if (pin == (int)MIO_TDI) {
+		JtagEngine.TdiLevel = (value) ? 1U : 0U;
+	}
+	else if (pin == (int)MIO_TMS) {
+		JtagEngine.TmsLevel = (value) ? 1U : 0U;
+	}
 
 	return (status);
 }
@@ -664,109 +688,410 @@ int readPin (int pin)
 	return (retVal);
 }
 
-void jtagShiftTDI (unsigned char tdiData, unsigned char* tdoData, int clkCount, int exitState)
+/****************************************************************************/
+/**
+*
+* This function precomputes the GPIO register accesses of the JTAG shift
+* engine for the configured TDI, TDO, TMS and TCK pins.
+*
+* @return	None.
+*
+* @note		On the PS GPIO the pins are packed when they are in the
+*		same half of the same bank, otherwise every pin is written
+*		through its own mask data register.
+*		On the AXI GPIO the output channel always drives all the
+*		pins, the values are rebuilt from GpoOutValue by
+*		JtagEngineSync() before every operation.
+*
+*****************************************************************************/
+static void JtagEngineInit(void)
 {
-   int count = clkCount;
-   unsigned char mask = 0x01;
+#ifdef XSK_ARM_PLATFORM
+	u32 Pins[3] = {MIO_TDI, MIO_TMS, MIO_TCK};
+	XilSKey_JtagPin *JtagPins[3] = {&JtagEngine.Tdi, &JtagEngine.Tms,
+					&JtagEngine.Tck};
+	u32 Bits[3];
+	u32 Mask;
+	u32 Index;
+	u8 Bank;
+	u8 PinNumber;
+	u32 BaseAddr = structXGpioPs.GpioConfig.BaseAddr;
+
+	for (Index = 0; Index < 3; Index++) {
+		XGpioPs_GetBankPin((u8)Pins[Index], &Bank, &PinNumber);
+		JtagPins[Index]->Addr = BaseAddr +
+				((u32)Bank * XGPIOPS_DATA_MASK_OFFSET);
+		if (PinNumber > 15U) {
+			PinNumber -= 16U;
+			JtagPins[Index]->Addr += XGPIOPS_DATA_MSW_OFFSET;
+		}
+		else {
+			JtagPins[Index]->Addr += XGPIOPS_DATA_LSW_OFFSET;
+		}
+		Bits[Index] = (u32)1 << PinNumber;
+		/* Upper 16 bits mask the pins which are not written */
+		JtagPins[Index]->Value[0] = ~(Bits[Index] << 16U) & 0xFFFF0000U;
+		JtagPins[Index]->Value[1] = JtagPins[Index]->Value[0] |
+							Bits[Index];
+	}
+
+	JtagEngine.Packed = ((JtagEngine.Tdi.Addr == JtagEngine.Tck.Addr) &&
+			(JtagEngine.Tms.Addr == JtagEngine.Tck.Addr)) ? 1U : 0U;
+	if (JtagEngine.Packed == 1U) {
+		Mask = Bits[0] | Bits[1] | Bits[2];
+		JtagEngine.OutAddr = JtagEngine.Tck.Addr;
+		JtagEngine.Out[0] = ~(Mask << 16U) & 0xFFFF0000U;
+		JtagEngine.Out[1] = JtagEngine.Out[0] | Bits[0];
+		JtagEngine.Out[2] = JtagEngine.Out[0] | Bits[1];
+		JtagEngine.Out[3] = JtagEngine.Out[0] | Bits[0] | Bits[1];
+		JtagEngine.TckHigh = Bits[2];
+	}
+
+	XGpioPs_GetBankPin((u8)MIO_TDO, &Bank, &PinNumber);
+	JtagEngine.TdoAddr = BaseAddr + XGPIOPS_DATA_RO_OFFSET +
+				((u32)Bank * XGPIOPS_DATA_BANK_OFFSET);
+	JtagEngine.TdoMask = (u32)1 << PinNumber;
+#else
+	JtagEngine.Packed = 1U;
+	JtagEngine.OutAddr = structXGpio.BaseAddress + XGPIO_DATA_OFFSET +
+				((GpioOutPutCh - 1U) * XGPIO_CHAN_OFFSET);
+	JtagEngine.TckHigh = (u32)1 << GPIO_TCK;
+	JtagEngine.TdoAddr = structXGpio.BaseAddress + XGPIO_DATA_OFFSET +
+				((GpioInPutCh - 1U) * XGPIO_CHAN_OFFSET);
+	JtagEngine.TdoMask = (u32)1 << GPIO_TDO;
+#endif
+	JtagEngine.TdiLevel = 0U;
+	JtagEngine.TmsLevel = 0U;
+}
 
-   while (count)
-   {
-	   if (tdoData) // read tdo bit
-	   {
-		   if (readPin (MIO_TDO))
-		   {
-			   *(unsigned char*)tdoData |= mask;
-		   }
-		   else
-		   {
-			   *(unsigned char*)tdoData &= ~mask;
-		   }
-	   }
-	   if (tdiData & mask)
-	   {
-		   setPin (MIO_TDI, 1);
-	   }
-	   else
-       {
-		   setPin (MIO_TDI, 0);
-       }
-       if (exitState == 1)
-       {
-           if (count == 1)
-           {
-               setPin (MIO_TMS, 1);
-           }
-       }
-
-       // pulse tck pin
-       setPin (MIO_TCK, 1);
-       setPin (MIO_TCK, 0);
-
-       mask <<= 1;
-       count--;
-   }
+/****************************************************************************/
+/**
+*
+* This function rebuilds the output values of the AXI GPIO from the
+* current state of the other output pins.
+*
+* @return	None.
+*
+*****************************************************************************/
+static inline void JtagEngineSync(void)
+{
+#ifdef XSK_MICROBLAZE_PLATFORM
+	u32 TdiBit = (u32)1 << GPIO_TDI;
+	u32 TmsBit = (u32)1 << GPIO_TMS;
+
+	JtagEngine.Out[0] = GpoOutValue & ~(TdiBit | TmsBit |
+						JtagEngine.TckHigh);
+	JtagEngine.Out[1] = JtagEngine.Out[0] | TdiBit;
+	JtagEngine.Out[2] = JtagEngine.Out[0] | TmsBit;
+	JtagEngine.Out[3] = JtagEngine.Out[0] | TdiBit | TmsBit;
+#endif
+}
+
+/****************************************************************************/
+/**
+*
+* This function clocks one TCK cycle. TDI and TMS are set up and TDO is
+* sampled with TCK low, then TCK is raised.
+*
+* @param	Tms is the TMS level of the cycle.
+* @param	Tdi is the TDI level of the cycle.
+* @param	ReadTdo is non zero to sample TDO.
+*
+* @return	Sampled TDO level, 0 when TDO is not sampled.
+*
+*****************************************************************************/
+static inline u8 JtagEngineClock(u8 Tms, u8 Tdi, u8 ReadTdo)
+{
+	u32 Word;
+	u32 Tdo = 0U;
+
+	if (JtagEngine.Packed == 1U) {
+		Word = JtagEngine.Out[((u32)Tms << 1) | Tdi];
+		Xil_Out32(JtagEngine.OutAddr, Word);
+		if (ReadTdo != 0U) {
+			Tdo = Xil_In32(JtagEngine.TdoAddr) &
+					JtagEngine.TdoMask;
+		}
+		Xil_Out32(JtagEngine.OutAddr, Word | JtagEngine.TckHigh);
+	}
+	else {
+		Xil_Out32(JtagEngine.Tck.Addr, JtagEngine.Tck.Value[0]);
+		if (Tdi != JtagEngine.TdiLevel) {
+			Xil_Out32(JtagEngine.Tdi.Addr, JtagEngine.Tdi.Value[Tdi]);
+		}
+		if (Tms != JtagEngine.TmsLevel) {
+			Xil_Out32(JtagEngine.Tms.Addr, JtagEngine.Tms.Value[Tms]);
+		}
+		if (ReadTdo != 0U) {
+			Tdo = Xil_In32(JtagEngine.TdoAddr) &
+					JtagEngine.TdoMask;
+		}
+		Xil_Out32(JtagEngine.Tck.Addr, JtagEngine.Tck.Value[1]);
+	}
+	JtagEngine.TdiLevel = Tdi;
+	JtagEngine.TmsLevel = Tms;
+
+	return (Tdo != 0U) ? 1U : 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* This function leaves TCK low at the end of an engine operation.
+*
+* @param	Count is the number of TCK cycles of the operation.
+*
+* @return	None.
+*
+*****************************************************************************/
+static inline void JtagEngineEnd(u32 Count)
+{
+	u32 Word;
+
+	if (JtagEngine.Packed == 1U) {
+		Word = JtagEngine.Out[((u32)JtagEngine.TmsLevel << 1) |
+					JtagEngine.TdiLevel];
+		Xil_Out32(JtagEngine.OutAddr, Word);
+#ifdef XSK_MICROBLAZE_PLATFORM
+		GpoOutValue = Word;
+#endif
+	}
+	else {
+		Xil_Out32(JtagEngine.Tck.Addr, JtagEngine.Tck.Value[0]);
+	}
+	JtagEngine.TckCycles += Count;
+}
+
+/****************************************************************************/
+/**
+*
+* This function clocks a TMS pattern, TDI is left unchanged.
+*
+* @param	TmsBits is the TMS pattern, LSB first.
+* @param	Count is the number of TCK cycles.
+*
+* @return	None.
+*
+*****************************************************************************/
+static void JtagEngineTms(u32 TmsBits, u32 Count)
+{
+	u32 Index;
+
+	JtagEngineSync();
+	for (Index = 0U; Index < Count; Index++) {
+		(void)JtagEngineClock((u8)((TmsBits >> Index) & 1U),
+				JtagEngine.TdiLevel, 0U);
+	}
+	JtagEngineEnd(Count);
+}
+
+/****************************************************************************/
+/**
+*
+* This function shifts a whole scan in one pass. TMS is kept low, except
+* on the last bit when the shift state has to be exited.
+*
+* @param	TdiBuf is the data shifted in LSB first, NULL to shift in
+*		TdiFill instead.
+* @param	TdiFill is the byte shifted in when TdiBuf is NULL.
+* @param	TdoBuf is where TDO is stored, NULL when TDO is not needed.
+* @param	BitCount is the number of bits to shift.
+* @param	ExitShift is non zero to raise TMS on the last bit.
+*
+* @return	None.
+*
+* @note		Bits of TdoBuf beyond BitCount are not modified.
+*
+*****************************************************************************/
+static void JtagEngineShift(const u8 *TdiBuf, u8 TdiFill, u8 *TdoBuf,
+				u32 BitCount, u8 ExitShift)
+{
+	u32 Index;
+	u32 Last = BitCount - 1U;
+	u8 TdiByte = TdiFill;
+	u8 Mask;
+	u8 Tms = 0U;
+
+	JtagEngineSync();
+	for (Index = 0U; Index < BitCount; Index++) {
+		Mask = (u8)(1U << (Index & 7U));
+		if (TdiBuf != NULL) {
+			TdiByte = TdiBuf[Index >> 3];
+		}
+		if ((ExitShift != 0U) && (Index == Last)) {
+			Tms = 1U;
+		}
+
+		if (TdoBuf != NULL) {
+			if (JtagEngineClock(Tms, ((TdiByte & Mask) != 0U) ?
+					1U : 0U, 1U) != 0U) {
+				TdoBuf[Index >> 3] |= Mask;
+			}
+			else {
+				TdoBuf[Index >> 3] &= (u8)~Mask;
+			}
+		}
+		else {
+			(void)JtagEngineClock(Tms, ((TdiByte & Mask) != 0U) ?
+					1U : 0U, 0U);
+		}
+	}
+	JtagEngineEnd(BitCount);
+}
+
+/****************************************************************************/
+/**
+*
+* This function starts the timing of a JTAG operation.
+*
+* @param	Mark is where the start time is stored.
+*
+* @return	None.
+*
+*****************************************************************************/
+static inline void JtagOpBegin(u64 *Mark)
+{
+	Mark[0] = XilSKey_Efuse_GetTime();
+	Mark[1] = JtagEngine.TckCycles;
+}
+
+/****************************************************************************/
+/**
+*
+* This function accounts a completed JTAG operation.
+*
+* @param	Op is the operation.
+* @param	Mark is the start time stored by JtagOpBegin.
+*
+* @return	None.
+*
+*****************************************************************************/
+static inline void JtagOpEnd(XilSKey_JtagOp Op, const u64 *Mark)
+{
+	u64 Ticks = XilSKey_Efuse_GetTime() - Mark[0];
+
+#ifdef XSK_MICROBLAZE_PLATFORM
+	/* AXI timer is a 32 bit counter */
+	Ticks &= 0xFFFFFFFFU;
+#endif
+	JtagTiming[Op].Count++;
+	JtagTiming[Op].TckCycles += JtagEngine.TckCycles - Mark[1];
+	JtagTiming[Op].Ticks += Ticks;
+}
+
+/****************************************************************************/
+/**
+*
+* This function clears the timing of all JTAG operations.
+*
+* @return	None.
+*
+*****************************************************************************/
+void XilSKey_JtagTimingReset(void)
+{
+	(void)memset(JtagTiming, 0, sizeof(JtagTiming));
+}
+
+/****************************************************************************/
+/**
+*
+* This function returns the timing of a JTAG operation.
+*
+* @param	Op is the operation.
+*
+* @return	Pointer to the timing, NULL for an invalid operation.
+*
+*****************************************************************************/
+const XilSKey_JtagTiming *XilSKey_JtagGetTiming(XilSKey_JtagOp Op)
+{
+	const XilSKey_JtagTiming *Timing = NULL;
+
+	if (Op < XSK_JTAG_OP_MAX) {
+		Timing = &JtagTiming[Op];
+	}
+
+	return Timing;
+}
+
+/****************************************************************************/
+/**
+*
+* This function prints the timing of all JTAG operations which were
+* executed since the last XilSKey_JtagTimingReset.
+*
+* @return	None.
+*
+* @note		Nested operations are accounted on their own too, e.g. the
+*		time of a BBRAM program includes its IR and DR scans.
+*
+*****************************************************************************/
+void XilSKey_JtagTimingReport(void)
+{
+	static const char *const OpNames[XSK_JTAG_OP_MAX] = {
+		"TAP navigate", "IR scan", "DR scan", "eFUSE write",
+		"eFUSE read", "BBRAM program", "BBRAM verify"
+	};
+	u32 TicksPerUs;
+	u32 Index;
+
+#ifdef XSK_ARM_PLATFORM
+	TicksPerUs = TimerTicksfor100ns * 10U;
+#else
+	TicksPerUs = XSK_EFUSEPL_CLCK_FREQ_ULTRA / 1000000U;
+#endif
+	if (TicksPerUs == 0U) {
+		TicksPerUs = 1U;
+	}
+
+	xil_printf("JTAG timing: operation, count, TCK cycles, time (us)\r\n");
+	for (Index = 0U; Index < (u32)XSK_JTAG_OP_MAX; Index++) {
+		if (JtagTiming[Index].Count == 0U) {
+			continue;
+		}
+		xil_printf("%s, %d, %d, %d\r\n", OpNames[Index],
+			JtagTiming[Index].Count,
+			(u32)JtagTiming[Index].TckCycles,
+			(u32)(JtagTiming[Index].Ticks / TicksPerUs));
+	}
+}
+
+void jtagShiftTDI (unsigned char tdiData, unsigned char* tdoData, int clkCount, int exitState)
+{
+	JtagEngineShift (&tdiData, 0, tdoData, (u32)clkCount, (u8)exitState);
 }
 
 // This function will be used to shift long bits. Returns a 1 if shift state is to be exited.
 // If tdoBuf != NULL, data will be read from device.
 int jtagShiftTDIBits (unsigned char* tdiBuf, unsigned char* tdoBuf, int bitCount, js_state_t endState, unsigned int flags)
 {
-	unsigned char* tdoByte = NULL;
-    int count = 8;
     int exitState = 0;
-    int currentByteCount = getByteCountFromBitCount (bitCount);
-    int byteCount = currentByteCount;
-    int index = 0;
     unsigned char TdiTemp = 0x0;
-    int bitsLeft = 8;
-    if (bitCount % 8)
-    {
-	bitsLeft = bitCount % 8;
-    }
 
 	if(flags | JS_ONES)
 		TdiTemp = 0xFF;
 
-    while (index < byteCount)
-    {
-	currentByteCount--;
-	if (currentByteCount == 0)  // last byte
+	if (bitCount <= 0)
 	{
-		if (bitsLeft != 8)
-		{
-			count = bitsLeft;
-		}
-		if (flags & JS_TO_IR)
-		{
-			if (endState != JS_IRSHIFT)
-			{
-				exitState = 1;
-			}
-		}
-		else
-		{
-			if (endState != JS_DRSHIFT)
-			{
-				exitState = 1;
-			}
-		}
+		return (exitState);
 	}
 
-	if (tdoBuf) // read tdo data
+	if (flags & JS_TO_IR)
 	{
-		tdoByte = &tdoBuf [index];
+		if (endState != JS_IRSHIFT)
+		{
+			exitState = 1;
+		}
 	}
-
-	if(tdiBuf != NULL)
-		jtagShiftTDI (tdiBuf [index], tdoByte, count, exitState);
 	else
-		jtagShiftTDI (TdiTemp, tdoByte, count, exitState);
-
-        if (tdoBuf)
-		js_printf ("tdoBuf=0x%02X\n", *tdoByte);
+	{
+		if (endState != JS_DRSHIFT)
+		{
+			exitState = 1;
+		}
+	}
 
-        index++;
-    }
+	// shift the whole scan in one pass
+	JtagEngineShift (tdiBuf, TdiTemp, tdoBuf, (u32)bitCount, (u8)exitState);
 
     return (exitState);
 }
@@ -913,17 +1238,20 @@ static int run_command_sequence(
 
     js_command_impl_t *cmd = cmd_start;
     js_state_t state = port->state;
+    u64 mark[2];
 
     while (cmd < cmd_end)
     {
         js_command_kind_t kind = cmd->lib.kind;
 
+        JtagOpBegin (mark);
         switch (kind)
         {
 		case JS_CMD_SET_STATE:
 		{
 			navigateTAP (state, cmd->lib.state);
 			state = cmd->lib.state; // save current state
+			JtagOpEnd (XSK_JTAG_OP_NAVIGATE, mark);
 			break;
 		}
 		case JS_CMD_SHIFT:
@@ -956,6 +1284,8 @@ static int run_command_sequence(
 					state = cmd->lib.state;
 				}
 			}
+			JtagOpEnd ((cmd->lib.flags & JS_TO_IR) ?
+				XSK_JTAG_OP_IR_SHIFT : XSK_JTAG_OP_DR_SHIFT, mark);
 			break;
 		}
 		default:
@@ -1103,6 +1433,9 @@ void JtagWrite(unsigned char row, unsigned char bit)
     unsigned char wrBuffer [8];
     u32 bits = 0;
     u64 time = 0;
+    u64 Mark[2];
+
+	JtagOpBegin(Mark);
 
 	// program FUSE_USER bit in row 31 bit 0
 	//Go to TLR to clear FUSE_CTS
@@ -1165,6 +1498,8 @@ void JtagWrite(unsigned char row, unsigned char bit)
 
 	jtag_navigate (g_port, JS_IRSELECT);
 	jtag_navigate (g_port, JS_RESET);
+
+	JtagOpEnd(XSK_JTAG_OP_EFUSE_WRITE, Mark);
 }
 
 
@@ -1185,6 +1520,9 @@ void JtagRead(unsigned char row, unsigned int * row_data, unsigned char marginOp
     unsigned char rdBuffer [8];
     int bits = 8;
     unsigned char * row_data_ptr = (unsigned char *)row_data;
+    u64 Mark[2];
+
+		JtagOpBegin(Mark);
 
 		// read 64-bit eFUSE dna
 		//Go to TLR to clear FUSE_CTS
@@ -1216,6 +1554,8 @@ void JtagRead(unsigned char row, unsigned int * row_data, unsigned char marginOp
 		row_data_ptr[1] = rdBuffer [5];
 		row_data_ptr[2] = rdBuffer [6];
 		row_data_ptr[3] = rdBuffer [7];
+
+		JtagOpEnd(XSK_JTAG_OP_EFUSE_READ, Mark);
 }
 int JtagValidateMioPins(XilSKey_ModuleSelection Module)
 {
@@ -1610,6 +1950,9 @@ int Bbram_ProgramKey(XilSKey_Bbram *InstancePtr)
 	u32 KeyCnt;
 	u8 WriteBuffer[4];
 	u8 TckCnt;
+	u64 Mark[2];
+
+	JtagOpBegin(Mark);
 
 	/*
 	 * Initial state - RTI
@@ -1726,6 +2069,8 @@ int Bbram_ProgramKey(XilSKey_Bbram *InstancePtr)
 	 */
 	jtag_navigate (g_port, JS_IDLE);
 
+	JtagOpEnd(XSK_JTAG_OP_BBRAM_PROGRAM, Mark);
+
 	return XST_SUCCESS;
 
 }
@@ -1758,8 +2103,11 @@ int Bbram_VerifyKey(XilSKey_Bbram *InstancePtr)
 	u8 ReadBuffer[5];
 	u8 TckCnt;
 	unsigned long long DataReg = 0;
+	u64 Mark[2];
 	int Status = XST_SUCCESS;
 
+	JtagOpBegin(Mark);
+
 	/*
 	 * Initial state - RTI
 	 */
@@ -1833,6 +2181,7 @@ int Bbram_VerifyKey(XilSKey_Bbram *InstancePtr)
 	DataReg = DataReg | ReadBuffer[0];
 
 	if((DataReg & DATAREGCLEAR) != DATAREGCLEAR){
+		JtagOpEnd(XSK_JTAG_OP_BBRAM_VERIFY, Mark);
 		return XST_FAILURE;
 	}
 
@@ -1951,6 +2300,8 @@ int Bbram_VerifyKey(XilSKey_Bbram *InstancePtr)
 		setPin (MIO_TCK, 0);
 	}
 
+	JtagOpEnd(XSK_JTAG_OP_BBRAM_VERIFY, Mark);
+
 	return Status;
 
 }
@@ -2079,7 +2430,9 @@ int JtagWrite_Ultrascale(u8 Row, u8 Bit, u8 Page, u8 Redundant)
 	u8 wrBuffer [8];
 	u32 Bits = 0;
 	int Status = XST_SUCCESS;
+	u64 Mark[2];
 
+	JtagOpBegin(Mark);
 	jtag_navigate (g_port, JS_RESET);
 
 	Bits = TAP_IR_LENGTH;
@@ -2142,6 +2495,8 @@ SKIP_HARDWARE:
 
 	jtag_navigate (g_port, JS_RESET);
 
+	JtagOpEnd(XSK_JTAG_OP_EFUSE_WRITE, Mark);
+
 	return Status;
 
 }
@@ -2181,7 +2536,9 @@ void JtagRead_Ultrascale(u8 Row, u32 *RowData, u8 MarginOption,
 	u8 RdBuffer [8];
 	u32 Bits = 8;
 	u8 *RowDataPtr = (u8 *)RowData;
+	u64 Mark[2];
 
+	JtagOpBegin(Mark);
 	jtag_navigate (g_port, JS_RESET);
 
 	/* Load FUSE_CTS instruction on IR */
@@ -2220,6 +2577,8 @@ void JtagRead_Ultrascale(u8 Row, u32 *RowData, u8 MarginOption,
 	RowDataPtr[2] = RdBuffer[6];
 	RowDataPtr[3] = RdBuffer[7];
 
+	JtagOpEnd(XSK_JTAG_OP_EFUSE_READ, Mark);
+
 }
 
 /****************************************************************************/
@@ -2544,6 +2903,9 @@ int Bbram_ProgramKey_Ultra(XilSKey_Bbram *InstancePtr)
 	u8 WriteBuffer[4];
 	u8 TckCnt;
 	u32 *WriteBuf32 = (u32 *)WriteBuffer;
+	u64 Mark[2];
+
+	JtagOpBegin(Mark);
 
 	/* Initial state - RTI */
 	jtag_navigate (g_port, JS_IDLE);
@@ -2647,6 +3009,8 @@ int Bbram_ProgramKey_Ultra(XilSKey_Bbram *InstancePtr)
 	/* Reset to IDLE */
 	jtag_navigate (g_port, JS_IDLE);
 
+	JtagOpEnd(XSK_JTAG_OP_BBRAM_PROGRAM, Mark);
+
 	return XST_SUCCESS;
 
 }
@@ -2741,6 +3105,9 @@ int Bbram_VerifyKey_Ultra(u32 *Crc32)
 	u64 ReadBuffer;
 	int Status = XST_SUCCESS;
 	u32 Num;
+	u64 Mark[2];
+
+	JtagOpBegin(Mark);
 
 	/* Initial state - RTI */
 	jtag_navigate (g_port, JS_IDLE);
@@ -2759,9 +3126,12 @@ int Bbram_VerifyKey_Ultra(u32 *Crc32)
 
 	ReadBuffer = ReadBuffer >> 5;
 	if (*Crc32 != (u32)ReadBuffer) {
+		JtagOpEnd(XSK_JTAG_OP_BBRAM_VERIFY, Mark);
 		return XST_FAILURE;
 	}
 
+	JtagOpEnd(XSK_JTAG_OP_BBRAM_VERIFY, Mark);
+
 	return Status;
 
 }